@@ -46,6 +46,8 @@
 #
 # Features of found Magnum library are exposed in these variables:
 #  MAGNUM_BUILD_STATIC  - Defined if compiled as static libraries
+#  MAGNUM_BUILD_SIMD    - Defined if compiled with SSE/NEON-optimized Math
+#   operations
 #  MAGNUM_TARGET_GLES   - Defined if compiled for OpenGL ES
 #  MAGNUM_TARGET_GLES2  - Defined if compiled for OpenGL ES 2.0
 #  MAGNUM_TARGET_GLES3  - Defined if compiled for OpenGL ES 3.0
@@ -116,6 +118,10 @@ string(FIND "${_magnumConfigure}" "#define MAGNUM_BUILD_STATIC" _BUILD_STATIC)
 if(NOT _BUILD_STATIC EQUAL -1)
     set(MAGNUM_BUILD_STATIC 1)
 endif()
+string(FIND "${_magnumConfigure}" "#define MAGNUM_BUILD_SIMD" _BUILD_SIMD)
+if(NOT _BUILD_SIMD EQUAL -1)
+    set(MAGNUM_BUILD_SIMD 1)
+endif()
 string(FIND "${_magnumConfigure}" "#define MAGNUM_TARGET_GLES" _TARGET_GLES)
 if(NOT _TARGET_GLES EQUAL -1)
     set(MAGNUM_TARGET_GLES 1)
@@ -220,6 +226,10 @@ foreach(component ${Magnum_FIND_COMPONENTS})
     # Mesh tools library
     if(${component} STREQUAL MeshTools)
         set(_MAGNUM_${_COMPONENT}_INCLUDE_PATH_NAMES CompressIndices.h)
+
+        # ThreadPool needs threading library
+        find_package(Threads)
+        set(_MAGNUM_${_COMPONENT}_LIBRARIES ${CMAKE_THREAD_LIBS_INIT})
     endif()
 
     # Primitives library
@@ -29,6 +29,7 @@
 #include "Shader.h"
 #include "Implementation/ShaderProgramState.h"
 #include "Implementation/State.h"
+#include "Implementation/UniformCache.h"
 
 namespace Magnum {
 
@@ -86,10 +87,11 @@ Int AbstractShaderProgram::maxSupportedVertexAttributeCount() {
     return value;
 }
 
-AbstractShaderProgram::AbstractShaderProgram(): _id(glCreateProgram()) {}
+AbstractShaderProgram::AbstractShaderProgram(): _id(glCreateProgram()), _uniformCache(nullptr) {}
 
-AbstractShaderProgram::AbstractShaderProgram(AbstractShaderProgram&& other) noexcept: _id(other._id) {
+AbstractShaderProgram::AbstractShaderProgram(AbstractShaderProgram&& other) noexcept: _id(other._id), _uniformCache(other._uniformCache) {
     other._id = 0;
+    other._uniformCache = nullptr;
 }
 
 AbstractShaderProgram::~AbstractShaderProgram() {
@@ -98,10 +100,12 @@ AbstractShaderProgram::~AbstractShaderProgram() {
     if(current == _id) current = 0;
 
     if(_id) glDeleteProgram(_id);
+    delete _uniformCache;
 }
 
 AbstractShaderProgram& AbstractShaderProgram::operator=(AbstractShaderProgram&& other) noexcept {
     std::swap(_id, other._id);
+    std::swap(_uniformCache, other._uniformCache);
     return *this;
 }
 
@@ -129,6 +133,33 @@ void AbstractShaderProgram::use() {
     if(current != _id) glUseProgram(current = _id);
 }
 
+void AbstractShaderProgram::setUniformCacheEnabled(const bool enabled) {
+    if(enabled == isUniformCacheEnabled()) return;
+
+    if(enabled) _uniformCache = new Implementation::UniformCache;
+    else {
+        delete _uniformCache;
+        _uniformCache = nullptr;
+    }
+}
+
+UnsignedInt AbstractShaderProgram::uniformUploadCount() const {
+    return _uniformCache ? _uniformCache->uploadCount : 0;
+}
+
+UnsignedInt AbstractShaderProgram::elidedUniformUploadCount() const {
+    return _uniformCache ? _uniformCache->elidedUploadCount : 0;
+}
+
+void AbstractShaderProgram::resetUniformUploadCount() {
+    if(!_uniformCache) return;
+    _uniformCache->uploadCount = _uniformCache->elidedUploadCount = 0;
+}
+
+bool AbstractShaderProgram::updateUniformCache(const Int location, const UnsignedInt count, const void* const values, const std::size_t elementSize) {
+    return _uniformCache->update(location, count, values, elementSize);
+}
+
 void AbstractShaderProgram::attachShader(Shader& shader) {
     glAttachShader(_id, shader.id());
 }
@@ -150,6 +181,9 @@ bool AbstractShaderProgram::link() {
     /* Link shader program */
     glLinkProgram(_id);
 
+    /* Uniform values are reset to defaults on link, forget the cached ones */
+    if(_uniformCache) _uniformCache->values.clear();
+
     /* Check link status */
     GLint success, logLength;
     glGetProgramiv(_id, GL_LINK_STATUS, &success);
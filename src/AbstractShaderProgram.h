@@ -39,6 +39,7 @@ namespace Magnum {
 
 namespace Implementation {
     template<class> struct Attribute;
+    struct UniformCache;
 }
 
 /**
@@ -282,6 +283,13 @@ setUniform() documentation for more information.
 
 To achieve least state changes, set all uniforms in one run -- method chaining
 comes in handy.
+
+Shaders which are used for many objects with mostly the same uniform values
+(e.g. the same projection, light position or color) can enable uniform value
+cache using setUniformCacheEnabled(). The program then remembers values set
+through setUniform() and skips uploads of values which didn't change. Count
+of issued and skipped uploads is available through uniformUploadCount() and
+elidedUniformUploadCount().
  */
 class MAGNUM_EXPORT AbstractShaderProgram {
     friend class Context;
@@ -346,6 +354,53 @@ class MAGNUM_EXPORT AbstractShaderProgram {
          */
         void use();
 
+        /**
+         * @brief Whether uniform value cache is enabled
+         *
+         * @see setUniformCacheEnabled()
+         */
+        bool isUniformCacheEnabled() const { return _uniformCache != nullptr; }
+
+        /**
+         * @brief Enable or disable uniform value cache
+         *
+         * If enabled, the program remembers values set through setUniform()
+         * and uploading the same value to the same location again is
+         * skipped. Disabled by default. The remembered values are discarded
+         * when the cache is disabled or when the program is linked. Values
+         * set directly through OpenGL are not tracked.
+         * @see @ref AbstractShaderProgram-performance-optimization "Performance optimizations"
+         */
+        void setUniformCacheEnabled(bool enabled);
+
+        /**
+         * @brief Count of issued uniform uploads
+         *
+         * Counted only if uniform value cache is enabled, one for each call
+         * to setUniform() which resulted in OpenGL call.
+         * @see setUniformCacheEnabled(), elidedUniformUploadCount(),
+         *      resetUniformUploadCount()
+         */
+        UnsignedInt uniformUploadCount() const;
+
+        /**
+         * @brief Count of elided uniform uploads
+         *
+         * Counted only if uniform value cache is enabled, one for each call
+         * to setUniform() which was skipped, because the value didn't change.
+         * @see setUniformCacheEnabled(), uniformUploadCount(),
+         *      resetUniformUploadCount()
+         */
+        UnsignedInt elidedUniformUploadCount() const;
+
+        /**
+         * @brief Reset uniform upload counters
+         *
+         * The cached values are kept.
+         * @see uniformUploadCount(), elidedUniformUploadCount()
+         */
+        void resetUniformUploadCount();
+
     protected:
         #ifndef MAGNUM_TARGET_GLES2
         /**
@@ -508,41 +563,49 @@ class MAGNUM_EXPORT AbstractShaderProgram {
          *      or @fn_gl{ProgramUniform}/@fn_gl_extension{ProgramUniform,EXT,direct_state_access}.
          */
         void setUniform(Int location, UnsignedInt count, const Float* values) {
+            if(!uniformChanged(location, count, values, sizeof(Float))) return;
             (this->*uniform1fvImplementation)(location, count, values);
         }
 
         /** @copydoc setUniform(Int, UnsignedInt, const Float*) */
         void setUniform(Int location, UnsignedInt count, const Math::Vector<2, Float>* values) {
+            if(!uniformChanged(location, count, values, 2*sizeof(Float))) return;
             (this->*uniform2fvImplementation)(location, count, values);
         }
 
         /** @copydoc setUniform(Int, UnsignedInt, const Float*) */
         void setUniform(Int location, UnsignedInt count, const Math::Vector<3, Float>* values) {
+            if(!uniformChanged(location, count, values, 3*sizeof(Float))) return;
             (this->*uniform3fvImplementation)(location, count, values);
         }
 
         /** @copydoc setUniform(Int, UnsignedInt, const Float*) */
         void setUniform(Int location, UnsignedInt count, const Math::Vector<4, Float>* values) {
+            if(!uniformChanged(location, count, values, 4*sizeof(Float))) return;
             (this->*uniform4fvImplementation)(location, count, values);
         }
 
         /** @copydoc setUniform(Int, UnsignedInt, const Float*) */
         void setUniform(Int location, UnsignedInt count, const Int* values) {
+            if(!uniformChanged(location, count, values, sizeof(Int))) return;
             (this->*uniform1ivImplementation)(location, count, values);
         }
 
         /** @copydoc setUniform(Int, UnsignedInt, const Float*) */
         void setUniform(Int location, UnsignedInt count, const Math::Vector<2, Int>* values) {
+            if(!uniformChanged(location, count, values, 2*sizeof(Int))) return;
             (this->*uniform2ivImplementation)(location, count, values);
         }
 
         /** @copydoc setUniform(Int, UnsignedInt, const Float*) */
         void setUniform(Int location, UnsignedInt count, const Math::Vector<3, Int>* values) {
+            if(!uniformChanged(location, count, values, 3*sizeof(Int))) return;
             (this->*uniform3ivImplementation)(location, count, values);
         }
 
         /** @copydoc setUniform(Int, UnsignedInt, const Float*) */
         void setUniform(Int location, UnsignedInt count, const Math::Vector<4, Int>* values) {
+            if(!uniformChanged(location, count, values, 4*sizeof(Int))) return;
             (this->*uniform4ivImplementation)(location, count, values);
         }
 
@@ -553,6 +616,7 @@ class MAGNUM_EXPORT AbstractShaderProgram {
          * @requires_gles30 Only signed integers are available in OpenGL ES 2.0.
          */
         void setUniform(Int location, UnsignedInt count, const UnsignedInt* values) {
+            if(!uniformChanged(location, count, values, sizeof(UnsignedInt))) return;
             (this->*uniform1uivImplementation)(location, count, values);
         }
 
@@ -562,6 +626,7 @@ class MAGNUM_EXPORT AbstractShaderProgram {
          * @requires_gles30 Only signed integers are available in OpenGL ES 2.0.
          */
         void setUniform(Int location, UnsignedInt count, const Math::Vector<2, UnsignedInt>* values) {
+            if(!uniformChanged(location, count, values, 2*sizeof(UnsignedInt))) return;
             (this->*uniform2uivImplementation)(location, count, values);
         }
 
@@ -571,6 +636,7 @@ class MAGNUM_EXPORT AbstractShaderProgram {
          * @requires_gles30 Only signed integers are available in OpenGL ES 2.0.
          */
         void setUniform(Int location, UnsignedInt count, const Math::Vector<3, UnsignedInt>* values) {
+            if(!uniformChanged(location, count, values, 3*sizeof(UnsignedInt))) return;
             (this->*uniform3uivImplementation)(location, count, values);
         }
 
@@ -580,6 +646,7 @@ class MAGNUM_EXPORT AbstractShaderProgram {
          * @requires_gles30 Only signed integers are available in OpenGL ES 2.0.
          */
         void setUniform(Int location, UnsignedInt count, const Math::Vector<4, UnsignedInt>* values) {
+            if(!uniformChanged(location, count, values, 4*sizeof(UnsignedInt))) return;
             (this->*uniform4uivImplementation)(location, count, values);
         }
         #endif
@@ -591,6 +658,7 @@ class MAGNUM_EXPORT AbstractShaderProgram {
          * @requires_gl Only floats are available in OpenGL ES.
          */
         void setUniform(Int location, UnsignedInt count, const Double* values) {
+            if(!uniformChanged(location, count, values, sizeof(Double))) return;
             (this->*uniform1dvImplementation)(location, count, values);
         }
 
@@ -600,6 +668,7 @@ class MAGNUM_EXPORT AbstractShaderProgram {
          * @requires_gl Only floats are available in OpenGL ES.
          */
         void setUniform(Int location, UnsignedInt count, const Math::Vector<2, Double>* values) {
+            if(!uniformChanged(location, count, values, 2*sizeof(Double))) return;
             (this->*uniform2dvImplementation)(location, count, values);
         }
 
@@ -609,6 +678,7 @@ class MAGNUM_EXPORT AbstractShaderProgram {
          * @requires_gl Only floats are available in OpenGL ES.
          */
         void setUniform(Int location, UnsignedInt count, const Math::Vector<3, Double>* values) {
+            if(!uniformChanged(location, count, values, 3*sizeof(Double))) return;
             (this->*uniform3dvImplementation)(location, count, values);
         }
 
@@ -618,22 +688,26 @@ class MAGNUM_EXPORT AbstractShaderProgram {
          * @requires_gl Only floats are available in OpenGL ES.
          */
         void setUniform(Int location, UnsignedInt count, const Math::Vector<4, Double>* values) {
+            if(!uniformChanged(location, count, values, 4*sizeof(Double))) return;
             (this->*uniform4dvImplementation)(location, count, values);
         }
         #endif
 
         /** @copydoc setUniform(Int, UnsignedInt, const Float*) */
         void setUniform(Int location, UnsignedInt count, const Math::RectangularMatrix<2, 2, Float>* values) {
+            if(!uniformChanged(location, count, values, 2*2*sizeof(Float))) return;
             (this->*uniformMatrix2fvImplementation)(location, count, values);
         }
 
         /** @copydoc setUniform(Int, UnsignedInt, const Float*) */
         void setUniform(Int location, UnsignedInt count, const Math::RectangularMatrix<3, 3, Float>* values) {
+            if(!uniformChanged(location, count, values, 3*3*sizeof(Float))) return;
             (this->*uniformMatrix3fvImplementation)(location, count, values);
         }
 
         /** @copydoc setUniform(Int, UnsignedInt, const Float*) */
         void setUniform(Int location, UnsignedInt count, const Math::RectangularMatrix<4, 4, Float>* values) {
+            if(!uniformChanged(location, count, values, 4*4*sizeof(Float))) return;
             (this->*uniformMatrix4fvImplementation)(location, count, values);
         }
 
@@ -643,6 +717,7 @@ class MAGNUM_EXPORT AbstractShaderProgram {
          * @requires_gles30 Only square matrices are available in OpenGL ES 2.0.
          */
         void setUniform(Int location, UnsignedInt count, const Math::RectangularMatrix<2, 3, Float>* values) {
+            if(!uniformChanged(location, count, values, 2*3*sizeof(Float))) return;
             (this->*uniformMatrix2x3fvImplementation)(location, count, values);
         }
 
@@ -651,6 +726,7 @@ class MAGNUM_EXPORT AbstractShaderProgram {
          * @requires_gles30 Only square matrices are available in OpenGL ES 2.0.
          */
         void setUniform(Int location, UnsignedInt count, const Math::RectangularMatrix<3, 2, Float>* values) {
+            if(!uniformChanged(location, count, values, 3*2*sizeof(Float))) return;
             (this->*uniformMatrix3x2fvImplementation)(location, count, values);
         }
 
@@ -659,6 +735,7 @@ class MAGNUM_EXPORT AbstractShaderProgram {
          * @requires_gles30 Only square matrices are available in OpenGL ES 2.0.
          */
         void setUniform(Int location, UnsignedInt count, const Math::RectangularMatrix<2, 4, Float>* values) {
+            if(!uniformChanged(location, count, values, 2*4*sizeof(Float))) return;
             (this->*uniformMatrix2x4fvImplementation)(location, count, values);
         }
 
@@ -667,6 +744,7 @@ class MAGNUM_EXPORT AbstractShaderProgram {
          * @requires_gles30 Only square matrices are available in OpenGL ES 2.0.
          */
         void setUniform(Int location, UnsignedInt count, const Math::RectangularMatrix<4, 2, Float>* values) {
+            if(!uniformChanged(location, count, values, 4*2*sizeof(Float))) return;
             (this->*uniformMatrix4x2fvImplementation)(location, count, values);
         }
 
@@ -675,6 +753,7 @@ class MAGNUM_EXPORT AbstractShaderProgram {
          * @requires_gles30 Only square matrices are available in OpenGL ES 2.0.
          */
         void setUniform(Int location, UnsignedInt count, const Math::RectangularMatrix<3, 4, Float>* values) {
+            if(!uniformChanged(location, count, values, 3*4*sizeof(Float))) return;
             (this->*uniformMatrix3x4fvImplementation)(location, count, values);
         }
 
@@ -683,6 +762,7 @@ class MAGNUM_EXPORT AbstractShaderProgram {
          * @requires_gles30 Only square matrices are available in OpenGL ES 2.0.
          */
         void setUniform(Int location, UnsignedInt count, const Math::RectangularMatrix<4, 3, Float>* values) {
+            if(!uniformChanged(location, count, values, 4*3*sizeof(Float))) return;
             (this->*uniformMatrix4x3fvImplementation)(location, count, values);
         }
         #endif
@@ -694,6 +774,7 @@ class MAGNUM_EXPORT AbstractShaderProgram {
          * @requires_gl Only floats are available in OpenGL ES.
          */
         void setUniform(Int location, UnsignedInt count, const Math::RectangularMatrix<2, 2, Double>* values) {
+            if(!uniformChanged(location, count, values, 2*2*sizeof(Double))) return;
             (this->*uniformMatrix2dvImplementation)(location, count, values);
         }
 
@@ -703,6 +784,7 @@ class MAGNUM_EXPORT AbstractShaderProgram {
          * @requires_gl Only floats are available in OpenGL ES.
          */
         void setUniform(Int location, UnsignedInt count, const Math::RectangularMatrix<3, 3, Double>* values) {
+            if(!uniformChanged(location, count, values, 3*3*sizeof(Double))) return;
             (this->*uniformMatrix3dvImplementation)(location, count, values);
         }
 
@@ -712,6 +794,7 @@ class MAGNUM_EXPORT AbstractShaderProgram {
          * @requires_gl Only floats are available in OpenGL ES.
          */
         void setUniform(Int location, UnsignedInt count, const Math::RectangularMatrix<4, 4, Double>* values) {
+            if(!uniformChanged(location, count, values, 4*4*sizeof(Double))) return;
             (this->*uniformMatrix4dvImplementation)(location, count, values);
         }
 
@@ -721,6 +804,7 @@ class MAGNUM_EXPORT AbstractShaderProgram {
          * @requires_gl Only floats are available in OpenGL ES.
          */
         void setUniform(Int location, UnsignedInt count, const Math::RectangularMatrix<2, 3, Double>* values) {
+            if(!uniformChanged(location, count, values, 2*3*sizeof(Double))) return;
             (this->*uniformMatrix2x3dvImplementation)(location, count, values);
         }
 
@@ -730,6 +814,7 @@ class MAGNUM_EXPORT AbstractShaderProgram {
          * @requires_gl Only floats are available in OpenGL ES.
          */
         void setUniform(Int location, UnsignedInt count, const Math::RectangularMatrix<3, 2, Double>* values) {
+            if(!uniformChanged(location, count, values, 3*2*sizeof(Double))) return;
             (this->*uniformMatrix3x2dvImplementation)(location, count, values);
         }
 
@@ -739,6 +824,7 @@ class MAGNUM_EXPORT AbstractShaderProgram {
          * @requires_gl Only floats are available in OpenGL ES.
          */
         void setUniform(Int location, UnsignedInt count, const Math::RectangularMatrix<2, 4, Double>* values) {
+            if(!uniformChanged(location, count, values, 2*4*sizeof(Double))) return;
             (this->*uniformMatrix2x4dvImplementation)(location, count, values);
         }
 
@@ -748,6 +834,7 @@ class MAGNUM_EXPORT AbstractShaderProgram {
          * @requires_gl Only floats are available in OpenGL ES.
          */
         void setUniform(Int location, UnsignedInt count, const Math::RectangularMatrix<4, 2, Double>* values) {
+            if(!uniformChanged(location, count, values, 4*2*sizeof(Double))) return;
             (this->*uniformMatrix4x2dvImplementation)(location, count, values);
         }
 
@@ -757,6 +844,7 @@ class MAGNUM_EXPORT AbstractShaderProgram {
          * @requires_gl Only floats are available in OpenGL ES.
          */
         void setUniform(Int location, UnsignedInt count, const Math::RectangularMatrix<3, 4, Double>* values) {
+            if(!uniformChanged(location, count, values, 3*4*sizeof(Double))) return;
             (this->*uniformMatrix3x4dvImplementation)(location, count, values);
         }
 
@@ -766,6 +854,7 @@ class MAGNUM_EXPORT AbstractShaderProgram {
          * @requires_gl Only floats are available in OpenGL ES.
          */
         void setUniform(Int location, UnsignedInt count, const Math::RectangularMatrix<4, 3, Double>* values) {
+            if(!uniformChanged(location, count, values, 4*3*sizeof(Double))) return;
             (this->*uniformMatrix4x3dvImplementation)(location, count, values);
         }
         #endif
@@ -773,6 +862,13 @@ class MAGNUM_EXPORT AbstractShaderProgram {
     private:
         static void MAGNUM_LOCAL initializeContextBasedFunctionality(Context* context);
 
+        /* Element size is passed explicitly, as the math types are only
+           forward-declared here */
+        bool uniformChanged(Int location, UnsignedInt count, const void* values, std::size_t elementSize) {
+            return !_uniformCache || updateUniformCache(location, count, values, elementSize);
+        }
+        bool updateUniformCache(Int location, UnsignedInt count, const void* values, std::size_t elementSize);
+
         typedef void(AbstractShaderProgram::*Uniform1fvImplementation)(GLint, GLsizei, const GLfloat*);
         typedef void(AbstractShaderProgram::*Uniform2fvImplementation)(GLint, GLsizei, const Math::Vector<2, GLfloat>*);
         typedef void(AbstractShaderProgram::*Uniform3fvImplementation)(GLint, GLsizei, const Math::Vector<3, GLfloat>*);
@@ -936,6 +1032,7 @@ class MAGNUM_EXPORT AbstractShaderProgram {
         #endif
 
         GLuint _id;
+        Implementation::UniformCache* _uniformCache;
 };
 
 /**
@@ -1139,6 +1236,16 @@ template<UnsignedInt location, class T> class AbstractShaderProgram::Attribute {
             return Implementation::Attribute<T>::size(GLint(_components)*Implementation::Attribute<T>::vectorCount(), _dataType);
         }
 
+        /**
+         * @brief Size of one column of passed data
+         *
+         * Same as dataSize() for vector types, size of one column for
+         * matrix types.
+         */
+        std::size_t vectorSize() const {
+            return Implementation::Attribute<T>::size(GLint(_components), _dataType);
+        }
+
         /** @brief Data options */
         constexpr DataOptions dataOptions() const { return _dataOptions; }
 
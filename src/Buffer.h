@@ -99,6 +99,9 @@ for(std::size_t i: {7, 27, 56, 128}) {
 CORRADE_INTERNAL_ASSERT_OUTPUT(buffer.unmap());
 @endcode
 
+For data rewritten every frame see StreamingBuffer, which avoids stalls when
+the GPU is still reading the previous contents.
+
 @section Buffer-performance-optimization Performance optimizations
 
 The engine tracks currently bound buffers to avoid unnecessary calls to
@@ -42,7 +42,8 @@ namespace Magnum {
 @brief %Buffer image
 
 Stores image data in GPU memory. Interchangeable with Image, ImageWrapper or
-Trade::ImageData.
+Trade::ImageData. See BufferImageQueue for pipelining transfers without
+CPU-GPU synchronization.
 @see BufferImage1D, BufferImage2D, BufferImage3D, Buffer
 @requires_gles30 Pixel buffer objects are not available in OpenGL ES 2.0.
 */
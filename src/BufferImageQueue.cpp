@@ -0,0 +1,106 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BufferImageQueue.h"
+
+#include <Utility/Assert.h>
+
+namespace Magnum {
+
+#ifndef MAGNUM_TARGET_GLES2
+template<UnsignedInt dimensions> BufferImageQueue<dimensions>::BufferImageQueue(const ImageFormat format, const ImageType type, const UnsignedInt capacity): images(capacity), slots(capacity) {
+    CORRADE_ASSERT(capacity, "BufferImageQueue: capacity must not be zero", );
+
+    for(Slot& slot: images)
+        slot.image.reset(new BufferImage<dimensions>(format, type));
+}
+
+template<UnsignedInt dimensions> BufferImage<dimensions>* BufferImageQueue<dimensions>::acquire() {
+    const Int slot = slots.acquire();
+    return slot == -1 ? nullptr : images[slot].image.get();
+}
+
+template<UnsignedInt dimensions> void BufferImageQueue<dimensions>::submit(BufferImage<dimensions>* const image, Callback callback) {
+    const UnsignedInt slot = slotForImage(image);
+    CORRADE_ASSERT(slot != images.size(), "BufferImageQueue::submit(): the image is not from this queue", );
+    CORRADE_ASSERT(slots.isAcquired(slot), "BufferImageQueue::submit(): the image is not acquired", );
+
+    images[slot].fence.insert();
+    images[slot].callback = std::move(callback);
+    slots.submit(slot);
+}
+
+template<UnsignedInt dimensions> void BufferImageQueue<dimensions>::release(BufferImage<dimensions>* const image) {
+    const UnsignedInt slot = slotForImage(image);
+    CORRADE_ASSERT(slot != images.size(), "BufferImageQueue::release(): the image is not from this queue", );
+    CORRADE_ASSERT(slots.isAcquired(slot), "BufferImageQueue::release(): the image is not acquired", );
+
+    slots.release(slot);
+}
+
+template<UnsignedInt dimensions> std::size_t BufferImageQueue<dimensions>::poll() {
+    /* Fences are signaled in order, stop on first pending one */
+    std::size_t count = 0;
+    for(; slots.front() != -1 && images[slots.front()].fence.isSignaled(); ++count)
+        complete();
+    return count;
+}
+
+template<UnsignedInt dimensions> std::size_t BufferImageQueue<dimensions>::finish() {
+    std::size_t count = 0;
+    for(; slots.front() != -1; ++count) {
+        Fence& fence = images[slots.front()].fence;
+        Fence::Status status;
+        do status = fence.wait(1000000000ull);
+        while(status == Fence::Status::TimeoutExpired);
+        complete();
+    }
+    return count;
+}
+
+template<UnsignedInt dimensions> UnsignedInt BufferImageQueue<dimensions>::slotForImage(BufferImage<dimensions>* const image) const {
+    for(UnsignedInt i = 0; i != images.size(); ++i)
+        if(images[i].image.get() == image) return i;
+    return images.size();
+}
+
+template<UnsignedInt dimensions> void BufferImageQueue<dimensions>::complete() {
+    const UnsignedInt slot = slots.complete();
+
+    /* The image is made free only after the callback, so acquire() called
+       from inside the callback doesn't return it */
+    Callback callback = std::move(images[slot].callback);
+    images[slot].callback = Callback();
+    if(callback) callback(images[slot].image.get());
+    slots.release(slot);
+}
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+template class MAGNUM_EXPORT BufferImageQueue<1>;
+template class MAGNUM_EXPORT BufferImageQueue<2>;
+template class MAGNUM_EXPORT BufferImageQueue<3>;
+#endif
+#endif
+
+}
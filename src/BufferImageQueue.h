@@ -0,0 +1,256 @@
+#ifndef Magnum_BufferImageQueue_h
+#define Magnum_BufferImageQueue_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "magnumConfigure.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+/** @file
+ * @brief Class Magnum::BufferImageQueue, typedef Magnum::BufferImageQueue1D, Magnum::BufferImageQueue2D, Magnum::BufferImageQueue3D
+ */
+#endif
+
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "BufferImage.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+#include "Fence.h"
+#endif
+
+namespace Magnum {
+
+namespace Implementation {
+
+    /* CPU-side bookkeeping of BufferImageQueue: each slot is either free,
+       acquired or pending. Pending slots are completed in submission order,
+       free slots are reused in the order they were completed or released. */
+    class BufferImageQueueSlots {
+        public:
+            explicit BufferImageQueueSlots(UnsignedInt capacity): _capacity(capacity) {
+                for(UnsignedInt i = 0; i != capacity; ++i) free.push_back(i);
+            }
+
+            UnsignedInt capacity() const { return _capacity; }
+            std::size_t freeCount() const { return free.size(); }
+            std::size_t pendingCount() const { return pending.size(); }
+
+            /* Whether the slot was acquired and not yet submitted or
+               released */
+            bool isAcquired(UnsignedInt slot) const {
+                return slot < _capacity &&
+                    std::find(free.begin(), free.end(), slot) == free.end() &&
+                    std::find(pending.begin(), pending.end(), slot) == pending.end();
+            }
+
+            /* Acquires free slot, returns -1 if there is none */
+            Int acquire() {
+                if(free.empty()) return -1;
+
+                const UnsignedInt slot = free.front();
+                free.pop_front();
+                return slot;
+            }
+
+            /* Makes acquired slot pending */
+            void submit(UnsignedInt slot) { pending.push_back(slot); }
+
+            /* Makes acquired slot free again */
+            void release(UnsignedInt slot) { free.push_back(slot); }
+
+            /* Oldest pending slot, -1 if there is none */
+            Int front() const { return pending.empty() ? -1 : Int(pending.front()); }
+
+            /* Removes oldest pending slot and returns it, the slot is
+               then acquired until released */
+            UnsignedInt complete() {
+                const UnsignedInt slot = pending.front();
+                pending.pop_front();
+                return slot;
+            }
+
+        private:
+            UnsignedInt _capacity;
+            std::deque<UnsignedInt> free, pending;
+    };
+}
+
+#ifndef MAGNUM_TARGET_GLES2
+
+/**
+@brief Queue of asynchronous pixel transfers
+
+Reading pixels from framebuffer or texture into client memory blocks until
+the GPU finishes rendering them. Reading them into BufferImage instead
+returns immediately, but mapping the buffer right after that blocks again.
+This class keeps multiple buffer images in flight and hands each of them to
+a callback only after the transfer is finished, so the data can be read
+without any CPU-GPU synchronization, a few frames later.
+
+@section BufferImageQueue-usage Usage
+
+Acquire an image with acquire(), issue the transfer and submit the image
+along with a callback. Call poll() once per frame to call callbacks of
+finished transfers:
+@code
+BufferImageQueue2D queue(ImageFormat::RGBA, ImageType::UnsignedByte);
+
+// Each frame
+if(BufferImage2D* image = queue.acquire()) {
+    defaultFramebuffer.read({}, size, image, Buffer::Usage::StreamRead);
+    queue.submit(image, [](BufferImage2D* image) {
+        const void* data = image->buffer()->map(0, image->pixelSize()*image->size().product(), Buffer::MapFlag::Read);
+        // save the data...
+        image->buffer()->unmap();
+    });
+}
+queue.poll();
+@endcode
+
+If all images are in flight, acquire() returns `nullptr` and the frame can be
+either skipped or finish() can be called to wait for all pending transfers.
+
+The same can be done with uploads. Fill the image with data, pass it to e.g.
+Texture::setSubImage() and submit it without callback. The image is then
+reused only after the upload is finished, so filling it doesn't stall.
+
+@section BufferImageQueue-performance Performance optimizations
+
+Completion of each transfer is detected using Fence inserted in submit(),
+poll() only queries the fence status and never blocks. Callbacks are called
+in submission order.
+@see BufferImageQueue1D, BufferImageQueue2D, BufferImageQueue3D
+@requires_gl32 %Extension @extension{ARB,sync}
+@requires_gles30 Pixel buffer objects are not available in OpenGL ES 2.0.
+*/
+template<UnsignedInt dimensions> class MAGNUM_EXPORT BufferImageQueue {
+    BufferImageQueue(const BufferImageQueue<dimensions>&) = delete;
+    BufferImageQueue<dimensions>& operator=(const BufferImageQueue<dimensions>&) = delete;
+
+    public:
+        const static UnsignedInt Dimensions = dimensions; /**< @brief %Image dimension count */
+
+        /**
+         * @brief Callback called on finished transfer
+         *
+         * The image can be used only inside the callback, then it is reused
+         * for other transfers.
+         */
+        typedef std::function<void(BufferImage<dimensions>*)> Callback;
+
+        /**
+         * @brief Constructor
+         * @param format            Format of pixel data
+         * @param type              Data type of pixel data
+         * @param capacity          Count of images in flight
+         *
+         * Capacity should be larger than count of frames the GPU can be
+         * behind the CPU.
+         */
+        explicit BufferImageQueue(ImageFormat format, ImageType type, UnsignedInt capacity = 3);
+
+        /** @brief Count of images */
+        UnsignedInt capacity() const { return slots.capacity(); }
+
+        /** @brief Count of submitted transfers which aren't finished yet */
+        std::size_t pendingCount() const { return slots.pendingCount(); }
+
+        /**
+         * @brief Acquire free image
+         *
+         * Returns `nullptr` if all images are either acquired or in flight.
+         * @see poll(), finish()
+         */
+        BufferImage<dimensions>* acquire();
+
+        /**
+         * @brief Submit image
+         * @param image     Image returned from acquire(), with transfer
+         *      command issued
+         * @param callback  Callback called when the transfer is finished.
+         *      Can be empty.
+         *
+         * @see Fence::insert()
+         */
+        void submit(BufferImage<dimensions>* image, Callback callback = Callback());
+
+        /**
+         * @brief Release acquired image without submitting it
+         *
+         * Useful if the transfer was not issued after all.
+         */
+        void release(BufferImage<dimensions>* image);
+
+        /**
+         * @brief Poll finished transfers
+         * @return Count of finished transfers
+         *
+         * Calls callbacks of all finished transfers and makes their images
+         * free for acquire(). Doesn't block.
+         * @see Fence::isSignaled()
+         */
+        std::size_t poll();
+
+        /**
+         * @brief Wait for all pending transfers
+         * @return Count of finished transfers
+         *
+         * Blocks until all submitted transfers are finished and calls their
+         * callbacks.
+         * @see Fence::wait()
+         */
+        std::size_t finish();
+
+    private:
+        struct Slot {
+            std::unique_ptr<BufferImage<dimensions>> image;
+            Fence fence;
+            Callback callback;
+        };
+
+        UnsignedInt MAGNUM_LOCAL slotForImage(BufferImage<dimensions>* image) const;
+        void MAGNUM_LOCAL complete();
+
+        std::vector<Slot> images;
+        Implementation::BufferImageQueueSlots slots;
+};
+
+/** @brief One-dimensional buffer image queue */
+typedef BufferImageQueue<1> BufferImageQueue1D;
+
+/** @brief Two-dimensional buffer image queue */
+typedef BufferImageQueue<2> BufferImageQueue2D;
+
+/** @brief Three-dimensional buffer image queue */
+typedef BufferImageQueue<3> BufferImageQueue3D;
+
+}
+#endif
+
+#endif
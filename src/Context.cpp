@@ -39,6 +39,7 @@
 #include "Extensions.h"
 #include "Framebuffer.h"
 #include "Mesh.h"
+#include "MeshBatch.h"
 #include "Renderbuffer.h"
 #include "Renderer.h"
 
@@ -399,6 +400,7 @@ Context::Context() {
     DefaultFramebuffer::initializeContextBasedFunctionality(this);
     Framebuffer::initializeContextBasedFunctionality(this);
     Mesh::initializeContextBasedFunctionality(this);
+    MeshBatch::initializeContextBasedFunctionality(this);
     Renderbuffer::initializeContextBasedFunctionality(this);
     Renderer::initializeContextBasedFunctionality(this);
 }
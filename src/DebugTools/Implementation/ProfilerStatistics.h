@@ -1,5 +1,5 @@
-#ifndef Magnum_MeshTools_Test_SubdivideRemoveDuplicatesBenchmark_h
-#define Magnum_MeshTools_Test_SubdivideRemoveDuplicatesBenchmark_h
+#ifndef Magnum_DebugTools_Implementation_ProfilerStatistics_h
+#define Magnum_DebugTools_Implementation_ProfilerStatistics_h
 /*
     This file is part of Magnum.
 
@@ -24,25 +24,13 @@
     DEALINGS IN THE SOFTWARE.
 */
 
-#include <QtCore/QObject>
+#include "DebugTools/Profiler.h"
 
-#include "Magnum.h"
+namespace Magnum { namespace DebugTools { namespace Implementation {
 
-namespace Magnum { namespace MeshTools { namespace Test {
-
-class SubdivideRemoveDuplicatesBenchmark: public QObject {
-    Q_OBJECT
-
-    private slots:
-        void subdivide();
-        void subdivideAndRemoveDuplicatesMeshAfter();
-        void subdivideAndRemoveDuplicatesMeshBetween();
-
-    private:
-        static Magnum::Vector4 interpolator(const Magnum::Vector4& a, const Magnum::Vector4& b) {
-            return (a+b).xyz().normalized();
-        }
-};
+/* Computes statistics of given durations in microseconds, all zeros if the
+   list is empty */
+Profiler::Statistics MAGNUM_DEBUGTOOLS_EXPORT profilerStatistics(std::vector<Float> durations);
 
 }}}
 
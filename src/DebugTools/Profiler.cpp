@@ -25,17 +25,390 @@
 #include "Profiler.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <mutex>
 #include <numeric>
+#include <sstream>
+#include <thread>
 #include <Utility/Assert.h>
 
-#include "Magnum.h"
+#if defined(__i386__) || defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+#ifndef MAGNUM_TARGET_GLES
+#include "Query.h"
+#endif
+
+#include "Implementation/ProfilerStatistics.h"
 
 using namespace std::chrono;
 
 namespace Magnum { namespace DebugTools {
 
+namespace Implementation {
+
+Profiler::Statistics profilerStatistics(std::vector<Float> durations) {
+    Profiler::Statistics statistics{0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+    if(durations.empty()) return statistics;
+
+    std::sort(durations.begin(), durations.end());
+
+    /* Nearest-rank percentile */
+    auto percentile = [&durations](Float p) {
+        const std::size_t rank = std::ceil(p*durations.size()/100.0f);
+        return durations[rank ? rank - 1 : 0];
+    };
+
+    /* Sum in double precision, Float can't hold many large durations */
+    statistics.mean = std::accumulate(durations.begin(), durations.end(), 0.0)/durations.size();
+    statistics.min = durations.front();
+    statistics.max = durations.back();
+    statistics.median = percentile(50.0f);
+    statistics.percentile90 = percentile(90.0f);
+    statistics.percentile99 = percentile(99.0f);
+    return statistics;
+}
+
+namespace {
+    /* Raw event timestamp. On x86 the time stamp counter is read, which is
+       several times cheaper than querying the clock, the ticks are converted
+       to nanoseconds only when the trace is read. */
+    inline UnsignedLong timestamp() {
+        #if defined(__i386__) || defined(__x86_64__)
+        return __rdtsc();
+        #else
+        return duration_cast<nanoseconds>(high_resolution_clock::now().time_since_epoch()).count();
+        #endif
+    }
+}
+
+/* Per-thread ring buffers of trace events. Each thread claims one slot in a
+   fixed table on its first event and remembers it in a thread-local cache,
+   the events are then written without any locking or read-modify-write
+   operations, as only the owning thread writes into given buffer.
+
+   The buffers are read while other threads may still write into them, so
+   the event data are atomic and the read is validated afterwards the same
+   way as with a sequence lock: the writer bumps the `started` counter before
+   writing the event and the `count` counter after, events which the writer
+   could have started overwriting while they were being read are dropped.
+   The buffers are never freed while the trace exists, when the capacity
+   changes, each thread allocates a new one on its next event. Events
+   recorded before the trace start are recognized by their timestamp. */
+class ProfilerTrace {
+    public:
+        enum: std::size_t { MaxThreads = 64 };
+
+        struct Event {
+            UnsignedLong time;  /* Nanoseconds since the trace start */
+            UnsignedInt frame;
+            Profiler::Section section;
+            bool begin;
+        };
+
+        explicit ProfilerTrace();
+
+        bool isRecording() const { return recording.load(std::memory_order_relaxed); }
+
+        /* Drops all recorded events and starts recording */
+        void start(std::size_t capacity);
+
+        /* Stops recording */
+        void stop();
+
+        void record(Profiler::Section section, bool begin);
+
+        /* Calls the function with events of each thread, ordered by time.
+           Returns false if the recording is not enabled. Serialized with
+           start() and stop(), can be called while other threads record. */
+        template<class F> bool forEachThread(F function) const;
+
+        std::atomic<UnsignedInt> frame;
+
+    private:
+        struct Ring {
+            /* Keep the counters of different threads on separate cache
+               lines */
+            char padding[64];
+            std::atomic<std::size_t> started, count;
+            std::size_t mask;
+
+            /* Two words per event: timestamp and frame, section and
+               begin/end flag packed together */
+            std::unique_ptr<std::atomic<UnsignedLong>[]> data;
+        };
+
+        struct ThreadBuffer {
+            std::thread::id thread;
+            std::atomic<bool> ready;
+
+            /* Written only by the owning thread */
+            std::atomic<Ring*> ring;
+        };
+
+        ThreadBuffer* buffer();
+        Ring* ring(ThreadBuffer& t);
+
+        /* Unique for each trace, identifies the thread-local cache owner */
+        const UnsignedLong id;
+
+        /* Changed only with the mutex locked */
+        mutable std::mutex mutex;
+        high_resolution_clock::time_point startTime;
+        UnsignedLong startTimestamp;
+
+        std::atomic<bool> recording;
+        std::atomic<std::size_t> mask;
+        std::atomic<std::size_t> threadCount;
+        ThreadBuffer threads[MaxThreads];
+
+        /* All buffers ever allocated */
+        std::mutex ringMutex;
+        std::vector<std::unique_ptr<Ring>> rings;
+};
+
+namespace {
+    /* Round up to power of two so the ring index is just a mask */
+    std::size_t traceCapacity(const std::size_t capacity) {
+        std::size_t rounded = 1;
+        while(rounded < capacity) rounded <<= 1;
+        return rounded;
+    }
+
+    std::atomic<UnsignedLong> traceId(0);
+
+    /* Slot of current thread in the last trace it recorded into. GCC < 4.8
+       doesn't support thread_local, __thread is enough for plain struct. */
+    struct TraceThreadCache {
+        UnsignedLong trace;
+        void* buffer;
+    };
+    #if defined(__GNUC__) && !defined(__clang__) && __GNUC__*100 + __GNUC_MINOR__ < 408
+    __thread
+    #else
+    thread_local
+    #endif
+    TraceThreadCache traceThreadCache{0, nullptr};
+}
+
+ProfilerTrace::ProfilerTrace(): frame(0), id(traceId.fetch_add(1, std::memory_order_relaxed) + 1), startTimestamp(0), recording(false), mask(0), threadCount(0) {
+    for(ThreadBuffer& t: threads) {
+        t.ready.store(false, std::memory_order_relaxed);
+        t.ring.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+void ProfilerTrace::start(const std::size_t capacity) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    /* Each thread allocates a new buffer on its next event if the capacity
+       differs, events recorded before are older than the start */
+    frame.store(0, std::memory_order_relaxed);
+    startTime = high_resolution_clock::now();
+    startTimestamp = timestamp();
+    mask.store(traceCapacity(capacity) - 1, std::memory_order_relaxed);
+    recording.store(true, std::memory_order_release);
+}
+
+void ProfilerTrace::stop() {
+    std::lock_guard<std::mutex> lock(mutex);
+    recording.store(false, std::memory_order_relaxed);
+}
+
+ProfilerTrace::ThreadBuffer* ProfilerTrace::buffer() {
+    /* Fast path, the thread already recorded into this trace */
+    if(traceThreadCache.trace == id)
+        return static_cast<ThreadBuffer*>(traceThreadCache.buffer);
+
+    const std::thread::id thread = std::this_thread::get_id();
+    ThreadBuffer* t = nullptr;
+
+    /* The thread might have recorded into another trace in the meantime.
+       Slots are never released, so the table can be scanned without locks. */
+    const std::size_t count = threadCount.load(std::memory_order_acquire);
+    for(std::size_t i = 0, end = std::min(count, std::size_t(MaxThreads)); i != end && !t; ++i)
+        if(threads[i].ready.load(std::memory_order_acquire) && threads[i].thread == thread)
+            t = threads + i;
+
+    /* First event from this thread, claim new slot. If the table is full,
+       the events are dropped, without touching the shared counter again. */
+    if(!t && count < MaxThreads) {
+        const std::size_t i = threadCount.fetch_add(1, std::memory_order_relaxed);
+        if(i < MaxThreads) {
+            t = threads + i;
+            t->thread = thread;
+            t->ready.store(true, std::memory_order_release);
+        }
+    }
+
+    /* Remember also that the table is full for this thread */
+    traceThreadCache.trace = id;
+    traceThreadCache.buffer = t;
+    return t;
+}
+
+ProfilerTrace::Ring* ProfilerTrace::ring(ThreadBuffer& t) {
+    Ring* r = t.ring.load(std::memory_order_relaxed);
+    const std::size_t mask = this->mask.load(std::memory_order_relaxed);
+    if(r && r->mask == mask) return r;
+
+    /* First event or the capacity changed */
+    std::unique_ptr<Ring> ring(new Ring);
+    ring->started.store(0, std::memory_order_relaxed);
+    ring->count.store(0, std::memory_order_relaxed);
+    ring->mask = mask;
+    ring->data.reset(new std::atomic<UnsignedLong>[2*(mask + 1)]);
+    r = ring.get();
+    {
+        std::lock_guard<std::mutex> lock(ringMutex);
+        rings.push_back(std::move(ring));
+    }
+    t.ring.store(r, std::memory_order_release);
+    return r;
+}
+
+void ProfilerTrace::record(const Profiler::Section section, const bool begin) {
+    if(!isRecording()) return;
+
+    const UnsignedLong time = timestamp();
+
+    ThreadBuffer* t = buffer();
+    if(!t) return;
+    Ring* r = ring(*t);
+
+    /* Only this thread writes to the buffer. The release fence orders the
+       `started` update before the event data, pairs with the acquire fence
+       in forEachThread(). */
+    const std::size_t count = r->count.load(std::memory_order_relaxed);
+    r->started.store(count + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    std::atomic<UnsignedLong>* data = r->data.get() + 2*(count & r->mask);
+    data[0].store(time, std::memory_order_relaxed);
+    data[1].store(UnsignedLong(frame.load(std::memory_order_relaxed)) << 32 | UnsignedLong(section) << 1 | UnsignedLong(begin), std::memory_order_relaxed);
+    r->count.store(count + 1, std::memory_order_release);
+}
+
+template<class F> bool ProfilerTrace::forEachThread(F function) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    if(!recording.load(std::memory_order_relaxed)) return false;
+
+    /* Ratio of timestamp ticks and nanoseconds */
+    #if defined(__i386__) || defined(__x86_64__)
+    const double elapsed = duration<double, std::nano>(high_resolution_clock::now() - startTime).count();
+    const UnsignedLong ticks = timestamp() - startTimestamp;
+    const double ticksPerNanosecond = elapsed > 0.0 && ticks ? ticks/elapsed : 1.0;
+    #else
+    const double ticksPerNanosecond = 1.0;
+    #endif
+
+    std::vector<Event> events;
+    const std::size_t count = std::min(threadCount.load(std::memory_order_acquire), std::size_t(MaxThreads));
+    for(std::size_t i = 0; i != count; ++i) {
+        if(!threads[i].ready.load(std::memory_order_acquire)) continue;
+        const Ring* r = threads[i].ring.load(std::memory_order_acquire);
+        if(!r) continue;
+
+        /* If the buffer wrapped around, only the latest events are there */
+        const std::size_t end = r->count.load(std::memory_order_acquire);
+        const std::size_t begin = end > r->mask ? end - r->mask - 1 : 0;
+        std::vector<std::pair<UnsignedLong, UnsignedLong>> data;
+        data.reserve(end - begin);
+        for(std::size_t j = begin; j != end; ++j) {
+            const std::atomic<UnsignedLong>* event = r->data.get() + 2*(j & r->mask);
+            data.emplace_back(event[0].load(std::memory_order_relaxed), event[1].load(std::memory_order_relaxed));
+        }
+
+        /* Drop events which the writer could have overwritten meanwhile */
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const std::size_t started = r->started.load(std::memory_order_relaxed);
+        const std::size_t valid = started > r->mask + 1 + begin ? started - r->mask - 1 - begin : 0;
+
+        events.clear();
+        for(std::size_t j = std::min(valid, data.size()); j != data.size(); ++j) {
+            /* Recorded before the trace start */
+            if(data[j].first < startTimestamp) continue;
+
+            events.push_back(Event{UnsignedLong((data[j].first - startTimestamp)/ticksPerNanosecond),
+                UnsignedInt(data[j].second >> 32),
+                Profiler::Section((data[j].second & 0xffffffffu) >> 1),
+                bool(data[j].second & 1)});
+        }
+        function(i, events);
+    }
+
+    return true;
+}
+
+}
+
+namespace {
+    #ifndef MAGNUM_TARGET_GLES
+    /* Count of frames the GPU results are collected after */
+    constexpr std::size_t GpuLatency = 3;
+
+    constexpr Profiler::Section NoSection = ~Profiler::Section(0);
+    #endif
+
+    void writeJsonString(std::ostream& out, const std::string& string) {
+        out << '"';
+        for(const char c: string) {
+            if(c == '"' || c == '\\') out << '\\' << c;
+            else if(UnsignedByte(c) < 0x20) {
+                const char hex[] = "0123456789abcdef";
+                out << "\\u00" << hex[c >> 4] << hex[c & 0xf];
+            } else out << c;
+        }
+        out << '"';
+    }
+
+    Debug operator<<(Debug debug, const Profiler::Statistics& statistics) {
+        return debug << UnsignedInt(statistics.mean) << u8"µs (min" << UnsignedInt(statistics.min) << u8"µs, median" << UnsignedInt(statistics.median) << u8"µs, 90%" << UnsignedInt(statistics.percentile90) << u8"µs, 99%" << UnsignedInt(statistics.percentile99) << u8"µs, max" << UnsignedInt(statistics.max) << u8"µs)";
+    }
+}
+
+void Profiler::Timings::reset(const std::size_t frameCount, const std::size_t sectionCount) {
+    /* One more frame for the one currently being measured */
+    this->sectionCount = sectionCount;
+    data.assign((frameCount + 1)*sectionCount, high_resolution_clock::duration::zero());
+    currentFrame = 0;
+    this->frameCount = 0;
+}
+
+void Profiler::Timings::add(const Section section, const high_resolution_clock::duration duration) {
+    data[currentFrame*sectionCount + section] += duration;
+}
+
+void Profiler::Timings::nextFrame() {
+    const std::size_t capacity = data.size()/sectionCount;
+    currentFrame = (currentFrame + 1) % capacity;
+    std::fill_n(data.begin() + currentFrame*sectionCount, sectionCount, high_resolution_clock::duration::zero());
+    if(frameCount < capacity - 1) ++frameCount;
+}
+
+Profiler::Statistics Profiler::Timings::statistics(const Section section) const {
+    const std::size_t capacity = data.size()/sectionCount;
+    std::vector<Float> durations;
+    durations.reserve(frameCount);
+    for(std::size_t i = 1; i <= frameCount; ++i) {
+        const std::size_t frame = (currentFrame + capacity - i) % capacity;
+        durations.push_back(duration<Float, std::micro>(data[frame*sectionCount + section]).count());
+    }
+    return Implementation::profilerStatistics(std::move(durations));
+}
+
+Profiler::Profiler(): enabled(false), measureDuration(60), sections{"Other"}, currentSection(otherSection)
+    #ifndef MAGNUM_TARGET_GLES
+    , gpuTimingEnabled(false), currentGpuFrame(0), _droppedGpuFrameCount(0)
+    #endif
+    , trace(new Implementation::ProfilerTrace) {}
+
+Profiler::~Profiler() = default;
+
 Profiler::Section Profiler::addSection(const std::string& name) {
     CORRADE_ASSERT(!enabled, "Profiler: cannot add section when profiling is enabled", 0);
+    CORRADE_ASSERT(!trace->isRecording(), "Profiler: cannot add section when tracing is enabled", 0);
     sections.push_back(name);
     return sections.size()-1;
 }
@@ -45,11 +418,24 @@ void Profiler::setMeasureDuration(std::size_t frames) {
     measureDuration = frames;
 }
 
+#ifndef MAGNUM_TARGET_GLES
+void Profiler::setGpuTimingEnabled(bool enabled) {
+    CORRADE_ASSERT(!this->enabled, "Profiler: cannot enable GPU timing when profiling is enabled", );
+    gpuTimingEnabled = enabled;
+}
+#endif
+
 void Profiler::enable() {
     enabled = true;
-    frameData.assign(measureDuration*sections.size(), high_resolution_clock::duration::zero());
-    totalData.assign(sections.size(), high_resolution_clock::duration::zero());
-    frameCount = 0;
+    timings.reset(measureDuration, sections.size());
+
+    #ifndef MAGNUM_TARGET_GLES
+    gpuTimings.reset(measureDuration, sections.size());
+    gpuFrames.clear();
+    if(gpuTimingEnabled) gpuFrames.resize(GpuLatency);
+    currentGpuFrame = 0;
+    _droppedGpuFrameCount = 0;
+    #endif
 }
 
 void Profiler::disable() {
@@ -60,6 +446,12 @@ void Profiler::start(Section section) {
     if(!enabled) return;
     CORRADE_ASSERT(section < sections.size(), "Profiler: unknown section passed to start()", );
 
+    if(trace->isRecording()) {
+        if(previousTime != high_resolution_clock::time_point())
+            trace->record(currentSection, false);
+        trace->record(section, true);
+    }
+
     save();
 
     currentSection = section;
@@ -68,6 +460,9 @@ void Profiler::start(Section section) {
 void Profiler::stop() {
     if(!enabled) return;
 
+    if(trace->isRecording() && previousTime != high_resolution_clock::time_point())
+        trace->record(currentSection, false);
+
     save();
 
     previousTime = high_resolution_clock::time_point();
@@ -75,48 +470,168 @@ void Profiler::stop() {
 
 void Profiler::save() {
     auto now = high_resolution_clock::now();
+    const bool running = previousTime != high_resolution_clock::time_point();
 
     /* If the profiler is already running, add time to given section */
-    if(previousTime != high_resolution_clock::time_point())
-        frameData[currentFrame*sections.size()+currentSection] += now-previousTime;
+    if(running)
+        timings.add(currentSection, now-previousTime);
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(!gpuFrames.empty()) timestamp(running ? currentSection : NoSection);
+    #endif
 
     /* Set current time as previous for next section */
     previousTime = now;
 }
 
+#ifndef MAGNUM_TARGET_GLES
+void Profiler::timestamp(const Section section) {
+    GpuFrame& frame = gpuFrames[currentGpuFrame];
+
+    /* Reuse queries from previous use of this frame */
+    const std::size_t i = frame.sections.size();
+    if(i == frame.queries.size()) frame.queries.emplace_back(new TimeQuery);
+
+    frame.queries[i]->timestamp();
+    frame.sections.push_back(section);
+}
+
+void Profiler::collectGpuFrame(GpuFrame& frame) {
+    if(frame.sections.empty()) return;
+
+    /* The queries finish in order, if the last one is not available yet,
+       skip the frame instead of waiting for it */
+    if(!frame.queries[frame.sections.size()-1]->resultAvailable()) {
+        ++_droppedGpuFrameCount;
+        frame.sections.clear();
+        return;
+    }
+
+    UnsignedLong previous = 0;
+    for(std::size_t i = 0; i != frame.sections.size(); ++i) {
+        const UnsignedLong current = frame.queries[i]->result<UnsignedLong>();
+        if(frame.sections[i] != NoSection)
+            gpuTimings.add(frame.sections[i], duration_cast<high_resolution_clock::duration>(nanoseconds(current - previous)));
+        previous = current;
+    }
+
+    gpuTimings.nextFrame();
+    frame.sections.clear();
+}
+#endif
+
 void Profiler::nextFrame() {
+    if(trace->isRecording()) trace->frame.fetch_add(1, std::memory_order_relaxed);
+
     if(!enabled) return;
 
-    /* Next frame index */
-    std::size_t nextFrame = (currentFrame+1) % measureDuration;
+    timings.nextFrame();
 
-    /* Add times of current frame to total */
-    for(std::size_t i = 0; i != sections.size(); ++i)
-        totalData[i] += frameData[currentFrame*sections.size()+i];
+    #ifndef MAGNUM_TARGET_GLES
+    if(!gpuFrames.empty()) {
+        /* Close the interval in this frame and continue it in the next one */
+        const bool running = previousTime != high_resolution_clock::time_point();
+        if(running) timestamp(currentSection);
 
-    /* Subtract times of next frame from total and erase them */
-    for(std::size_t i = 0; i != sections.size(); ++i) {
-        totalData[i] -= frameData[nextFrame*sections.size()+i];
-        frameData[nextFrame*sections.size()+i] = high_resolution_clock::duration::zero();
+        currentGpuFrame = (currentGpuFrame + 1) % gpuFrames.size();
+        collectGpuFrame(gpuFrames[currentGpuFrame]);
+
+        if(running) timestamp(NoSection);
     }
+    #endif
+}
 
-    /* Advance to next frame */
-    currentFrame = nextFrame;
+Profiler::Statistics Profiler::statistics(const Section section) const {
+    CORRADE_ASSERT(section < sections.size(), "Profiler: unknown section passed to statistics()", {});
+    return timings.statistics(section);
+}
 
-    if(frameCount < measureDuration) ++frameCount;
+#ifndef MAGNUM_TARGET_GLES
+Profiler::Statistics Profiler::gpuStatistics(const Section section) const {
+    CORRADE_ASSERT(section < sections.size(), "Profiler: unknown section passed to gpuStatistics()", {});
+    return gpuTimings.statistics(section);
 }
+#endif
 
 void Profiler::printStatistics() {
     if(!enabled) return;
 
+    std::vector<Statistics> cpu(sections.size());
+    for(std::size_t i = 0; i != sections.size(); ++i)
+        cpu[i] = statistics(i);
+
     std::vector<std::size_t> totalSorted(sections.size());
     std::iota(totalSorted.begin(), totalSorted.end(), 0);
 
-    std::sort(totalSorted.begin(), totalSorted.end(), [this](std::size_t i, std::size_t j){return totalData[i] > totalData[j];});
+    std::sort(totalSorted.begin(), totalSorted.end(), [&cpu](std::size_t i, std::size_t j){return cpu[i].mean > cpu[j].mean;});
 
     Debug() << "Statistics for last" << measureDuration << "frames:";
-    for(std::size_t i = 0; i != sections.size(); ++i)
-        Debug() << " " << sections[totalSorted[i]] << duration_cast<microseconds>(totalData[totalSorted[i]]).count()/frameCount << u8"µs";
+    for(std::size_t i = 0; i != sections.size(); ++i) {
+        #ifndef MAGNUM_TARGET_GLES
+        if(gpuTimingEnabled) {
+            Debug() << " " << sections[totalSorted[i]] << cpu[totalSorted[i]] << "GPU" << gpuStatistics(totalSorted[i]);
+            continue;
+        }
+        #endif
+
+        Debug() << " " << sections[totalSorted[i]] << cpu[totalSorted[i]];
+    }
+}
+
+void Profiler::enableTracing(const std::size_t capacity) {
+    CORRADE_ASSERT(capacity, "Profiler: trace capacity must be positive", );
+    trace->start(capacity);
+}
+
+void Profiler::disableTracing() {
+    trace->stop();
+}
+
+bool Profiler::isTracingEnabled() const {
+    return trace->isRecording();
+}
+
+void Profiler::beginEvent(const Section section) {
+    if(!trace->isRecording()) return;
+    CORRADE_ASSERT(section < sections.size(), "Profiler: unknown section passed to beginEvent()", );
+    trace->record(section, true);
+}
+
+void Profiler::endEvent(const Section section) {
+    if(!trace->isRecording()) return;
+    CORRADE_ASSERT(section < sections.size(), "Profiler: unknown section passed to endEvent()", );
+    trace->record(section, false);
+}
+
+void Profiler::writeTrace(std::ostream& out) const {
+    /* Chrome trace event format, timestamps are in microseconds */
+    std::ostringstream json;
+    json << "{\"traceEvents\":[";
+    bool first = true;
+    const bool recording = trace->forEachThread([&](std::size_t thread, const std::vector<Implementation::ProfilerTrace::Event>& events) {
+        /* If the buffer wrapped around, begin of some events may have been
+           overwritten, skip their ends to keep the output balanced */
+        std::size_t depth = 0;
+        for(const Implementation::ProfilerTrace::Event& event: events) {
+            if(event.begin) ++depth;
+            else if(depth) --depth;
+            else continue;
+
+            if(!first) json << ',';
+            first = false;
+
+            json << "\n{\"name\":";
+            writeJsonString(json, sections[event.section]);
+            json << ",\"ph\":\"" << (event.begin ? 'B' : 'E')
+                << "\",\"ts\":" << event.time/1000 << '.' << char('0' + event.time/100 % 10) << char('0' + event.time/10 % 10) << char('0' + event.time % 10)
+                << ",\"pid\":0,\"tid\":" << thread
+                << ",\"args\":{\"frame\":" << event.frame << "}}";
+        }
+    });
+    json << "\n]}\n";
+
+    /* Tracing was disabled */
+    if(recording) out << json.str();
 }
 
 }}
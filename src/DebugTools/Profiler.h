@@ -30,14 +30,20 @@
 
 #include <chrono>
 #include <initializer_list>
+#include <iosfwd>
+#include <memory>
 #include <string>
 #include <vector>
 
-#include "Types.h"
+#include "Magnum.h"
 #include "magnumDebugToolsVisibility.h"
 
 namespace Magnum { namespace DebugTools {
 
+namespace Implementation {
+    class ProfilerTrace;
+}
+
 /**
 @brief %Profiler
 
@@ -95,7 +101,55 @@ p.printStatistics();
 It's possible to start profiler only for certain parts of the code and then
 stop it again using stop(), if you are not interested in profiling the rest.
 
-@todo Some unit testing
+@section Profiler-statistics Statistics
+
+Besides the mean printed by printStatistics(), statistics() returns also
+minimum, maximum, median and 90th and 99th percentile of section duration
+in the measured frames, which show occasional spikes hidden by the mean.
+
+@section Profiler-gpu GPU timing
+
+On desktop OpenGL the profiler can measure also time the GPU spent executing
+commands issued in each section, see setGpuTimingEnabled(). Timestamp query
+is issued at each section boundary and the results are collected a few frames
+later, so reading them never blocks. GPU statistics are available through
+gpuStatistics() and are printed alongside the CPU ones.
+
+@section Profiler-tracing Tracing
+
+Statistics don't show individual frames nor nesting of the measured code. For
+offline analysis of frame time spikes the profiler can record each section
+start and end along with thread and frame number, see enableTracing(). Besides
+start() and stop(), nested events can be recorded from any thread using
+beginEvent() and endEvent() or ScopedEvent:
+@code
+p.enableTracing();
+
+void Physics::step() {
+    DebugTools::Profiler::ScopedEvent e(p, sections.physics);
+
+    {
+        DebugTools::Profiler::ScopedEvent e(p, sections.collisions);
+        // ...
+    }
+}
+
+// After the interesting part, e.g. on key press
+std::ofstream out("trace.json");
+p.writeTrace(out);
+@endcode
+
+The output is in Chrome trace event format, it can be viewed e.g. by opening
+`about:tracing` in Chromium. Each thread records into its own ring buffer,
+without any locking, once the buffer is full the oldest events are
+overwritten and ends of events whose beginning was overwritten are left out
+of the output. Recording one event should take less than 50 nanoseconds, on
+x86 the timestamps are taken from the CPU time stamp counter, which is
+assumed to be invariant and synchronized across cores. At most 64 threads
+can record events during the profiler lifetime, events of any further
+threads are ignored. The buffers are kept allocated until the profiler is
+destroyed.
+
 @todo More time intervals
 */
 class MAGNUM_DEBUGTOOLS_EXPORT Profiler {
@@ -114,7 +168,48 @@ class MAGNUM_DEBUGTOOLS_EXPORT Profiler {
          */
         static const Section otherSection = 0;
 
-        explicit Profiler(): enabled(false), measureDuration(60), currentFrame(0), frameCount(0), sections{"Other"}, currentSection(otherSection) {}
+        /**
+         * @brief Section statistics
+         *
+         * All values are in microseconds.
+         * @see statistics(), gpuStatistics()
+         */
+        struct Statistics {
+            Float mean,             /**< @brief Mean duration */
+                min,                /**< @brief Minimal duration */
+                max,                /**< @brief Maximal duration */
+                median,             /**< @brief Median duration */
+                percentile90,       /**< @brief 90th percentile of duration */
+                percentile99;       /**< @brief 99th percentile of duration */
+        };
+
+        /**
+         * @brief Scoped trace event
+         *
+         * Calls beginEvent() on construction and endEvent() on destruction.
+         * @see @ref Profiler-tracing "Tracing"
+         */
+        class ScopedEvent {
+            ScopedEvent(const ScopedEvent&) = delete;
+            ScopedEvent& operator=(const ScopedEvent&) = delete;
+
+            public:
+                /** @brief Constructor */
+                explicit ScopedEvent(Profiler& profiler, Section section): profiler(profiler), section(section) {
+                    profiler.beginEvent(section);
+                }
+
+                /** @brief Destructor */
+                ~ScopedEvent() { profiler.endEvent(section); }
+
+            private:
+                Profiler& profiler;
+                const Section section;
+        };
+
+        explicit Profiler();
+
+        ~Profiler();
 
         /**
          * @brief Set measure duration
@@ -133,6 +228,23 @@ class MAGNUM_DEBUGTOOLS_EXPORT Profiler {
          */
         Section addSection(const std::string& name);
 
+        #ifndef MAGNUM_TARGET_GLES
+        /** @brief Whether GPU timing is enabled */
+        bool isGpuTimingEnabled() const { return gpuTimingEnabled; }
+
+        /**
+         * @brief Enable or disable GPU timing
+         *
+         * Disabled by default. See @ref Profiler-gpu "class documentation"
+         * for more information.
+         * @attention This function cannot be called if profiling is enabled.
+         * @see TimeQuery::timestamp()
+         * @requires_gl33 %Extension @extension{ARB,timer_query}
+         * @requires_gl GPU timing is not available in OpenGL ES.
+         */
+        void setGpuTimingEnabled(bool enabled);
+        #endif
+
         /**
          * @brief Whether profiling is enabled
          *
@@ -184,29 +296,147 @@ class MAGNUM_DEBUGTOOLS_EXPORT Profiler {
         /**
          * @brief Save data from previous frame and advance to another
          *
-         * Call at the end of each frame.
-         * @note Does nothing if profiling is disabled.
+         * Call at the end of each frame. If tracing is enabled, frame number
+         * of recorded events is incremented.
+         * @note Does nothing else if profiling is disabled.
          */
         void nextFrame();
 
+        /**
+         * @brief Section statistics
+         *
+         * Statistics of section duration in the frames measured so far, at
+         * most the last frames given by setMeasureDuration(). Returns all
+         * zeros if no frame was measured yet.
+         */
+        Statistics statistics(Section section) const;
+
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Section GPU statistics
+         *
+         * Similar to statistics(), but for time spent by the GPU. As the
+         * query results are collected with a few frames delay, the most
+         * recent frames are not included.
+         * @see setGpuTimingEnabled()
+         * @requires_gl GPU timing is not available in OpenGL ES.
+         */
+        Statistics gpuStatistics(Section section) const;
+
+        /**
+         * @brief Count of frames without GPU timing
+         *
+         * Frames for which the query results were not available in time and
+         * were thus skipped. Non-zero value means the GPU is lagging behind
+         * the CPU more than the profiler expects.
+         */
+        std::size_t droppedGpuFrameCount() const { return _droppedGpuFrameCount; }
+        #endif
+
         /**
          * @brief Print statistics
          *
-         * Prints statistics about previous frame ordered by duration.
+         * Prints statistics about measured frames ordered by mean duration,
+         * including GPU times if GPU timing is enabled.
          * @note Does nothing if profiling is disabled.
          */
         void printStatistics();
 
+        /** @brief Whether tracing is enabled */
+        bool isTracingEnabled() const;
+
+        /**
+         * @brief Enable tracing
+         * @param capacity  Capacity of event buffer of each thread
+         *
+         * Clears already recorded events. Independent on enable(), but
+         * start() and stop() record events only if both profiling and
+         * tracing is enabled. See @ref Profiler-tracing "class documentation"
+         * for more information.
+         * @attention Sections cannot be added when tracing is enabled.
+         */
+        void enableTracing(std::size_t capacity = 65536);
+
+        /**
+         * @brief Disable tracing
+         *
+         * Further events are ignored, already recorded events are dropped
+         * when tracing is enabled again. Can be called while other threads
+         * record events or write the trace.
+         */
+        void disableTracing();
+
+        /**
+         * @brief Begin nested trace event
+         *
+         * Can be called from any thread. Does nothing if tracing is disabled.
+         * @see endEvent(), ScopedEvent
+         */
+        void beginEvent(Section section);
+
+        /**
+         * @brief End nested trace event
+         *
+         * @see beginEvent()
+         */
+        void endEvent(Section section);
+
+        /**
+         * @brief Write recorded trace
+         *
+         * Writes the events in Chrome trace event JSON format. Does nothing
+         * if tracing is disabled. Other threads can continue recording
+         * during this call, events which they overwrite meanwhile are left
+         * out. Enabling or disabling tracing waits until the trace is
+         * written.
+         */
+        void writeTrace(std::ostream& out) const;
+
     private:
+        /* Durations of each section in ring of frames */
+        class Timings {
+            public:
+                explicit Timings(): sectionCount(1), currentFrame(0), frameCount(0) {}
+
+                void reset(std::size_t frameCount, std::size_t sectionCount);
+                void add(Section section, std::chrono::high_resolution_clock::duration duration);
+                void nextFrame();
+                Statistics statistics(Section section) const;
+
+            private:
+                std::size_t sectionCount, currentFrame, frameCount;
+                std::vector<std::chrono::high_resolution_clock::duration> data;
+        };
+
+        #ifndef MAGNUM_TARGET_GLES
+        /* Timestamp queries issued in one frame, for each query the section
+           of interval ending with it or ~0 if it begins new interval */
+        struct GpuFrame {
+            std::vector<std::unique_ptr<TimeQuery>> queries;
+            std::vector<Section> sections;
+        };
+
+        void timestamp(Section section);
+        void collectGpuFrame(GpuFrame& frame);
+        #endif
+
         void save();
 
         bool enabled;
-        std::size_t measureDuration, currentFrame, frameCount;
+        std::size_t measureDuration;
         std::vector<std::string> sections;
-        std::vector<std::chrono::high_resolution_clock::duration> frameData;
-        std::vector<std::chrono::high_resolution_clock::duration> totalData;
+        Timings timings;
         std::chrono::high_resolution_clock::time_point previousTime;
         Section currentSection;
+
+        #ifndef MAGNUM_TARGET_GLES
+        bool gpuTimingEnabled;
+        Timings gpuTimings;
+        std::vector<GpuFrame> gpuFrames;
+        std::size_t currentGpuFrame, _droppedGpuFrameCount;
+        #endif
+
+        std::unique_ptr<Implementation::ProfilerTrace> trace;
 };
 
 }}
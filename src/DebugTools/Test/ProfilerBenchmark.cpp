@@ -0,0 +1,100 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <thread>
+#include <vector>
+#include <TestSuite/Tester.h>
+
+#include "DebugTools/Profiler.h"
+#include "Test/Benchmark.h"
+
+namespace Magnum { namespace DebugTools { namespace Test {
+
+class ProfilerBenchmark: public TestSuite::Tester {
+    public:
+        ProfilerBenchmark();
+
+        void event();
+        void eventThreads();
+};
+
+namespace {
+
+/* Recording one event shouldn't take more than this many nanoseconds */
+constexpr double EventBudget = 50.0;
+
+/* Average time of one event in nanoseconds, measured on begin/end pairs */
+double measureEvent(Profiler& profiler, const Profiler::Section section, const std::size_t repeats) {
+    return Magnum::Test::measure<std::nano>([&profiler, section]() {
+        profiler.beginEvent(section);
+        profiler.endEvent(section);
+    }, repeats)/2;
+}
+
+}
+
+ProfilerBenchmark::ProfilerBenchmark() {
+    addTests({&ProfilerBenchmark::event,
+              &ProfilerBenchmark::eventThreads});
+}
+
+void ProfilerBenchmark::event() {
+    Profiler p;
+    Profiler::Section section = p.addSection("Section");
+
+    Debug() << "Single thread:";
+    Debug() << "  tracing disabled:" << measureEvent(p, section, 1000000) << "ns per event";
+
+    p.enableTracing();
+    const double time = measureEvent(p, section, 1000000);
+    Debug() << "  tracing enabled:" << time << "ns per event";
+    CORRADE_VERIFY(time < EventBudget);
+}
+
+void ProfilerBenchmark::eventThreads() {
+    Profiler p;
+    Profiler::Section section = p.addSection("Section");
+    p.enableTracing();
+
+    std::vector<double> times(4);
+    std::vector<std::thread> threads;
+    for(std::size_t i = 0; i != times.size(); ++i)
+        threads.emplace_back([&p, &times, section, i]() {
+            times[i] = measureEvent(p, section, 1000000);
+        });
+    for(std::thread& t: threads) t.join();
+
+    Debug() << times.size() << "threads:";
+    for(std::size_t i = 0; i != times.size(); ++i)
+        Debug() << "  thread" << i << "-" << times[i] << "ns per event";
+
+    /* With less cores the threads are time-sliced and the wall time of each
+       includes time spent by the others */
+    if(std::thread::hardware_concurrency() < times.size()) return;
+    for(double time: times) CORRADE_VERIFY(time < EventBudget);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::DebugTools::Test::ProfilerBenchmark)
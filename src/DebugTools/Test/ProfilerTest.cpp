@@ -0,0 +1,366 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <atomic>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include <TestSuite/Tester.h>
+
+#include "DebugTools/Profiler.h"
+#include "DebugTools/Implementation/ProfilerStatistics.h"
+
+namespace Magnum { namespace DebugTools { namespace Test {
+
+class ProfilerTest: public TestSuite::Tester {
+    public:
+        ProfilerTest();
+
+        void statisticsEmpty();
+        void statistics();
+        void statisticsPercentiles();
+        void measure();
+
+        void trace();
+        void traceNested();
+        void traceWrapAround();
+        void traceWrapAroundUnmatched();
+        void traceThreads();
+        void traceThreadLimit();
+        void traceConcurrent();
+        void traceDisableWhileWriting();
+};
+
+ProfilerTest::ProfilerTest() {
+    addTests({&ProfilerTest::statisticsEmpty,
+              &ProfilerTest::statistics,
+              &ProfilerTest::statisticsPercentiles,
+              &ProfilerTest::measure,
+
+              &ProfilerTest::trace,
+              &ProfilerTest::traceNested,
+              &ProfilerTest::traceWrapAround,
+              &ProfilerTest::traceWrapAroundUnmatched,
+              &ProfilerTest::traceThreads,
+              &ProfilerTest::traceThreadLimit,
+              &ProfilerTest::traceConcurrent,
+              &ProfilerTest::traceDisableWhileWriting});
+}
+
+void ProfilerTest::statisticsEmpty() {
+    const Profiler::Statistics s = Implementation::profilerStatistics({});
+    CORRADE_COMPARE(s.mean, 0.0);
+    CORRADE_COMPARE(s.min, 0.0);
+    CORRADE_COMPARE(s.max, 0.0);
+    CORRADE_COMPARE(s.percentile99, 0.0);
+
+    /* No frames measured yet */
+    Profiler p;
+    CORRADE_COMPARE(p.statistics(Profiler::otherSection).max, 0.0);
+}
+
+void ProfilerTest::statistics() {
+    const Profiler::Statistics s = Implementation::profilerStatistics({30.0f, 10.0f, 50.0f, 20.0f, 40.0f});
+    CORRADE_COMPARE(s.mean, 30.0);
+    CORRADE_COMPARE(s.min, 10.0);
+    CORRADE_COMPARE(s.max, 50.0);
+    CORRADE_COMPARE(s.median, 30.0);
+    CORRADE_COMPARE(s.percentile90, 50.0);
+    CORRADE_COMPARE(s.percentile99, 50.0);
+}
+
+void ProfilerTest::statisticsPercentiles() {
+    /* 1, 2, ..., 100 in reverse order */
+    std::vector<Float> durations;
+    for(Int i = 100; i != 0; --i) durations.push_back(i);
+
+    const Profiler::Statistics s = Implementation::profilerStatistics(durations);
+    CORRADE_COMPARE(s.mean, 50.5);
+    CORRADE_COMPARE(s.median, 50.0);
+    CORRADE_COMPARE(s.percentile90, 90.0);
+    CORRADE_COMPARE(s.percentile99, 99.0);
+}
+
+void ProfilerTest::measure() {
+    Profiler p;
+    p.setMeasureDuration(2);
+    Profiler::Section sleep = p.addSection("Sleep");
+    p.enable();
+
+    for(Int i = 0; i != 3; ++i) {
+        p.start(sleep);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        p.start();
+        p.nextFrame();
+    }
+    p.stop();
+
+    /* Sleeping section took at least 2 ms in each of last two frames */
+    const Profiler::Statistics s = p.statistics(sleep);
+    CORRADE_VERIFY(s.min >= 2000.0);
+    CORRADE_VERIFY(s.max >= s.min);
+    CORRADE_VERIFY(p.statistics(Profiler::otherSection).max < s.min);
+}
+
+void ProfilerTest::trace() {
+    Profiler p;
+    Profiler::Section physics = p.addSection("Physics \"step\"");
+    p.enable();
+
+    /* Nothing recorded if tracing is not enabled */
+    std::ostringstream out;
+    p.start(physics);
+    p.writeTrace(out);
+    CORRADE_VERIFY(!p.isTracingEnabled());
+    CORRADE_COMPARE(out.str(), "");
+    p.stop();
+
+    p.enableTracing();
+    CORRADE_VERIFY(p.isTracingEnabled());
+    p.start();
+    p.nextFrame();
+    p.start(physics);
+    p.stop();
+    p.writeTrace(out);
+
+    const std::string trace = out.str();
+    const std::size_t a = trace.find(R"({"name":"Other","ph":"B",)");
+    const std::size_t b = trace.find(R"({"name":"Other","ph":"E",)");
+    const std::size_t c = trace.find(R"({"name":"Physics \"step\"","ph":"B",)");
+    const std::size_t d = trace.find(R"({"name":"Physics \"step\"","ph":"E",)");
+    CORRADE_COMPARE(trace.find(R"({"traceEvents":[)"), 0);
+    CORRADE_VERIFY(a != std::string::npos);
+    CORRADE_VERIFY(a < b);
+    CORRADE_VERIFY(b < c);
+    CORRADE_VERIFY(c < d);
+    CORRADE_VERIFY(d != std::string::npos);
+    CORRADE_VERIFY(trace.find(R"("args":{"frame":0})", a) < b);
+    CORRADE_VERIFY(trace.find(R"("args":{"frame":1})", b) < c);
+    CORRADE_COMPARE(trace.substr(trace.size() - 3), "]}\n");
+
+    p.disableTracing();
+    CORRADE_VERIFY(!p.isTracingEnabled());
+}
+
+void ProfilerTest::traceNested() {
+    Profiler p;
+    Profiler::Section outer = p.addSection("Outer");
+    Profiler::Section inner = p.addSection("Inner");
+    p.enableTracing();
+
+    /* Works also without profiling enabled */
+    {
+        Profiler::ScopedEvent e(p, outer);
+        p.beginEvent(inner);
+        p.endEvent(inner);
+    }
+
+    std::ostringstream out;
+    p.writeTrace(out);
+    const std::string trace = out.str();
+    const std::size_t a = trace.find(R"("name":"Outer","ph":"B")");
+    const std::size_t b = trace.find(R"("name":"Inner","ph":"B")");
+    const std::size_t c = trace.find(R"("name":"Inner","ph":"E")");
+    const std::size_t d = trace.find(R"("name":"Outer","ph":"E")");
+    CORRADE_VERIFY(a < b);
+    CORRADE_VERIFY(b < c);
+    CORRADE_VERIFY(c < d);
+    CORRADE_VERIFY(d != std::string::npos);
+}
+
+void ProfilerTest::traceWrapAround() {
+    Profiler p;
+    Profiler::Section first = p.addSection("First");
+    Profiler::Section second = p.addSection("Second");
+
+    /* Capacity is rounded up to 4 */
+    p.enableTracing(3);
+    p.beginEvent(first);
+    p.endEvent(first);
+    p.beginEvent(second);
+    p.endEvent(second);
+    p.beginEvent(second);
+    p.endEvent(second);
+
+    std::ostringstream out;
+    p.writeTrace(out);
+    const std::string trace = out.str();
+    CORRADE_COMPARE(trace.find("First"), std::string::npos);
+
+    std::size_t count = 0;
+    for(std::size_t pos = trace.find("\"name\""); pos != std::string::npos; pos = trace.find("\"name\"", pos + 1))
+        ++count;
+    CORRADE_COMPARE(count, 4);
+}
+
+void ProfilerTest::traceWrapAroundUnmatched() {
+    Profiler p;
+    Profiler::Section outer = p.addSection("Outer");
+    Profiler::Section inner = p.addSection("Inner");
+
+    /* Begin of the outer event gets overwritten, its end is skipped */
+    p.enableTracing(4);
+    p.beginEvent(outer);
+    p.beginEvent(inner);
+    p.endEvent(inner);
+    p.beginEvent(inner);
+    p.endEvent(inner);
+    p.endEvent(outer);
+
+    std::ostringstream out;
+    p.writeTrace(out);
+    const std::string trace = out.str();
+    CORRADE_COMPARE(trace.find("Outer"), std::string::npos);
+
+    const std::size_t begin = trace.find(R"("name":"Inner","ph":"B")");
+    const std::size_t end = trace.find(R"("name":"Inner","ph":"E")");
+    CORRADE_VERIFY(begin != std::string::npos);
+    CORRADE_VERIFY(end != std::string::npos);
+    CORRADE_VERIFY(begin < end);
+
+    std::size_t count = 0;
+    for(std::size_t pos = trace.find("\"name\""); pos != std::string::npos; pos = trace.find("\"name\"", pos + 1))
+        ++count;
+    CORRADE_COMPARE(count, 2);
+}
+
+void ProfilerTest::traceThreads() {
+    Profiler p;
+    Profiler::Section work = p.addSection("Work");
+    p.enableTracing();
+
+    p.beginEvent(work);
+    std::thread t([&p, work]() {
+        Profiler::ScopedEvent e(p, work);
+    });
+    t.join();
+    p.endEvent(work);
+
+    std::ostringstream out;
+    p.writeTrace(out);
+    const std::string trace = out.str();
+    CORRADE_VERIFY(trace.find(R"("ph":"B","ts":)") != std::string::npos);
+    CORRADE_VERIFY(trace.find(R"("tid":0,)") != std::string::npos);
+    CORRADE_VERIFY(trace.find(R"("tid":1,)") != std::string::npos);
+    CORRADE_COMPARE(trace.find(R"("tid":2,)"), std::string::npos);
+}
+
+void ProfilerTest::traceThreadLimit() {
+    Profiler p;
+    Profiler::Section work = p.addSection("Work");
+    p.enableTracing(4);
+
+    /* Events of threads beyond the limit are ignored. The threads are kept
+       alive so their IDs aren't reused. */
+    std::atomic<Int> recorded(0);
+    std::atomic<bool> done(false);
+    std::vector<std::thread> threads;
+    for(Int i = 0; i != 70; ++i) threads.emplace_back([&p, &recorded, &done, work]() {
+        p.beginEvent(work);
+        ++recorded;
+        while(!done.load()) std::this_thread::yield();
+    });
+    while(recorded.load() != 70) std::this_thread::yield();
+
+    std::ostringstream out;
+    p.writeTrace(out);
+    done.store(true);
+    for(std::thread& t: threads) t.join();
+    const std::string trace = out.str();
+    CORRADE_VERIFY(trace.find(R"("tid":63,)") != std::string::npos);
+    CORRADE_COMPARE(trace.find(R"("tid":64,)"), std::string::npos);
+
+    /* The slots are never released, so this thread is ignored even after
+       re-enabling */
+    p.enableTracing(4);
+    p.beginEvent(work);
+    out.str({});
+    p.writeTrace(out);
+    CORRADE_COMPARE(out.str().find(R"("ph":"B")"), std::string::npos);
+}
+
+void ProfilerTest::traceConcurrent() {
+    Profiler p;
+    Profiler::Section work = p.addSection("Work");
+    p.enableTracing(16);
+
+    /* Writing and disabling the trace while other thread records into it */
+    std::atomic<bool> done(false);
+    std::thread t([&p, &done, work]() {
+        while(!done.load()) {
+            Profiler::ScopedEvent e(p, work);
+        }
+    });
+
+    for(Int i = 0; i != 100; ++i) {
+        std::ostringstream out;
+        p.writeTrace(out);
+        CORRADE_VERIFY(p.isTracingEnabled());
+        CORRADE_COMPARE(out.str().substr(out.str().size() - 3), "]}\n");
+
+        p.disableTracing();
+        CORRADE_VERIFY(!p.isTracingEnabled());
+        p.enableTracing(16);
+    }
+
+    done.store(true);
+    t.join();
+}
+
+void ProfilerTest::traceDisableWhileWriting() {
+    Profiler p;
+    Profiler::Section work = p.addSection("Work");
+    p.enableTracing(16);
+    for(Int i = 0; i != 16; ++i) {
+        Profiler::ScopedEvent e(p, work);
+    }
+
+    /* Writing the trace doesn't enable it again after it was disabled */
+    std::atomic<bool> done(false);
+    std::thread t([&p, &done]() {
+        while(!done.load()) {
+            std::ostringstream out;
+            p.writeTrace(out);
+        }
+    });
+
+    for(Int i = 0; i != 100; ++i) {
+        p.disableTracing();
+        CORRADE_VERIFY(!p.isTracingEnabled());
+        p.enableTracing(16);
+    }
+    p.disableTracing();
+
+    done.store(true);
+    t.join();
+    CORRADE_VERIFY(!p.isTracingEnabled());
+
+    std::ostringstream out;
+    p.writeTrace(out);
+    CORRADE_COMPARE(out.str(), "");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::DebugTools::Test::ProfilerTest)
@@ -0,0 +1,157 @@
+#ifndef Magnum_Fence_h
+#define Magnum_Fence_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "magnumConfigure.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+/** @file
+ * @brief Class Magnum::Fence
+ */
+#endif
+
+#include "Types.h"
+#include "OpenGL.h"
+#include "magnumVisibility.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum {
+
+/**
+@brief Sync fence
+
+Allows to find out when all previously issued OpenGL commands were completed,
+e.g. to know that given buffer range is no longer used by the GPU and can be
+overwritten. Example usage:
+@code
+Fence fence;
+
+// draw commands reading from the buffer...
+fence.insert();
+
+// some other work...
+
+if(!fence.isSignaled()) {
+    // the GPU is still busy, do something else...
+}
+
+// Wait at most one millisecond
+fence.wait(1000000);
+@endcode
+@see StreamingBuffer
+@requires_gl32 %Extension @extension{ARB,sync}
+@requires_gles30 Sync objects are not available in OpenGL ES 2.0.
+*/
+class MAGNUM_EXPORT Fence {
+    Fence(const Fence&) = delete;
+    Fence& operator=(const Fence&) = delete;
+
+    public:
+        /**
+         * @brief Wait status
+         *
+         * @see wait()
+         */
+        enum class Status: GLenum {
+            /** The fence was already signaled when wait() was called */
+            AlreadySignaled = GL_ALREADY_SIGNALED,
+
+            /** The fence was signaled before the timeout expired */
+            ConditionSatisfied = GL_CONDITION_SATISFIED,
+
+            /** The fence wasn't signaled before the timeout expired */
+            TimeoutExpired = GL_TIMEOUT_EXPIRED,
+
+            /** An error occurred */
+            WaitFailed = GL_WAIT_FAILED
+        };
+
+        /**
+         * @brief Constructor
+         *
+         * The fence is not inserted into command stream, call insert() for
+         * that.
+         */
+        explicit Fence(): _sync(nullptr) {}
+
+        /**
+         * @brief Destructor
+         *
+         * Deletes assigned OpenGL sync object, if any.
+         * @see @fn_gl{DeleteSync}
+         */
+        ~Fence();
+
+        /** @brief Move constructor */
+        Fence(Fence&& other): _sync(other._sync) {
+            other._sync = nullptr;
+        }
+
+        /** @brief Move assignment */
+        Fence& operator=(Fence&& other);
+
+        /** @brief OpenGL sync object */
+        GLsync sync() const { return _sync; }
+
+        /** @brief Whether the fence was inserted */
+        bool isInserted() const { return _sync; }
+
+        /**
+         * @brief Insert the fence into command stream
+         *
+         * Previously inserted sync object is deleted.
+         * @see @fn_gl{FenceSync}, @fn_gl{DeleteSync}
+         */
+        void insert();
+
+        /**
+         * @brief Whether the fence was signaled
+         *
+         * Doesn't block. Returns `true` also if the fence wasn't inserted at
+         * all.
+         * @see @fn_gl{GetSync} with @def_gl{SYNC_STATUS}
+         */
+        bool isSignaled() const;
+
+        /**
+         * @brief Wait for the fence
+         * @param timeout   Timeout in nanoseconds
+         *
+         * Blocks until the fence is signaled or the timeout expires. Pending
+         * commands are flushed before waiting. Returns
+         * @ref Status "Status::AlreadySignaled" also if the fence wasn't
+         * inserted at all.
+         * @see @fn_gl{ClientWaitSync}
+         */
+        Status wait(UnsignedLong timeout);
+
+    private:
+        GLsync _sync;
+};
+
+}
+#endif
+
+#endif
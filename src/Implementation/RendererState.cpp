@@ -0,0 +1,57 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "RendererState.h"
+
+#include <Utility/Assert.h>
+
+namespace Magnum { namespace Implementation {
+
+const std::size_t RendererState::FeatureCount;
+
+std::size_t RendererState::indexForFeature(const Renderer::Feature feature) {
+    switch(feature) {
+        case Renderer::Feature::Blending:               return 0;
+        case Renderer::Feature::DepthTest:              return 1;
+        case Renderer::Feature::Dithering:              return 2;
+        case Renderer::Feature::FaceCulling:            return 3;
+        case Renderer::Feature::PolygonOffsetFill:      return 4;
+        case Renderer::Feature::ScissorTest:            return 5;
+        case Renderer::Feature::StencilTest:            return 6;
+        #ifndef MAGNUM_TARGET_GLES
+        case Renderer::Feature::DepthClamp:             return 7;
+        case Renderer::Feature::LogicOperation:         return 8;
+        case Renderer::Feature::Multisampling:          return 9;
+        case Renderer::Feature::PolygonOffsetLine:      return 10;
+        case Renderer::Feature::PolygonOffsetPoint:     return 11;
+        case Renderer::Feature::ProgramPointSize:       return 12;
+        case Renderer::Feature::SeamlessCubeMapTexture: return 13;
+        #endif
+    }
+
+    CORRADE_ASSERT_UNREACHABLE();
+}
+
+}}
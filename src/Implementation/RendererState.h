@@ -24,16 +24,112 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <tuple>
+#include <utility>
+
+#include "Math/Geometry/Rectangle.h"
+#include "Color.h"
 #include "Renderer.h"
 
 namespace Magnum { namespace Implementation {
 
-struct RendererState {
-    constexpr RendererState()
+struct MAGNUM_EXPORT RendererState {
+    #ifndef MAGNUM_TARGET_GLES
+    static const std::size_t FeatureCount = 14;
+    #else
+    static const std::size_t FeatureCount = 7;
+    #endif
+
+    /* Feature -> index mapping */
+    static std::size_t indexForFeature(Renderer::Feature feature);
+
+    /* Cached value, unknown until first set, so the first call always goes
+       to the driver */
+    template<class T> struct Cached {
+        constexpr Cached(): value(), known(false) {}
+
+        T value;
+        bool known;
+    };
+
+    struct Cache {
+        Cached<bool> features[FeatureCount];
+
+        Cached<Color4<>> clearColor;
+        #ifndef MAGNUM_TARGET_GLES
+        Cached<Double> clearDepth;
+        #else
+        Cached<Float> clearDepth;
+        #endif
+        Cached<Int> clearStencil;
+
+        Cached<Renderer::FrontFace> frontFace;
+        Cached<Renderer::PolygonFacing> faceCullingMode;
+        #ifndef MAGNUM_TARGET_GLES
+        Cached<Renderer::ProvokingVertex> provokingVertex;
+        Cached<Renderer::PolygonMode> polygonMode;
+        #endif
+        Cached<std::pair<Float, Float>> polygonOffset;
+        Cached<Float> lineWidth;
+        #ifndef MAGNUM_TARGET_GLES
+        Cached<Float> pointSize;
+        #endif
+
+        Cached<Rectanglei> scissor;
+        Cached<std::tuple<Renderer::StencilFunction, Int, UnsignedInt>> stencilFunction[2];
+        Cached<std::tuple<Renderer::StencilOperation, Renderer::StencilOperation, Renderer::StencilOperation>> stencilOperation[2];
+        Cached<Renderer::DepthFunction> depthFunction;
+
+        Cached<std::tuple<GLboolean, GLboolean, GLboolean, GLboolean>> colorMask;
+        Cached<GLboolean> depthMask;
+        Cached<UnsignedInt> stencilMask[2];
+
+        Cached<std::pair<Renderer::BlendEquation, Renderer::BlendEquation>> blendEquation;
+        Cached<std::tuple<Renderer::BlendFunction, Renderer::BlendFunction, Renderer::BlendFunction, Renderer::BlendFunction>> blendFunction;
+        Cached<Color4<>> blendColor;
+        #ifndef MAGNUM_TARGET_GLES
+        Cached<Renderer::LogicOperation> logicOperation;
+        #endif
+    };
+
+    explicit RendererState(): stateChangeCount(0), elidedStateChangeCount(0)
         #ifndef MAGNUM_TARGET_GLES3
-        : resetNotificationStrategy()
+        , resetNotificationStrategy()
         #endif
-    {}
+        {}
+
+    /* Updates cached value, returns false if the value didn't change and the
+       call can be elided */
+    template<class T> bool update(Cached<T>& cached, const T& value) {
+        if(cached.known && cached.value == value) {
+            ++elidedStateChangeCount;
+            return false;
+        }
+
+        cached.value = value;
+        cached.known = true;
+        ++stateChangeCount;
+        return true;
+    }
+
+    /* Updates front- and/or back-facing value */
+    template<class T> bool update(Cached<T>(&cached)[2], Renderer::PolygonFacing facing, const T& value) {
+        bool changed = false;
+        for(std::size_t i = 0; i != 2; ++i) {
+            if(facing == (i == 0 ? Renderer::PolygonFacing::Back : Renderer::PolygonFacing::Front)) continue;
+            if(cached[i].known && cached[i].value == value) continue;
+
+            cached[i].value = value;
+            cached[i].known = true;
+            changed = true;
+        }
+
+        ++(changed ? stateChangeCount : elidedStateChangeCount);
+        return changed;
+    }
+
+    Cache cache;
+    UnsignedInt stateChangeCount, elidedStateChangeCount;
 
     #ifndef MAGNUM_TARGET_GLES3
     Renderer::ResetNotificationStrategy resetNotificationStrategy;
@@ -0,0 +1,53 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "UniformCache.h"
+
+#include <cstring>
+
+namespace Magnum { namespace Implementation {
+
+bool UniformCache::update(const Int location, const UnsignedInt count, const void* const data, const std::size_t elementSize) {
+    /* Invalid location, let OpenGL deal with it */
+    if(location < 0) return true;
+
+    if(values.size() < std::size_t(location)+count)
+        values.resize(location+count);
+
+    bool changed = false;
+    const char* element = static_cast<const char*>(data);
+    for(UnsignedInt i = 0; i != count; ++i, element += elementSize) {
+        std::string& value = values[location+i];
+        if(value.size() == elementSize && std::memcmp(value.data(), element, elementSize) == 0)
+            continue;
+
+        value.assign(element, elementSize);
+        changed = true;
+    }
+
+    ++(changed ? uploadCount : elidedUploadCount);
+    return changed;
+}
+
+}}
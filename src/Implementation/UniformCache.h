@@ -0,0 +1,52 @@
+#ifndef Magnum_Implementation_UniformCache_h
+#define Magnum_Implementation_UniformCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <string>
+#include <vector>
+
+#include "Magnum.h"
+#include "magnumVisibility.h"
+
+namespace Magnum { namespace Implementation {
+
+/* Shadow copy of uniform values of one shader program */
+struct MAGNUM_EXPORT UniformCache {
+    explicit UniformCache(): uploadCount(0), elidedUploadCount(0) {}
+
+    /* Updates cached values of `count` elements of given size starting at
+       given location, returns false if none of them changed and the upload
+       can be elided. Array elements are expected to have consecutive
+       locations. */
+    bool update(Int location, UnsignedInt count, const void* data, std::size_t elementSize);
+
+    /* Raw element data for each location, empty if not known */
+    std::vector<std::string> values;
+    UnsignedInt uploadCount, elidedUploadCount;
+};
+
+}}
+
+#endif
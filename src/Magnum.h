@@ -353,6 +353,11 @@ template<UnsignedInt> class BufferImage;
 typedef BufferImage<1> BufferImage1D;
 typedef BufferImage<2> BufferImage2D;
 typedef BufferImage<3> BufferImage3D;
+
+template<UnsignedInt> class BufferImageQueue;
+typedef BufferImageQueue<1> BufferImageQueue1D;
+typedef BufferImageQueue<2> BufferImageQueue2D;
+typedef BufferImageQueue<3> BufferImageQueue3D;
 #endif
 
 #ifndef MAGNUM_TARGET_GLES
@@ -376,6 +381,11 @@ class CubeMapTextureArray;
 /* DimensionTraits forward declaration is not needed */
 
 class Extension;
+
+#ifndef MAGNUM_TARGET_GLES2
+class Fence;
+#endif
+
 class Framebuffer;
 
 template<UnsignedInt> class Image;
@@ -392,6 +402,7 @@ typedef ImageWrapper<2> ImageWrapper2D;
 typedef ImageWrapper<3> ImageWrapper3D;
 
 class Mesh;
+class MeshBatch;
 
 /* AbstractQuery is not used directly */
 class PrimitiveQuery;
@@ -410,6 +421,7 @@ template<class...> class ResourceManager;
 
 class Sampler;
 class Shader;
+class StreamingBuffer;
 
 template<UnsignedInt> class Texture;
 #ifndef MAGNUM_TARGET_GLES
@@ -0,0 +1,250 @@
+#ifndef Magnum_Math_Algorithms_BatchTransform_h
+#define Magnum_Math_Algorithms_BatchTransform_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function Magnum::Math::Algorithms::transformPoints(), Magnum::Math::Algorithms::transformVectors(), Magnum::Math::Algorithms::transformNormals(), Magnum::Math::Algorithms::multiply()
+ */
+
+#include "Math/Matrix4.h"
+
+namespace Magnum { namespace Math { namespace Algorithms {
+
+/**
+@brief Transform array of points
+@param matrix       Transformation matrix
+@param points       Points to transform
+@param[out] out     Where to put the transformed points
+@param count        Point count
+
+Same as calling Matrix4::transformPoint() on each point, @p out can be the
+same array as @p points. The @ref Magnum::Float "Float" overload is built
+with SIMD instructions if enabled (see @ref Math-simd), which process four
+points at once with the same operations as the scalar variant, so the results
+are the same.
+@see transformVectors(), transformNormals(), MeshTools::transformPointsInPlace()
+*/
+template<class T> void transformPoints(const Matrix4<T>& matrix, const Vector3<T>* points, Vector3<T>* out, std::size_t count) {
+    for(std::size_t i = 0; i != count; ++i)
+        out[i] = matrix.transformPoint(points[i]);
+}
+
+/** @overload */
+void transformPoints(const Matrix4<Float>& matrix, const Vector3<Float>* points, Vector3<Float>* out, std::size_t count);
+
+/**
+@brief Transform array of vectors
+@param matrix       Transformation matrix
+@param vectors      Vectors to transform
+@param[out] out     Where to put the transformed vectors
+@param count        Vector count
+
+Same as calling Matrix4::transformVector() on each vector, @p out can be the
+same array as @p vectors. See transformPoints() for more information.
+@see transformNormals(), MeshTools::transformVectorsInPlace()
+*/
+template<class T> void transformVectors(const Matrix4<T>& matrix, const Vector3<T>* vectors, Vector3<T>* out, std::size_t count) {
+    for(std::size_t i = 0; i != count; ++i)
+        out[i] = matrix.transformVector(vectors[i]);
+}
+
+/** @overload */
+void transformVectors(const Matrix4<Float>& matrix, const Vector3<Float>* vectors, Vector3<Float>* out, std::size_t count);
+
+/**
+@brief Transform array of normals
+@param matrix       Transformation matrix
+@param normals      Normals to transform
+@param[out] out     Where to put the transformed normals
+@param count        Normal count
+
+Unlike transformVectors() the normals are transformed with inverse transpose
+of upper-left 3x3 part of the matrix, so they stay perpendicular to the
+surface also with non-uniform scaling, and are normalized afterwards. The
+normal matrix is computed only once for the whole array. @p out can be the
+same array as @p normals. See transformPoints() for more information.
+@see MeshTools::transformNormalsInPlace()
+*/
+template<class T> void transformNormals(const Matrix4<T>& matrix, const Vector3<T>* normals, Vector3<T>* out, std::size_t count) {
+    const Matrix<3, T> normalMatrix = matrix.rotationScaling().inverted().transposed();
+    for(std::size_t i = 0; i != count; ++i)
+        out[i] = (normalMatrix*normals[i]).normalized();
+}
+
+/** @overload */
+void transformNormals(const Matrix4<Float>& matrix, const Vector3<Float>* normals, Vector3<Float>* out, std::size_t count);
+
+/**
+@brief Multiply two arrays of matrices
+@param a            Left operands
+@param b            Right operands
+@param[out] out     Where to put the products
+@param count        Matrix count
+
+Computes @f$ \boldsymbol{O}_i = \boldsymbol{A}_i \boldsymbol{B}_i @f$ for
+all @p count matrices. @p out can be the same array as @p a or @p b. The
+@ref Magnum::Float "Float" overload is built with SIMD instructions if
+enabled (see @ref Math-simd), the results are the same as with plain matrix
+multiplication.
+*/
+template<class T> void multiply(const Matrix4<T>* a, const Matrix4<T>* b, Matrix4<T>* out, std::size_t count) {
+    for(std::size_t i = 0; i != count; ++i)
+        out[i] = a[i]*b[i];
+}
+
+/** @overload */
+void multiply(const Matrix4<Float>* a, const Matrix4<Float>* b, Matrix4<Float>* out, std::size_t count);
+
+/**
+@brief Multiply array of matrices with one matrix
+@param a            Left operand
+@param b            Right operands
+@param[out] out     Where to put the products
+@param count        Matrix count
+
+Computes @f$ \boldsymbol{O}_i = \boldsymbol{A} \boldsymbol{B}_i @f$ for
+all @p count matrices, e.g. for applying camera matrix to absolute
+transformations of many objects. @p out can be the same array as @p b. See
+multiply(const Matrix4<T>*, const Matrix4<T>*, Matrix4<T>*, std::size_t) for
+more information.
+*/
+template<class T> void multiply(const Matrix4<T>& a, const Matrix4<T>* b, Matrix4<T>* out, std::size_t count) {
+    for(std::size_t i = 0; i != count; ++i)
+        out[i] = a*b[i];
+}
+
+/** @overload */
+void multiply(const Matrix4<Float>& a, const Matrix4<Float>* b, Matrix4<Float>* out, std::size_t count);
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+#ifdef MAGNUM_MATH_SIMD
+namespace Implementation {
+    static_assert(sizeof(Vector3<Float>) == 3*sizeof(Float) && sizeof(Matrix4<Float>) == 16*sizeof(Float),
+        "Math::Algorithms: unexpected layout of Vector3 or Matrix4");
+
+    /* Four vectors at a time, the rest is done with the scalar code */
+    template<class Function> inline std::size_t simdTransformVectors(const Vector3<Float>* vectors, Vector3<Float>* out, std::size_t count, Function function) {
+        std::size_t i = 0;
+        for(; i + 4 <= count; i += 4) {
+            Math::Implementation::Simd4::Type x, y, z;
+            Math::Implementation::simdLoadVector3x4(vectors[i].data(), x, y, z);
+            function(x, y, z);
+            Math::Implementation::simdStoreVector3x4(out[i].data(), x, y, z);
+        }
+        return i;
+    }
+}
+
+inline void transformPoints(const Matrix4<Float>& matrix, const Vector3<Float>* points, Vector3<Float>* out, std::size_t count) {
+    typedef Math::Implementation::Simd4 S;
+    const S::Type c0[] = {S::splat(matrix[0][0]), S::splat(matrix[0][1]), S::splat(matrix[0][2])};
+    const S::Type c1[] = {S::splat(matrix[1][0]), S::splat(matrix[1][1]), S::splat(matrix[1][2])};
+    const S::Type c2[] = {S::splat(matrix[2][0]), S::splat(matrix[2][1]), S::splat(matrix[2][2])};
+    const S::Type c3[] = {S::splat(matrix[3][0]), S::splat(matrix[3][1]), S::splat(matrix[3][2])};
+
+    const std::size_t done = Implementation::simdTransformVectors(points, out, count, [&](S::Type& x, S::Type& y, S::Type& z) {
+        const S::Type ox = S::add(S::add(S::add(S::mul(c0[0], x), S::mul(c1[0], y)), S::mul(c2[0], z)), c3[0]);
+        const S::Type oy = S::add(S::add(S::add(S::mul(c0[1], x), S::mul(c1[1], y)), S::mul(c2[1], z)), c3[1]);
+        const S::Type oz = S::add(S::add(S::add(S::mul(c0[2], x), S::mul(c1[2], y)), S::mul(c2[2], z)), c3[2]);
+        x = ox;
+        y = oy;
+        z = oz;
+    });
+    transformPoints<Float>(matrix, points + done, out + done, count - done);
+}
+
+inline void transformVectors(const Matrix4<Float>& matrix, const Vector3<Float>* vectors, Vector3<Float>* out, std::size_t count) {
+    typedef Math::Implementation::Simd4 S;
+    const S::Type c0[] = {S::splat(matrix[0][0]), S::splat(matrix[0][1]), S::splat(matrix[0][2])};
+    const S::Type c1[] = {S::splat(matrix[1][0]), S::splat(matrix[1][1]), S::splat(matrix[1][2])};
+    const S::Type c2[] = {S::splat(matrix[2][0]), S::splat(matrix[2][1]), S::splat(matrix[2][2])};
+
+    const std::size_t done = Implementation::simdTransformVectors(vectors, out, count, [&](S::Type& x, S::Type& y, S::Type& z) {
+        const S::Type ox = S::add(S::add(S::mul(c0[0], x), S::mul(c1[0], y)), S::mul(c2[0], z));
+        const S::Type oy = S::add(S::add(S::mul(c0[1], x), S::mul(c1[1], y)), S::mul(c2[1], z));
+        const S::Type oz = S::add(S::add(S::mul(c0[2], x), S::mul(c1[2], y)), S::mul(c2[2], z));
+        x = ox;
+        y = oy;
+        z = oz;
+    });
+    transformVectors<Float>(matrix, vectors + done, out + done, count - done);
+}
+
+inline void transformNormals(const Matrix4<Float>& matrix, const Vector3<Float>* normals, Vector3<Float>* out, std::size_t count) {
+    typedef Math::Implementation::Simd4 S;
+    const Matrix<3, Float> normalMatrix = matrix.rotationScaling().inverted().transposed();
+    const S::Type c0[] = {S::splat(normalMatrix[0][0]), S::splat(normalMatrix[0][1]), S::splat(normalMatrix[0][2])};
+    const S::Type c1[] = {S::splat(normalMatrix[1][0]), S::splat(normalMatrix[1][1]), S::splat(normalMatrix[1][2])};
+    const S::Type c2[] = {S::splat(normalMatrix[2][0]), S::splat(normalMatrix[2][1]), S::splat(normalMatrix[2][2])};
+    const S::Type one = S::splat(1.0f);
+
+    const std::size_t done = Implementation::simdTransformVectors(normals, out, count, [&](S::Type& x, S::Type& y, S::Type& z) {
+        const S::Type ox = S::add(S::add(S::mul(c0[0], x), S::mul(c1[0], y)), S::mul(c2[0], z));
+        const S::Type oy = S::add(S::add(S::mul(c0[1], x), S::mul(c1[1], y)), S::mul(c2[1], z));
+        const S::Type oz = S::add(S::add(S::mul(c0[2], x), S::mul(c1[2], y)), S::mul(c2[2], z));
+        const S::Type lengthInverted = S::div(one, S::sqrt(S::add(S::add(S::mul(ox, ox), S::mul(oy, oy)), S::mul(oz, oz))));
+        x = S::mul(ox, lengthInverted);
+        y = S::mul(oy, lengthInverted);
+        z = S::mul(oz, lengthInverted);
+    });
+    for(std::size_t i = done; i != count; ++i)
+        out[i] = (normalMatrix*normals[i]).normalized();
+}
+
+inline void multiply(const Matrix4<Float>* a, const Matrix4<Float>* b, Matrix4<Float>* out, std::size_t count) {
+    for(std::size_t i = 0; i != count; ++i)
+        Math::Implementation::simdMultiplyMatrix<4>(a[i].data(), b[i].data(), out[i].data());
+}
+
+inline void multiply(const Matrix4<Float>& a, const Matrix4<Float>* b, Matrix4<Float>* out, std::size_t count) {
+    for(std::size_t i = 0; i != count; ++i)
+        Math::Implementation::simdMultiplyMatrix<4>(a.data(), b[i].data(), out[i].data());
+}
+#else
+inline void transformPoints(const Matrix4<Float>& matrix, const Vector3<Float>* points, Vector3<Float>* out, std::size_t count) {
+    transformPoints<Float>(matrix, points, out, count);
+}
+
+inline void transformVectors(const Matrix4<Float>& matrix, const Vector3<Float>* vectors, Vector3<Float>* out, std::size_t count) {
+    transformVectors<Float>(matrix, vectors, out, count);
+}
+
+inline void transformNormals(const Matrix4<Float>& matrix, const Vector3<Float>* normals, Vector3<Float>* out, std::size_t count) {
+    transformNormals<Float>(matrix, normals, out, count);
+}
+
+inline void multiply(const Matrix4<Float>* a, const Matrix4<Float>* b, Matrix4<Float>* out, std::size_t count) {
+    multiply<Float>(a, b, out, count);
+}
+
+inline void multiply(const Matrix4<Float>& a, const Matrix4<Float>* b, Matrix4<Float>* out, std::size_t count) {
+    multiply<Float>(a, b, out, count);
+}
+#endif
+#endif
+
+}}}
+
+#endif
@@ -0,0 +1,137 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+#include <TestSuite/Tester.h>
+#include <Utility/Debug.h>
+
+#include "Math/Algorithms/BatchTransform.h"
+#include "Test/Benchmark.h"
+
+namespace Magnum { namespace Math { namespace Algorithms { namespace Test {
+
+using Magnum::Test::measure;
+
+class BatchTransformBenchmark: public Corrade::TestSuite::Tester {
+    public:
+        BatchTransformBenchmark();
+
+        void transformPoints();
+        void transformNormals();
+        void multiply();
+};
+
+typedef Math::Deg<Float> Deg;
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Matrix4<Float> Matrix4;
+
+namespace {
+
+constexpr std::size_t Count = 100000;
+constexpr std::size_t Repeats = 100;
+
+std::vector<Vector3> randomVectors(std::size_t count, UnsignedInt seed) {
+    std::vector<Vector3> data(count);
+    for(Vector3& v: data) for(std::size_t i = 0; i != 3; ++i) {
+        seed = seed*1103515245u + 12345u;
+        v[i] = Float((seed >> 8) % 10001)/100.0f - 50.0f;
+    }
+    return data;
+}
+
+const Matrix4 transformation = Matrix4::translation({1.0f, -2.0f, 3.5f})*
+    Matrix4::rotation(Deg(35.0f), Vector3(1.0f, 2.0f, -0.5f).normalized())*
+    Matrix4::scaling({2.0f, 0.5f, 1.5f});
+
+void print(const char* what, double scalar, double batched) {
+    Corrade::Utility::Debug() << Count << what;
+    Corrade::Utility::Debug() << "  per element:" << Count/scalar/1000000.0 << "M/s";
+    Corrade::Utility::Debug() << "  batched:" << Count/batched/1000000.0 << "M/s";
+}
+
+}
+
+BatchTransformBenchmark::BatchTransformBenchmark() {
+    addTests({&BatchTransformBenchmark::transformPoints,
+              &BatchTransformBenchmark::transformNormals,
+              &BatchTransformBenchmark::multiply});
+}
+
+void BatchTransformBenchmark::transformPoints() {
+    const std::vector<Vector3> points = randomVectors(Count, 1);
+    std::vector<Vector3> expected(Count), out(Count);
+
+    const double scalar = measure<std::ratio<1>>([&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            expected[i] = transformation.transformPoint(points[i]);
+    }, Repeats);
+    const double batched = measure<std::ratio<1>>([&]() {
+        Algorithms::transformPoints(transformation, points.data(), out.data(), Count);
+    }, Repeats);
+
+    print("points:", scalar, batched);
+    CORRADE_COMPARE(out, expected);
+}
+
+void BatchTransformBenchmark::transformNormals() {
+    const std::vector<Vector3> normals = randomVectors(Count, 2);
+    std::vector<Vector3> expected(Count), out(Count);
+
+    const double scalar = measure<std::ratio<1>>([&]() {
+        const Matrix<3, Float> normalMatrix = transformation.rotationScaling().inverted().transposed();
+        for(std::size_t i = 0; i != Count; ++i)
+            expected[i] = (normalMatrix*normals[i]).normalized();
+    }, Repeats);
+    const double batched = measure<std::ratio<1>>([&]() {
+        Algorithms::transformNormals(transformation, normals.data(), out.data(), Count);
+    }, Repeats);
+
+    print("normals:", scalar, batched);
+    CORRADE_COMPARE(out, expected);
+}
+
+void BatchTransformBenchmark::multiply() {
+    const std::vector<Vector3> translations = randomVectors(Count, 3);
+    std::vector<Matrix4> a(Count), b(Count);
+    for(std::size_t i = 0; i != Count; ++i) {
+        a[i] = Matrix4::translation(translations[i])*Matrix4::rotationX(Deg(Float(i % 360)));
+        b[i] = Matrix4::rotationY(Deg(Float(i % 180)))*Matrix4::scaling(translations[Count - i - 1]);
+    }
+    std::vector<Matrix4> expected(Count), out(Count);
+
+    const double scalar = measure<std::ratio<1>>([&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            expected[i] = a[i]*b[i];
+    }, Repeats);
+    const double batched = measure<std::ratio<1>>([&]() {
+        Algorithms::multiply(a.data(), b.data(), out.data(), Count);
+    }, Repeats);
+
+    print("matrix products:", scalar, batched);
+    CORRADE_COMPARE(out, expected);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::BatchTransformBenchmark)
@@ -0,0 +1,150 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+#include <TestSuite/Tester.h>
+
+#include "Math/Algorithms/BatchTransform.h"
+
+namespace Magnum { namespace Math { namespace Algorithms { namespace Test {
+
+class BatchTransformTest: public Corrade::TestSuite::Tester {
+    public:
+        BatchTransformTest();
+
+        void transformPoints();
+        void transformVectors();
+        void transformNormals();
+        void transformInPlace();
+        void multiply();
+        void multiplyBroadcast();
+};
+
+typedef Math::Deg<Float> Deg;
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Matrix4<Float> Matrix4;
+
+namespace {
+
+/* Eleven vectors, so the four-at-a-time code path and the remainder are both
+   tested */
+std::vector<Vector3> vectors() {
+    std::vector<Vector3> data;
+    for(Int i = 0; i != 11; ++i)
+        data.push_back(Vector3(1.5f*i - 4.0f, 0.25f*i + 1.0f, 3.0f - 0.75f*i));
+    return data;
+}
+
+const Matrix4 transformation = Matrix4::translation({1.0f, -2.0f, 3.5f})*
+    Matrix4::rotation(Deg(35.0f), Vector3(1.0f, 2.0f, -0.5f).normalized())*
+    Matrix4::scaling({2.0f, 0.5f, 1.5f});
+
+}
+
+BatchTransformTest::BatchTransformTest() {
+    addTests({&BatchTransformTest::transformPoints,
+              &BatchTransformTest::transformVectors,
+              &BatchTransformTest::transformNormals,
+              &BatchTransformTest::transformInPlace,
+              &BatchTransformTest::multiply,
+              &BatchTransformTest::multiplyBroadcast});
+}
+
+void BatchTransformTest::transformPoints() {
+    const std::vector<Vector3> points = vectors();
+    std::vector<Vector3> out(points.size());
+    Algorithms::transformPoints(transformation, points.data(), out.data(), points.size());
+
+    for(std::size_t i = 0; i != points.size(); ++i)
+        CORRADE_COMPARE(out[i], transformation.transformPoint(points[i]));
+}
+
+void BatchTransformTest::transformVectors() {
+    const std::vector<Vector3> data = vectors();
+    std::vector<Vector3> out(data.size());
+    Algorithms::transformVectors(transformation, data.data(), out.data(), data.size());
+
+    for(std::size_t i = 0; i != data.size(); ++i)
+        CORRADE_COMPARE(out[i], transformation.transformVector(data[i]));
+}
+
+void BatchTransformTest::transformNormals() {
+    const std::vector<Vector3> normals = vectors();
+    std::vector<Vector3> out(normals.size());
+    Algorithms::transformNormals(transformation, normals.data(), out.data(), normals.size());
+
+    /* The normals must stay perpendicular to transformed tangents */
+    const Vector3 a = Vector3::cross(normals[1], Vector3::xAxis());
+    const Vector3 b = Vector3::cross(normals[1], Vector3::yAxis());
+    CORRADE_COMPARE(Vector3::dot(out[1], transformation.transformVector(a)), 0.0f);
+    CORRADE_COMPARE(Vector3::dot(out[1], transformation.transformVector(b)), 0.0f);
+
+    const Matrix<3, Float> normalMatrix = transformation.rotationScaling().inverted().transposed();
+    for(std::size_t i = 0; i != normals.size(); ++i) {
+        CORRADE_VERIFY(out[i].isNormalized());
+        CORRADE_COMPARE(out[i], (normalMatrix*normals[i]).normalized());
+    }
+}
+
+void BatchTransformTest::transformInPlace() {
+    const std::vector<Vector3> points = vectors();
+    std::vector<Vector3> out(points);
+    Algorithms::transformPoints(transformation, out.data(), out.data(), out.size());
+
+    for(std::size_t i = 0; i != points.size(); ++i)
+        CORRADE_COMPARE(out[i], transformation.transformPoint(points[i]));
+}
+
+void BatchTransformTest::multiply() {
+    std::vector<Matrix4> a, b;
+    for(Int i = 0; i != 5; ++i) {
+        a.push_back(Matrix4::rotationX(Deg(15.0f*i))*Matrix4::translation({1.0f, Float(i), 0.5f}));
+        b.push_back(Matrix4::scaling({1.0f, 2.0f, Float(i)})*Matrix4::rotationZ(Deg(-20.0f*i)));
+    }
+
+    std::vector<Matrix4> out(a.size());
+    Algorithms::multiply(a.data(), b.data(), out.data(), a.size());
+    for(std::size_t i = 0; i != a.size(); ++i)
+        CORRADE_COMPARE(out[i], a[i]*b[i]);
+
+    /* Output aliasing one of the inputs */
+    std::vector<Matrix4> inPlace(b);
+    Algorithms::multiply(a.data(), inPlace.data(), inPlace.data(), a.size());
+    CORRADE_COMPARE(inPlace, out);
+}
+
+void BatchTransformTest::multiplyBroadcast() {
+    std::vector<Matrix4> b;
+    for(Int i = 0; i != 5; ++i)
+        b.push_back(Matrix4::translation({Float(i), 1.0f, -2.0f})*Matrix4::rotationY(Deg(10.0f*i)));
+
+    std::vector<Matrix4> out(b.size());
+    Algorithms::multiply(transformation, b.data(), out.data(), b.size());
+    for(std::size_t i = 0; i != b.size(); ++i)
+        CORRADE_COMPARE(out[i], transformation*b[i]);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::BatchTransformTest)
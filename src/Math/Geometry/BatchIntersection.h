@@ -0,0 +1,402 @@
+#ifndef Magnum_Math_Geometry_BatchIntersection_h
+#define Magnum_Math_Geometry_BatchIntersection_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class Magnum::Math::Geometry::BatchIntersection
+ */
+
+#include <algorithm>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#ifdef __AVX__
+#include <immintrin.h>
+#endif
+
+#include "Math/Vector4.h"
+
+namespace Magnum { namespace Math { namespace Geometry {
+
+/**
+@brief Batched intersection tests
+
+Tests many primitives at once, useful e.g. for frustum culling, picking or
+broadphase collision detection. Unlike functions in Intersection, which work
+with one pair of primitives at a time, the primitives are passed as structure
+of arrays (i.e. separate arrays of X, Y and Z coordinates, radii etc.) and the
+results are stored in a bitmask. Bit `i%32` of `i/32`-th item of the result
+array is set if `i`-th primitive passed the test, see resultSize() and
+result().
+
+The planes are specified as Vector4 with normal in first three components and
+distance in the last, point **p** lies inside the plane if @f$
+\boldsymbol n \cdot \boldsymbol p + d \ge 0 @f$. The normals don't need to be
+normalized for box and point tests, but they need to be normalized for sphere
+tests.
+
+@section BatchIntersection-simd SIMD optimizations
+
+The functions are templated for any floating-point type. For @ref Float,
+non-template overloads are provided, which process four primitives at once
+using SSE2 instructions, or eight at once using AVX, if the code is compiled
+with them enabled (e.g. using `-msse2` or `-mavx` flags). Otherwise they fall
+back to the generic implementation. There are no alignment requirements on
+the arrays.
+*/
+class BatchIntersection {
+    public:
+        BatchIntersection() = delete;
+
+        /**
+         * @brief Size of result array for given primitive count
+         *
+         * Count of 32-bit items needed to store one bit for each primitive.
+         */
+        constexpr static std::size_t resultSize(std::size_t count) {
+            return (count + 31)/32;
+        }
+
+        /**
+         * @brief Whether given primitive passed the test
+         * @param results   Result array
+         * @param i         Primitive index
+         */
+        static bool result(const UnsignedInt* results, std::size_t i) {
+            return (results[i/32] >> (i%32)) & 1;
+        }
+
+        /**
+         * @brief Spheres inside or intersecting set of planes
+         * @param x, y, z       Sphere center coordinates
+         * @param radii         Sphere radii
+         * @param count         Sphere count
+         * @param planes        Normalized planes
+         * @param planeCount    Plane count
+         * @param[out] results  Result array of resultSize() items
+         *
+         * Bit is set for spheres which are not completely outside of any of
+         * the planes, i.e. potentially visible spheres if the planes are
+         * frustum planes: @f[
+         *      \boldsymbol n_j \cdot \boldsymbol c_i + d_j \ge -r_i ~~~ \forall j
+         * @f]
+         */
+        template<class T> static void spheresPlanes(const T* x, const T* y, const T* z, const T* radii, std::size_t count, const Vector4<T>* planes, std::size_t planeCount, UnsignedInt* results);
+
+        /** @overload */
+        static void spheresPlanes(const Float* x, const Float* y, const Float* z, const Float* radii, std::size_t count, const Vector4<Float>* planes, std::size_t planeCount, UnsignedInt* results);
+
+        /**
+         * @brief Axis-aligned boxes inside or intersecting set of planes
+         * @param minX, minY, minZ  Minimal box coordinates
+         * @param maxX, maxY, maxZ  Maximal box coordinates
+         * @param count         Box count
+         * @param planes        Planes
+         * @param planeCount    Plane count
+         * @param[out] results  Result array of resultSize() items
+         *
+         * Bit is set for boxes which are not completely outside of any of the
+         * planes. For each plane, the box corner furthest in the direction of
+         * plane normal is tested. Note that boxes lying near frustum corners
+         * outside of it can be reported as intersecting.
+         */
+        template<class T> static void boxesPlanes(const T* minX, const T* minY, const T* minZ, const T* maxX, const T* maxY, const T* maxZ, std::size_t count, const Vector4<T>* planes, std::size_t planeCount, UnsignedInt* results);
+
+        /** @overload */
+        static void boxesPlanes(const Float* minX, const Float* minY, const Float* minZ, const Float* maxX, const Float* maxY, const Float* maxZ, std::size_t count, const Vector4<Float>* planes, std::size_t planeCount, UnsignedInt* results);
+
+        /**
+         * @brief Ray intersecting axis-aligned boxes
+         * @param origin        Ray origin
+         * @param direction     Ray direction
+         * @param minX, minY, minZ  Minimal box coordinates
+         * @param maxX, maxY, maxZ  Maximal box coordinates
+         * @param count         Box count
+         * @param[out] results  Result array of resultSize() items
+         *
+         * Bit is set for boxes intersected by ray `origin + t*direction` for
+         * @f$ t \ge 0 @f$, including boxes containing the origin. Uses slab
+         * test, zero direction components are handled as long as the origin
+         * doesn't lie exactly on the box boundary in that axis.
+         */
+        template<class T> static void rayBoxes(const Vector3<T>& origin, const Vector3<T>& direction, const T* minX, const T* minY, const T* minZ, const T* maxX, const T* maxY, const T* maxZ, std::size_t count, UnsignedInt* results);
+
+        /** @overload */
+        static void rayBoxes(const Vector3<Float>& origin, const Vector3<Float>& direction, const Float* minX, const Float* minY, const Float* minZ, const Float* maxX, const Float* maxY, const Float* maxZ, std::size_t count, UnsignedInt* results);
+
+        /**
+         * @brief Point inside spheres
+         * @param point         Point
+         * @param x, y, z       Sphere center coordinates
+         * @param radii         Sphere radii
+         * @param count         Sphere count
+         * @param[out] results  Result array of resultSize() items
+         *
+         * Bit is set for spheres containing the point, including the
+         * boundary.
+         */
+        template<class T> static void pointSpheres(const Vector3<T>& point, const T* x, const T* y, const T* z, const T* radii, std::size_t count, UnsignedInt* results);
+
+        /** @overload */
+        static void pointSpheres(const Vector3<Float>& point, const Float* x, const Float* y, const Float* z, const Float* radii, std::size_t count, UnsignedInt* results);
+
+    private:
+        static void clear(std::size_t count, UnsignedInt* results) {
+            std::fill_n(results, resultSize(count), 0);
+        }
+
+        static void set(std::size_t i, UnsignedInt* results) {
+            results[i/32] |= 1u << (i%32);
+        }
+
+        /* Store mask of `width` results starting at `i`, which is multiple of
+           `width` */
+        static void setMask(std::size_t i, UnsignedInt mask, UnsignedInt* results) {
+            results[i/32] |= mask << (i%32);
+        }
+
+        template<class T> static bool spherePlanes(T x, T y, T z, T radius, const Vector4<T>* planes, std::size_t planeCount) {
+            for(std::size_t j = 0; j != planeCount; ++j)
+                if(planes[j].x()*x + planes[j].y()*y + planes[j].z()*z + planes[j].w() < -radius) return false;
+            return true;
+        }
+
+        template<class T> static bool boxPlanes(T minX, T minY, T minZ, T maxX, T maxY, T maxZ, const Vector4<T>* planes, std::size_t planeCount) {
+            for(std::size_t j = 0; j != planeCount; ++j) {
+                const Vector4<T>& p = planes[j];
+                if(p.x()*(p.x() > T(0) ? maxX : minX) +
+                   p.y()*(p.y() > T(0) ? maxY : minY) +
+                   p.z()*(p.z() > T(0) ? maxZ : minZ) + p.w() < T(0)) return false;
+            }
+            return true;
+        }
+
+        template<class T> static bool rayBox(const Vector3<T>& origin, const Vector3<T>& inverseDirection, T minX, T minY, T minZ, T maxX, T maxY, T maxZ) {
+            const T x1 = (minX - origin.x())*inverseDirection.x();
+            const T x2 = (maxX - origin.x())*inverseDirection.x();
+            const T y1 = (minY - origin.y())*inverseDirection.y();
+            const T y2 = (maxY - origin.y())*inverseDirection.y();
+            const T z1 = (minZ - origin.z())*inverseDirection.z();
+            const T z2 = (maxZ - origin.z())*inverseDirection.z();
+            const T entry = std::max(std::max(std::min(x1, x2), std::min(y1, y2)), std::max(std::min(z1, z2), T(0)));
+            const T exit = std::min(std::min(std::max(x1, x2), std::max(y1, y2)), std::max(z1, z2));
+            return entry <= exit;
+        }
+
+        template<class T> static bool pointSphere(const Vector3<T>& point, T x, T y, T z, T radius) {
+            const T dx = x - point.x();
+            const T dy = y - point.y();
+            const T dz = z - point.z();
+            return dx*dx + dy*dy + dz*dz <= radius*radius;
+        }
+};
+
+template<class T> void BatchIntersection::spheresPlanes(const T* x, const T* y, const T* z, const T* radii, std::size_t count, const Vector4<T>* planes, std::size_t planeCount, UnsignedInt* results) {
+    clear(count, results);
+    for(std::size_t i = 0; i != count; ++i)
+        if(spherePlanes(x[i], y[i], z[i], radii[i], planes, planeCount)) set(i, results);
+}
+
+template<class T> void BatchIntersection::boxesPlanes(const T* minX, const T* minY, const T* minZ, const T* maxX, const T* maxY, const T* maxZ, std::size_t count, const Vector4<T>* planes, std::size_t planeCount, UnsignedInt* results) {
+    clear(count, results);
+    for(std::size_t i = 0; i != count; ++i)
+        if(boxPlanes(minX[i], minY[i], minZ[i], maxX[i], maxY[i], maxZ[i], planes, planeCount)) set(i, results);
+}
+
+template<class T> void BatchIntersection::rayBoxes(const Vector3<T>& origin, const Vector3<T>& direction, const T* minX, const T* minY, const T* minZ, const T* maxX, const T* maxY, const T* maxZ, std::size_t count, UnsignedInt* results) {
+    clear(count, results);
+    const Vector3<T> inverseDirection = T(1)/direction;
+    for(std::size_t i = 0; i != count; ++i)
+        if(rayBox(origin, inverseDirection, minX[i], minY[i], minZ[i], maxX[i], maxY[i], maxZ[i])) set(i, results);
+}
+
+template<class T> void BatchIntersection::pointSpheres(const Vector3<T>& point, const T* x, const T* y, const T* z, const T* radii, std::size_t count, UnsignedInt* results) {
+    clear(count, results);
+    for(std::size_t i = 0; i != count; ++i)
+        if(pointSphere(point, x[i], y[i], z[i], radii[i])) set(i, results);
+}
+
+/* The SIMD loops process as many primitives as possible in full registers,
+   the rest is done using the scalar code. The register width divides 32, so
+   each mask fits into one result item. */
+#if defined(__AVX__)
+namespace Implementation {
+    struct BatchIntersectionSimd {
+        enum: std::size_t { Width = 8 };
+        typedef __m256 Type;
+
+        static Type load(const Float* data) { return _mm256_loadu_ps(data); }
+        static Type set(Float value) { return _mm256_set1_ps(value); }
+        static Type add(Type a, Type b) { return _mm256_add_ps(a, b); }
+        static Type sub(Type a, Type b) { return _mm256_sub_ps(a, b); }
+        static Type mul(Type a, Type b) { return _mm256_mul_ps(a, b); }
+        static Type min(Type a, Type b) { return _mm256_min_ps(a, b); }
+        static Type max(Type a, Type b) { return _mm256_max_ps(a, b); }
+        static Type lessEqual(Type a, Type b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+        static Type greaterEqual(Type a, Type b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+        static Type bitAnd(Type a, Type b) { return _mm256_and_ps(a, b); }
+        static UnsignedInt mask(Type a) { return _mm256_movemask_ps(a); }
+    };
+}
+#elif defined(__SSE2__)
+namespace Implementation {
+    struct BatchIntersectionSimd {
+        enum: std::size_t { Width = 4 };
+        typedef __m128 Type;
+
+        static Type load(const Float* data) { return _mm_loadu_ps(data); }
+        static Type set(Float value) { return _mm_set1_ps(value); }
+        static Type add(Type a, Type b) { return _mm_add_ps(a, b); }
+        static Type sub(Type a, Type b) { return _mm_sub_ps(a, b); }
+        static Type mul(Type a, Type b) { return _mm_mul_ps(a, b); }
+        static Type min(Type a, Type b) { return _mm_min_ps(a, b); }
+        static Type max(Type a, Type b) { return _mm_max_ps(a, b); }
+        static Type lessEqual(Type a, Type b) { return _mm_cmple_ps(a, b); }
+        static Type greaterEqual(Type a, Type b) { return _mm_cmpge_ps(a, b); }
+        static Type bitAnd(Type a, Type b) { return _mm_and_ps(a, b); }
+        static UnsignedInt mask(Type a) { return _mm_movemask_ps(a); }
+    };
+}
+#endif
+
+#if defined(__AVX__) || defined(__SSE2__)
+inline void BatchIntersection::spheresPlanes(const Float* x, const Float* y, const Float* z, const Float* radii, std::size_t count, const Vector4<Float>* planes, std::size_t planeCount, UnsignedInt* results) {
+    typedef Implementation::BatchIntersectionSimd S;
+    clear(count, results);
+
+    std::size_t i = 0;
+    for(; i + S::Width <= count; i += S::Width) {
+        const S::Type vx = S::load(x + i), vy = S::load(y + i), vz = S::load(z + i);
+        const S::Type negativeRadius = S::sub(S::set(0.0f), S::load(radii + i));
+
+        UnsignedInt mask = (1u << S::Width) - 1;
+        for(std::size_t j = 0; j != planeCount && mask; ++j) {
+            const S::Type distance = S::add(S::add(S::add(
+                S::mul(S::set(planes[j].x()), vx),
+                S::mul(S::set(planes[j].y()), vy)),
+                S::mul(S::set(planes[j].z()), vz)),
+                S::set(planes[j].w()));
+            mask &= S::mask(S::greaterEqual(distance, negativeRadius));
+        }
+
+        setMask(i, mask, results);
+    }
+
+    for(; i != count; ++i)
+        if(spherePlanes(x[i], y[i], z[i], radii[i], planes, planeCount)) set(i, results);
+}
+
+inline void BatchIntersection::boxesPlanes(const Float* minX, const Float* minY, const Float* minZ, const Float* maxX, const Float* maxY, const Float* maxZ, std::size_t count, const Vector4<Float>* planes, std::size_t planeCount, UnsignedInt* results) {
+    typedef Implementation::BatchIntersectionSimd S;
+    clear(count, results);
+
+    std::size_t i = 0;
+    for(; i + S::Width <= count; i += S::Width) {
+        UnsignedInt mask = (1u << S::Width) - 1;
+        for(std::size_t j = 0; j != planeCount && mask; ++j) {
+            /* The plane is the same for all boxes, so the corner selection
+               doesn't need any per-box masking */
+            const Vector4<Float>& p = planes[j];
+            const S::Type distance = S::add(S::add(S::add(
+                S::mul(S::set(p.x()), S::load((p.x() > 0.0f ? maxX : minX) + i)),
+                S::mul(S::set(p.y()), S::load((p.y() > 0.0f ? maxY : minY) + i))),
+                S::mul(S::set(p.z()), S::load((p.z() > 0.0f ? maxZ : minZ) + i))),
+                S::set(p.w()));
+            mask &= S::mask(S::greaterEqual(distance, S::set(0.0f)));
+        }
+
+        setMask(i, mask, results);
+    }
+
+    for(; i != count; ++i)
+        if(boxPlanes(minX[i], minY[i], minZ[i], maxX[i], maxY[i], maxZ[i], planes, planeCount)) set(i, results);
+}
+
+inline void BatchIntersection::rayBoxes(const Vector3<Float>& origin, const Vector3<Float>& direction, const Float* minX, const Float* minY, const Float* minZ, const Float* maxX, const Float* maxY, const Float* maxZ, std::size_t count, UnsignedInt* results) {
+    typedef Implementation::BatchIntersectionSimd S;
+    clear(count, results);
+
+    const Vector3<Float> inverseDirection = 1.0f/direction;
+    const S::Type ox = S::set(origin.x()), oy = S::set(origin.y()), oz = S::set(origin.z());
+    const S::Type ix = S::set(inverseDirection.x()), iy = S::set(inverseDirection.y()), iz = S::set(inverseDirection.z());
+
+    std::size_t i = 0;
+    for(; i + S::Width <= count; i += S::Width) {
+        const S::Type x1 = S::mul(S::sub(S::load(minX + i), ox), ix);
+        const S::Type x2 = S::mul(S::sub(S::load(maxX + i), ox), ix);
+        const S::Type y1 = S::mul(S::sub(S::load(minY + i), oy), iy);
+        const S::Type y2 = S::mul(S::sub(S::load(maxY + i), oy), iy);
+        const S::Type z1 = S::mul(S::sub(S::load(minZ + i), oz), iz);
+        const S::Type z2 = S::mul(S::sub(S::load(maxZ + i), oz), iz);
+        const S::Type entry = S::max(S::max(S::min(x1, x2), S::min(y1, y2)), S::max(S::min(z1, z2), S::set(0.0f)));
+        const S::Type exit = S::min(S::min(S::max(x1, x2), S::max(y1, y2)), S::max(z1, z2));
+        setMask(i, S::mask(S::lessEqual(entry, exit)), results);
+    }
+
+    for(; i != count; ++i)
+        if(rayBox(origin, inverseDirection, minX[i], minY[i], minZ[i], maxX[i], maxY[i], maxZ[i])) set(i, results);
+}
+
+inline void BatchIntersection::pointSpheres(const Vector3<Float>& point, const Float* x, const Float* y, const Float* z, const Float* radii, std::size_t count, UnsignedInt* results) {
+    typedef Implementation::BatchIntersectionSimd S;
+    clear(count, results);
+
+    const S::Type px = S::set(point.x()), py = S::set(point.y()), pz = S::set(point.z());
+
+    std::size_t i = 0;
+    for(; i + S::Width <= count; i += S::Width) {
+        const S::Type dx = S::sub(S::load(x + i), px);
+        const S::Type dy = S::sub(S::load(y + i), py);
+        const S::Type dz = S::sub(S::load(z + i), pz);
+        const S::Type r = S::load(radii + i);
+        const S::Type distanceSquared = S::add(S::add(S::mul(dx, dx), S::mul(dy, dy)), S::mul(dz, dz));
+        setMask(i, S::mask(S::lessEqual(distanceSquared, S::mul(r, r))), results);
+    }
+
+    for(; i != count; ++i)
+        if(pointSphere(point, x[i], y[i], z[i], radii[i])) set(i, results);
+}
+#else
+inline void BatchIntersection::spheresPlanes(const Float* x, const Float* y, const Float* z, const Float* radii, std::size_t count, const Vector4<Float>* planes, std::size_t planeCount, UnsignedInt* results) {
+    spheresPlanes<Float>(x, y, z, radii, count, planes, planeCount, results);
+}
+
+inline void BatchIntersection::boxesPlanes(const Float* minX, const Float* minY, const Float* minZ, const Float* maxX, const Float* maxY, const Float* maxZ, std::size_t count, const Vector4<Float>* planes, std::size_t planeCount, UnsignedInt* results) {
+    boxesPlanes<Float>(minX, minY, minZ, maxX, maxY, maxZ, count, planes, planeCount, results);
+}
+
+inline void BatchIntersection::rayBoxes(const Vector3<Float>& origin, const Vector3<Float>& direction, const Float* minX, const Float* minY, const Float* minZ, const Float* maxX, const Float* maxY, const Float* maxZ, std::size_t count, UnsignedInt* results) {
+    rayBoxes<Float>(origin, direction, minX, minY, minZ, maxX, maxY, maxZ, count, results);
+}
+
+inline void BatchIntersection::pointSpheres(const Vector3<Float>& point, const Float* x, const Float* y, const Float* z, const Float* radii, std::size_t count, UnsignedInt* results) {
+    pointSpheres<Float>(point, x, y, z, radii, count, results);
+}
+#endif
+
+}}}
+
+#endif
@@ -158,6 +158,35 @@ class Distance {
          * other values, because it doesn't compute the square root.
          */
         template<class T> static T lineSegmentPointSquared(const Vector3<T>& a, const Vector3<T>& b, const Vector3<T>& point);
+
+        /**
+         * @brief %Distance of two line segments
+         * @param a0        Starting point of first line segment
+         * @param a1        Ending point of first line segment
+         * @param b0        Starting point of second line segment
+         * @param b1        Ending point of second line segment
+         *
+         * Returns distance of closest points of the two line segments.
+         * Degenerate segments are handled as points.
+         * @see lineSegmentLineSegmentSquared()
+         */
+        template<std::size_t size, class T> static T lineSegmentLineSegment(const Vector<size, T>& a0, const Vector<size, T>& a1, const Vector<size, T>& b0, const Vector<size, T>& b1) {
+            return std::sqrt(lineSegmentLineSegmentSquared(a0, a1, b0, b1));
+        }
+
+        /**
+         * @brief %Distance of two line segments, squared
+         *
+         * More efficient than lineSegmentLineSegment() for comparing distance
+         * with other values, because it doesn't compute the square root. The
+         * closest point on the first segment is found by minimizing the
+         * distance of both infinite lines, clamped to the segment and then
+         * the closest point on the second segment is found for it. If that
+         * point lies outside the second segment, it is clamped and the point
+         * on the first segment is recomputed. Source: Christer Ericson, *Real
+         * Time Collision Detection*, section 5.1.9.
+         */
+        template<std::size_t size, class T> static T lineSegmentLineSegmentSquared(const Vector<size, T>& a0, const Vector<size, T>& a1, const Vector<size, T>& b0, const Vector<size, T>& b1);
 };
 
 /** @todoc Remove workaround when Doxygen is sane */
@@ -237,6 +266,62 @@ T Distance::lineSegmentPointSquared(const Vector3<T>& a, const Vector3<T>& b, co
     return Vector3<T>::cross(pointMinusA, pointMinusB).dot()/bDistanceA;
 }
 
+/** @todoc Remove workaround when Doxygen is sane */
+#ifdef DOXYGEN_GENERATING_OUTPUT
+template<std::size_t size, class T> static
+#else
+template<std::size_t size, class T>
+#endif
+T Distance::lineSegmentLineSegmentSquared(const Vector<size, T>& a0, const Vector<size, T>& a1, const Vector<size, T>& b0, const Vector<size, T>& b1) {
+    const Vector<size, T> a1MinusA0 = a1 - a0;
+    const Vector<size, T> b1MinusB0 = b1 - b0;
+    const Vector<size, T> a0MinusB0 = a0 - b0;
+    const T lengthA = a1MinusA0.dot();
+    const T lengthB = b1MinusB0.dot();
+    const T f = Vector<size, T>::dot(b1MinusB0, a0MinusB0);
+
+    /* Both segments are points */
+    if(lengthA <= TypeTraits<T>::epsilon() && lengthB <= TypeTraits<T>::epsilon())
+        return a0MinusB0.dot();
+
+    T s, t;
+
+    /* First segment is a point */
+    if(lengthA <= TypeTraits<T>::epsilon()) {
+        s = T(0);
+        t = Math::clamp(f/lengthB, T(0), T(1));
+
+    } else {
+        const T c = Vector<size, T>::dot(a1MinusA0, a0MinusB0);
+
+        /* Second segment is a point */
+        if(lengthB <= TypeTraits<T>::epsilon()) {
+            t = T(0);
+            s = Math::clamp(-c/lengthA, T(0), T(1));
+
+        } else {
+            /* Closest point of the lines on the first segment, arbitrary point
+               if the segments are parallel */
+            const T b = Vector<size, T>::dot(a1MinusA0, b1MinusB0);
+            const T denominator = lengthA*lengthB - b*b;
+            s = denominator != T(0) ? Math::clamp((b*f - c*lengthB)/denominator, T(0), T(1)) : T(0);
+
+            /* Closest point on the second segment, if outside, clamp it and
+               recompute the point on the first segment */
+            t = (b*s + f)/lengthB;
+            if(t < T(0)) {
+                t = T(0);
+                s = Math::clamp(-c/lengthA, T(0), T(1));
+            } else if(t > T(1)) {
+                t = T(1);
+                s = Math::clamp((b - c)/lengthA, T(0), T(1));
+            }
+        }
+    }
+
+    return (a0 + a1MinusA0*s - b0 - b1MinusB0*t).dot();
+}
+
 }}}
 
 #endif
@@ -0,0 +1,225 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+#include <TestSuite/Tester.h>
+#include <Utility/Debug.h>
+
+#include "Math/Vector4.h"
+#include "Math/Geometry/BatchIntersection.h"
+#include "Test/Benchmark.h"
+
+namespace Magnum { namespace Math { namespace Geometry { namespace Test {
+
+using Magnum::Test::measure;
+
+class BatchIntersectionBenchmark: public Corrade::TestSuite::Tester {
+    public:
+        BatchIntersectionBenchmark();
+
+        void spheresPlanes();
+        void boxesPlanes();
+        void rayBoxes();
+};
+
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector4<Float> Vector4;
+
+namespace {
+
+constexpr std::size_t Count = 100000;
+
+std::vector<Float> randomData(std::size_t count, UnsignedInt seed, Float scale, Float offset) {
+    std::vector<Float> data(count);
+    for(Float& f: data) {
+        seed = seed*1103515245u + 12345u;
+        f = Float((seed >> 8) % 10001)/10000.0f*scale + offset;
+    }
+    return data;
+}
+
+/* Normalized planes of perspective frustum looking down -Z */
+const Vector4 frustumPlanes[] = {
+    { 0.7071f,  0.0f,    -0.7071f,   0.0f},
+    {-0.7071f,  0.0f,    -0.7071f,   0.0f},
+    { 0.0f,     0.7071f, -0.7071f,   0.0f},
+    { 0.0f,    -0.7071f, -0.7071f,   0.0f},
+    { 0.0f,     0.0f,    -1.0f,     -0.1f},
+    { 0.0f,     0.0f,     1.0f,    100.0f}
+};
+
+struct Sphere {
+    Vector3 center;
+    Float radius;
+};
+
+struct Box {
+    Vector3 min, max;
+};
+
+}
+
+BatchIntersectionBenchmark::BatchIntersectionBenchmark() {
+    addTests({&BatchIntersectionBenchmark::spheresPlanes,
+              &BatchIntersectionBenchmark::boxesPlanes,
+              &BatchIntersectionBenchmark::rayBoxes});
+}
+
+void BatchIntersectionBenchmark::spheresPlanes() {
+    const std::vector<Float> x = randomData(Count, 1, 200.0f, -100.0f),
+        y = randomData(Count, 2, 200.0f, -100.0f),
+        z = randomData(Count, 3, 100.0f, -100.0f),
+        radii = randomData(Count, 4, 2.0f, 0.1f);
+    std::vector<Sphere> spheres(Count);
+    for(std::size_t i = 0; i != Count; ++i)
+        spheres[i] = {{x[i], y[i], z[i]}, radii[i]};
+
+    /* Straightforward loop over array of structures */
+    std::vector<bool> expected(Count);
+    const double scalar = measure([&]() {
+        for(std::size_t i = 0; i != Count; ++i) {
+            bool visible = true;
+            for(const Vector4& plane: frustumPlanes)
+                if(Vector3::dot(plane.xyz(), spheres[i].center) + plane.w() < -spheres[i].radius) {
+                    visible = false;
+                    break;
+                }
+            expected[i] = visible;
+        }
+    }, 100);
+
+    std::vector<UnsignedInt> results(BatchIntersection::resultSize(Count));
+    const double batched = measure([&]() {
+        BatchIntersection::spheresPlanes(x.data(), y.data(), z.data(), radii.data(), Count, frustumPlanes, 6, results.data());
+    }, 100);
+
+    Corrade::Utility::Debug() << Count << "spheres vs. frustum:";
+    Corrade::Utility::Debug() << "  scalar:" << scalar << "ms";
+    Corrade::Utility::Debug() << "  batched:" << batched << "ms";
+
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(BatchIntersection::result(results.data(), i), bool(expected[i]));
+}
+
+void BatchIntersectionBenchmark::boxesPlanes() {
+    const std::vector<Float> minX = randomData(Count, 1, 200.0f, -100.0f),
+        minY = randomData(Count, 2, 200.0f, -100.0f),
+        minZ = randomData(Count, 3, 100.0f, -100.0f),
+        size = randomData(Count, 4, 4.0f, 0.1f);
+    std::vector<Float> maxX(Count), maxY(Count), maxZ(Count);
+    std::vector<Box> boxes(Count);
+    for(std::size_t i = 0; i != Count; ++i) {
+        maxX[i] = minX[i] + size[i];
+        maxY[i] = minY[i] + size[i];
+        maxZ[i] = minZ[i] + size[i];
+        boxes[i] = {{minX[i], minY[i], minZ[i]}, {maxX[i], maxY[i], maxZ[i]}};
+    }
+
+    /* Positive vertex of each box against each plane */
+    std::vector<bool> expected(Count);
+    const double scalar = measure([&]() {
+        for(std::size_t i = 0; i != Count; ++i) {
+            bool visible = true;
+            for(const Vector4& plane: frustumPlanes) {
+                const Vector3 positive(plane.x() >= 0.0f ? boxes[i].max.x() : boxes[i].min.x(),
+                                       plane.y() >= 0.0f ? boxes[i].max.y() : boxes[i].min.y(),
+                                       plane.z() >= 0.0f ? boxes[i].max.z() : boxes[i].min.z());
+                if(Vector3::dot(plane.xyz(), positive) + plane.w() < 0.0f) {
+                    visible = false;
+                    break;
+                }
+            }
+            expected[i] = visible;
+        }
+    }, 100);
+
+    std::vector<UnsignedInt> results(BatchIntersection::resultSize(Count));
+    const double batched = measure([&]() {
+        BatchIntersection::boxesPlanes(minX.data(), minY.data(), minZ.data(), maxX.data(), maxY.data(), maxZ.data(), Count, frustumPlanes, 6, results.data());
+    }, 100);
+
+    Corrade::Utility::Debug() << Count << "boxes vs. frustum:";
+    Corrade::Utility::Debug() << "  scalar:" << scalar << "ms";
+    Corrade::Utility::Debug() << "  batched:" << batched << "ms";
+
+    /* Rounding differences are possible for boxes touching the planes, so
+       only the counts are compared */
+    std::size_t expectedCount = 0, actualCount = 0;
+    for(std::size_t i = 0; i != Count; ++i) {
+        if(expected[i]) ++expectedCount;
+        if(BatchIntersection::result(results.data(), i)) ++actualCount;
+    }
+    CORRADE_COMPARE(actualCount, expectedCount);
+}
+
+void BatchIntersectionBenchmark::rayBoxes() {
+    const std::vector<Float> minX = randomData(Count, 1, 200.0f, -100.0f),
+        minY = randomData(Count, 2, 200.0f, -100.0f),
+        minZ = randomData(Count, 3, 200.0f, -100.0f),
+        size = randomData(Count, 4, 10.0f, 0.1f);
+    std::vector<Float> maxX(Count), maxY(Count), maxZ(Count);
+    std::vector<Box> boxes(Count);
+    for(std::size_t i = 0; i != Count; ++i) {
+        maxX[i] = minX[i] + size[i];
+        maxY[i] = minY[i] + size[i];
+        maxZ[i] = minZ[i] + size[i];
+        boxes[i] = {{minX[i], minY[i], minZ[i]}, {maxX[i], maxY[i], maxZ[i]}};
+    }
+
+    const Vector3 origin(1.0f, 2.0f, 3.0f);
+    const Vector3 direction = Vector3(0.3f, -0.2f, 1.0f).normalized();
+
+    /* Slab test, one box at a time */
+    std::vector<bool> expected(Count);
+    const double scalar = measure([&]() {
+        const Vector3 inverseDirection = 1.0f/direction;
+        for(std::size_t i = 0; i != Count; ++i) {
+            const Vector3 a = (boxes[i].min - origin)*inverseDirection;
+            const Vector3 b = (boxes[i].max - origin)*inverseDirection;
+            const Float entry = std::max(std::max(std::min(a.x(), b.x()), std::min(a.y(), b.y())), std::min(a.z(), b.z()));
+            const Float exit = std::min(std::min(std::max(a.x(), b.x()), std::max(a.y(), b.y())), std::max(a.z(), b.z()));
+            expected[i] = entry <= exit && exit >= 0.0f;
+        }
+    }, 100);
+
+    std::vector<UnsignedInt> results(BatchIntersection::resultSize(Count));
+    const double batched = measure([&]() {
+        BatchIntersection::rayBoxes(origin, direction, minX.data(), minY.data(), minZ.data(), maxX.data(), maxY.data(), maxZ.data(), Count, results.data());
+    }, 100);
+
+    Corrade::Utility::Debug() << Count << "ray vs. boxes:";
+    Corrade::Utility::Debug() << "  scalar:" << scalar << "ms";
+    Corrade::Utility::Debug() << "  batched:" << batched << "ms";
+
+    std::size_t expectedCount = 0, actualCount = 0;
+    for(std::size_t i = 0; i != Count; ++i) {
+        if(expected[i]) ++expectedCount;
+        if(BatchIntersection::result(results.data(), i)) ++actualCount;
+    }
+    CORRADE_COMPARE(actualCount, expectedCount);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Geometry::Test::BatchIntersectionBenchmark)
@@ -0,0 +1,233 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include <TestSuite/Tester.h>
+
+#include "Math/Geometry/BatchIntersection.h"
+
+namespace Magnum { namespace Math { namespace Geometry { namespace Test {
+
+class BatchIntersectionTest: public Corrade::TestSuite::Tester {
+    public:
+        BatchIntersectionTest();
+
+        void resultSize();
+        void spheresPlanes();
+        void boxesPlanes();
+        void rayBoxes();
+        void pointSpheres();
+        void simdConsistency();
+};
+
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector4<Float> Vector4;
+
+namespace {
+
+/* Unit cube [-1, 1] as six planes */
+const Vector4 cubePlanes[] = {
+    { 1.0f,  0.0f,  0.0f, 1.0f},
+    {-1.0f,  0.0f,  0.0f, 1.0f},
+    { 0.0f,  1.0f,  0.0f, 1.0f},
+    { 0.0f, -1.0f,  0.0f, 1.0f},
+    { 0.0f,  0.0f,  1.0f, 1.0f},
+    { 0.0f,  0.0f, -1.0f, 1.0f}
+};
+
+/* Deterministic pseudorandom numbers in range [-10, 10] */
+std::vector<Float> randomData(std::size_t count, UnsignedInt seed) {
+    std::vector<Float> data(count);
+    for(Float& f: data) {
+        seed = seed*1103515245u + 12345u;
+        f = Float((seed >> 8) % 20001)/1000.0f - 10.0f;
+    }
+    return data;
+}
+
+}
+
+BatchIntersectionTest::BatchIntersectionTest() {
+    addTests({&BatchIntersectionTest::resultSize,
+              &BatchIntersectionTest::spheresPlanes,
+              &BatchIntersectionTest::boxesPlanes,
+              &BatchIntersectionTest::rayBoxes,
+              &BatchIntersectionTest::pointSpheres,
+              &BatchIntersectionTest::simdConsistency});
+}
+
+void BatchIntersectionTest::resultSize() {
+    CORRADE_COMPARE(BatchIntersection::resultSize(0), 0);
+    CORRADE_COMPARE(BatchIntersection::resultSize(1), 1);
+    CORRADE_COMPARE(BatchIntersection::resultSize(32), 1);
+    CORRADE_COMPARE(BatchIntersection::resultSize(33), 2);
+
+    const UnsignedInt results[] = {0x80000001u, 0x2u};
+    CORRADE_VERIFY(BatchIntersection::result(results, 0));
+    CORRADE_VERIFY(!BatchIntersection::result(results, 1));
+    CORRADE_VERIFY(BatchIntersection::result(results, 31));
+    CORRADE_VERIFY(!BatchIntersection::result(results, 32));
+    CORRADE_VERIFY(BatchIntersection::result(results, 33));
+}
+
+void BatchIntersectionTest::spheresPlanes() {
+    /* Eleven spheres, so both the vectorized and the remaining part is
+       tested. Every third is outside. */
+    std::vector<Float> x, y, z, radii;
+    for(std::size_t i = 0; i != 11; ++i) {
+        x.push_back(i % 3 == 2 ? 3.0f : 0.5f);
+        y.push_back(i % 2 ? 1.5f : 0.0f);
+        z.push_back(0.0f);
+        radii.push_back(i % 2 ? 0.6f : 1.0f);
+    }
+
+    UnsignedInt results[1] = {0xffffffffu};
+    BatchIntersection::spheresPlanes(x.data(), y.data(), z.data(), radii.data(), x.size(), cubePlanes, 6, results);
+    for(std::size_t i = 0; i != 11; ++i)
+        CORRADE_COMPARE(BatchIntersection::result(results, i), i % 3 != 2);
+
+    /* Unused bits are cleared */
+    CORRADE_COMPARE(results[0] >> 11, 0);
+
+    /* Generic implementation */
+    const std::vector<Double> xd(x.begin(), x.end()), yd(y.begin(), y.end()), zd(z.begin(), z.end()), radiid(radii.begin(), radii.end());
+    const Math::Vector4<Double> planesd[] = {{1.0, 0.0, 0.0, 1.0}, {-1.0, 0.0, 0.0, 1.0}};
+    BatchIntersection::spheresPlanes(xd.data(), yd.data(), zd.data(), radiid.data(), xd.size(), planesd, 2, results);
+    for(std::size_t i = 0; i != 11; ++i)
+        CORRADE_COMPARE(BatchIntersection::result(results, i), i % 3 != 2);
+}
+
+void BatchIntersectionTest::boxesPlanes() {
+    const Float minX[] = {-0.5f, 1.5f, 0.9f, -3.0f, -2.0f},
+                minY[] = {-0.5f, 0.0f, 0.9f, -3.0f, -2.0f},
+                minZ[] = {-0.5f, 0.0f, 0.9f, -3.0f,  1.1f},
+                maxX[] = { 0.5f, 2.0f, 2.0f,  3.0f,  2.0f},
+                maxY[] = { 0.5f, 1.0f, 2.0f,  3.0f,  2.0f},
+                maxZ[] = { 0.5f, 1.0f, 2.0f,  3.0f,  2.0f};
+
+    UnsignedInt results[1];
+    BatchIntersection::boxesPlanes(minX, minY, minZ, maxX, maxY, maxZ, 5, cubePlanes, 6, results);
+
+    /* Inside, outside, touching corner, containing the cube, outside */
+    CORRADE_VERIFY(BatchIntersection::result(results, 0));
+    CORRADE_VERIFY(!BatchIntersection::result(results, 1));
+    CORRADE_VERIFY(BatchIntersection::result(results, 2));
+    CORRADE_VERIFY(BatchIntersection::result(results, 3));
+    CORRADE_VERIFY(!BatchIntersection::result(results, 4));
+}
+
+void BatchIntersectionTest::rayBoxes() {
+    const Float minX[] = {-1.0f, -1.0f, -1.0f, 4.0f, -1.0f},
+                minY[] = {-1.0f,  2.0f, -1.0f, 0.0f, -1.0f},
+                minZ[] = { 4.0f,  4.0f, -6.0f, 4.0f, -1.0f},
+                maxX[] = { 1.0f,  1.0f,  1.0f, 5.0f,  1.0f},
+                maxY[] = { 1.0f,  3.0f,  1.0f, 1.0f,  1.0f},
+                maxZ[] = { 6.0f,  6.0f, -4.0f, 5.0f,  1.0f};
+
+    /* Ray going along Z axis with direction having zero components */
+    UnsignedInt results[1];
+    BatchIntersection::rayBoxes(Vector3(0.0f, 0.5f, 0.0f), Vector3::zAxis(), minX, minY, minZ, maxX, maxY, maxZ, 5, results);
+
+    /* In front, beside, behind the origin, beside, containing the origin */
+    CORRADE_VERIFY(BatchIntersection::result(results, 0));
+    CORRADE_VERIFY(!BatchIntersection::result(results, 1));
+    CORRADE_VERIFY(!BatchIntersection::result(results, 2));
+    CORRADE_VERIFY(!BatchIntersection::result(results, 3));
+    CORRADE_VERIFY(BatchIntersection::result(results, 4));
+
+    /* Diagonal ray */
+    BatchIntersection::rayBoxes(Vector3(0.0f, 0.5f, 0.0f), Vector3(1.0f, 0.0f, 1.0f), minX, minY, minZ, maxX, maxY, maxZ, 5, results);
+    CORRADE_VERIFY(!BatchIntersection::result(results, 0));
+    CORRADE_VERIFY(BatchIntersection::result(results, 3));
+    CORRADE_VERIFY(BatchIntersection::result(results, 4));
+}
+
+void BatchIntersectionTest::pointSpheres() {
+    std::vector<Float> x, y, z, radii;
+    for(std::size_t i = 0; i != 19; ++i) {
+        x.push_back(Float(i));
+        y.push_back(1.0f);
+        z.push_back(0.0f);
+        radii.push_back(1.0f);
+    }
+
+    /* Touching sphere 2, inside sphere 3, touching sphere 4 */
+    UnsignedInt results[1];
+    BatchIntersection::pointSpheres(Vector3(3.0f, 1.0f, 0.0f), x.data(), y.data(), z.data(), radii.data(), x.size(), results);
+    CORRADE_COMPARE(results[0], 0x1cu);
+
+    BatchIntersection::pointSpheres(Vector3(17.5f, 1.0f, 0.5f), x.data(), y.data(), z.data(), radii.data(), x.size(), results);
+    CORRADE_COMPARE(results[0], (1u << 17)|(1u << 18));
+}
+
+void BatchIntersectionTest::simdConsistency() {
+    /* The SIMD implementation should give the same results as the generic
+       one on arbitrary data, including the remaining part */
+    const std::size_t count = 1003;
+    const std::vector<Float> x = randomData(count, 1), y = randomData(count, 2), z = randomData(count, 3);
+    std::vector<Float> radii = randomData(count, 4), width = randomData(count, 5);
+    for(Float& r: radii) r = std::abs(r)/4.0f;
+    for(Float& w: width) w = std::abs(w)/2.0f;
+    std::vector<Float> maxX(count), maxY(count), maxZ(count);
+    for(std::size_t i = 0; i != count; ++i) {
+        maxX[i] = x[i] + width[i];
+        maxY[i] = y[i] + width[i];
+        maxZ[i] = z[i] + width[i];
+    }
+
+    const Vector4 planes[] = {
+        Vector4( 0.6f, 0.8f, 0.0f, 2.0f),
+        Vector4(-0.6f, 0.0f, 0.8f, 4.0f),
+        Vector4( 0.0f, 0.0f, -1.0f, 3.0f)
+    };
+
+    std::vector<UnsignedInt> expected(BatchIntersection::resultSize(count)), actual(BatchIntersection::resultSize(count));
+
+    BatchIntersection::spheresPlanes<Float>(x.data(), y.data(), z.data(), radii.data(), count, planes, 3, expected.data());
+    BatchIntersection::spheresPlanes(x.data(), y.data(), z.data(), radii.data(), count, planes, 3, actual.data());
+    CORRADE_VERIFY(actual == expected);
+
+    /* Not all bits are the same */
+    CORRADE_VERIFY(std::count(expected.begin(), expected.end(), 0u) != Int(expected.size()));
+    CORRADE_VERIFY(std::count(expected.begin(), expected.end(), 0xffffffffu) != Int(expected.size()));
+
+    BatchIntersection::boxesPlanes<Float>(x.data(), y.data(), z.data(), maxX.data(), maxY.data(), maxZ.data(), count, planes, 3, expected.data());
+    BatchIntersection::boxesPlanes(x.data(), y.data(), z.data(), maxX.data(), maxY.data(), maxZ.data(), count, planes, 3, actual.data());
+    CORRADE_VERIFY(actual == expected);
+
+    const Vector3 origin(0.5f, -0.3f, 0.1f), direction(1.0f, 2.0f, -0.5f);
+    BatchIntersection::rayBoxes<Float>(origin, direction, x.data(), y.data(), z.data(), maxX.data(), maxY.data(), maxZ.data(), count, expected.data());
+    BatchIntersection::rayBoxes(origin, direction, x.data(), y.data(), z.data(), maxX.data(), maxY.data(), maxZ.data(), count, actual.data());
+    CORRADE_VERIFY(actual == expected);
+
+    BatchIntersection::pointSpheres<Float>(origin, x.data(), y.data(), z.data(), radii.data(), count, expected.data());
+    BatchIntersection::pointSpheres(origin, x.data(), y.data(), z.data(), radii.data(), count, actual.data());
+    CORRADE_VERIFY(actual == expected);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Geometry::Test::BatchIntersectionTest)
@@ -38,6 +38,8 @@ class DistanceTest: public Corrade::TestSuite::Tester {
         void linePoint3D();
         void lineSegmentPoint2D();
         void lineSegmentPoint3D();
+        void lineSegmentLineSegment2D();
+        void lineSegmentLineSegment3D();
 };
 
 typedef Math::Vector2<Float> Vector2;
@@ -48,7 +50,9 @@ DistanceTest::DistanceTest() {
     addTests({&DistanceTest::linePoint2D,
               &DistanceTest::linePoint3D,
               &DistanceTest::lineSegmentPoint2D,
-              &DistanceTest::lineSegmentPoint3D});
+              &DistanceTest::lineSegmentPoint3D,
+              &DistanceTest::lineSegmentLineSegment2D,
+              &DistanceTest::lineSegmentLineSegment3D});
 }
 
 void DistanceTest::linePoint2D() {
@@ -157,6 +161,52 @@ void DistanceTest::lineSegmentPoint3D() {
                     Constants::sqrt2());
 }
 
+void DistanceTest::lineSegmentLineSegment2D() {
+    Vector2 a(0.0f);
+    Vector2 b(1.0f);
+
+    /* Intersecting segments */
+    CORRADE_COMPARE(Distance::lineSegmentLineSegment(a, b, Vector2(1.0f, 0.0f), Vector2(0.0f, 1.0f)),
+                    0.0f);
+
+    /* Parallel segments */
+    CORRADE_COMPARE(Distance::lineSegmentLineSegment(a, b, Vector2(1.0f, 0.0f), Vector2(2.0f, 1.0f)),
+                    Constants::sqrt2()/2);
+
+    /* Lines intersect, but not the segments, closest to B */
+    CORRADE_COMPARE(Distance::lineSegmentLineSegmentSquared(a, b, Vector2(3.0f, 0.0f), Vector2(2.0f, 1.0f)),
+                    1.0f);
+
+    /* Collinear disjoint segments */
+    CORRADE_COMPARE(Distance::lineSegmentLineSegment(a, b, Vector2(2.0f), Vector2(3.0f)),
+                    Constants::sqrt2());
+
+    /* Degenerate segments */
+    CORRADE_COMPARE(Distance::lineSegmentLineSegment(a, a, Vector2(1.0f, 0.0f), Vector2(1.0f, 0.0f)),
+                    1.0f);
+    CORRADE_COMPARE(Distance::lineSegmentLineSegment(a, b, Vector2(1.0f, 0.0f), Vector2(1.0f, 0.0f)),
+                    Constants::sqrt2()/2);
+    CORRADE_COMPARE(Distance::lineSegmentLineSegment(Vector2(1.0f, 0.0f), Vector2(1.0f, 0.0f), a, b),
+                    Constants::sqrt2()/2);
+}
+
+void DistanceTest::lineSegmentLineSegment3D() {
+    Vector3 a(0.0f);
+    Vector3 b(1.0f, 0.0f, 0.0f);
+
+    /* Skew segments */
+    CORRADE_COMPARE(Distance::lineSegmentLineSegment(a, b, Vector3(0.5f, -1.0f, 1.0f), Vector3(0.5f, 1.0f, 1.0f)),
+                    1.0f);
+
+    /* Skew segments, closest points at the end */
+    CORRADE_COMPARE(Distance::lineSegmentLineSegmentSquared(a, b, Vector3(2.0f, -1.0f, 1.0f), Vector3(2.0f, 1.0f, 1.0f)),
+                    2.0f);
+
+    /* Intersecting segments */
+    CORRADE_COMPARE(Distance::lineSegmentLineSegment(a, b, Vector3(0.5f, -1.0f, 0.0f), Vector3(0.5f, 1.0f, 0.0f)),
+                    0.0f);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Geometry::Test::DistanceTest)
@@ -34,6 +34,7 @@ namespace Magnum { namespace Math {
 
 namespace Implementation {
     template<std::size_t size, class T> class MatrixDeterminant;
+    template<std::size_t size, class T> class MatrixInverse;
 }
 
 /**
@@ -145,8 +146,12 @@ template<std::size_t size, class T> class Matrix: public RectangularMatrix<size,
          * Computed using Cramer's rule: @f[
          *      A^{-1} = \frac{1}{\det(A)} Adj(A)
          * @f]
-         * See invertedOrthogonal(), Matrix3::invertedRigid() and Matrix4::invertedRigid()
-         * which are faster alternatives for particular matrix types.
+         * For 2x2, 3x3 and 4x4 matrices the adjugate and determinant are
+         * computed in closed form from shared 2x2 subdeterminants instead of
+         * recursively expanding the minors. See invertedOrthogonal(),
+         * Matrix3::invertedAffine(), Matrix3::invertedRigid(),
+         * Matrix4::invertedAffine() and Matrix4::invertedRigid() which are
+         * faster alternatives for particular matrix types.
          */
         Matrix<size, T> inverted() const;
 
@@ -266,6 +271,90 @@ template<class T> class MatrixDeterminant<1, T> {
         }
 };
 
+template<std::size_t size, class T> class MatrixInverse {
+    public:
+        Matrix<size, T> operator()(const Matrix<size, T>& m);
+};
+
+template<std::size_t size, class T> Matrix<size, T> MatrixInverse<size, T>::operator()(const Matrix<size, T>& m) {
+    Matrix<size, T> out(Matrix<size, T>::Zero);
+
+    const T determinant = m.determinant();
+
+    for(std::size_t col = 0; col != size; ++col)
+        for(std::size_t row = 0; row != size; ++row)
+            out[col][row] = (((row+col) & 1) ? -1 : 1)*m.ij(row, col).determinant()/determinant;
+
+    return out;
+}
+
+template<class T> class MatrixInverse<2, T> {
+    public:
+        Matrix<2, T> operator()(const Matrix<2, T>& m) {
+            const T determinant = m.determinant();
+            return Matrix<2, T>(Vector<2, T>( m[1][1]/determinant, -m[0][1]/determinant),
+                                Vector<2, T>(-m[1][0]/determinant,  m[0][0]/determinant));
+        }
+};
+
+/* Rows of the inverse are cross products of the columns, divided by the
+   determinant (triple product) */
+template<class T> class MatrixInverse<3, T> {
+    public:
+        Matrix<3, T> operator()(const Matrix<3, T>& m) {
+            const T c00 = m[1][1]*m[2][2] - m[1][2]*m[2][1];
+            const T c01 = m[1][2]*m[2][0] - m[1][0]*m[2][2];
+            const T c02 = m[1][0]*m[2][1] - m[1][1]*m[2][0];
+            const T invertedDeterminant = T(1)/(m[0][0]*c00 + m[0][1]*c01 + m[0][2]*c02);
+
+            return Matrix<3, T>(
+                Vector<3, T>(c00, m[0][2]*m[2][1] - m[0][1]*m[2][2], m[0][1]*m[1][2] - m[0][2]*m[1][1])*invertedDeterminant,
+                Vector<3, T>(c01, m[0][0]*m[2][2] - m[0][2]*m[2][0], m[0][2]*m[1][0] - m[0][0]*m[1][2])*invertedDeterminant,
+                Vector<3, T>(c02, m[0][1]*m[2][0] - m[0][0]*m[2][1], m[0][0]*m[1][1] - m[0][1]*m[1][0])*invertedDeterminant);
+        }
+};
+
+/* Laplace expansion along first two columns, the adjugate is composed from
+   twelve 2x2 subdeterminants shared between its elements */
+template<class T> class MatrixInverse<4, T> {
+    public:
+        Matrix<4, T> operator()(const Matrix<4, T>& m) {
+            const T s0 = m[0][0]*m[1][1] - m[1][0]*m[0][1];
+            const T s1 = m[0][0]*m[1][2] - m[1][0]*m[0][2];
+            const T s2 = m[0][0]*m[1][3] - m[1][0]*m[0][3];
+            const T s3 = m[0][1]*m[1][2] - m[1][1]*m[0][2];
+            const T s4 = m[0][1]*m[1][3] - m[1][1]*m[0][3];
+            const T s5 = m[0][2]*m[1][3] - m[1][2]*m[0][3];
+
+            const T c5 = m[2][2]*m[3][3] - m[3][2]*m[2][3];
+            const T c4 = m[2][1]*m[3][3] - m[3][1]*m[2][3];
+            const T c3 = m[2][1]*m[3][2] - m[3][1]*m[2][2];
+            const T c2 = m[2][0]*m[3][3] - m[3][0]*m[2][3];
+            const T c1 = m[2][0]*m[3][2] - m[3][0]*m[2][2];
+            const T c0 = m[2][0]*m[3][1] - m[3][0]*m[2][1];
+
+            const T invertedDeterminant = T(1)/(s0*c5 - s1*c4 + s2*c3 + s3*c2 - s4*c1 + s5*c0);
+
+            return Matrix<4, T>(
+                Vector<4, T>( m[1][1]*c5 - m[1][2]*c4 + m[1][3]*c3,
+                             -m[0][1]*c5 + m[0][2]*c4 - m[0][3]*c3,
+                              m[3][1]*s5 - m[3][2]*s4 + m[3][3]*s3,
+                             -m[2][1]*s5 + m[2][2]*s4 - m[2][3]*s3)*invertedDeterminant,
+                Vector<4, T>(-m[1][0]*c5 + m[1][2]*c2 - m[1][3]*c1,
+                              m[0][0]*c5 - m[0][2]*c2 + m[0][3]*c1,
+                             -m[3][0]*s5 + m[3][2]*s2 - m[3][3]*s1,
+                              m[2][0]*s5 - m[2][2]*s2 + m[2][3]*s1)*invertedDeterminant,
+                Vector<4, T>( m[1][0]*c4 - m[1][1]*c2 + m[1][3]*c0,
+                             -m[0][0]*c4 + m[0][1]*c2 - m[0][3]*c0,
+                              m[3][0]*s4 - m[3][1]*s2 + m[3][3]*s0,
+                             -m[2][0]*s4 + m[2][1]*s2 - m[2][3]*s0)*invertedDeterminant,
+                Vector<4, T>(-m[1][0]*c3 + m[1][1]*c1 - m[1][2]*c0,
+                              m[0][0]*c3 - m[0][1]*c1 + m[0][2]*c0,
+                             -m[3][0]*s3 + m[3][1]*s1 - m[3][2]*s0,
+                              m[2][0]*s3 - m[2][1]*s1 + m[2][2]*s0)*invertedDeterminant);
+        }
+};
+
 }
 #endif
 
@@ -294,17 +383,19 @@ template<std::size_t size, class T> Matrix<size-1, T> Matrix<size, T>::ij(const
     return out;
 }
 
-template<std::size_t size, class T> Matrix<size, T> Matrix<size, T>::inverted() const {
-    Matrix<size, T> out(Zero);
-
-    const T _determinant = determinant();
-
-    for(std::size_t col = 0; col != size; ++col)
-        for(std::size_t row = 0; row != size; ++row)
-            out[col][row] = (((row+col) & 1) ? -1 : 1)*ij(row, col).determinant()/_determinant;
+template<std::size_t size, class T> inline Matrix<size, T> Matrix<size, T>::inverted() const {
+    return Implementation::MatrixInverse<size, T>()(*this);
+}
 
+#if defined(MAGNUM_MATH_SIMD) && !defined(DOXYGEN_GENERATING_OUTPUT)
+/* SIMD implementation of 4x4 Float matrix inversion, see
+   @ref Math-simd "Math namespace documentation" for details */
+template<> inline Matrix<4, Float> Matrix<4, Float>::inverted() const {
+    Matrix<4, Float> out(Zero);
+    Implementation::simdInvertMatrix(data(), out.data());
     return out;
 }
+#endif
 
 }}
 
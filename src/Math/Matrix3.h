@@ -148,6 +148,17 @@ template<class T> class Matrix3: public Matrix<3, T> {
         /** @brief Copy constructor */
         constexpr Matrix3(const RectangularMatrix<3, 3, T>& other): Matrix<3, T>(other) {}
 
+        /**
+         * @brief Check whether the matrix represents affine transformation
+         *
+         * Affine transformation has no projection, i.e. last row of the
+         * matrix is @f$ (0, 0, 1) @f$.
+         * @see isRigidTransformation(), invertedAffine()
+         */
+        bool isAffineTransformation() const {
+            return row(2) == Vector3<T>(T(0), T(0), T(1));
+        }
+
         /**
          * @brief Check whether the matrix represents rigid transformation
          *
@@ -214,12 +225,28 @@ template<class T> class Matrix3: public Matrix<3, T> {
         Vector2<T>& translation() { return (*this)[2].xy(); }
         constexpr Vector2<T> translation() const { return (*this)[2].xy(); } /**< @overload */
 
+        /**
+         * @brief Inverted affine transformation matrix
+         *
+         * Expects that the matrix represents affine transformation. Only the
+         * upper-left 2x2 part is inverted (in closed form), translation of
+         * the inverse is computed from it: @f[
+         *      \begin{pmatrix} \boldsymbol A & \boldsymbol t \\ \boldsymbol 0^T & 1 \end{pmatrix}^{-1} =
+         *      \begin{pmatrix} \boldsymbol A^{-1} & -\boldsymbol A^{-1} \boldsymbol t \\ \boldsymbol 0^T & 1 \end{pmatrix}
+         * @f]
+         * Significantly faster than the general algorithm in inverted(), if
+         * the transformation is also rigid, invertedRigid() is even faster.
+         * @see isAffineTransformation(), rotationScaling() const,
+         *      translation() const
+         */
+        Matrix3<T> invertedAffine() const;
+
         /**
          * @brief Inverted rigid transformation matrix
          *
          * Expects that the matrix represents rigid transformation.
          * Significantly faster than the general algorithm in inverted().
-         * @see isRigidTransformation(), invertedOrthogonal(),
+         * @see isRigidTransformation(), invertedAffine(), invertedOrthogonal(),
          *      rotationScaling() const, translation() const
          */
         Matrix3<T> invertedRigid() const;
@@ -271,6 +298,14 @@ template<class T> Matrix3<T> Matrix3<T>::rotation(const Rad<T> angle) {
             {   T(0),   T(0), T(1)}};
 }
 
+template<class T> inline Matrix3<T> Matrix3<T>::invertedAffine() const {
+    CORRADE_ASSERT(isAffineTransformation(),
+        "Math::Matrix3::invertedAffine(): the matrix doesn't represent affine transformation", {});
+
+    const Matrix<2, T> inverseRotationScaling = rotationScaling().inverted();
+    return from(inverseRotationScaling, inverseRotationScaling*-translation());
+}
+
 template<class T> inline Matrix3<T> Matrix3<T>::invertedRigid() const {
     CORRADE_ASSERT(isRigidTransformation(),
         "Math::Matrix3::invertedRigid(): the matrix doesn't represent rigid transformation", {});
@@ -211,6 +211,17 @@ template<class T> class Matrix4: public Matrix<4, T> {
         /** @brief Copy constructor */
         constexpr Matrix4(const RectangularMatrix<4, 4, T>& other): Matrix<4, T>(other) {}
 
+        /**
+         * @brief Check whether the matrix represents affine transformation
+         *
+         * Affine transformation has no projection, i.e. last row of the
+         * matrix is @f$ (0, 0, 0, 1) @f$.
+         * @see isRigidTransformation(), invertedAffine()
+         */
+        bool isAffineTransformation() const {
+            return row(3) == Vector4<T>(T(0), T(0), T(0), T(1));
+        }
+
         /**
          * @brief Check whether the matrix represents rigid transformation
          *
@@ -287,12 +298,28 @@ template<class T> class Matrix4: public Matrix<4, T> {
         Vector3<T>& translation() { return (*this)[3].xyz(); }
         constexpr Vector3<T> translation() const { return (*this)[3].xyz(); } /**< @overload */
 
+        /**
+         * @brief Inverted affine transformation matrix
+         *
+         * Expects that the matrix represents affine transformation. Only the
+         * upper-left 3x3 part is inverted (in closed form), translation of
+         * the inverse is computed from it: @f[
+         *      \begin{pmatrix} \boldsymbol A & \boldsymbol t \\ \boldsymbol 0^T & 1 \end{pmatrix}^{-1} =
+         *      \begin{pmatrix} \boldsymbol A^{-1} & -\boldsymbol A^{-1} \boldsymbol t \\ \boldsymbol 0^T & 1 \end{pmatrix}
+         * @f]
+         * Significantly faster than the general algorithm in inverted(), if
+         * the transformation is also rigid, invertedRigid() is even faster.
+         * @see isAffineTransformation(), rotationScaling() const,
+         *      translation() const
+         */
+        Matrix4<T> invertedAffine() const;
+
         /**
          * @brief Inverted rigid transformation matrix
          *
          * Expects that the matrix represents rigid transformation.
          * Significantly faster than the general algorithm in inverted().
-         * @see isRigidTransformation(), invertedOrthogonal(),
+         * @see isRigidTransformation(), invertedAffine(), invertedOrthogonal(),
          *      rotationScaling() const, translation() const
          */
         Matrix4<T> invertedRigid() const;
@@ -429,6 +456,14 @@ template<class T> inline Matrix<3, T> Matrix4<T>::rotation() const {
             (*this)[2].xyz().normalized()};
 }
 
+template<class T> Matrix4<T> Matrix4<T>::invertedAffine() const {
+    CORRADE_ASSERT(isAffineTransformation(),
+        "Math::Matrix4::invertedAffine(): the matrix doesn't represent affine transformation", {});
+
+    const Matrix<3, T> inverseRotationScaling = rotationScaling().inverted();
+    return from(inverseRotationScaling, inverseRotationScaling*-translation());
+}
+
 template<class T> Matrix4<T> Matrix4<T>::invertedRigid() const {
     CORRADE_ASSERT(isRigidTransformation(),
         "Math::Matrix4::invertedRigid(): the matrix doesn't represent rigid transformation", {});
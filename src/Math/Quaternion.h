@@ -551,6 +551,18 @@ template<class T> inline Quaternion<T> Quaternion<T>::operator*(const Quaternion
             _scalar*other._scalar - Vector3<T>::dot(_vector, other._vector)};
 }
 
+#if defined(MAGNUM_MATH_SIMD) && !defined(DOXYGEN_GENERATING_OUTPUT)
+/* SIMD implementation of Float quaternion multiplication, see
+   @ref Math-simd "Math namespace documentation" for details */
+template<> inline Quaternion<Float> Quaternion<Float>::operator*(const Quaternion<Float>& other) const {
+    const Float a[] = {_vector.x(), _vector.y(), _vector.z(), _scalar};
+    const Float b[] = {other._vector.x(), other._vector.y(), other._vector.z(), other._scalar};
+    Float out[4];
+    Implementation::simdMultiplyQuaternion(a, b, out);
+    return {{out[0], out[1], out[2]}, out[3]};
+}
+#endif
+
 template<class T> inline Quaternion<T> Quaternion<T>::invertedNormalized() const {
     CORRADE_ASSERT(isNormalized(), "Math::Quaternion::invertedNormalized(): quaternion must be normalized",
         Quaternion<T>({}, std::numeric_limits<T>::quiet_NaN()));
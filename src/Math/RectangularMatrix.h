@@ -30,6 +30,10 @@
 
 #include "Math/Vector.h"
 
+#ifdef MAGNUM_BUILD_SIMD
+#include "Math/simdImplementation.h"
+#endif
+
 namespace Magnum { namespace Math {
 
 namespace Implementation {
@@ -575,6 +579,28 @@ template<std::size_t cols, std::size_t rows, class T> auto RectangularMatrix<col
     return out;
 }
 
+#if defined(MAGNUM_MATH_SIMD) && !defined(DOXYGEN_GENERATING_OUTPUT)
+/* SIMD implementation of 4x4 Float matrix multiplication, see
+   @ref Math-simd "Math namespace documentation" for details */
+template<> template<> inline RectangularMatrix<4, 4, Float> RectangularMatrix<4, 4, Float>::operator*(const RectangularMatrix<4, 4, Float>& other) const {
+    RectangularMatrix<4, 4, Float> out;
+    Implementation::simdMultiplyMatrix<4>(data(), other.data(), out.data());
+    return out;
+}
+
+template<> template<> inline RectangularMatrix<1, 4, Float> RectangularMatrix<4, 4, Float>::operator*(const RectangularMatrix<1, 4, Float>& other) const {
+    RectangularMatrix<1, 4, Float> out;
+    Implementation::simdMultiplyMatrix<1>(data(), other.data(), out.data());
+    return out;
+}
+
+template<> inline Vector<4, Float> RectangularMatrix<4, 4, Float>::operator*(const Vector<4, Float>& other) const {
+    Vector<4, Float> out;
+    Implementation::simdMultiplyMatrix<1>(data(), other.data(), out.data());
+    return out;
+}
+#endif
+
 }}
 
 namespace Corrade { namespace Utility {
@@ -0,0 +1,153 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+#include <TestSuite/Tester.h>
+#include <Utility/Debug.h>
+
+#include "Math/Matrix4.h"
+#include "Test/Benchmark.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+using Magnum::Test::measure;
+
+class InvertedBenchmark: public Corrade::TestSuite::Tester {
+    public:
+        InvertedBenchmark();
+
+        void affine();
+        void rigid();
+};
+
+typedef Math::Deg<Float> Deg;
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::Vector3<Float> Vector3;
+
+namespace {
+
+constexpr std::size_t Count = 10000;
+constexpr std::size_t Repeats = 100;
+
+Float random(UnsignedInt& seed) {
+    seed = seed*1103515245u + 12345u;
+    return Float((seed >> 8) % 20001)/10000.0f - 1.0f;
+}
+
+/* Rotation and translation, optionally with non-uniform scaling */
+std::vector<Matrix4> randomTransformations(UnsignedInt seed, bool scaling) {
+    std::vector<Matrix4> out(Count);
+    for(Matrix4& m: out) {
+        const Vector3 axis = Vector3(random(seed), random(seed), random(seed) + 2.0f).normalized();
+        m = Matrix4::translation(Vector3(random(seed), random(seed), random(seed)))*
+            Matrix4::rotation(Deg(random(seed)*180.0f), axis);
+        if(scaling) m = m*Matrix4::scaling(Vector3(random(seed), random(seed), random(seed)) + Vector3(1.5f));
+    }
+    return out;
+}
+
+/* Original implementation of Matrix::inverted(), recursively expanding the
+   minors */
+Matrix4 invertedCramer(const Matrix<4, Float>& a) {
+    Matrix<4, Float> out(Matrix<4, Float>::Zero);
+    const Float determinant = a.determinant();
+    for(std::size_t col = 0; col != 4; ++col)
+        for(std::size_t row = 0; row != 4; ++row)
+            out[col][row] = (((row+col) & 1) ? -1 : 1)*a.ij(row, col).determinant()/determinant;
+    return out;
+}
+
+void print(const char* name, double seconds) {
+    Corrade::Utility::Debug() << "  " << name << Count/seconds/1.0e6 << "M/s";
+}
+
+}
+
+InvertedBenchmark::InvertedBenchmark() {
+    addTests({&InvertedBenchmark::affine,
+              &InvertedBenchmark::rigid});
+}
+
+void InvertedBenchmark::affine() {
+    const std::vector<Matrix4> a = randomTransformations(1, true);
+    std::vector<Matrix4> expected(Count), general(Count), affine(Count);
+
+    const double cramer = measure<std::ratio<1>>([&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            expected[i] = invertedCramer(a[i]);
+    }, Repeats);
+    const double inverted = measure<std::ratio<1>>([&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            general[i] = a[i].inverted();
+    }, Repeats);
+    const double invertedAffine = measure<std::ratio<1>>([&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            affine[i] = a[i].invertedAffine();
+    }, Repeats);
+
+    Corrade::Utility::Debug() << Count << "affine transformations:";
+    print("Cramer's rule:", cramer);
+    print("inverted():", inverted);
+    print("invertedAffine():", invertedAffine);
+
+    for(std::size_t i = 0; i != Count; ++i) {
+        CORRADE_COMPARE(general[i], expected[i]);
+        CORRADE_COMPARE(affine[i], expected[i]);
+    }
+}
+
+void InvertedBenchmark::rigid() {
+    const std::vector<Matrix4> a = randomTransformations(2, false);
+    std::vector<Matrix4> expected(Count), affine(Count), rigid(Count);
+
+    const double inverted = measure<std::ratio<1>>([&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            expected[i] = a[i].inverted();
+    }, Repeats);
+    const double invertedAffine = measure<std::ratio<1>>([&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            affine[i] = a[i].invertedAffine();
+    }, Repeats);
+    const double invertedRigid = measure<std::ratio<1>>([&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            rigid[i] = a[i].invertedRigid();
+    }, Repeats);
+
+    Corrade::Utility::Debug() << Count << "rigid transformations:";
+    print("inverted():", inverted);
+    print("invertedAffine():", invertedAffine);
+    print("invertedRigid():", invertedRigid);
+
+    /* The rotations are not exactly orthogonal, so transposing them in
+       invertedRigid() is a bit less precise */
+    for(std::size_t i = 0; i != Count; ++i) {
+        CORRADE_COMPARE(affine[i], expected[i]);
+        for(std::size_t col = 0; col != 4; ++col)
+            CORRADE_VERIFY((rigid[i][col] - expected[i][col]).dot() < 1.0e-10f);
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::InvertedBenchmark)
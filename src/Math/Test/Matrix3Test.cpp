@@ -67,6 +67,7 @@ class Matrix3Test: public Corrade::TestSuite::Tester {
 
         void convert();
 
+        void isAffineTransformation();
         void isRigidTransformation();
 
         void translation();
@@ -78,6 +79,7 @@ class Matrix3Test: public Corrade::TestSuite::Tester {
         void rotationScalingPart();
         void rotationPart();
         void vectorParts();
+        void invertedAffine();
         void invertedRigid();
         void transform();
 
@@ -101,6 +103,7 @@ Matrix3Test::Matrix3Test() {
 
               &Matrix3Test::convert,
 
+              &Matrix3Test::isAffineTransformation,
               &Matrix3Test::isRigidTransformation,
 
               &Matrix3Test::translation,
@@ -112,6 +115,7 @@ Matrix3Test::Matrix3Test() {
               &Matrix3Test::rotationScalingPart,
               &Matrix3Test::rotationPart,
               &Matrix3Test::vectorParts,
+              &Matrix3Test::invertedAffine,
               &Matrix3Test::invertedRigid,
               &Matrix3Test::transform,
 
@@ -203,6 +207,15 @@ void Matrix3Test::convert() {
     CORRADE_VERIFY(!(std::is_convertible<Matrix3, Mat3>::value));
 }
 
+void Matrix3Test::isAffineTransformation() {
+    CORRADE_VERIFY(!Matrix3({1.0f, 0.0f, 0.0f},
+                            {0.0f, 1.0f, 1.0f},
+                            {5.0f, 4.0f, 1.0f}).isAffineTransformation());
+    CORRADE_VERIFY(Matrix3({2.0f, 0.0f, 0.0f},
+                           {0.3f, 1.0f, 0.0f},
+                           {5.0f, 4.0f, 1.0f}).isAffineTransformation());
+}
+
 void Matrix3Test::isRigidTransformation() {
     CORRADE_VERIFY(!Matrix3({1.0f, 0.0f, 0.0f},
                             {0.1f, 1.0f, 0.0f},
@@ -327,6 +340,25 @@ void Matrix3Test::vectorParts() {
     CORRADE_COMPARE(translation, Vector2(-5.0f, 12.0f));
 }
 
+void Matrix3Test::invertedAffine() {
+    Matrix3 actual = Matrix3::rotation(Deg(-74.0f))*
+                     Matrix3::scaling({2.0f, -0.5f})*
+                     Matrix3::translation({2.0f, -3.0f});
+    Matrix3 expected = Matrix3::translation({-2.0f, 3.0f})*
+                       Matrix3::scaling({0.5f, -2.0f})*
+                       Matrix3::rotation(Deg(74.0f));
+
+    std::ostringstream o;
+    Error::setOutput(&o);
+    Matrix3({1.0f, 0.0f, 0.5f},
+            {0.0f, 1.0f, 0.0f},
+            {0.0f, 0.0f, 1.0f}).invertedAffine();
+    CORRADE_COMPARE(o.str(), "Math::Matrix3::invertedAffine(): the matrix doesn't represent affine transformation\n");
+
+    CORRADE_COMPARE(actual.invertedAffine(), expected);
+    CORRADE_COMPARE(actual.invertedAffine(), actual.inverted());
+}
+
 void Matrix3Test::invertedRigid() {
     Matrix3 actual = Matrix3::rotation(Deg(-74.0f))*
                      Matrix3::reflection(Vector2(0.5f, -2.0f).normalized())*
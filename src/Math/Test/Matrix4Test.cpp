@@ -69,6 +69,7 @@ class Matrix4Test: public Corrade::TestSuite::Tester {
 
         void convert();
 
+        void isAffineTransformation();
         void isRigidTransformation();
 
         void translation();
@@ -85,6 +86,7 @@ class Matrix4Test: public Corrade::TestSuite::Tester {
         void rotationScalingPart();
         void rotationPart();
         void vectorParts();
+        void invertedAffine();
         void invertedRigid();
         void transform();
 
@@ -108,6 +110,7 @@ Matrix4Test::Matrix4Test() {
 
               &Matrix4Test::convert,
 
+              &Matrix4Test::isAffineTransformation,
               &Matrix4Test::isRigidTransformation,
 
               &Matrix4Test::translation,
@@ -124,6 +127,7 @@ Matrix4Test::Matrix4Test() {
               &Matrix4Test::rotationScalingPart,
               &Matrix4Test::rotationPart,
               &Matrix4Test::vectorParts,
+              &Matrix4Test::invertedAffine,
               &Matrix4Test::invertedRigid,
               &Matrix4Test::transform,
 
@@ -227,6 +231,17 @@ void Matrix4Test::convert() {
     CORRADE_VERIFY(!(std::is_convertible<Matrix4, Mat4>::value));
 }
 
+void Matrix4Test::isAffineTransformation() {
+    CORRADE_VERIFY(!Matrix4({1.0f, 0.0f, 0.0f, 0.0f},
+                            {0.0f, 1.0f, 0.0f, 0.0f},
+                            {0.0f, 0.0f, 1.0f, -1.0f},
+                            {5.0f, 4.0f, 0.5f, 0.0f}).isAffineTransformation());
+    CORRADE_VERIFY(Matrix4({2.0f, 0.0f, 0.0f, 0.0f},
+                           {0.3f, 1.0f, 0.0f, 0.0f},
+                           {0.0f, 0.1f, 1.0f, 0.0f},
+                           {5.0f, 4.0f, 0.5f, 1.0f}).isAffineTransformation());
+}
+
 void Matrix4Test::isRigidTransformation() {
     CORRADE_VERIFY(!Matrix4({1.0f, 0.0f, 0.0f, 0.0f},
                             {0.0f, 1.0f, 0.0f, 0.0f},
@@ -414,6 +429,23 @@ void Matrix4Test::vectorParts() {
     CORRADE_COMPARE(translation, Vector3(-5.0f, 12.0f, 0.5f));
 }
 
+void Matrix4Test::invertedAffine() {
+    Matrix4 actual = Matrix4::rotation(Deg(-74.0f), Vector3(-1.0f, 0.5f, 2.0f).normalized())*
+                     Matrix4::scaling({2.0f, -0.5f, 3.0f})*
+                     Matrix4::translation({1.0f, 2.0f, -3.0f});
+    Matrix4 expected = Matrix4::translation({-1.0f, -2.0f, 3.0f})*
+                       Matrix4::scaling({0.5f, -2.0f, 1.0f/3.0f})*
+                       Matrix4::rotation(Deg(74.0f), Vector3(-1.0f, 0.5f, 2.0f).normalized());
+
+    std::ostringstream o;
+    Error::setOutput(&o);
+    Matrix4::perspectiveProjection(Deg(35.0f), 1.0f, 0.5f, 100.0f).invertedAffine();
+    CORRADE_COMPARE(o.str(), "Math::Matrix4::invertedAffine(): the matrix doesn't represent affine transformation\n");
+
+    CORRADE_COMPARE(actual.invertedAffine(), expected);
+    CORRADE_COMPARE(actual.invertedAffine(), actual.inverted());
+}
+
 void Matrix4Test::invertedRigid() {
     Matrix4 actual = Matrix4::rotation(Deg(-74.0f), Vector3(-1.0f, 0.5f, 2.0f).normalized())*
                      Matrix4::reflection(Vector3(0.5f, -2.0f, 2.0f).normalized())*
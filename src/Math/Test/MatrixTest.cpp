@@ -73,6 +73,7 @@ class MatrixTest: public Corrade::TestSuite::Tester {
         void ij();
         void determinant();
         void inverted();
+        void invertedClosedForm();
         void invertedOrthogonal();
 
         void debug();
@@ -82,9 +83,11 @@ class MatrixTest: public Corrade::TestSuite::Tester {
 typedef Matrix<4, Float> Matrix4;
 typedef Matrix<4, Int> Matrix4i;
 typedef Matrix<3, Float> Matrix3;
+typedef Matrix<2, Float> Matrix2;
 typedef Vector<4, Float> Vector4;
 typedef Vector<4, Int> Vector4i;
 typedef Vector<3, Float> Vector3;
+typedef Vector<2, Float> Vector2;
 typedef Math::Constants<Float> Constants;
 
 MatrixTest::MatrixTest() {
@@ -102,6 +105,7 @@ MatrixTest::MatrixTest() {
               &MatrixTest::ij,
               &MatrixTest::determinant,
               &MatrixTest::inverted,
+              &MatrixTest::invertedClosedForm,
               &MatrixTest::invertedOrthogonal,
               &MatrixTest::debug,
               &MatrixTest::configuration});
@@ -267,6 +271,39 @@ void MatrixTest::inverted() {
     CORRADE_COMPARE(_inverse*m, Matrix4());
 }
 
+void MatrixTest::invertedClosedForm() {
+    Matrix2 a(Vector2(3.0f, -1.5f),
+              Vector2(2.0f,  4.0f));
+    Matrix3 b(Vector3(3.0f,  5.0f, 8.0f),
+              Vector3(4.0f,  4.0f, 7.0f),
+              Vector3(7.0f, -1.0f, 8.0f));
+
+    /* Inverse of block-diagonal 5x5 matrix, computed using Cramer's rule, is
+       composed of inverses of the blocks */
+    Matrix<5, Float> m(Matrix<5, Float>::Zero);
+    for(std::size_t col = 0; col != 2; ++col)
+        for(std::size_t row = 0; row != 2; ++row)
+            m[col][row] = a[col][row];
+    for(std::size_t col = 0; col != 3; ++col)
+        for(std::size_t row = 0; row != 3; ++row)
+            m[col + 2][row + 2] = b[col][row];
+    Matrix<5, Float> inverse = m.inverted();
+
+    Matrix2 aInverse(Matrix2::Zero);
+    for(std::size_t col = 0; col != 2; ++col)
+        for(std::size_t row = 0; row != 2; ++row)
+            aInverse[col][row] = inverse[col][row];
+    Matrix3 bInverse(Matrix3::Zero);
+    for(std::size_t col = 0; col != 3; ++col)
+        for(std::size_t row = 0; row != 3; ++row)
+            bInverse[col][row] = inverse[col + 2][row + 2];
+
+    CORRADE_COMPARE(a.inverted(), aInverse);
+    CORRADE_COMPARE(a.inverted()*a, Matrix2());
+    CORRADE_COMPARE(b.inverted(), bInverse);
+    CORRADE_COMPARE(b.inverted()*b, Matrix3());
+}
+
 void MatrixTest::invertedOrthogonal() {
     std::ostringstream o;
     Error::setOutput(&o);
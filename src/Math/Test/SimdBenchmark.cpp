@@ -0,0 +1,211 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+#include <TestSuite/Tester.h>
+#include <Utility/Debug.h>
+
+#include "Math/Matrix4.h"
+#include "Math/Quaternion.h"
+#include "Math/simdImplementation.h"
+#include "Test/Benchmark.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+using Magnum::Test::measure;
+
+class SimdBenchmark: public Corrade::TestSuite::Tester {
+    public:
+        SimdBenchmark();
+
+        void multiplyMatrix();
+        void multiplyVector();
+        void invertMatrix();
+        void multiplyQuaternion();
+};
+
+typedef Math::Matrix<4, Float> Matrix4;
+typedef Math::Vector<4, Float> Vector4;
+typedef Math::Quaternion<Float> Quaternion;
+
+namespace {
+
+constexpr std::size_t Count = 10000;
+constexpr std::size_t Repeats = 100;
+
+/* Operations per second */
+double throughput(double milliseconds) {
+    return Count/milliseconds*1000.0;
+}
+
+Float random(UnsignedInt& seed) {
+    seed = seed*1103515245u + 12345u;
+    return Float((seed >> 8) % 20001)/10000.0f - 1.0f;
+}
+
+std::vector<Matrix4> randomMatrices(UnsignedInt seed) {
+    std::vector<Matrix4> out(Count, Matrix4(Matrix4::Zero));
+    for(Matrix4& m: out) {
+        for(std::size_t i = 0; i != 16; ++i)
+            m.data()[i] = random(seed);
+
+        /* Make it well-conditioned */
+        for(std::size_t i = 0; i != 4; ++i)
+            m[i][i] += 4.0f;
+    }
+    return out;
+}
+
+/* Scalar implementations, same as the generic ones */
+Matrix4 multiplyScalar(const Matrix4& a, const Matrix4& b) {
+    Matrix4 out(Matrix4::Zero);
+    for(std::size_t col = 0; col != 4; ++col)
+        for(std::size_t row = 0; row != 4; ++row)
+            for(std::size_t pos = 0; pos != 4; ++pos)
+                out[col][row] += a[pos][row]*b[col][pos];
+    return out;
+}
+
+Vector4 multiplyScalar(const Matrix4& a, const Vector4& b) {
+    Vector4 out;
+    for(std::size_t row = 0; row != 4; ++row)
+        for(std::size_t pos = 0; pos != 4; ++pos)
+            out[row] += a[pos][row]*b[pos];
+    return out;
+}
+
+Matrix4 invertScalar(const Matrix4& a) {
+    Matrix4 out(Matrix4::Zero);
+    const Float determinant = a.determinant();
+    for(std::size_t col = 0; col != 4; ++col)
+        for(std::size_t row = 0; row != 4; ++row)
+            out[col][row] = (((row+col) & 1) ? -1 : 1)*a.ij(row, col).determinant()/determinant;
+    return out;
+}
+
+Quaternion multiplyScalar(const Quaternion& a, const Quaternion& b) {
+    return {a.scalar()*b.vector() + b.scalar()*a.vector() + Vector3<Float>::cross(a.vector(), b.vector()),
+            a.scalar()*b.scalar() - Vector3<Float>::dot(a.vector(), b.vector())};
+}
+
+void print(const char* name, double scalar, double current) {
+    Corrade::Utility::Debug() << name;
+    Corrade::Utility::Debug() << "  scalar:" << throughput(scalar)/1.0e6 << "M/s";
+    #ifdef MAGNUM_MATH_SIMD
+    Corrade::Utility::Debug() << "  SIMD:" << throughput(current)/1.0e6 << "M/s";
+    #else
+    Corrade::Utility::Debug() << "  current (SIMD disabled):" << throughput(current)/1.0e6 << "M/s";
+    #endif
+}
+
+}
+
+SimdBenchmark::SimdBenchmark() {
+    addTests({&SimdBenchmark::multiplyMatrix,
+              &SimdBenchmark::multiplyVector,
+              &SimdBenchmark::invertMatrix,
+              &SimdBenchmark::multiplyQuaternion});
+}
+
+void SimdBenchmark::multiplyMatrix() {
+    const std::vector<Matrix4> a = randomMatrices(1), b = randomMatrices(2);
+    std::vector<Matrix4> expected(Count, Matrix4(Matrix4::Zero)), actual(Count, Matrix4(Matrix4::Zero));
+
+    const double scalar = measure([&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            expected[i] = multiplyScalar(a[i], b[i]);
+    }, Repeats);
+    const double current = measure([&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            actual[i] = a[i]*b[i];
+    }, Repeats);
+    print("4x4 matrix multiplication:", scalar, current);
+
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(actual[i], expected[i]);
+}
+
+void SimdBenchmark::multiplyVector() {
+    const std::vector<Matrix4> a = randomMatrices(3);
+    std::vector<Vector4> b(Count), expected(Count), actual(Count);
+    UnsignedInt seed = 4;
+    for(Vector4& v: b) v = Vector4(random(seed), random(seed), random(seed), 1.0f);
+
+    const double scalar = measure([&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            expected[i] = multiplyScalar(a[i], b[i]);
+    }, Repeats);
+    const double current = measure([&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            actual[i] = a[i]*b[i];
+    }, Repeats);
+    print("4x4 matrix and vector multiplication:", scalar, current);
+
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(actual[i], expected[i]);
+}
+
+void SimdBenchmark::invertMatrix() {
+    const std::vector<Matrix4> a = randomMatrices(5);
+    std::vector<Matrix4> expected(Count, Matrix4(Matrix4::Zero)), actual(Count, Matrix4(Matrix4::Zero));
+
+    const double scalar = measure([&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            expected[i] = invertScalar(a[i]);
+    }, Repeats);
+    const double current = measure([&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            actual[i] = a[i].inverted();
+    }, Repeats);
+    print("4x4 matrix inversion:", scalar, current);
+
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(actual[i], expected[i]);
+}
+
+void SimdBenchmark::multiplyQuaternion() {
+    std::vector<Quaternion> a(Count), b(Count), expected(Count), actual(Count);
+    UnsignedInt seed = 6;
+    for(std::size_t i = 0; i != Count; ++i) {
+        a[i] = Quaternion({random(seed), random(seed), random(seed)}, random(seed));
+        b[i] = Quaternion({random(seed), random(seed), random(seed)}, random(seed));
+    }
+
+    const double scalar = measure([&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            expected[i] = multiplyScalar(a[i], b[i]);
+    }, Repeats);
+    const double current = measure([&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            actual[i] = a[i]*b[i];
+    }, Repeats);
+    print("quaternion multiplication:", scalar, current);
+
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(actual[i], expected[i]);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::SimdBenchmark)
@@ -0,0 +1,212 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cmath>
+#include <limits>
+#include <TestSuite/Tester.h>
+
+#include "Math/Matrix4.h"
+#include "Math/Quaternion.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+class SimdTest: public Corrade::TestSuite::Tester {
+    public:
+        SimdTest();
+
+        void multiplyMatrix();
+        void multiplyVector();
+        void invertMatrix();
+        void invertMatrixSingular();
+        void multiplyQuaternion();
+};
+
+typedef Math::Matrix<4, Float> Matrix4;
+typedef Math::Matrix<4, Double> Matrix4d;
+typedef Math::Matrix4<Float> Transformation;
+typedef Math::Vector<4, Float> Vector4;
+typedef Math::Vector<4, Double> Vector4d;
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Quaternion<Float> Quaternion;
+typedef Math::Quaternion<Double> Quaterniond;
+typedef Math::Deg<Float> Deg;
+
+namespace {
+
+/* Deterministic pseudorandom numbers in range [-1, 1] */
+class Random {
+    public:
+        explicit Random(UnsignedInt seed): seed(seed) {}
+
+        Float operator()() {
+            seed = seed*1103515245u + 12345u;
+            return Float((seed >> 8) % 20001)/10000.0f - 1.0f;
+        }
+
+    private:
+        UnsignedInt seed;
+};
+
+/* Difference between Float result and exact (double) result in ULPs of the
+   given magnitude */
+Double ulps(Float actual, Double expected, Float magnitude) {
+    const Float ulp = std::nextafter(magnitude, std::numeric_limits<Float>::infinity()) - magnitude;
+    return std::abs(Double(actual) - expected)/ulp;
+}
+
+Matrix4 randomMatrix(Random& random) {
+    Matrix4 out(Matrix4::Zero);
+    for(std::size_t col = 0; col != 4; ++col)
+        for(std::size_t row = 0; row != 4; ++row)
+            out[col][row] = random()*10.0f;
+    return out;
+}
+
+Transformation randomTransformation(Random& random) {
+    return Transformation::translation(Vector3(random(), random(), random())*100.0f)*
+        Transformation::rotation(Deg(random()*180.0f), Vector3(random(), random(), random() + 2.0f).normalized())*
+        Transformation::scaling(Vector3(random() + 2.0f, random() + 2.0f, random() + 2.0f));
+}
+
+}
+
+SimdTest::SimdTest() {
+    addTests({&SimdTest::multiplyMatrix,
+              &SimdTest::multiplyVector,
+              &SimdTest::invertMatrix,
+              &SimdTest::invertMatrixSingular,
+              &SimdTest::multiplyQuaternion});
+}
+
+void SimdTest::multiplyMatrix() {
+    /* The products are summed in the same order as in generic implementation,
+       so the results are the same as with plain loops */
+    Random random(1);
+    for(std::size_t i = 0; i != 1000; ++i) {
+        const Matrix4 a = randomMatrix(random);
+        const Matrix4 b = randomMatrix(random);
+        const Matrix4 result = a*b;
+
+        for(std::size_t col = 0; col != 4; ++col) for(std::size_t row = 0; row != 4; ++row) {
+            Float expected = 0.0f;
+            for(std::size_t pos = 0; pos != 4; ++pos)
+                expected += a[pos][row]*b[col][pos];
+            CORRADE_COMPARE(result[col][row], expected);
+        }
+    }
+}
+
+void SimdTest::multiplyVector() {
+    Random random(2);
+    for(std::size_t i = 0; i != 1000; ++i) {
+        const Matrix4 a = randomMatrix(random);
+        const Vector4 b(random(), random(), random(), random());
+        const Vector4 result = a*b;
+
+        for(std::size_t row = 0; row != 4; ++row) {
+            Float expected = 0.0f;
+            for(std::size_t pos = 0; pos != 4; ++pos)
+                expected += a[pos][row]*b[pos];
+            CORRADE_COMPARE(result[row], expected);
+        }
+    }
+
+    /* Typed wrappers end up in the same implementation */
+    const Transformation transformation = Transformation::translation({1.0f, 2.0f, 3.0f});
+    CORRADE_COMPARE(transformation*Math::Vector4<Float>(1.0f, 1.0f, 1.0f, 1.0f), Math::Vector4<Float>(2.0f, 3.0f, 4.0f, 1.0f));
+    CORRADE_COMPARE(transformation.transformPoint({1.0f, 1.0f, 1.0f}), Vector3(2.0f, 3.0f, 4.0f));
+}
+
+void SimdTest::invertMatrix() {
+    /* Compared to exact result, relative to the largest element of it */
+    Random random(3);
+    Double maxError = 0.0;
+    for(std::size_t i = 0; i != 1000; ++i) {
+        const Transformation a = randomTransformation(random);
+        const Matrix4 inverted = a.inverted();
+        const Matrix4d expected = Matrix4d(a).inverted();
+
+        Double magnitude = 0.0;
+        for(std::size_t col = 0; col != 4; ++col) for(std::size_t row = 0; row != 4; ++row)
+            magnitude = std::max(magnitude, std::abs(expected[col][row]));
+
+        for(std::size_t col = 0; col != 4; ++col) for(std::size_t row = 0; row != 4; ++row)
+            maxError = std::max(maxError, ulps(inverted[col][row], expected[col][row], Float(magnitude)));
+    }
+    CORRADE_VERIFY(maxError <= 8.0);
+
+    /* Identity is inverted exactly */
+    CORRADE_COMPARE(Matrix4().inverted(), Matrix4());
+
+    /* Typed wrapper ends up in the same implementation */
+    const Transformation a = Transformation::translation({1.0f, 2.0f, 3.0f})*Transformation::scaling({2.0f, 4.0f, 8.0f});
+    CORRADE_COMPARE(a.inverted(), Transformation::scaling({0.5f, 0.25f, 0.125f})*Transformation::translation({-1.0f, -2.0f, -3.0f}));
+    CORRADE_COMPARE(a.inverted()*a, Transformation());
+}
+
+void SimdTest::invertMatrixSingular() {
+    const Matrix4 a(Vector4(1.0f, 2.0f, 3.0f, 4.0f),
+                    Vector4(2.0f, 4.0f, 6.0f, 8.0f),
+                    Vector4(0.0f, 1.0f, 0.0f, 1.0f),
+                    Vector4(1.0f, 0.0f, 1.0f, 0.0f));
+    CORRADE_COMPARE(a.determinant(), 0.0f);
+
+    /* Same as generic implementation, the division by zero determinant gives
+       non-finite values */
+    const Matrix4 inverted = a.inverted();
+    CORRADE_VERIFY(!std::isfinite(inverted[0][0]) || !std::isfinite(inverted[1][1]));
+}
+
+void SimdTest::multiplyQuaternion() {
+    /* Compared to exact result, relative to the largest product */
+    Random random(4);
+    Double maxError = 0.0;
+    for(std::size_t i = 0; i != 1000; ++i) {
+        const Quaternion a({random(), random(), random()}, random());
+        const Quaternion b({random(), random(), random()}, random());
+        const Quaternion result = a*b;
+        const Quaterniond expected = Quaterniond({a.vector().x(), a.vector().y(), a.vector().z()}, a.scalar())*
+                                     Quaterniond({b.vector().x(), b.vector().y(), b.vector().z()}, b.scalar());
+
+        Float magnitude = 0.0f;
+        for(Float x: {a.vector().x(), a.vector().y(), a.vector().z(), a.scalar()})
+            for(Float y: {b.vector().x(), b.vector().y(), b.vector().z(), b.scalar()})
+                magnitude = std::max(magnitude, std::abs(x*y));
+
+        for(std::size_t j = 0; j != 3; ++j)
+            maxError = std::max(maxError, ulps(result.vector()[j], expected.vector()[j], magnitude));
+        maxError = std::max(maxError, ulps(result.scalar(), expected.scalar(), magnitude));
+    }
+    CORRADE_VERIFY(maxError <= 4.0);
+
+    /* Basic rotation composition */
+    const Quaternion x = Quaternion::rotation(Deg(90.0f), Vector3::xAxis());
+    const Quaternion y = Quaternion::rotation(Deg(90.0f), Vector3::yAxis());
+    CORRADE_COMPARE((x*y).transformVector(Vector3::zAxis()), x.transformVector(y.transformVector(Vector3::zAxis())));
+    CORRADE_COMPARE(x*x.inverted(), Quaternion());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::SimdTest)
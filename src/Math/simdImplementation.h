@@ -0,0 +1,243 @@
+#ifndef Magnum_Math_simdImplementation_h
+#define Magnum_Math_simdImplementation_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cmath>
+#include <cstddef>
+
+#include "Types.h"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define MAGNUM_MATH_SIMD_SSE
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#define MAGNUM_MATH_SIMD_NEON
+#endif
+
+#if defined(MAGNUM_MATH_SIMD_SSE) || defined(MAGNUM_MATH_SIMD_NEON)
+namespace Magnum { namespace Math { namespace Implementation {
+
+/* Four-component Float vector with the few operations needed below. Loads
+   and stores are unaligned, as the math classes don't have any alignment
+   requirements. */
+#ifdef MAGNUM_MATH_SIMD_SSE
+struct Simd4 {
+    typedef __m128 Type;
+
+    static Type load(const Float* data) { return _mm_loadu_ps(data); }
+    static void store(Float* data, Type a) { _mm_storeu_ps(data, a); }
+    static Type set(Float x, Float y, Float z, Float w) { return _mm_setr_ps(x, y, z, w); }
+    static Type splat(Float value) { return _mm_set1_ps(value); }
+    static Float first(Type a) { return _mm_cvtss_f32(a); }
+
+    static Type add(Type a, Type b) { return _mm_add_ps(a, b); }
+    static Type sub(Type a, Type b) { return _mm_sub_ps(a, b); }
+    static Type mul(Type a, Type b) { return _mm_mul_ps(a, b); }
+    static Type div(Type a, Type b) { return _mm_div_ps(a, b); }
+    static Type sqrt(Type a) { return _mm_sqrt_ps(a); }
+
+    /* Components x, y of a and z, w of b */
+    template<int x, int y, int z, int w> static Type shuffle(Type a, Type b) {
+        return _mm_shuffle_ps(a, b, _MM_SHUFFLE(w, z, y, x));
+    }
+};
+#else
+struct Simd4 {
+    typedef float32x4_t Type;
+
+    static Type load(const Float* data) { return vld1q_f32(data); }
+    static void store(Float* data, Type a) { vst1q_f32(data, a); }
+    static Type set(Float x, Float y, Float z, Float w) {
+        const Float data[] = {x, y, z, w};
+        return vld1q_f32(data);
+    }
+    static Type splat(Float value) { return vdupq_n_f32(value); }
+    static Float first(Type a) { return vgetq_lane_f32(a, 0); }
+
+    static Type add(Type a, Type b) { return vaddq_f32(a, b); }
+    static Type sub(Type a, Type b) { return vsubq_f32(a, b); }
+    static Type mul(Type a, Type b) { return vmulq_f32(a, b); }
+    #ifdef __aarch64__
+    static Type div(Type a, Type b) { return vdivq_f32(a, b); }
+    static Type sqrt(Type a) { return vsqrtq_f32(a); }
+    #else
+    /* ARMv7 NEON has only reciprocal estimates, which are not precise
+       enough */
+    static Type div(Type a, Type b) {
+        return set(vgetq_lane_f32(a, 0)/vgetq_lane_f32(b, 0),
+                   vgetq_lane_f32(a, 1)/vgetq_lane_f32(b, 1),
+                   vgetq_lane_f32(a, 2)/vgetq_lane_f32(b, 2),
+                   vgetq_lane_f32(a, 3)/vgetq_lane_f32(b, 3));
+    }
+    static Type sqrt(Type a) {
+        return set(std::sqrt(vgetq_lane_f32(a, 0)), std::sqrt(vgetq_lane_f32(a, 1)),
+                   std::sqrt(vgetq_lane_f32(a, 2)), std::sqrt(vgetq_lane_f32(a, 3)));
+    }
+    #endif
+
+    template<int x, int y, int z, int w> static Type shuffle(Type a, Type b) {
+        Type out = vdupq_n_f32(vgetq_lane_f32(a, x));
+        out = vsetq_lane_f32(vgetq_lane_f32(a, y), out, 1);
+        out = vsetq_lane_f32(vgetq_lane_f32(b, z), out, 2);
+        return vsetq_lane_f32(vgetq_lane_f32(b, w), out, 3);
+    }
+};
+#endif
+
+template<int x, int y, int z, int w> inline Simd4::Type simdSwizzle(Simd4::Type a) {
+    return Simd4::shuffle<x, y, z, w>(a, a);
+}
+
+/* Four consecutive three-component vectors (x0 y0 z0 x1 | y1 z1 x2 y2 |
+   z2 x3 y3 z3) to and from (x0 x1 x2 x3), (y0 y1 y2 y3), (z0 z1 z2 z3) */
+inline void simdLoadVector3x4(const Float* data, Simd4::Type& x, Simd4::Type& y, Simd4::Type& z) {
+    const Simd4::Type a = Simd4::load(data);
+    const Simd4::Type b = Simd4::load(data + 4);
+    const Simd4::Type c = Simd4::load(data + 8);
+    x = Simd4::shuffle<0, 3, 0, 2>(a, Simd4::shuffle<2, 2, 1, 1>(b, c));
+    y = Simd4::shuffle<0, 2, 0, 2>(Simd4::shuffle<1, 1, 0, 0>(a, b), Simd4::shuffle<3, 3, 2, 2>(b, c));
+    z = Simd4::shuffle<0, 2, 0, 2>(Simd4::shuffle<2, 2, 1, 1>(a, b), simdSwizzle<0, 0, 3, 3>(c));
+}
+
+inline void simdStoreVector3x4(Float* data, Simd4::Type x, Simd4::Type y, Simd4::Type z) {
+    Simd4::store(data, Simd4::shuffle<0, 2, 0, 2>(Simd4::shuffle<0, 0, 0, 0>(x, y), Simd4::shuffle<0, 0, 1, 1>(z, x)));
+    Simd4::store(data + 4, Simd4::shuffle<0, 2, 0, 2>(Simd4::shuffle<1, 1, 1, 1>(y, z), Simd4::shuffle<2, 2, 2, 2>(x, y)));
+    Simd4::store(data + 8, Simd4::shuffle<0, 2, 0, 2>(Simd4::shuffle<2, 2, 3, 3>(z, x), Simd4::shuffle<3, 3, 3, 3>(y, z)));
+}
+
+/* Column-major 4x4 matrix multiplication, out = a*b, where b has given count
+   of columns. The products are summed in the same order as in the generic
+   implementation. */
+template<std::size_t cols> void simdMultiplyMatrix(const Float* a, const Float* b, Float* out) {
+    const Simd4::Type a0 = Simd4::load(a);
+    const Simd4::Type a1 = Simd4::load(a + 4);
+    const Simd4::Type a2 = Simd4::load(a + 8);
+    const Simd4::Type a3 = Simd4::load(a + 12);
+
+    for(std::size_t col = 0; col != cols; ++col, b += 4, out += 4) {
+        Simd4::Type column = Simd4::mul(a0, Simd4::splat(b[0]));
+        column = Simd4::add(column, Simd4::mul(a1, Simd4::splat(b[1])));
+        column = Simd4::add(column, Simd4::mul(a2, Simd4::splat(b[2])));
+        column = Simd4::add(column, Simd4::mul(a3, Simd4::splat(b[3])));
+        Simd4::store(out, column);
+    }
+}
+
+/* Quaternion multiplication, quaternions stored as (x, y, z, w) */
+inline void simdMultiplyQuaternion(const Float* a, const Float* b, Float* out) {
+    const Simd4::Type vb = Simd4::load(b);
+
+    Simd4::Type result = Simd4::mul(Simd4::splat(a[3]), vb);
+    result = Simd4::add(result, Simd4::mul(Simd4::splat(a[0]),
+        Simd4::mul(simdSwizzle<3, 2, 1, 0>(vb), Simd4::set(1.0f, -1.0f, 1.0f, -1.0f))));
+    result = Simd4::add(result, Simd4::mul(Simd4::splat(a[1]),
+        Simd4::mul(simdSwizzle<2, 3, 0, 1>(vb), Simd4::set(1.0f, 1.0f, -1.0f, -1.0f))));
+    result = Simd4::add(result, Simd4::mul(Simd4::splat(a[2]),
+        Simd4::mul(simdSwizzle<1, 0, 3, 2>(vb), Simd4::set(-1.0f, 1.0f, 1.0f, -1.0f))));
+
+    Simd4::store(out, result);
+}
+
+/* 2x2 matrices packed into one vector as (a00, a01, a10, a11), A*B, A#*B
+   and A*B#, where # is adjugate */
+inline Simd4::Type simdMultiply2x2(Simd4::Type a, Simd4::Type b) {
+    return Simd4::add(Simd4::mul(a, simdSwizzle<0, 3, 0, 3>(b)),
+                      Simd4::mul(simdSwizzle<1, 0, 3, 2>(a), simdSwizzle<2, 1, 2, 1>(b)));
+}
+inline Simd4::Type simdAdjugateMultiply2x2(Simd4::Type a, Simd4::Type b) {
+    return Simd4::sub(Simd4::mul(simdSwizzle<3, 3, 0, 0>(a), b),
+                      Simd4::mul(simdSwizzle<1, 1, 2, 2>(a), simdSwizzle<2, 3, 0, 1>(b)));
+}
+inline Simd4::Type simdMultiplyAdjugate2x2(Simd4::Type a, Simd4::Type b) {
+    return Simd4::sub(Simd4::mul(a, simdSwizzle<3, 0, 3, 0>(b)),
+                      Simd4::mul(simdSwizzle<1, 0, 3, 2>(a), simdSwizzle<2, 1, 2, 1>(b)));
+}
+
+/* 4x4 matrix inversion. The matrix is split into 2x2 blocks
+   | A B |
+   | C D |
+   and the inverse is computed from their adjugates and determinants. As
+   inverse of transposed matrix is transposed inverse, it doesn't matter that
+   the columns are treated as rows here. */
+inline void simdInvertMatrix(const Float* m, Float* out) {
+    const Simd4::Type c0 = Simd4::load(m);
+    const Simd4::Type c1 = Simd4::load(m + 4);
+    const Simd4::Type c2 = Simd4::load(m + 8);
+    const Simd4::Type c3 = Simd4::load(m + 12);
+
+    const Simd4::Type a = Simd4::shuffle<0, 1, 0, 1>(c0, c1);
+    const Simd4::Type b = Simd4::shuffle<2, 3, 2, 3>(c0, c1);
+    const Simd4::Type c = Simd4::shuffle<0, 1, 0, 1>(c2, c3);
+    const Simd4::Type d = Simd4::shuffle<2, 3, 2, 3>(c2, c3);
+
+    /* Determinants of all blocks, (|A|, |B|, |C|, |D|) */
+    const Simd4::Type blockDeterminants = Simd4::sub(
+        Simd4::mul(Simd4::shuffle<0, 2, 0, 2>(c0, c2), Simd4::shuffle<1, 3, 1, 3>(c1, c3)),
+        Simd4::mul(Simd4::shuffle<1, 3, 1, 3>(c0, c2), Simd4::shuffle<0, 2, 0, 2>(c1, c3)));
+    const Simd4::Type determinantA = simdSwizzle<0, 0, 0, 0>(blockDeterminants);
+    const Simd4::Type determinantB = simdSwizzle<1, 1, 1, 1>(blockDeterminants);
+    const Simd4::Type determinantC = simdSwizzle<2, 2, 2, 2>(blockDeterminants);
+    const Simd4::Type determinantD = simdSwizzle<3, 3, 3, 3>(blockDeterminants);
+
+    const Simd4::Type adjugateDC = simdAdjugateMultiply2x2(d, c);
+    const Simd4::Type adjugateAB = simdAdjugateMultiply2x2(a, b);
+
+    /* Adjugates of resulting blocks */
+    Simd4::Type x = Simd4::sub(Simd4::mul(determinantD, a), simdMultiply2x2(b, adjugateDC));
+    Simd4::Type w = Simd4::sub(Simd4::mul(determinantA, d), simdMultiply2x2(c, adjugateAB));
+    Simd4::Type y = Simd4::sub(Simd4::mul(determinantB, c), simdMultiplyAdjugate2x2(d, adjugateAB));
+    Simd4::Type z = Simd4::sub(Simd4::mul(determinantC, b), simdMultiplyAdjugate2x2(a, adjugateDC));
+
+    /* |M| = |A||D| + |B||C| - tr((A#B)(D#C)) */
+    Simd4::Type trace = Simd4::mul(adjugateAB, simdSwizzle<0, 2, 1, 3>(adjugateDC));
+    trace = Simd4::add(trace, simdSwizzle<1, 0, 3, 2>(trace));
+    trace = Simd4::add(trace, simdSwizzle<2, 3, 0, 1>(trace));
+    const Float determinant = Simd4::first(Simd4::sub(Simd4::add(
+        Simd4::mul(determinantA, determinantD),
+        Simd4::mul(determinantB, determinantC)), trace));
+
+    const Float inverseDeterminant = 1.0f/determinant;
+    const Simd4::Type scale = Simd4::set(inverseDeterminant, -inverseDeterminant, -inverseDeterminant, inverseDeterminant);
+    x = Simd4::mul(x, scale);
+    y = Simd4::mul(y, scale);
+    z = Simd4::mul(z, scale);
+    w = Simd4::mul(w, scale);
+
+    /* Adjugate the blocks and put them back together */
+    Simd4::store(out, Simd4::shuffle<3, 1, 3, 1>(x, y));
+    Simd4::store(out + 4, Simd4::shuffle<2, 0, 2, 0>(x, y));
+    Simd4::store(out + 8, Simd4::shuffle<3, 1, 3, 1>(z, w));
+    Simd4::store(out + 12, Simd4::shuffle<2, 0, 2, 0>(z, w));
+}
+
+}}}
+
+#ifdef MAGNUM_BUILD_SIMD
+#define MAGNUM_MATH_SIMD
+#endif
+#endif
+
+#endif
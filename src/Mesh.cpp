@@ -60,7 +60,7 @@ std::size_t Mesh::indexSize(IndexType type) {
 
 Mesh::Mesh(Primitive primitive): _primitive(primitive), _vertexCount(0), _indexCount(0)
     #ifndef MAGNUM_TARGET_GLES2
-    , indexStart(0), indexEnd(0)
+    , indexStart(0), indexEnd(0), _instanceCount(1)
     #endif
     , indexOffset(0), indexType(IndexType::UnsignedInt), indexBuffer(nullptr)
 {
@@ -77,7 +77,7 @@ Mesh::~Mesh() {
 
 Mesh::Mesh(Mesh&& other): vao(other.vao), _primitive(other._primitive), _vertexCount(other._vertexCount), _indexCount(other._indexCount)
     #ifndef MAGNUM_TARGET_GLES2
-    , indexStart(other.indexStart), indexEnd(other.indexEnd)
+    , indexStart(other.indexStart), indexEnd(other.indexEnd), _instanceCount(other._instanceCount)
     #endif
     , indexOffset(other.indexOffset), indexType(other.indexType), indexBuffer(other.indexBuffer), attributes(std::move(other.attributes))
     #ifndef MAGNUM_TARGET_GLES2
@@ -100,6 +100,7 @@ Mesh& Mesh::operator=(Mesh&& other) {
     #ifndef MAGNUM_TARGET_GLES2
     indexStart = other.indexStart;
     indexEnd = other.indexEnd;
+    _instanceCount = other._instanceCount;
     #endif
     indexOffset = other.indexOffset;
     indexType = other.indexType;
@@ -134,9 +135,24 @@ Mesh* Mesh::setIndexBuffer(Buffer* buffer, GLintptr offset, IndexType type, Unsi
 void Mesh::draw() {
     /* Nothing to draw */
     if(!_vertexCount && !_indexCount) return;
+    #ifndef MAGNUM_TARGET_GLES2
+    if(!_instanceCount) return;
+    #endif
 
     (this->*bindImplementation)();
 
+    #ifndef MAGNUM_TARGET_GLES2
+    /* Instanced non-indexed mesh */
+    if(_instanceCount != 1 && !_indexCount)
+        glDrawArraysInstanced(static_cast<GLenum>(_primitive), 0, _vertexCount, _instanceCount);
+
+    /* Instanced indexed mesh */
+    else if(_instanceCount != 1)
+        glDrawElementsInstanced(static_cast<GLenum>(_primitive), _indexCount, static_cast<GLenum>(indexType), reinterpret_cast<GLvoid*>(indexOffset), _instanceCount);
+
+    else
+    #endif
+
     /* Non-indexed mesh */
     if(!_indexCount)
         glDrawArrays(static_cast<GLenum>(_primitive), 0, _vertexCount);
@@ -168,6 +184,9 @@ void Mesh::vertexAttribPointer(const Attribute& attribute) {
     glEnableVertexAttribArray(attribute.location);
     attribute.buffer->bind(Buffer::Target::Array);
     glVertexAttribPointer(attribute.location, attribute.size, attribute.type, attribute.normalized, attribute.stride, reinterpret_cast<const GLvoid*>(attribute.offset));
+    #ifndef MAGNUM_TARGET_GLES2
+    if(attribute.divisor) glVertexAttribDivisor(attribute.location, attribute.divisor);
+    #endif
 }
 
 #ifndef MAGNUM_TARGET_GLES2
@@ -175,6 +194,7 @@ void Mesh::vertexAttribPointer(const IntegerAttribute& attribute) {
     glEnableVertexAttribArray(attribute.location);
     attribute.buffer->bind(Buffer::Target::Array);
     glVertexAttribIPointer(attribute.location, attribute.size, attribute.type, attribute.stride, reinterpret_cast<const GLvoid*>(attribute.offset));
+    if(attribute.divisor) glVertexAttribDivisor(attribute.location, attribute.divisor);
 }
 
 #ifndef MAGNUM_TARGET_GLES
@@ -182,6 +202,7 @@ void Mesh::vertexAttribPointer(const LongAttribute& attribute) {
     glEnableVertexAttribArray(attribute.location);
     attribute.buffer->bind(Buffer::Target::Array);
     glVertexAttribLPointer(attribute.location, attribute.size, attribute.type, attribute.stride, reinterpret_cast<const GLvoid*>(attribute.offset));
+    if(attribute.divisor) glVertexAttribDivisor(attribute.location, attribute.divisor);
 }
 #endif
 #endif
@@ -247,6 +268,7 @@ void Mesh::attributePointerImplementationVAO(const Attribute& attribute) {
 void Mesh::attributePointerImplementationDSA(const Attribute& attribute) {
     glEnableVertexArrayAttribEXT(vao, attribute.location);
     glVertexArrayVertexAttribOffsetEXT(vao, attribute.buffer->id(), attribute.location, attribute.size, attribute.type, attribute.normalized, attribute.stride, attribute.offset);
+    if(attribute.divisor) attributeDivisorImplementationDSA(attribute.location, attribute.divisor);
 }
 #endif
 
@@ -264,6 +286,7 @@ void Mesh::attributePointerImplementationVAO(const IntegerAttribute& attribute)
 void Mesh::attributePointerImplementationDSA(const IntegerAttribute& attribute) {
     glEnableVertexArrayAttribEXT(vao, attribute.location);
     glVertexArrayVertexAttribIOffsetEXT(vao, attribute.buffer->id(), attribute.location, attribute.size, attribute.type, attribute.stride, attribute.offset);
+    if(attribute.divisor) attributeDivisorImplementationDSA(attribute.location, attribute.divisor);
 }
 #endif
 
@@ -280,6 +303,14 @@ void Mesh::attributePointerImplementationVAO(const LongAttribute& attribute) {
 void Mesh::attributePointerImplementationDSA(const LongAttribute& attribute) {
     glEnableVertexArrayAttribEXT(vao, attribute.location);
     glVertexArrayVertexAttribLOffsetEXT(vao, attribute.buffer->id(), attribute.location, attribute.size, attribute.type, attribute.stride, attribute.offset);
+    if(attribute.divisor) attributeDivisorImplementationDSA(attribute.location, attribute.divisor);
+}
+
+void Mesh::attributeDivisorImplementationDSA(const GLuint location, const GLuint divisor) {
+    /* EXT_direct_state_access has no divisor function in the revision we
+       support, the VAO must be bound */
+    bindVAO(vao);
+    glVertexAttribDivisor(location, divisor);
 }
 #endif
 #endif
@@ -322,16 +353,26 @@ void Mesh::bindImplementationVAO() {
 }
 
 void Mesh::unbindImplementationDefault() {
-    for(const Attribute& attribute: attributes)
+    /* Without VAOs the divisors would stay set also for other meshes, reset
+       them */
+    for(const Attribute& attribute: attributes) {
+        #ifndef MAGNUM_TARGET_GLES2
+        if(attribute.divisor) glVertexAttribDivisor(attribute.location, 0);
+        #endif
         glDisableVertexAttribArray(attribute.location);
+    }
 
     #ifndef MAGNUM_TARGET_GLES2
-    for(const IntegerAttribute& attribute: integerAttributes)
+    for(const IntegerAttribute& attribute: integerAttributes) {
+        if(attribute.divisor) glVertexAttribDivisor(attribute.location, 0);
         glDisableVertexAttribArray(attribute.location);
+    }
 
     #ifndef MAGNUM_TARGET_GLES
-    for(const LongAttribute& attribute: longAttributes)
+    for(const LongAttribute& attribute: longAttributes) {
+        if(attribute.divisor) glVertexAttribDivisor(attribute.location, 0);
         glDisableVertexAttribArray(attribute.location);
+    }
     #endif
     #endif
 }
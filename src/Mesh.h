@@ -36,6 +36,22 @@
 
 namespace Magnum {
 
+namespace Implementation {
+    /* Offset and stride of given column of vertex attribute. Columns of
+       matrix attributes are consecutive in memory, zero stride means tightly
+       packed attribute array and is expanded to size of the whole attribute,
+       as GL would otherwise take size of one column as the stride. */
+    struct AttributeColumnLayout {
+        GLintptr offset;
+        GLsizei stride;
+    };
+
+    template<UnsignedInt location, class T> inline AttributeColumnLayout attributeColumnLayout(const AbstractShaderProgram::Attribute<location, T>& attribute, GLintptr offset, GLsizei stride, UnsignedInt column) {
+        return {GLintptr(offset + column*attribute.vectorSize()),
+                stride ? stride : GLsizei(attribute.dataSize())};
+    }
+}
+
 /**
 @brief %Mesh
 
@@ -214,6 +230,27 @@ respective shader, bind required textures (see
 @ref AbstractShaderProgram-rendering-workflow "AbstractShaderProgram documentation"
 for more infromation) and call Mesh::draw().
 
+@section Mesh-instancing Instanced rendering
+
+Many copies of the same mesh can be drawn in single draw call by setting
+instance count with setInstanceCount(). Data which differ between instances
+(e.g. transformation or color) are then supplied in per-instance attributes,
+added with addInstancedVertexBuffer() or addInstancedInterleavedVertexBuffer().
+Instanced attributes advance once per given count of instances instead of once
+per vertex:
+@code
+// Transformation of each instance, the shader has the transformation as
+// vertex attribute
+std::vector<Matrix4> transformations;
+Buffer transformationBuffer;
+transformationBuffer.setData(transformations, Buffer::Usage::StreamDraw);
+
+mesh->setInstanceCount(transformations.size())
+    ->addInstancedVertexBuffer(&transformationBuffer, 0, 1, MyShader::TransformationMatrix());
+@endcode
+See for example Shaders::Flat and Shaders::Phong with
+@ref Shaders::Phong::Flag "Flag::InstancedTransformation" enabled.
+
 @section Mesh-performance-optimization Performance optimizations
 
 If @extension{APPLE,vertex_array_object}, OpenGL ES 3.0 or
@@ -232,13 +269,15 @@ If index range is specified in setIndexBuffer(), range-based version of
 drawing commands are used on desktop OpenGL and OpenGL ES 3.0. See also draw()
 for more information.
 
+Many small meshes sharing one vertex and index buffer can be drawn with single
+bind and single draw call using MeshBatch.
+
 @todo Support for indirect draw buffer (OpenGL 4.0, @extension{ARB,draw_indirect})
-@todo Redo in a way that allows glMultiDrawArrays, glDrawArraysInstanced etc.
 @todo test vertex specification & drawing
-@todo How to glDrawElementsBaseVertex()/vertex offset -- in draw()?
  */
 class MAGNUM_EXPORT Mesh {
     friend class Context;
+    friend class MeshBatch;
 
     Mesh(const Mesh&) = delete;
     Mesh& operator=(const Mesh&) = delete;
@@ -408,6 +447,35 @@ class MAGNUM_EXPORT Mesh {
             return this;
         }
 
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Instance count
+         *
+         * @requires_gl31 %Extension @extension{ARB,draw_instanced}
+         * @requires_gles30 Instanced rendering is not available in OpenGL ES
+         *      2.0.
+         */
+        Int instanceCount() const { return _instanceCount; }
+
+        /**
+         * @brief Set instance count
+         * @return Pointer to self (for method chaining)
+         *
+         * Default is `1`. If set to other value than `1`, the mesh is drawn
+         * using instanced draw calls. If set to `0`, draw() does nothing.
+         * See @ref Mesh-instancing "class documentation" for more
+         * information.
+         * @see addInstancedVertexBuffer(), addInstancedInterleavedVertexBuffer()
+         * @requires_gl31 %Extension @extension{ARB,draw_instanced}
+         * @requires_gles30 Instanced rendering is not available in OpenGL ES
+         *      2.0.
+         */
+        Mesh* setInstanceCount(Int count) {
+            _instanceCount = count;
+            return this;
+        }
+        #endif
+
         /**
          * @brief Add buffer with non-interleaved vertex attributes for use with given shader
          * @return Pointer to self (for method chaining)
@@ -518,7 +586,7 @@ class MAGNUM_EXPORT Mesh {
          *      if @extension{APPLE,vertex_array_object} is available
          */
         template<class ...T> inline Mesh* addInterleavedVertexBuffer(Buffer* buffer, GLintptr offset, const T&... attributes) {
-            addInterleavedVertexBufferInternal(buffer, offset, strideOfInterleaved(attributes...), attributes...);
+            addInterleavedVertexBufferInternal(buffer, offset, strideOfInterleaved(attributes...), 0, attributes...);
             return this;
         }
 
@@ -529,10 +597,64 @@ class MAGNUM_EXPORT Mesh {
          * See addInterleavedVertexBuffer() for more information.
          */
         template<UnsignedInt location, class T> inline Mesh* addVertexBufferStride(Buffer* buffer, GLintptr offset, GLsizei stride, const AbstractShaderProgram::Attribute<location, T>& attribute) {
-            addInterleavedVertexBufferInternal(buffer, offset, stride, attribute);
+            addInterleavedVertexBufferInternal(buffer, offset, stride, 0, attribute);
+            return this;
+        }
+
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Add buffer with non-interleaved per-instance attributes for use with given shader
+         * @param buffer        Buffer
+         * @param offset        Offset of the data in the buffer
+         * @param divisor       Count of instances using the same attribute
+         *      value, must not be zero
+         * @param attributes    Attribute list
+         * @return Pointer to self (for method chaining)
+         *
+         * Similar to addVertexBuffer(), but the attributes advance once per
+         * @p divisor instances instead of once per vertex. Size of each
+         * attribute array is computed from instance count and @p divisor.
+         * See @ref Mesh-instancing "class documentation" for more
+         * information.
+         * @attention If specifying more than one attribute the actual
+         *      instance count must be set before calling this function.
+         *      Otherwise instance data positions in the buffer will be
+         *      miscalculated.
+         * @see setInstanceCount(), @fn_gl{VertexAttribDivisor}
+         * @requires_gl33 %Extension @extension{ARB,instanced_arrays}
+         * @requires_gles30 Instanced rendering is not available in OpenGL ES
+         *      2.0.
+         */
+        template<class ...T> inline Mesh* addInstancedVertexBuffer(Buffer* buffer, GLintptr offset, UnsignedInt divisor, const T&... attributes) {
+            CORRADE_ASSERT(divisor, "Mesh::addInstancedVertexBuffer(): divisor must not be zero", this);
+            addVertexBufferInternal(buffer, offset, (_instanceCount + divisor - 1)/divisor, divisor, attributes...);
             return this;
         }
 
+        /**
+         * @brief Add buffer with interleaved per-instance attributes for use with given shader
+         * @param buffer        Buffer
+         * @param offset        Offset of the interleaved array in the buffer
+         * @param divisor       Count of instances using the same attribute
+         *      value, must not be zero
+         * @param attributes    Attribute list
+         * @return Pointer to self (for method chaining)
+         *
+         * Similar to addInterleavedVertexBuffer(), but the attributes advance
+         * once per @p divisor instances instead of once per vertex. See
+         * @ref Mesh-instancing "class documentation" for more information.
+         * @see setInstanceCount(), @fn_gl{VertexAttribDivisor}
+         * @requires_gl33 %Extension @extension{ARB,instanced_arrays}
+         * @requires_gles30 Instanced rendering is not available in OpenGL ES
+         *      2.0.
+         */
+        template<class ...T> inline Mesh* addInstancedInterleavedVertexBuffer(Buffer* buffer, GLintptr offset, UnsignedInt divisor, const T&... attributes) {
+            CORRADE_ASSERT(divisor, "Mesh::addInstancedInterleavedVertexBuffer(): divisor must not be zero", this);
+            addInterleavedVertexBufferInternal(buffer, offset, strideOfInterleaved(attributes...), divisor, attributes...);
+            return this;
+        }
+        #endif
+
         /**
          * @brief Set index buffer
          * @param buffer        Index buffer
@@ -581,7 +703,9 @@ class MAGNUM_EXPORT Mesh {
          * @see @fn_gl{EnableVertexAttribArray}, @fn_gl{BindBuffer},
          *      @fn_gl{VertexAttribPointer}, @fn_gl{DisableVertexAttribArray}
          *      or @fn_gl{BindVertexArray} (if @extension{APPLE,vertex_array_object}
-         *      is available), @fn_gl{DrawArrays} or @fn_gl{DrawElements}/@fn_gl{DrawRangeElements}.
+         *      is available), @fn_gl{DrawArrays} or @fn_gl{DrawElements}/@fn_gl{DrawRangeElements},
+         *      @fn_gl{DrawArraysInstanced} or @fn_gl{DrawElementsInstanced}
+         *      if instance count is not `1`.
          */
         void draw();
 
@@ -595,6 +719,7 @@ class MAGNUM_EXPORT Mesh {
             bool normalized;
             GLintptr offset;
             GLsizei stride;
+            GLuint divisor;
         };
 
         #ifndef MAGNUM_TARGET_GLES2
@@ -605,6 +730,7 @@ class MAGNUM_EXPORT Mesh {
             GLenum type;
             GLintptr offset;
             GLsizei stride;
+            GLuint divisor;
         };
 
         #ifndef MAGNUM_TARGET_GLES
@@ -615,6 +741,7 @@ class MAGNUM_EXPORT Mesh {
             GLenum type;
             GLintptr offset;
             GLsizei stride;
+            GLuint divisor;
         };
         #endif
         #endif
@@ -622,18 +749,19 @@ class MAGNUM_EXPORT Mesh {
 
         static void MAGNUM_LOCAL initializeContextBasedFunctionality(Context* context);
 
-        /* Adding non-interleaved vertex attributes */
-        template<UnsignedInt location, class T, class ...U> inline void addVertexBufferInternal(Buffer* buffer, GLintptr offset, const AbstractShaderProgram::Attribute<location, T>& attribute, const U&... attributes) {
-            addVertexAttribute(buffer, attribute, offset, 0);
+        /* Adding non-interleaved vertex attributes, `count` is count of
+           attribute values in each array */
+        template<UnsignedInt location, class T, class ...U> inline void addVertexBufferInternal(Buffer* buffer, GLintptr offset, Int count, UnsignedInt divisor, const AbstractShaderProgram::Attribute<location, T>& attribute, const U&... attributes) {
+            addVertexAttribute(buffer, attribute, offset, attribute.dataSize(), divisor);
 
             /* Add size of this attribute array to offset for next attribute */
-            addVertexBufferInternal(buffer, offset+attribute.dataSize()*_vertexCount, attributes...);
+            addVertexBufferInternal(buffer, offset+attribute.dataSize()*count, count, divisor, attributes...);
         }
-        template<class ...T> inline void addVertexBufferInternal(Buffer* buffer, GLintptr offset, GLintptr gap, const T&... attributes) {
+        template<class ...T> inline void addVertexBufferInternal(Buffer* buffer, GLintptr offset, Int count, UnsignedInt divisor, GLintptr gap, const T&... attributes) {
             /* Add the gap to offset for next attribute */
-            addVertexBufferInternal(buffer, offset+gap, attributes...);
+            addVertexBufferInternal(buffer, offset+gap, count, divisor, attributes...);
         }
-        inline void addVertexBufferInternal(Buffer*, GLintptr) {}
+        inline void addVertexBufferInternal(Buffer*, GLintptr, Int, UnsignedInt) {}
 
         /* Computing stride of interleaved vertex attributes */
         template<UnsignedInt location, class T, class ...U> inline static GLsizei strideOfInterleaved(const AbstractShaderProgram::Attribute<location, T>& attribute, const U&... attributes) {
@@ -645,54 +773,61 @@ class MAGNUM_EXPORT Mesh {
         inline static GLsizei strideOfInterleaved() { return 0; }
 
         /* Adding interleaved vertex attributes */
-        template<UnsignedInt location, class T, class ...U> inline void addInterleavedVertexBufferInternal(Buffer* buffer, GLintptr offset, GLsizei stride, const AbstractShaderProgram::Attribute<location, T>& attribute, const U&... attributes) {
-            addVertexAttribute(buffer, attribute, offset, stride);
+        template<UnsignedInt location, class T, class ...U> inline void addInterleavedVertexBufferInternal(Buffer* buffer, GLintptr offset, GLsizei stride, UnsignedInt divisor, const AbstractShaderProgram::Attribute<location, T>& attribute, const U&... attributes) {
+            addVertexAttribute(buffer, attribute, offset, stride, divisor);
 
             /* Add size of this attribute to offset for next attribute */
-            addInterleavedVertexBufferInternal(buffer, offset+attribute.dataSize(), stride, attributes...);
+            addInterleavedVertexBufferInternal(buffer, offset+attribute.dataSize(), stride, divisor, attributes...);
         }
-        template<class ...T> inline void addInterleavedVertexBufferInternal(Buffer* buffer, GLintptr offset, GLsizei stride, GLintptr gap, const T&... attributes) {
+        template<class ...T> inline void addInterleavedVertexBufferInternal(Buffer* buffer, GLintptr offset, GLsizei stride, UnsignedInt divisor, GLintptr gap, const T&... attributes) {
             /* Add the gap to offset for next attribute */
-            addInterleavedVertexBufferInternal(buffer, offset+gap, stride, attributes...);
+            addInterleavedVertexBufferInternal(buffer, offset+gap, stride, divisor, attributes...);
         }
-        inline void addInterleavedVertexBufferInternal(Buffer*, GLsizei, GLintptr) {}
+        inline void addInterleavedVertexBufferInternal(Buffer*, GLintptr, GLsizei, UnsignedInt) {}
 
-        template<UnsignedInt location, class T> inline void addVertexAttribute(typename std::enable_if<std::is_same<typename Implementation::Attribute<T>::Type, Float>::value, Buffer*>::type buffer, const AbstractShaderProgram::Attribute<location, T>& attribute, GLintptr offset, GLsizei stride) {
-            for(UnsignedInt i = 0; i != Implementation::Attribute<T>::vectorCount(); ++i)
+        template<UnsignedInt location, class T> inline void addVertexAttribute(typename std::enable_if<std::is_same<typename Implementation::Attribute<T>::Type, Float>::value, Buffer*>::type buffer, const AbstractShaderProgram::Attribute<location, T>& attribute, GLintptr offset, GLsizei stride, GLuint divisor) {
+            for(UnsignedInt i = 0; i != Implementation::Attribute<T>::vectorCount(); ++i) {
+                const Implementation::AttributeColumnLayout layout = Implementation::attributeColumnLayout(attribute, offset, stride, i);
                 (this->*attributePointerImplementation)(Attribute{
                     buffer,
                     location+i,
                     static_cast<GLint>(attribute.components()),
                     static_cast<GLenum>(attribute.dataType()),
                     bool(attribute.dataOptions() & AbstractShaderProgram::Attribute<location, T>::DataOption::Normalized),
-                    offset,
-                    stride
+                    layout.offset,
+                    layout.stride,
+                    divisor
                 });
+            }
         }
 
         #ifndef MAGNUM_TARGET_GLES2
-        template<UnsignedInt location, class T> inline void addVertexAttribute(typename std::enable_if<std::is_integral<typename Implementation::Attribute<T>::Type>::value, Buffer*>::type buffer, const AbstractShaderProgram::Attribute<location, T>& attribute, GLintptr offset, GLsizei stride) {
+        template<UnsignedInt location, class T> inline void addVertexAttribute(typename std::enable_if<std::is_integral<typename Implementation::Attribute<T>::Type>::value, Buffer*>::type buffer, const AbstractShaderProgram::Attribute<location, T>& attribute, GLintptr offset, GLsizei stride, GLuint divisor) {
             (this->*attributeIPointerImplementation)(IntegerAttribute{
                 buffer,
                 location,
                 static_cast<GLint>(attribute.components()),
                 static_cast<GLenum>(attribute.dataType()),
                 offset,
-                stride
+                stride,
+                divisor
             });
         }
 
         #ifndef MAGNUM_TARGET_GLES
-        template<UnsignedInt location, class T> inline void addVertexAttribute(typename std::enable_if<std::is_same<typename Implementation::Attribute<T>::Type, Double>::value, Buffer*>::type buffer, const AbstractShaderProgram::Attribute<location, T>& attribute, GLintptr offset, GLsizei stride) {
-            for(UnsignedInt i = 0; i != Implementation::Attribute<T>::vectorCount(); ++i)
+        template<UnsignedInt location, class T> inline void addVertexAttribute(typename std::enable_if<std::is_same<typename Implementation::Attribute<T>::Type, Double>::value, Buffer*>::type buffer, const AbstractShaderProgram::Attribute<location, T>& attribute, GLintptr offset, GLsizei stride, GLuint divisor) {
+            for(UnsignedInt i = 0; i != Implementation::Attribute<T>::vectorCount(); ++i) {
+                const Implementation::AttributeColumnLayout layout = Implementation::attributeColumnLayout(attribute, offset, stride, i);
                 (this->*attributeLPointerImplementation)(LongAttribute{
                     buffer,
                     location+i,
                     static_cast<GLint>(attribute.components()),
                     static_cast<GLenum>(attribute.dataType()),
-                    offset,
-                    stride
+                    layout.offset,
+                    layout.stride,
+                    divisor
                 });
+            }
         }
         #endif
         #endif
@@ -739,6 +874,7 @@ class MAGNUM_EXPORT Mesh {
         void MAGNUM_LOCAL attributePointerImplementationDefault(const LongAttribute& attribute);
         void MAGNUM_LOCAL attributePointerImplementationVAO(const LongAttribute& attribute);
         void MAGNUM_LOCAL attributePointerImplementationDSA(const LongAttribute& attribute);
+        void MAGNUM_LOCAL attributeDivisorImplementationDSA(GLuint location, GLuint divisor);
         static AttributeLPointerImplementation attributeLPointerImplementation;
         #endif
         #endif
@@ -764,6 +900,9 @@ class MAGNUM_EXPORT Mesh {
         #ifndef MAGNUM_TARGET_GLES2
         UnsignedInt indexStart, indexEnd;
         #endif
+        #ifndef MAGNUM_TARGET_GLES2
+        Int _instanceCount;
+        #endif
         GLintptr indexOffset;
         IndexType indexType;
         Buffer* indexBuffer;
@@ -787,7 +926,7 @@ template<class ...T> inline Mesh* Mesh::addVertexBuffer(Buffer* buffer, GLintptr
     CORRADE_ASSERT(sizeof...(attributes) == 1 || _vertexCount != 0,
         "Mesh::addVertexBuffer(): vertex count must be set before binding attributes", this);
 
-    addVertexBufferInternal(buffer, offset, attributes...);
+    addVertexBufferInternal(buffer, offset, _vertexCount, 0, attributes...);
     return this;
 }
 
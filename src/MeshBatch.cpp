@@ -0,0 +1,170 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MeshBatch.h"
+
+#include <Utility/Assert.h>
+#include <Utility/Debug.h>
+
+#include "Buffer.h"
+#include "Context.h"
+#include "Extensions.h"
+#include "Mesh.h"
+
+namespace Magnum {
+
+MeshBatch::DrawArraysImplementation MeshBatch::drawArraysImplementation = &MeshBatch::drawArraysImplementationDefault;
+MeshBatch::DrawElementsImplementation MeshBatch::drawElementsImplementation = &MeshBatch::drawElementsImplementationDefault;
+bool MeshBatch::baseVertexSupported = false;
+
+MeshBatch::MeshBatch(Mesh* mesh): _mesh(mesh), _vertexCount(0), _indexCount(0), indexPointerBase(0), indexPointerType(0) {}
+
+UnsignedInt MeshBatch::add(Int vertexCount, Int indexCount) {
+    CORRADE_ASSERT(vertexOffsets.empty() || !indexCount == !_indexCount,
+        "MeshBatch::add(): either all meshes must be indexed or none", 0);
+
+    vertexOffsets.push_back(_vertexCount);
+    indexOffsets.push_back(_indexCount);
+    counts.push_back(indexCount ? indexCount : vertexCount);
+
+    _vertexCount += vertexCount;
+    _indexCount += indexCount;
+
+    /* Force recalculation of index pointers */
+    indexPointers.clear();
+
+    return vertexOffsets.size()-1;
+}
+
+void MeshBatch::clear() {
+    _vertexCount = _indexCount = 0;
+    vertexOffsets.clear();
+    indexOffsets.clear();
+    counts.clear();
+    indexPointers.clear();
+}
+
+void MeshBatch::draw() {
+    if(vertexOffsets.empty()) return;
+
+    if(_indexCount) updateIndexPointers();
+    drawInternal(vertexOffsets.data(), counts.data(), indexPointers.data(), counts.size());
+}
+
+void MeshBatch::draw(const std::vector<UnsignedInt>& ids) {
+    if(ids.empty()) return;
+
+    if(_indexCount) updateIndexPointers();
+
+    subsetVertexOffsets.clear();
+    subsetCounts.clear();
+    subsetIndexPointers.clear();
+    for(UnsignedInt id: ids) {
+        CORRADE_ASSERT(id < vertexOffsets.size(), "MeshBatch::draw(): mesh ID" << id << "out of range for" << vertexOffsets.size() << "meshes", );
+        subsetVertexOffsets.push_back(vertexOffsets[id]);
+        subsetCounts.push_back(counts[id]);
+        if(_indexCount) subsetIndexPointers.push_back(indexPointers[id]);
+    }
+
+    drawInternal(subsetVertexOffsets.data(), subsetCounts.data(), subsetIndexPointers.data(), subsetCounts.size());
+}
+
+void MeshBatch::updateIndexPointers() {
+    if(indexPointers.size() == indexOffsets.size() &&
+       indexPointerBase == _mesh->indexOffset &&
+       indexPointerType == GLenum(_mesh->indexType)) return;
+
+    indexPointerBase = _mesh->indexOffset;
+    indexPointerType = GLenum(_mesh->indexType);
+
+    const std::size_t indexSize = Mesh::indexSize(_mesh->indexType);
+    indexPointers.resize(indexOffsets.size());
+    for(std::size_t i = 0; i != indexOffsets.size(); ++i)
+        indexPointers[i] = reinterpret_cast<const GLvoid*>(indexPointerBase + indexOffsets[i]*indexSize);
+}
+
+void MeshBatch::drawInternal(const GLint* first, const GLsizei* count, const GLvoid* const* indices, GLsizei drawCount) {
+    (_mesh->*Mesh::bindImplementation)();
+
+    /* Without VAOs the mesh binds its index buffer only if it has non-zero
+       index count, which isn't set for batches */
+    if(_indexCount) {
+        CORRADE_ASSERT(_mesh->indexBuffer, "MeshBatch::draw(): the mesh has no index buffer", );
+        _mesh->indexBuffer->bind(Buffer::Target::ElementArray);
+    }
+
+    /* Vertex offsets are used as base vertices for indexed meshes */
+    if(_indexCount)
+        drawElementsImplementation(static_cast<GLenum>(_mesh->_primitive), count, static_cast<GLenum>(_mesh->indexType), indices, first, drawCount);
+    else
+        drawArraysImplementation(static_cast<GLenum>(_mesh->_primitive), first, count, drawCount);
+
+    (_mesh->*Mesh::unbindImplementation)();
+}
+
+void MeshBatch::initializeContextBasedFunctionality(Context* context) {
+    #ifndef MAGNUM_TARGET_GLES
+    drawArraysImplementation = &MeshBatch::drawArraysImplementationMulti;
+
+    if(context->isExtensionSupported<Extensions::GL::ARB::draw_elements_base_vertex>()) {
+        Debug() << "MeshBatch: using" << Extensions::GL::ARB::draw_elements_base_vertex::string() << "features";
+
+        drawElementsImplementation = &MeshBatch::drawElementsImplementationMultiBaseVertex;
+        baseVertexSupported = true;
+    } else {
+        drawElementsImplementation = &MeshBatch::drawElementsImplementationMulti;
+        baseVertexSupported = false;
+    }
+    #else
+    static_cast<void>(context);
+    #endif
+}
+
+void MeshBatch::drawArraysImplementationDefault(GLenum primitive, const GLint* first, const GLsizei* count, GLsizei drawCount) {
+    for(GLsizei i = 0; i != drawCount; ++i)
+        glDrawArrays(primitive, first[i], count[i]);
+}
+
+#ifndef MAGNUM_TARGET_GLES
+void MeshBatch::drawArraysImplementationMulti(GLenum primitive, const GLint* first, const GLsizei* count, GLsizei drawCount) {
+    glMultiDrawArrays(primitive, first, count, drawCount);
+}
+#endif
+
+void MeshBatch::drawElementsImplementationDefault(GLenum primitive, const GLsizei* count, GLenum type, const GLvoid* const* indices, const GLint*, GLsizei drawCount) {
+    for(GLsizei i = 0; i != drawCount; ++i)
+        glDrawElements(primitive, count[i], type, indices[i]);
+}
+
+#ifndef MAGNUM_TARGET_GLES
+void MeshBatch::drawElementsImplementationMulti(GLenum primitive, const GLsizei* count, GLenum type, const GLvoid* const* indices, const GLint*, GLsizei drawCount) {
+    glMultiDrawElements(primitive, count, type, indices, drawCount);
+}
+
+void MeshBatch::drawElementsImplementationMultiBaseVertex(GLenum primitive, const GLsizei* count, GLenum type, const GLvoid* const* indices, const GLint* baseVertex, GLsizei drawCount) {
+    glMultiDrawElementsBaseVertex(primitive, count, type, indices, drawCount, baseVertex);
+}
+#endif
+
+}
@@ -0,0 +1,223 @@
+#ifndef Magnum_MeshBatch_h
+#define Magnum_MeshBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class Magnum::MeshBatch
+ */
+
+#include <vector>
+
+#include "Magnum.h"
+#include "OpenGL.h"
+#include "magnumVisibility.h"
+
+namespace Magnum {
+
+/**
+@brief Batch of meshes sharing one vertex and index buffer
+
+Many small meshes stored in shared buffers can be drawn using single mesh
+(thus single VAO, if available) and single draw call instead of binding and drawing each of
+them separately. The shared Mesh is configured as usual (primitive, vertex
+buffers, index buffer), its vertex and index count is ignored.
+
+@section MeshBatch-usage Usage
+
+Each mesh added with add() gets its own contiguous range of vertices and
+indices in the shared buffers. Upload its data at vertexOffset() and
+indexOffset(), add indexBias() to each index first:
+@code
+Buffer vertexBuffer, indexBuffer;
+Mesh mesh;
+mesh.addInterleavedVertexBuffer(&vertexBuffer, 0, Shader::Position(), Shader::Normal())
+    ->setIndexBuffer(&indexBuffer, 0, Mesh::IndexType::UnsignedInt);
+
+MeshBatch batch(&mesh);
+vertexBuffer.setData(totalVertexCount*sizeof(Vertex), nullptr, Buffer::Usage::StaticDraw);
+indexBuffer.setData(totalIndexCount*sizeof(UnsignedInt), nullptr, Buffer::Usage::StaticDraw);
+
+for(const MeshData& data: meshes) {
+    UnsignedInt id = batch.add(data.vertices.size(), data.indices.size());
+
+    std::vector<UnsignedInt> indices(data.indices);
+    for(UnsignedInt& i: indices) i += batch.indexBias(id);
+
+    vertexBuffer.setSubData(batch.vertexOffset(id)*sizeof(Vertex), data.vertices);
+    indexBuffer.setSubData(batch.indexOffset(id)*sizeof(UnsignedInt), indices);
+}
+
+// Draw everything
+shader.use();
+batch.draw();
+@endcode
+
+Either all meshes in the batch are indexed or none of them.
+
+@section MeshBatch-performance Performance optimizations
+
+The mesh is bound only once for the whole batch. On desktop OpenGL all meshes
+are drawn using single @fn_gl{MultiDrawArrays} or @fn_gl{MultiDrawElements}
+call. If @extension{ARB,draw_elements_base_vertex} (part of OpenGL 3.2) is
+available, @fn_gl{MultiDrawElementsBaseVertex} is used for indexed meshes, so
+the indices can be relative to start of each mesh and indexBias() is always
+`0`. On OpenGL ES the meshes are drawn with sequential @fn_gl{DrawArrays} or
+@fn_gl{DrawElements} calls, but the vertex attributes and index buffer are
+still set up only once for all of them. Vertex array objects are used only if
+@extension{APPLE,vertex_array_object} (part of OpenGL 3.0) is available, they
+are not used on OpenGL ES.
+
+Pointers to index data are recalculated only if index buffer offset or type of
+the mesh changes.
+@see Mesh
+*/
+class MAGNUM_EXPORT MeshBatch {
+    friend class Context;
+
+    public:
+        /**
+         * @brief Constructor
+         * @param mesh      Mesh with shared vertex and index buffers
+         *
+         * The mesh is not touched until draw() is called.
+         */
+        explicit MeshBatch(Mesh* mesh);
+
+        /** @brief Shared mesh */
+        Mesh* mesh() { return _mesh; }
+        const Mesh* mesh() const { return _mesh; } /**< @overload */
+
+        /** @brief Count of meshes in the batch */
+        std::size_t size() const { return vertexOffsets.size(); }
+
+        /** @brief Whether the batch is empty */
+        bool isEmpty() const { return vertexOffsets.empty(); }
+
+        /** @brief Count of vertices allocated in shared vertex buffer */
+        Int vertexCount() const { return _vertexCount; }
+
+        /** @brief Count of indices allocated in shared index buffer */
+        Int indexCount() const { return _indexCount; }
+
+        /**
+         * @brief Add mesh
+         * @param vertexCount   Vertex count
+         * @param indexCount    Index count or `0` for non-indexed mesh
+         * @return Mesh ID
+         *
+         * Allocates range of vertices and indices right after the previous
+         * mesh. The IDs are consecutive, starting from `0`.
+         */
+        UnsignedInt add(Int vertexCount, Int indexCount = 0);
+
+        /** @brief Offset of mesh vertices in shared vertex buffer */
+        Int vertexOffset(UnsignedInt id) const {
+            return vertexOffsets[id];
+        }
+
+        /** @brief Offset of mesh indices in shared index buffer */
+        Int indexOffset(UnsignedInt id) const {
+            return indexOffsets[id];
+        }
+
+        /**
+         * @brief Value to add to each mesh index
+         *
+         * If @extension{ARB,draw_elements_base_vertex} is not available, the
+         * indices must point to absolute position in shared vertex buffer,
+         * thus this returns vertexOffset(). Otherwise returns `0`.
+         */
+        Int indexBias(UnsignedInt id) const {
+            return baseVertexSupported ? 0 : vertexOffsets[id];
+        }
+
+        /**
+         * @brief Remove all meshes
+         *
+         * The shared buffers can then be filled again from the beginning.
+         */
+        void clear();
+
+        /**
+         * @brief Draw all meshes
+         *
+         * Does nothing if the batch is empty. Shader must be set up before.
+         * @see @ref MeshBatch-performance "Performance optimizations"
+         */
+        void draw();
+
+        /**
+         * @brief Draw subset of meshes
+         * @param ids       Mesh IDs
+         *
+         * Useful e.g. for drawing only visible meshes. The meshes are drawn
+         * in given order.
+         */
+        void draw(const std::vector<UnsignedInt>& ids);
+
+    private:
+        typedef void(*DrawArraysImplementation)(GLenum, const GLint*, const GLsizei*, GLsizei);
+        static void MAGNUM_LOCAL drawArraysImplementationDefault(GLenum primitive, const GLint* first, const GLsizei* count, GLsizei drawCount);
+        #ifndef MAGNUM_TARGET_GLES
+        static void MAGNUM_LOCAL drawArraysImplementationMulti(GLenum primitive, const GLint* first, const GLsizei* count, GLsizei drawCount);
+        #endif
+        static MAGNUM_LOCAL DrawArraysImplementation drawArraysImplementation;
+
+        typedef void(*DrawElementsImplementation)(GLenum, const GLsizei*, GLenum, const GLvoid* const*, const GLint*, GLsizei);
+        static void MAGNUM_LOCAL drawElementsImplementationDefault(GLenum primitive, const GLsizei* count, GLenum type, const GLvoid* const* indices, const GLint* baseVertex, GLsizei drawCount);
+        #ifndef MAGNUM_TARGET_GLES
+        static void MAGNUM_LOCAL drawElementsImplementationMulti(GLenum primitive, const GLsizei* count, GLenum type, const GLvoid* const* indices, const GLint* baseVertex, GLsizei drawCount);
+        static void MAGNUM_LOCAL drawElementsImplementationMultiBaseVertex(GLenum primitive, const GLsizei* count, GLenum type, const GLvoid* const* indices, const GLint* baseVertex, GLsizei drawCount);
+        #endif
+        static MAGNUM_LOCAL DrawElementsImplementation drawElementsImplementation;
+
+        static MAGNUM_LOCAL bool baseVertexSupported;
+
+        static void MAGNUM_LOCAL initializeContextBasedFunctionality(Context* context);
+
+        void MAGNUM_LOCAL updateIndexPointers();
+        void MAGNUM_LOCAL drawInternal(const GLint* first, const GLsizei* count, const GLvoid* const* indices, GLsizei drawCount);
+
+        Mesh* _mesh;
+        Int _vertexCount, _indexCount;
+
+        std::vector<GLint> vertexOffsets, indexOffsets;
+        std::vector<GLsizei> counts;
+
+        /* Pointers to index data, recalculated if index buffer offset or
+           type of the mesh changes */
+        std::vector<const GLvoid*> indexPointers;
+        GLintptr indexPointerBase;
+        GLenum indexPointerType;
+
+        /* Scratch arrays for drawing subset of meshes */
+        std::vector<GLint> subsetVertexOffsets;
+        std::vector<GLsizei> subsetCounts;
+        std::vector<const GLvoid*> subsetIndexPointers;
+};
+
+}
+
+#endif
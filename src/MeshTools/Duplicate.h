@@ -31,6 +31,7 @@
 #include <vector>
 
 #include "Types.h"
+#include "MeshTools/ThreadPool.h"
 
 namespace Magnum { namespace MeshTools {
 
@@ -49,6 +50,22 @@ template<class T> std::vector<T> duplicate(const std::vector<UnsignedInt>& indic
     return std::move(out);
 }
 
+/**
+@brief Duplicate vertices using index array in parallel
+
+Parallel variant of duplicate(const std::vector<UnsignedInt>&, const std::vector<T>&),
+the output is bit-identical to it. Unlike the serial variant, requires @p T to
+be default-constructible. See ThreadPool for more information.
+*/
+template<class T> std::vector<T> duplicate(ThreadPool& pool, const std::vector<UnsignedInt>& indices, const std::vector<T>& vertices) {
+    std::vector<T> out(indices.size());
+    pool.run(indices.size(), [&indices, &vertices, &out](std::size_t begin, std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i)
+            out[i] = vertices[indices[i]];
+    });
+    return out;
+}
+
 }}
 
 #endif
@@ -25,19 +25,47 @@
 #include "FlipNormals.h"
 
 #include "Math/Vector3.h"
+#include "MeshTools/ThreadPool.h"
 
 namespace Magnum { namespace MeshTools {
 
+namespace {
+
+void flipFaceWindingRange(std::vector<UnsignedInt>& indices, std::size_t begin, std::size_t end) {
+    for(std::size_t i = begin*3; i != end*3; i += 3)
+        std::swap(indices[i+1], indices[i+2]);
+}
+
+void flipNormalsRange(std::vector<Vector3>& normals, std::size_t begin, std::size_t end) {
+    for(std::size_t i = begin; i != end; ++i)
+        normals[i] = -normals[i];
+}
+
+}
+
 void flipFaceWinding(std::vector<UnsignedInt>& indices) {
     CORRADE_ASSERT(!(indices.size()%3), "MeshTools::flipNormals(): index count is not divisible by 3!", );
 
-    for(std::size_t i = 0; i != indices.size(); i += 3)
-        std::swap(indices[i+1], indices[i+2]);
+    flipFaceWindingRange(indices, 0, indices.size()/3);
 }
 
 void flipNormals(std::vector<Vector3>& normals) {
-    for(Vector3& normal: normals)
-        normal = -normal;
+    flipNormalsRange(normals, 0, normals.size());
+}
+
+void flipFaceWinding(ThreadPool& pool, std::vector<UnsignedInt>& indices) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::flipNormals(): index count is not divisible by 3!", );
+
+    /* Split on face boundaries */
+    pool.run(indices.size()/3, [&indices](std::size_t begin, std::size_t end) {
+        flipFaceWindingRange(indices, begin, end);
+    });
+}
+
+void flipNormals(ThreadPool& pool, std::vector<Vector3>& normals) {
+    pool.run(normals.size(), [&normals](std::size_t begin, std::size_t end) {
+        flipNormalsRange(normals, begin, end);
+    });
 }
 
 }}
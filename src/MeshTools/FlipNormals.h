@@ -36,6 +36,8 @@
 
 namespace Magnum { namespace MeshTools {
 
+class ThreadPool;
+
 /**
 @brief Flip face winding
 
@@ -69,6 +71,33 @@ inline void flipNormals(std::vector<UnsignedInt>& indices, std::vector<Vector3>&
     flipNormals(normals);
 }
 
+/**
+@brief Flip face winding in parallel
+
+Parallel variant of flipFaceWinding(std::vector<UnsignedInt>&), the output is
+bit-identical to it. See ThreadPool for more information.
+*/
+void MAGNUM_MESHTOOLS_EXPORT flipFaceWinding(ThreadPool& pool, std::vector<UnsignedInt>& indices);
+
+/**
+@brief Flip mesh normals in parallel
+
+Parallel variant of flipNormals(std::vector<Vector3>&), the output is
+bit-identical to it. See ThreadPool for more information.
+*/
+void MAGNUM_MESHTOOLS_EXPORT flipNormals(ThreadPool& pool, std::vector<Vector3>& normals);
+
+/**
+@brief Flip mesh normals and face winding in parallel
+
+Parallel variant of flipNormals(std::vector<UnsignedInt>&, std::vector<Vector3>&),
+the output is bit-identical to it. See ThreadPool for more information.
+*/
+inline void flipNormals(ThreadPool& pool, std::vector<UnsignedInt>& indices, std::vector<Vector3>& normals) {
+    flipFaceWinding(pool, indices);
+    flipNormals(pool, normals);
+}
+
 }}
 
 #endif
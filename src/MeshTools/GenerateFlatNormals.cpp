@@ -26,27 +26,48 @@
 
 #include "Math/Vector3.h"
 #include "MeshTools/RemoveDuplicates.h"
+#include "MeshTools/ThreadPool.h"
 
 namespace Magnum { namespace MeshTools {
 
+namespace {
+
+void generateFlatNormalsRange(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, std::vector<UnsignedInt>& normalIndices, std::vector<Vector3>& normals, const std::size_t begin, const std::size_t end) {
+    for(std::size_t i = begin; i != end; ++i) {
+        const std::size_t j = i*3;
+        normals[i] = Vector3::cross(positions[indices[j+2]]-positions[indices[j+1]],
+                                    positions[indices[j]]-positions[indices[j+1]]).normalized();
+
+        /* Use the same normal for all three vertices of the face */
+        normalIndices[j] = normalIndices[j+1] = normalIndices[j+2] = i;
+    }
+}
+
+}
+
 std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>> generateFlatNormals(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions) {
     CORRADE_ASSERT(!(indices.size()%3), "MeshTools::generateFlatNormals(): index count is not divisible by 3!", (std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>>()));
 
     /* Create normal for every triangle (assuming counterclockwise winding) */
-    std::vector<UnsignedInt> normalIndices;
-    normalIndices.reserve(indices.size());
-    std::vector<Vector3> normals;
-    normals.reserve(indices.size()/3);
-    for(std::size_t i = 0; i != indices.size(); i += 3) {
-        Vector3 normal = Vector3::cross(positions[indices[i+2]]-positions[indices[i+1]],
-                                        positions[indices[i]]-positions[indices[i+1]]).normalized();
+    std::vector<UnsignedInt> normalIndices(indices.size());
+    std::vector<Vector3> normals(indices.size()/3);
+    generateFlatNormalsRange(indices, positions, normalIndices, normals, 0, normals.size());
 
-        /* Use the same normal for all three vertices of the face */
-        normalIndices.push_back(normals.size());
-        normalIndices.push_back(normals.size());
-        normalIndices.push_back(normals.size());
-        normals.push_back(normal);
-    }
+    /* Remove duplicate normals and return */
+    MeshTools::removeDuplicates(normalIndices, normals);
+    return std::make_tuple(std::move(normalIndices), std::move(normals));
+}
+
+std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>> generateFlatNormals(ThreadPool& pool, const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::generateFlatNormals(): index count is not divisible by 3!", (std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>>()));
+
+    /* Create normal for every triangle in parallel, each chunk writes only
+       its own part of the output */
+    std::vector<UnsignedInt> normalIndices(indices.size());
+    std::vector<Vector3> normals(indices.size()/3);
+    pool.run(normals.size(), [&](std::size_t begin, std::size_t end) {
+        generateFlatNormalsRange(indices, positions, normalIndices, normals, begin, end);
+    });
 
     /* Remove duplicate normals and return */
     MeshTools::removeDuplicates(normalIndices, normals);
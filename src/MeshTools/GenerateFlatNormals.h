@@ -37,6 +37,8 @@
 
 namespace Magnum { namespace MeshTools {
 
+class ThreadPool;
+
 /**
 @brief Generate flat normals
 @param indices      Array of triangle face indexes
@@ -61,6 +63,16 @@ use the same indices.
 */
 std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>> MAGNUM_MESHTOOLS_EXPORT generateFlatNormals(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions);
 
+/**
+@brief Generate flat normals in parallel
+
+Parallel variant of generateFlatNormals(const std::vector<UnsignedInt>&, const std::vector<Vector3>&),
+the output is bit-identical to it. Only the normal computation is done in
+parallel, removing the duplicates is done serially afterwards. See ThreadPool
+for more information.
+*/
+std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>> MAGNUM_MESHTOOLS_EXPORT generateFlatNormals(ThreadPool& pool, const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions);
+
 }}
 
 #endif
@@ -29,12 +29,14 @@
  */
 
 #include <cstring>
+#include <iterator>
 #include <vector>
 #include <limits>
 #include <tuple>
 
 #include "Mesh.h"
 #include "Buffer.h"
+#include "MeshTools/ThreadPool.h"
 
 namespace Magnum { namespace MeshTools {
 
@@ -75,6 +77,36 @@ class Interleave {
             buffer->setData(attribute, usage);
         }
 
+        template<class ...T> std::tuple<std::size_t, std::size_t, char*> operator()(ThreadPool& pool, const T&... attributes) {
+            /* Compute buffer size and stride */
+            _attributeCount = attributeCount(attributes...);
+            if(_attributeCount && _attributeCount != ~std::size_t(0)) {
+                _stride = stride(attributes...);
+
+                /* Create output buffer */
+                _data = new char[_attributeCount*_stride];
+
+                /* Save the data */
+                writeParallel(pool, _data, attributes...);
+            }
+
+            return std::make_tuple(_attributeCount, _stride, _data);
+        }
+
+        template<class ...T> void operator()(ThreadPool& pool, Mesh* mesh, Buffer* buffer, Buffer::Usage usage, const T&... attributes) {
+            operator()(pool, attributes...);
+
+            mesh->setVertexCount(_attributeCount);
+            buffer->setData(_attributeCount*_stride, _data, usage);
+
+            delete[] _data;
+        }
+
+        /* Specialization for only one attribute array, nothing to parallelize */
+        template<class T> typename std::enable_if<!std::is_convertible<T, std::size_t>::value, void>::type operator()(ThreadPool&, Mesh* mesh, Buffer* buffer, Buffer::Usage usage, const T& attribute) {
+            operator()(mesh, buffer, usage, attribute);
+        }
+
         template<class T, class ...U> static typename std::enable_if<!std::is_convertible<T, std::size_t>::value, std::size_t>::type attributeCount(const T& first, const U&... next) {
             CORRADE_ASSERT(sizeof...(next) == 0 || attributeCount(next...) == first.size() || attributeCount(next...) == ~std::size_t(0), "MeshTools::interleave(): attribute arrays don't have the same length, nothing done.", 0);
 
@@ -99,25 +131,34 @@ class Interleave {
 
     private:
         template<class T, class ...U> void write(char* startingOffset, const T& first, const U&... next) {
-            write(startingOffset+writeOne(startingOffset, first), next...);
+            write(startingOffset+writeOne(startingOffset, first, 0, _attributeCount), next...);
+        }
+
+        /* Each attribute is written in parallel, one after another */
+        template<class T, class ...U> void writeParallel(ThreadPool& pool, char* startingOffset, const T& first, const U&... next) {
+            pool.run(_attributeCount, [this, startingOffset, &first](std::size_t begin, std::size_t end) {
+                writeOne(startingOffset, first, begin, end);
+            });
+
+            /* Empty range writes nothing, only returns the attribute size */
+            writeParallel(pool, startingOffset+writeOne(startingOffset, first, 0, 0), next...);
         }
 
         /* Copy data to the buffer */
-        template<class T>  typename std::enable_if<!std::is_convertible<T, std::size_t>::value, std::size_t>::type writeOne(char* startingOffset, const T& attributeList) {
+        template<class T>  typename std::enable_if<!std::is_convertible<T, std::size_t>::value, std::size_t>::type writeOne(char* startingOffset, const T& attributeList, std::size_t begin, std::size_t end) {
             auto it = attributeList.begin();
-            for(std::size_t i = 0; i != _attributeCount; ++i, ++it)
-                memcpy(startingOffset+i*_stride, reinterpret_cast<const char*>(&*it), sizeof(typename T::value_type));
+            std::advance(it, begin);
+            for(std::size_t i = begin; i != end; ++i, ++it)
+                std::memcpy(startingOffset+i*_stride, reinterpret_cast<const char*>(&*it), sizeof(typename T::value_type));
 
             return sizeof(typename T::value_type);
         }
 
         /* Fill gap with zeros */
-        std::size_t writeOne(char* startingOffset, std::size_t gap) {
-            char* data = new char[gap]();
-            for(std::size_t i = 0; i != _attributeCount; ++i)
-                memcpy(startingOffset+i*_stride, data, gap);
+        std::size_t writeOne(char* startingOffset, std::size_t gap, std::size_t begin, std::size_t end) {
+            for(std::size_t i = begin; i != end; ++i)
+                std::memset(startingOffset+i*_stride, 0, gap);
 
-            delete[] data;
             return gap;
         }
 
@@ -125,6 +166,7 @@ class Interleave {
         static std::size_t attributeCount() { return 0; }
         static std::size_t stride() { return 0; }
         void write(char*) {}
+        void writeParallel(ThreadPool&, char*) {}
 
         std::size_t _attributeCount;
         std::size_t _stride;
@@ -179,8 +221,8 @@ possible performance loss.
 See also interleave(Mesh*, Buffer*, Buffer::Usage, const T&...),
 which writes the interleaved array directly into buffer of given mesh.
 */
-/* enable_if to avoid clash with overloaded function below */
-template<class T, class ...U> inline typename std::enable_if<!std::is_convertible<T, Mesh*>::value, std::tuple<std::size_t, std::size_t, char*>>::type interleave(const T& first, const U&... next) {
+/* enable_if to avoid clash with overloaded functions below */
+template<class T, class ...U> inline typename std::enable_if<!std::is_convertible<T, Mesh*>::value && !std::is_same<T, ThreadPool>::value, std::tuple<std::size_t, std::size_t, char*>>::type interleave(const T& first, const U&... next) {
     return Implementation::Interleave()(first, next...);
 }
 
@@ -211,6 +253,27 @@ template<class ...T> inline void interleave(Mesh* mesh, Buffer* buffer, Buffer::
     return Implementation::Interleave()(mesh, buffer, usage, attributes...);
 }
 
+/**
+@brief %Interleave vertex attributes in parallel
+
+Parallel variant of interleave(const T&, const U&...), the output is
+bit-identical to it. Requires random-access attribute arrays for reasonable
+performance. See ThreadPool for more information.
+*/
+template<class T, class ...U> inline typename std::enable_if<!std::is_convertible<T, Mesh*>::value, std::tuple<std::size_t, std::size_t, char*>>::type interleave(ThreadPool& pool, const T& first, const U&... next) {
+    return Implementation::Interleave()(pool, first, next...);
+}
+
+/**
+@brief %Interleave vertex attributes in parallel and write them to array buffer
+
+Parallel variant of interleave(Mesh*, Buffer*, Buffer::Usage, const T&...),
+see interleave(ThreadPool&, const T&, const U&...) for more information.
+*/
+template<class ...T> inline void interleave(ThreadPool& pool, Mesh* mesh, Buffer* buffer, Buffer::Usage usage, const T&... attributes) {
+    return Implementation::Interleave()(pool, mesh, buffer, usage, attributes...);
+}
+
 }}
 
 #endif
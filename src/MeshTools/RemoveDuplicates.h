@@ -25,10 +25,12 @@
 */
 
 /** @file
- * @brief Function Magnum::MeshTools::removeDuplicates()
+ * @brief Function Magnum::MeshTools::removeDuplicates(), Magnum::MeshTools::removeDuplicatesSpatialHash()
  */
 
+#include <cstring>
 #include <limits>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 #include <Utility/MurmurHash2.h>
@@ -64,6 +66,47 @@ template<class Vertex, std::size_t vertexSize = Vertex::Size> class RemoveDuplic
         std::vector<Vertex>& vertices;
 };
 
+template<class Vertex, std::size_t vertexSize = Vertex::Size> class RemoveDuplicatesSpatialHash {
+    public:
+        RemoveDuplicatesSpatialHash(std::vector<UnsignedInt>& indices, std::vector<Vertex>& vertices): indices(indices), vertices(vertices) {}
+
+        void operator()(typename Vertex::Type epsilon = Math::TypeTraits<typename Vertex::Type>::epsilon());
+
+        /* Used also by RemoveDuplicates for integral types */
+        void exact();
+
+    private:
+        typedef Math::Vector<vertexSize, std::size_t> Cell;
+
+        /* FNV-1a for bitwise vertex data */
+        static std::size_t hash(const char* data, std::size_t size) {
+            UnsignedLong hash = 14695981039346656037ull;
+            for(std::size_t i = 0; i != size; ++i)
+                hash = (hash ^ UnsignedByte(data[i]))*1099511628211ull;
+            return std::size_t(hash ^ (hash >> 32));
+        }
+
+        /* Cheaper word-wise variant for cell indices */
+        static std::size_t hash(const Cell& cell) {
+            UnsignedLong hash = 14695981039346656037ull;
+            for(std::size_t i = 0; i != vertexSize; ++i)
+                hash = (hash ^ cell[i])*1099511628211ull;
+            return std::size_t(hash ^ (hash >> 29));
+        }
+
+        /* Power-of-two sized hash table for at least given count of items */
+        static std::size_t tableSize(std::size_t count) {
+            std::size_t size = 1;
+            while(size < 2*count) size <<= 1;
+            return size;
+        }
+
+        void fuzzy(typename Vertex::Type epsilon);
+
+        std::vector<UnsignedInt>& indices;
+        std::vector<Vertex>& vertices;
+};
+
 }
 
 /**
@@ -77,10 +120,17 @@ template<class Vertex, std::size_t vertexSize = Vertex::Size> class RemoveDuplic
 @param[in] epsilon      Epsilon value, vertices nearer than this distance will
     be melt together.
 
-Removes duplicate vertices from the mesh.
+Removes duplicate vertices from the mesh. The vertices are collapsed to first
+vertex in a cell of uniform grid with cell size @p epsilon. To catch also
+vertices on cell boundaries, the operation is repeated `vertexSize` more times
+with grid shifted by `epsilon/2` in each direction. Vertices with distance
+slightly more than @p epsilon thus may be melt together, while some nearer
+vertices may be left untouched, see removeDuplicatesSpatialHash() for more
+precise and faster alternative.
 @see duplicate()
 
-@todo Different (no cycle) implementation for integral vertices
+For integral vertex types and @p epsilon not larger than `1` only exactly
+equal vertices are melt, which is done in a single pass.
 @todo Interpolate vertices, not collapse them to first in the cell
 @todo Ability to specify other attributes for interpolation
 */
@@ -88,11 +138,41 @@ template<class Vertex, std::size_t vertexSize = Vertex::Size> inline void remove
     Implementation::RemoveDuplicates<Vertex, vertexSize>(indices, vertices)(epsilon);
 }
 
+/**
+@brief %Remove duplicate vertices from the mesh using spatial hash
+@tparam Vertex          Vertex data type
+@tparam vertexSize      How many initial vertex fields are important
+@param[in,out] indices  Index array to operate on
+@param[in,out] vertices Vertex array to operate on
+@param[in] epsilon      Epsilon value, vertices nearer than this distance will
+    be melt together.
+
+Alternative to removeDuplicates(), melting each vertex to nearest already
+processed vertex whose distance is less than @p epsilon. Unlike
+removeDuplicates() the vertex positions are compared exactly, the operation is
+done in single pass using flat open-addressing hash table and uniform grid
+with cell size `2*epsilon`, looking only into the `2^vertexSize` cells
+overlapped by epsilon neighborhood of each vertex.
+
+For integral vertex types with @p epsilon not larger than `1` and for
+@p epsilon equal to `0` only bitwise equal vertices are melt, which is done
+without any grid lookup. Vertices not referenced by any index are removed,
+order of remaining vertices is given by their first occurence in the index
+array.
+*/
+template<class Vertex, std::size_t vertexSize = Vertex::Size> inline void removeDuplicatesSpatialHash(std::vector<UnsignedInt>& indices, std::vector<Vertex>& vertices, typename Vertex::Type epsilon = Math::TypeTraits<typename Vertex::Type>::epsilon()) {
+    Implementation::RemoveDuplicatesSpatialHash<Vertex, vertexSize>(indices, vertices)(epsilon);
+}
+
 namespace Implementation {
 
 template<class Vertex, std::size_t vertexSize> void RemoveDuplicates<Vertex, vertexSize>::operator()(typename Vertex::Type epsilon) {
     if(indices.empty()) return;
 
+    /* Integral vertices nearer than 1 are equal, no need for the grid */
+    if(std::is_integral<typename Vertex::Type>::value && epsilon <= typename Vertex::Type(1))
+        return RemoveDuplicatesSpatialHash<Vertex, vertexSize>(indices, vertices).exact();
+
     /* Get mesh bounds */
     Vertex min = vertices[0], max = vertices[0];
     for(const auto& v: vertices) {
@@ -145,6 +225,133 @@ template<class Vertex, std::size_t vertexSize> void RemoveDuplicates<Vertex, ver
     }
 }
 
+template<class Vertex, std::size_t vertexSize> void RemoveDuplicatesSpatialHash<Vertex, vertexSize>::operator()(typename Vertex::Type epsilon) {
+    if(indices.empty()) return;
+
+    if((std::is_integral<typename Vertex::Type>::value && epsilon <= typename Vertex::Type(1)) || epsilon == typename Vertex::Type(0))
+        exact();
+    else fuzzy(epsilon);
+}
+
+template<class Vertex, std::size_t vertexSize> void RemoveDuplicatesSpatialHash<Vertex, vertexSize>::exact() {
+    /* New index for each original vertex (if already processed), hash table
+       with new indices */
+    std::vector<UnsignedInt> remap(vertices.size(), 0xFFFFFFFFu);
+    std::vector<UnsignedInt> table(tableSize(vertices.size()), 0xFFFFFFFFu);
+    const std::size_t mask = table.size()-1;
+    std::vector<Vertex> newVertices;
+
+    for(UnsignedInt& index: indices) {
+        UnsignedInt& newIndex = remap[index];
+
+        /* Vertex not yet processed, find the same vertex in the table or add
+           it there if not found */
+        if(newIndex == 0xFFFFFFFFu) {
+            const char* data = reinterpret_cast<const char*>(vertices[index].data());
+            for(std::size_t slot = hash(data, vertexSize*sizeof(typename Vertex::Type)) & mask; ; slot = (slot+1) & mask) {
+                const UnsignedInt candidate = table[slot];
+                if(candidate == 0xFFFFFFFFu) {
+                    newIndex = table[slot] = newVertices.size();
+                    newVertices.push_back(vertices[index]);
+                    break;
+                }
+
+                if(std::memcmp(newVertices[candidate].data(), data, vertexSize*sizeof(typename Vertex::Type)) == 0) {
+                    newIndex = candidate;
+                    break;
+                }
+            }
+        }
+
+        index = newIndex;
+    }
+
+    std::swap(newVertices, vertices);
+}
+
+template<class Vertex, std::size_t vertexSize> void RemoveDuplicatesSpatialHash<Vertex, vertexSize>::fuzzy(typename Vertex::Type epsilon) {
+    typedef typename Vertex::Type T;
+
+    /* Get mesh bounds */
+    Vertex min = vertices[0], max = vertices[0];
+    for(const auto& v: vertices) {
+        min = Math::min(v, min);
+        max = Math::max(v, max);
+    }
+
+    /* Make epsilon so large that std::size_t can index all vertices inside
+       mesh bounds. */
+    epsilon = Math::max(epsilon, static_cast<T>((max-min).max()/std::numeric_limits<std::size_t>::max()));
+
+    /* Cell size is twice the epsilon, so the epsilon neighborhood of each
+       vertex overlaps at most one neighbor cell in each direction */
+    const T cellSize = epsilon*2;
+
+    /* New index for each original vertex (if already processed), hash table
+       with new indices, cells of new vertices */
+    std::vector<UnsignedInt> remap(vertices.size(), 0xFFFFFFFFu);
+    std::vector<UnsignedInt> table(tableSize(vertices.size()), 0xFFFFFFFFu);
+    const std::size_t mask = table.size()-1;
+    std::vector<Vertex> newVertices;
+    std::vector<Cell> newCells;
+
+    for(UnsignedInt& index: indices) {
+        UnsignedInt& newIndex = remap[index];
+
+        /* Vertex already processed */
+        if(newIndex != 0xFFFFFFFFu) {
+            index = newIndex;
+            continue;
+        }
+
+        /* Cell of the vertex and direction to the neighbor cell overlapped
+           by its epsilon neighborhood in each dimension. Going below zero
+           wraps around, which is not a problem, as no vertex can be there. */
+        const Vertex& vertex = vertices[index];
+        Cell cell, side;
+        for(std::size_t i = 0; i != vertexSize; ++i) {
+            cell[i] = std::size_t((vertex[i]-min[i])/cellSize);
+            side[i] = vertex[i]-min[i]-T(cell[i])*cellSize < epsilon ? std::size_t(-1) : 1;
+        }
+
+        /* Find nearest vertex within epsilon in all 2^vertexSize candidate
+           cells. Multiple vertices can be in the same cell, thus going
+           through the whole probe sequence until empty slot is found. */
+        T nearestDistanceSquared = epsilon*epsilon;
+        for(std::size_t n = 0; n != (std::size_t(1) << vertexSize); ++n) {
+            Cell neighbor = cell;
+            for(std::size_t i = 0; i != vertexSize; ++i)
+                if(n & (std::size_t(1) << i)) neighbor[i] += side[i];
+
+            for(std::size_t slot = hash(neighbor) & mask; table[slot] != 0xFFFFFFFFu; slot = (slot+1) & mask) {
+                const UnsignedInt candidate = table[slot];
+                if(newCells[candidate] != neighbor) continue;
+
+                T distanceSquared(0);
+                for(std::size_t i = 0; i != vertexSize; ++i)
+                    distanceSquared += (newVertices[candidate][i]-vertex[i])*(newVertices[candidate][i]-vertex[i]);
+                if(distanceSquared < nearestDistanceSquared) {
+                    nearestDistanceSquared = distanceSquared;
+                    newIndex = candidate;
+                }
+            }
+        }
+
+        /* Nothing found, add new vertex to its cell */
+        if(newIndex == 0xFFFFFFFFu) {
+            std::size_t slot = hash(cell) & mask;
+            while(table[slot] != 0xFFFFFFFFu) slot = (slot+1) & mask;
+            newIndex = table[slot] = newVertices.size();
+            newVertices.push_back(vertex);
+            newCells.push_back(cell);
+        }
+
+        index = newIndex;
+    }
+
+    std::swap(newVertices, vertices);
+}
+
 }
 
 }}
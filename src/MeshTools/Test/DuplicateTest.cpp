@@ -25,6 +25,7 @@
 #include <TestSuite/Tester.h>
 
 #include "MeshTools/Duplicate.h"
+#include "MeshTools/ThreadPool.h"
 #include "Magnum.h"
 
 namespace Magnum { namespace MeshTools { namespace Test {
@@ -34,10 +35,12 @@ class DuplicateTest: public TestSuite::Tester {
         explicit DuplicateTest();
 
         void duplicate();
+        void duplicateParallel();
 };
 
 DuplicateTest::DuplicateTest() {
-    addTests({&DuplicateTest::duplicate});
+    addTests({&DuplicateTest::duplicate,
+              &DuplicateTest::duplicateParallel});
 }
 
 void DuplicateTest::duplicate() {
@@ -45,6 +48,17 @@ void DuplicateTest::duplicate() {
                     (std::vector<Int>{35, 35, -7, -18, 12, 12}));
 }
 
+void DuplicateTest::duplicateParallel() {
+    std::vector<Int> vertices{-7, 35, 12, -18};
+    std::vector<UnsignedInt> indices;
+    for(UnsignedInt i = 0; i != 1000; ++i) indices.push_back((i*7)%4);
+
+    ThreadPool pool(4);
+    pool.setMinimalChunkSize(50);
+    CORRADE_COMPARE(MeshTools::duplicate(pool, indices, vertices),
+                    MeshTools::duplicate(indices, vertices));
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::DuplicateTest)
@@ -27,6 +27,7 @@
 
 #include "Math/Vector3.h"
 #include "MeshTools/FlipNormals.h"
+#include "MeshTools/ThreadPool.h"
 
 namespace Magnum { namespace MeshTools { namespace Test {
 
@@ -37,12 +38,14 @@ class FlipNormalsTest: public TestSuite::Tester {
         void wrongIndexCount();
         void flipFaceWinding();
         void flipNormals();
+        void flipNormalsParallel();
 };
 
 FlipNormalsTest::FlipNormalsTest() {
     addTests({&FlipNormalsTest::wrongIndexCount,
               &FlipNormalsTest::flipFaceWinding,
-              &FlipNormalsTest::flipNormals});
+              &FlipNormalsTest::flipNormals,
+              &FlipNormalsTest::flipNormalsParallel});
 }
 
 void FlipNormalsTest::wrongIndexCount() {
@@ -75,6 +78,24 @@ void FlipNormalsTest::flipNormals() {
                                                    -Vector3::zAxis()}));
 }
 
+void FlipNormalsTest::flipNormalsParallel() {
+    std::vector<UnsignedInt> indices(3*1000);
+    std::vector<Vector3> normals(1000);
+    for(std::size_t i = 0; i != indices.size(); ++i) indices[i] = i;
+    for(std::size_t i = 0; i != normals.size(); ++i) normals[i] = Vector3(Float(i), -0.5f*i, 1.0f);
+
+    std::vector<UnsignedInt> serialIndices(indices);
+    std::vector<Vector3> serialNormals(normals);
+    MeshTools::flipNormals(serialIndices, serialNormals);
+
+    ThreadPool pool(4);
+    pool.setMinimalChunkSize(7);
+    MeshTools::flipNormals(pool, indices, normals);
+
+    CORRADE_COMPARE(indices, serialIndices);
+    CORRADE_COMPARE(normals, serialNormals);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::FlipNormalsTest)
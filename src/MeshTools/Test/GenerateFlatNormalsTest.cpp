@@ -27,6 +27,7 @@
 
 #include "Math/Vector3.h"
 #include "MeshTools/GenerateFlatNormals.h"
+#include "MeshTools/ThreadPool.h"
 
 namespace Magnum { namespace MeshTools { namespace Test {
 
@@ -36,11 +37,13 @@ class GenerateFlatNormalsTest: public TestSuite::Tester {
 
         void wrongIndexCount();
         void generate();
+        void generateParallel();
 };
 
 GenerateFlatNormalsTest::GenerateFlatNormalsTest() {
     addTests({&GenerateFlatNormalsTest::wrongIndexCount,
-              &GenerateFlatNormalsTest::generate});
+              &GenerateFlatNormalsTest::generate,
+              &GenerateFlatNormalsTest::generateParallel});
 }
 
 void GenerateFlatNormalsTest::wrongIndexCount() {
@@ -81,6 +84,34 @@ void GenerateFlatNormalsTest::generate() {
     }));
 }
 
+void GenerateFlatNormalsTest::generateParallel() {
+    /* Triangle strip of a wavy surface, some faces share the normal */
+    std::vector<Vector3> positions;
+    for(std::size_t i = 0; i != 500; ++i) {
+        positions.push_back({Float(i), Float(i%3), 0.0f});
+        positions.push_back({Float(i), Float(i%3), 1.0f});
+    }
+    std::vector<UnsignedInt> indices;
+    for(UnsignedInt i = 0; i != positions.size()-2; ++i) {
+        indices.push_back(i);
+        indices.push_back(i+1);
+        indices.push_back(i+2);
+    }
+
+    std::vector<UnsignedInt> serialNormalIndices;
+    std::vector<Vector3> serialNormals;
+    std::tie(serialNormalIndices, serialNormals) = MeshTools::generateFlatNormals(indices, positions);
+
+    ThreadPool pool(3);
+    pool.setMinimalChunkSize(10);
+    std::vector<UnsignedInt> normalIndices;
+    std::vector<Vector3> normals;
+    std::tie(normalIndices, normals) = MeshTools::generateFlatNormals(pool, indices, positions);
+
+    CORRADE_COMPARE(normalIndices, serialNormalIndices);
+    CORRADE_COMPARE(normals, serialNormals);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::GenerateFlatNormalsTest)
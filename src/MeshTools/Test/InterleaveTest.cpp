@@ -28,6 +28,7 @@
 #include "Utility/Endianness.h"
 #include "Utility/Debug.h"
 #include "MeshTools/Interleave.h"
+#include "MeshTools/ThreadPool.h"
 
 namespace Magnum { namespace MeshTools { namespace Test {
 
@@ -41,6 +42,7 @@ class InterleaveTest: public Corrade::TestSuite::Tester {
         void strideGaps();
         void write();
         void writeGaps();
+        void writeParallel();
 };
 
 InterleaveTest::InterleaveTest() {
@@ -49,7 +51,8 @@ InterleaveTest::InterleaveTest() {
               &InterleaveTest::stride,
               &InterleaveTest::strideGaps,
               &InterleaveTest::write,
-              &InterleaveTest::writeGaps});
+              &InterleaveTest::writeGaps,
+              &InterleaveTest::writeParallel});
 }
 
 void InterleaveTest::attributeCount() {
@@ -139,6 +142,37 @@ void InterleaveTest::writeGaps() {
     delete[] data;
 }
 
+void InterleaveTest::writeParallel() {
+    std::vector<Byte> a;
+    std::vector<Int> b;
+    std::vector<Short> c;
+    for(std::size_t i = 0; i != 1000; ++i) {
+        a.push_back(i%128);
+        b.push_back(i*1234567);
+        c.push_back(-Short(i));
+    }
+
+    std::size_t serialAttributeCount;
+    std::size_t serialStride;
+    char* serialData;
+    std::tie(serialAttributeCount, serialStride, serialData) = MeshTools::interleave(a, 3, b, c, 2);
+
+    ThreadPool pool(4);
+    pool.setMinimalChunkSize(100);
+    std::size_t attributeCount;
+    std::size_t stride;
+    char* data;
+    std::tie(attributeCount, stride, data) = MeshTools::interleave(pool, a, 3, b, c, 2);
+
+    CORRADE_COMPARE(attributeCount, serialAttributeCount);
+    CORRADE_COMPARE(stride, serialStride);
+    std::size_t size = attributeCount*stride;
+    CORRADE_COMPARE(std::vector<char>(data, data+size), std::vector<char>(serialData, serialData+size));
+
+    delete[] serialData;
+    delete[] data;
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::InterleaveTest)
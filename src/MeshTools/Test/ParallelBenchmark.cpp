@@ -0,0 +1,167 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <functional>
+#include <TestSuite/Tester.h>
+
+#include "Math/Matrix4.h"
+#include "Math/Vector2.h"
+#include "MeshTools/Duplicate.h"
+#include "MeshTools/FlipNormals.h"
+#include "MeshTools/GenerateFlatNormals.h"
+#include "MeshTools/Interleave.h"
+#include "MeshTools/ThreadPool.h"
+#include "MeshTools/Transform.h"
+#include "Test/Benchmark.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+using Magnum::Test::measure;
+
+class ParallelBenchmark: public TestSuite::Tester {
+    public:
+        ParallelBenchmark();
+
+        void transformPoints();
+        void transformVectors();
+        void flipNormals();
+        void generateFlatNormals();
+        void duplicate();
+        void interleave();
+
+    private:
+        std::vector<Vector3> positions;
+        std::vector<UnsignedInt> indices;
+};
+
+namespace {
+
+/* Grid of 1024x1024 quads, i.e. ~2M triangles, ~1M vertices */
+constexpr UnsignedInt GridSize = 1024;
+
+constexpr UnsignedInt ThreadCounts[]{1, 2, 4, 8, 16};
+
+/* Prints time and speedup against serial variant for each thread count */
+void measureThreads(const char* name, const std::function<void()>& serial, const std::function<void(ThreadPool&)>& parallel, const std::size_t repeats) {
+    const double serialTime = measure(serial, repeats);
+    Debug() << name;
+    Debug() << "  serial:" << serialTime << "ms";
+    for(UnsignedInt threadCount: ThreadCounts) {
+        ThreadPool pool(threadCount);
+        const double time = measure([&pool, &parallel]() { parallel(pool); }, repeats);
+        Debug() << " " << threadCount << "threads:" << time << "ms, speedup" << serialTime/time;
+    }
+}
+
+}
+
+ParallelBenchmark::ParallelBenchmark() {
+    addTests({&ParallelBenchmark::transformPoints,
+              &ParallelBenchmark::transformVectors,
+              &ParallelBenchmark::flipNormals,
+              &ParallelBenchmark::generateFlatNormals,
+              &ParallelBenchmark::duplicate,
+              &ParallelBenchmark::interleave});
+
+    Debug() << "Hardware threads:" << ThreadPool::defaultThreadCount();
+
+    /* Slightly wavy grid, so the normals are not all the same */
+    positions.reserve((GridSize+1)*(GridSize+1));
+    for(UnsignedInt y = 0; y != GridSize+1; ++y)
+        for(UnsignedInt x = 0; x != GridSize+1; ++x)
+            positions.push_back({Float(x), Float(y), Float((x*7 + y*13)%5)*0.1f});
+
+    indices.reserve(GridSize*GridSize*6);
+    for(UnsignedInt y = 0; y != GridSize; ++y) for(UnsignedInt x = 0; x != GridSize; ++x) {
+        const UnsignedInt i = y*(GridSize+1) + x;
+        indices.insert(indices.end(), {i, i+1, i+GridSize+2,
+                                       i, i+GridSize+2, i+GridSize+1});
+    }
+}
+
+void ParallelBenchmark::transformPoints() {
+    const Matrix4 transformation = Matrix4::translation({1.0f, 2.0f, 3.0f})*Matrix4::rotationX(Deg(35.0f));
+    std::vector<Vector3> points = MeshTools::duplicate(indices, positions);
+
+    measureThreads("transformPointsInPlace() on 6M points:", [&]() {
+        MeshTools::transformPointsInPlace(transformation, points);
+    }, [&](ThreadPool& pool) {
+        MeshTools::transformPointsInPlace(pool, transformation, points);
+    }, 10);
+}
+
+void ParallelBenchmark::transformVectors() {
+    const Quaternion transformation = Quaternion::rotation(Deg(35.0f), Vector3::xAxis());
+    std::vector<Vector3> vectors = MeshTools::duplicate(indices, positions);
+
+    measureThreads("transformVectorsInPlace() on 6M vectors:", [&]() {
+        MeshTools::transformVectorsInPlace(transformation, vectors);
+    }, [&](ThreadPool& pool) {
+        MeshTools::transformVectorsInPlace(pool, transformation, vectors);
+    }, 10);
+}
+
+void ParallelBenchmark::flipNormals() {
+    std::vector<UnsignedInt> flippedIndices = indices;
+    std::vector<Vector3> normals = MeshTools::duplicate(indices, positions);
+
+    measureThreads("flipNormals() on 2M faces:", [&]() {
+        MeshTools::flipNormals(flippedIndices, normals);
+    }, [&](ThreadPool& pool) {
+        MeshTools::flipNormals(pool, flippedIndices, normals);
+    }, 10);
+}
+
+void ParallelBenchmark::generateFlatNormals() {
+    /* Removing the duplicates is serial, thus it won't scale linearly */
+    measureThreads("generateFlatNormals() on 2M faces:", [&]() {
+        MeshTools::generateFlatNormals(indices, positions);
+    }, [&](ThreadPool& pool) {
+        MeshTools::generateFlatNormals(pool, indices, positions);
+    }, 1);
+}
+
+void ParallelBenchmark::duplicate() {
+    measureThreads("duplicate() on 6M indices:", [&]() {
+        MeshTools::duplicate(indices, positions);
+    }, [&](ThreadPool& pool) {
+        MeshTools::duplicate(pool, indices, positions);
+    }, 10);
+}
+
+void ParallelBenchmark::interleave() {
+    const std::vector<Vector3> normals = MeshTools::duplicate(indices, positions);
+    const std::vector<Vector2> textureCoordinates(normals.size());
+
+    measureThreads("interleave() of 6M vertices:", [&]() {
+        delete[] std::get<2>(MeshTools::interleave(normals, textureCoordinates, normals));
+    }, [&](ThreadPool& pool) {
+        delete[] std::get<2>(MeshTools::interleave(pool, normals, textureCoordinates, normals));
+    }, 5);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::ParallelBenchmark)
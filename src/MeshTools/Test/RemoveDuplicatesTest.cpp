@@ -24,6 +24,7 @@
 
 #include <TestSuite/Tester.h>
 
+#include "Math/Vector2.h"
 #include "MeshTools/RemoveDuplicates.h"
 
 namespace Magnum { namespace MeshTools { namespace Test {
@@ -33,12 +34,19 @@ class RemoveDuplicatesTest: public TestSuite::Tester {
         RemoveDuplicatesTest();
 
         void cleanMesh();
+        void spatialHashExact();
+        void spatialHashFuzzy();
+        void spatialHashNeighborCells();
 };
 
 typedef Math::Vector<1, int> Vector1;
+typedef Math::Vector<1, Float> Vector1f;
 
 RemoveDuplicatesTest::RemoveDuplicatesTest() {
-    addTests({&RemoveDuplicatesTest::cleanMesh});
+    addTests({&RemoveDuplicatesTest::cleanMesh,
+              &RemoveDuplicatesTest::spatialHashExact,
+              &RemoveDuplicatesTest::spatialHashFuzzy,
+              &RemoveDuplicatesTest::spatialHashNeighborCells});
 }
 
 void RemoveDuplicatesTest::cleanMesh() {
@@ -51,6 +59,45 @@ void RemoveDuplicatesTest::cleanMesh() {
     CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{0, 1, 0, 1, 0, 2}));
 }
 
+void RemoveDuplicatesTest::spatialHashExact() {
+    std::vector<Vector1> positions{1, 2, 1, 4};
+    std::vector<UnsignedInt> indices{0, 1, 2, 1, 2, 3};
+    MeshTools::removeDuplicatesSpatialHash(indices, positions);
+
+    CORRADE_VERIFY(positions == (std::vector<Vector1>{1, 2, 4}));
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{0, 1, 0, 1, 0, 2}));
+
+    /* Zero epsilon for floats, unreferenced vertex is removed */
+    std::vector<Vector1f> positionsf{1.0f, 5.0f, 2.0f, 1.0f};
+    std::vector<UnsignedInt> indicesf{3, 2, 0};
+    MeshTools::removeDuplicatesSpatialHash(indicesf, positionsf, 0.0f);
+
+    CORRADE_VERIFY(positionsf == (std::vector<Vector1f>{1.0f, 2.0f}));
+    CORRADE_COMPARE(indicesf, (std::vector<UnsignedInt>{0, 1, 0}));
+}
+
+void RemoveDuplicatesTest::spatialHashFuzzy() {
+    /* 1.9 is melt to 1.0, 3.0 is too far from it, 3.8 is nearer to 4.5 than
+       to 3.0 */
+    std::vector<Vector1f> positions{1.0f, 1.9f, 3.0f, 10.0f, 4.5f, 3.8f};
+    std::vector<UnsignedInt> indices{0, 1, 2, 3, 4, 5};
+    MeshTools::removeDuplicatesSpatialHash(indices, positions, 1.0f);
+
+    CORRADE_VERIFY(positions == (std::vector<Vector1f>{1.0f, 3.0f, 10.0f, 4.5f}));
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{0, 0, 1, 2, 3, 3}));
+}
+
+void RemoveDuplicatesTest::spatialHashNeighborCells() {
+    /* Second vertex is in the same cell as first, but too far. Third is in
+       diagonal neighbor cell and near enough to the second. */
+    std::vector<Vector2> positions{{0.0f, 0.0f}, {1.9f, 1.9f}, {2.3f, 2.3f}};
+    std::vector<UnsignedInt> indices{0, 1, 2};
+    MeshTools::removeDuplicatesSpatialHash(indices, positions, 1.0f);
+
+    CORRADE_VERIFY(positions == (std::vector<Vector2>{{0.0f, 0.0f}, {1.9f, 1.9f}}));
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{0, 1, 1}));
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::RemoveDuplicatesTest)
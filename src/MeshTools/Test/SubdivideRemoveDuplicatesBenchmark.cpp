@@ -22,62 +22,122 @@
     DEALINGS IN THE SOFTWARE.
 */
 
-#include "SubdivideRemoveDuplicatesBenchmark.h"
+#include <TestSuite/Tester.h>
 
-#include <QtTest/QTest>
-
-#include "Primitives/Icosphere.h"
+#include "Math/Vector3.h"
 #include "MeshTools/RemoveDuplicates.h"
 #include "MeshTools/Subdivide.h"
-
-QTEST_APPLESS_MAIN(Magnum::MeshTools::Test::SubdivideRemoveDuplicatesBenchmark)
+#include "Primitives/Icosphere.h"
+#include "Test/Benchmark.h"
 
 namespace Magnum { namespace MeshTools { namespace Test {
 
-void SubdivideRemoveDuplicatesBenchmark::subdivide() {
-    QBENCHMARK {
-        Primitives::Icosphere<0> icosphere;
-
-        /* Subdivide 5 times */
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-    }
+using Magnum::Test::measure;
+
+class SubdivideRemoveDuplicatesBenchmark: public TestSuite::Tester {
+    public:
+        SubdivideRemoveDuplicatesBenchmark();
+
+        void subdivide();
+        void subdivideAndRemoveDuplicatesMeshAfter();
+        void subdivideAndRemoveDuplicatesMeshBetween();
+        void removeDuplicatesLarge();
+};
+
+namespace {
+
+Vector3 interpolator(const Vector3& a, const Vector3& b) {
+    return (a+b).normalized();
 }
 
-void SubdivideRemoveDuplicatesBenchmark::subdivideAndRemoveDuplicatesMeshAfter() {
-    QBENCHMARK {
-        Primitives::Icosphere<0> icosphere;
+enum class Engine { None, Grid, SpatialHash };
 
-        /* Subdivide 5 times */
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
+void removeDuplicates(Engine engine, std::vector<UnsignedInt>& indices, std::vector<Vector3>& vertices) {
+    if(engine == Engine::Grid) MeshTools::removeDuplicates(indices, vertices);
+    else if(engine == Engine::SpatialHash) MeshTools::removeDuplicatesSpatialHash(indices, vertices);
+}
+
+/* Subdivides icosphere given number of times, removing duplicates using
+   given engine after each subdivision or only at the end */
+std::size_t icosphere(std::size_t subdivisions, Engine engine, bool between) {
+    Primitives::Icosphere<0> icosphere;
+    std::vector<UnsignedInt>& indices = *icosphere.indices();
+    std::vector<Vector3>& vertices = *icosphere.normals(0);
 
-        MeshTools::removeDuplicates(*icosphere.indices(), *icosphere.positions(0));
+    for(std::size_t i = 0; i != subdivisions; ++i) {
+        MeshTools::subdivide(indices, vertices, interpolator);
+        if(between) removeDuplicates(engine, indices, vertices);
     }
+
+    if(!between) removeDuplicates(engine, indices, vertices);
+    return vertices.size();
+}
+
+}
+
+SubdivideRemoveDuplicatesBenchmark::SubdivideRemoveDuplicatesBenchmark() {
+    addTests({&SubdivideRemoveDuplicatesBenchmark::subdivide,
+              &SubdivideRemoveDuplicatesBenchmark::subdivideAndRemoveDuplicatesMeshAfter,
+              &SubdivideRemoveDuplicatesBenchmark::subdivideAndRemoveDuplicatesMeshBetween,
+              &SubdivideRemoveDuplicatesBenchmark::removeDuplicatesLarge});
+}
+
+void SubdivideRemoveDuplicatesBenchmark::subdivide() {
+    Debug() << "Subdivide 5 times:" << measure([]() {
+        icosphere(5, Engine::None, false);
+    }, 20) << "ms";
+}
+
+void SubdivideRemoveDuplicatesBenchmark::subdivideAndRemoveDuplicatesMeshAfter() {
+    /* Both engines give the same vertex count (10*4^5 + 2) */
+    CORRADE_COMPARE(icosphere(5, Engine::Grid, false), 10242);
+    CORRADE_COMPARE(icosphere(5, Engine::SpatialHash, false), 10242);
+
+    Debug() << "Subdivide 5 times, remove duplicates after:";
+    Debug() << "  removeDuplicates():" << measure([]() {
+        icosphere(5, Engine::Grid, false);
+    }, 20) << "ms";
+    Debug() << "  removeDuplicatesSpatialHash():" << measure([]() {
+        icosphere(5, Engine::SpatialHash, false);
+    }, 20) << "ms";
 }
 
 void SubdivideRemoveDuplicatesBenchmark::subdivideAndRemoveDuplicatesMeshBetween() {
-    QBENCHMARK {
-        Primitives::Icosphere<0> icosphere;
-
-        /* Subdivide 5 times */
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::removeDuplicates(*icosphere.indices(), *icosphere.positions(0));
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::removeDuplicates(*icosphere.indices(), *icosphere.positions(0));
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::removeDuplicates(*icosphere.indices(), *icosphere.positions(0));
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::removeDuplicates(*icosphere.indices(), *icosphere.positions(0));
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::removeDuplicates(*icosphere.indices(), *icosphere.positions(0));
-    }
+    CORRADE_COMPARE(icosphere(5, Engine::Grid, true), 10242);
+    CORRADE_COMPARE(icosphere(5, Engine::SpatialHash, true), 10242);
+
+    Debug() << "Subdivide 5 times, remove duplicates between:";
+    Debug() << "  removeDuplicates():" << measure([]() {
+        icosphere(5, Engine::Grid, true);
+    }, 20) << "ms";
+    Debug() << "  removeDuplicatesSpatialHash():" << measure([]() {
+        icosphere(5, Engine::SpatialHash, true);
+    }, 20) << "ms";
+}
+
+void SubdivideRemoveDuplicatesBenchmark::removeDuplicatesLarge() {
+    /* 8 subdivisions without removing duplicates, ~1.3M vertices */
+    Primitives::Icosphere<0> icosphere;
+    std::vector<UnsignedInt> indices = *icosphere.indices();
+    std::vector<Vector3> vertices = *icosphere.normals(0);
+    for(std::size_t i = 0; i != 8; ++i)
+        MeshTools::subdivide(indices, vertices, interpolator);
+
+    Debug() << "Remove duplicates from" << vertices.size() << "vertices:";
+    Debug() << "  removeDuplicates():" << measure([&]() {
+        std::vector<UnsignedInt> i = indices;
+        std::vector<Vector3> v = vertices;
+        MeshTools::removeDuplicates(i, v);
+        CORRADE_COMPARE(v.size(), 655362);
+    }, 1) << "ms";
+    Debug() << "  removeDuplicatesSpatialHash():" << measure([&]() {
+        std::vector<UnsignedInt> i = indices;
+        std::vector<Vector3> v = vertices;
+        MeshTools::removeDuplicatesSpatialHash(i, v);
+        CORRADE_COMPARE(v.size(), 655362);
+    }, 1) << "ms";
 }
 
 }}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::SubdivideRemoveDuplicatesBenchmark)
@@ -0,0 +1,155 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <sstream>
+#include <TestSuite/Tester.h>
+
+#include "Magnum.h"
+#include "MeshTools/ThreadPool.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+typedef std::pair<std::size_t, std::size_t> Range;
+
+class ThreadPoolTest: public TestSuite::Tester {
+    public:
+        ThreadPoolTest();
+
+        void construct();
+        void constructDefault();
+        void zeroMinimalChunkSize();
+        void chunks();
+        void chunksSmall();
+        void run();
+        void runSerial();
+        void runRepeated();
+};
+
+ThreadPoolTest::ThreadPoolTest() {
+    addTests({&ThreadPoolTest::construct,
+              &ThreadPoolTest::constructDefault,
+              &ThreadPoolTest::zeroMinimalChunkSize,
+              &ThreadPoolTest::chunks,
+              &ThreadPoolTest::chunksSmall,
+              &ThreadPoolTest::run,
+              &ThreadPoolTest::runSerial,
+              &ThreadPoolTest::runRepeated});
+}
+
+void ThreadPoolTest::construct() {
+    ThreadPool pool(3);
+    CORRADE_COMPARE(pool.threadCount(), 3);
+    CORRADE_COMPARE(pool.minimalChunkSize(), 4096);
+}
+
+void ThreadPoolTest::constructDefault() {
+    ThreadPool pool;
+    CORRADE_COMPARE(pool.threadCount(), ThreadPool::defaultThreadCount());
+    CORRADE_VERIFY(pool.threadCount() >= 1);
+}
+
+void ThreadPoolTest::zeroMinimalChunkSize() {
+    std::stringstream ss;
+    Error::setOutput(&ss);
+
+    ThreadPool pool(2);
+    pool.setMinimalChunkSize(0);
+    CORRADE_COMPARE(pool.minimalChunkSize(), 4096);
+    CORRADE_COMPARE(ss.str(), "MeshTools::ThreadPool::setMinimalChunkSize(): the size must not be zero\n");
+}
+
+void ThreadPoolTest::chunks() {
+    ThreadPool pool(4);
+    pool.setMinimalChunkSize(10);
+
+    /* 42 = 11 + 11 + 10 + 10 */
+    CORRADE_COMPARE(pool.chunkCount(42), 4);
+    CORRADE_VERIFY(pool.chunk(42, 0) == Range(0, 11));
+    CORRADE_VERIFY(pool.chunk(42, 1) == Range(11, 22));
+    CORRADE_VERIFY(pool.chunk(42, 2) == Range(22, 32));
+    CORRADE_VERIFY(pool.chunk(42, 3) == Range(32, 42));
+}
+
+void ThreadPoolTest::chunksSmall() {
+    ThreadPool pool(4);
+    pool.setMinimalChunkSize(10);
+
+    /* Not enough elements for all threads */
+    CORRADE_COMPARE(pool.chunkCount(25), 2);
+    CORRADE_VERIFY(pool.chunk(25, 0) == Range(0, 13));
+    CORRADE_VERIFY(pool.chunk(25, 1) == Range(13, 25));
+
+    /* Too small to be split */
+    CORRADE_COMPARE(pool.chunkCount(19), 1);
+    CORRADE_VERIFY(pool.chunk(19, 0) == Range(0, 19));
+    CORRADE_COMPARE(pool.chunkCount(0), 1);
+}
+
+void ThreadPoolTest::run() {
+    ThreadPool pool(4);
+    pool.setMinimalChunkSize(1);
+
+    /* Each element must be processed exactly once */
+    std::vector<Int> data(1001);
+    pool.run(data.size(), [&data](std::size_t begin, std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) ++data[i];
+    });
+    CORRADE_COMPARE(data, std::vector<Int>(1001, 1));
+}
+
+void ThreadPoolTest::runSerial() {
+    ThreadPool pool(1);
+    pool.setMinimalChunkSize(1);
+    CORRADE_COMPARE(pool.chunkCount(1000), 1);
+
+    std::vector<Range> ranges;
+    pool.run(1000, [&ranges](std::size_t begin, std::size_t end) {
+        ranges.push_back({begin, end});
+    });
+    CORRADE_COMPARE(ranges.size(), 1);
+    CORRADE_VERIFY(ranges[0] == Range(0, 1000));
+
+    /* Nothing to do, function is not called */
+    pool.run(0, [&ranges](std::size_t begin, std::size_t end) {
+        ranges.push_back({begin, end});
+    });
+    CORRADE_COMPARE(ranges.size(), 1);
+}
+
+void ThreadPoolTest::runRepeated() {
+    ThreadPool pool(3);
+    pool.setMinimalChunkSize(1);
+
+    /* The pool must survive many consecutive jobs */
+    std::vector<Int> data(100);
+    for(Int j = 0; j != 1000; ++j) pool.run(data.size(), [&data](std::size_t begin, std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) ++data[i];
+    });
+    CORRADE_COMPARE(data, std::vector<Int>(100, 1000));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::ThreadPoolTest)
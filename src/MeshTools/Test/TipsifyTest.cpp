@@ -35,6 +35,8 @@ class TipsifyTest: public TestSuite::Tester {
 
         void buildAdjacency();
         void tipsify();
+        void tipsifyScratch();
+        void averageCacheMissRatio();
 
     private:
         std::vector<UnsignedInt> indices;
@@ -81,7 +83,9 @@ TipsifyTest::TipsifyTest(): indices{
     16, 17, 18
 }, vertexCount(19) {
     addTests({&TipsifyTest::buildAdjacency,
-              &TipsifyTest::tipsify});
+              &TipsifyTest::tipsify,
+              &TipsifyTest::tipsifyScratch,
+              &TipsifyTest::averageCacheMissRatio});
 }
 
 void TipsifyTest::buildAdjacency() {
@@ -155,6 +159,33 @@ void TipsifyTest::tipsify() {
     }));
 }
 
+void TipsifyTest::tipsifyScratch() {
+    std::vector<UnsignedInt> expected = indices;
+    MeshTools::tipsify(expected, vertexCount, 3);
+
+    /* Same result as without scratch memory, also when reusing it */
+    MeshTools::TipsifyScratch scratch;
+    for(std::size_t i = 0; i != 2; ++i) {
+        std::vector<UnsignedInt> indices = this->indices;
+        CORRADE_COMPARE(MeshTools::tipsify(indices, vertexCount, 3, scratch),
+                        MeshTools::averageCacheMissRatio(expected, vertexCount, 3));
+        CORRADE_COMPARE(indices, expected);
+    }
+}
+
+void TipsifyTest::averageCacheMissRatio() {
+    /* Empty mesh */
+    CORRADE_COMPARE(MeshTools::averageCacheMissRatio({}, 0, 3), 0.0f);
+
+    /* Full reuse, partial reuse */
+    CORRADE_COMPARE(MeshTools::averageCacheMissRatio({0, 1, 2, 2, 1, 0}, 3, 3), 1.5f);
+    CORRADE_COMPARE(MeshTools::averageCacheMissRatio({0, 1, 2, 2, 1, 3}, 4, 3), 2.0f);
+
+    /* FIFO cache, vertices are evicted in order of insertion */
+    CORRADE_COMPARE(MeshTools::averageCacheMissRatio({0, 1, 2, 3, 4, 5, 0, 1, 2}, 6, 3), 3.0f);
+    CORRADE_COMPARE(MeshTools::averageCacheMissRatio({0, 1, 2, 0, 3, 0, 4, 5, 1}, 6, 3), 8.0f/3.0f);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::TipsifyTest)
@@ -23,6 +23,7 @@
 */
 
 #include <array>
+#include <cstring>
 #include <TestSuite/Tester.h>
 
 #include "Math/Matrix3.h"
@@ -40,6 +41,11 @@ class TransformTest: public TestSuite::Tester {
 
         void transformPoints2D();
         void transformPoints3D();
+
+        void transformNormals2D();
+        void transformNormals3D();
+
+        void transformParallel();
 };
 
 TransformTest::TransformTest() {
@@ -47,7 +53,12 @@ TransformTest::TransformTest() {
               &TransformTest::transformVectors3D,
 
               &TransformTest::transformPoints2D,
-              &TransformTest::transformPoints3D});
+              &TransformTest::transformPoints3D,
+
+              &TransformTest::transformNormals2D,
+              &TransformTest::transformNormals3D,
+
+              &TransformTest::transformParallel});
 }
 
 /* GCC < 4.7 doesn't like constexpr here, don't know why */
@@ -125,6 +136,69 @@ void TransformTest::transformPoints3D() {
     CORRADE_COMPARE(quaternion, points3DRotatedTranslated);
 }
 
+void TransformTest::transformNormals2D() {
+    /* Normal of x + y = 1 line, which becomes 2x + y = 2 after scaling */
+    const std::vector<Vector2> normals{Vector2(1.0f, 1.0f).normalized()};
+    auto matrix = MeshTools::transformNormals(Matrix3::scaling({0.5f, 1.0f}), normals);
+
+    CORRADE_COMPARE(matrix.size(), 1);
+    CORRADE_COMPARE(matrix[0], Vector2(2.0f, 1.0f).normalized());
+}
+
+void TransformTest::transformNormals3D() {
+    /* Normal of x + y = 1 plane, which becomes 2x + y = 2 after scaling, the
+       last one is just rotated */
+    const std::vector<Vector3> normals{
+        Vector3(1.0f, 1.0f, 0.0f).normalized(),
+        Vector3::zAxis(),
+        Vector3::xAxis(),
+        Vector3::yAxis(),
+        Vector3::zAxis()};
+    auto matrix = MeshTools::transformNormals(Matrix4::translation(Vector3::yAxis(5.0f))*Matrix4::scaling({0.5f, 1.0f, 3.0f}), normals);
+    auto rotated = MeshTools::transformNormals(Matrix4::rotationZ(Deg(90.0f))*Matrix4::scaling(Vector3(2.0f)), normals);
+
+    CORRADE_COMPARE(matrix, (std::vector<Vector3>{
+        Vector3(2.0f, 1.0f, 0.0f).normalized(),
+        Vector3::zAxis(),
+        Vector3::xAxis(),
+        Vector3::yAxis(),
+        Vector3::zAxis()}));
+    CORRADE_COMPARE(rotated, (std::vector<Vector3>{
+        Vector3(-1.0f, 1.0f, 0.0f).normalized(),
+        Vector3::zAxis(),
+        Vector3::yAxis(),
+        -Vector3::xAxis(),
+        Vector3::zAxis()}));
+}
+
+void TransformTest::transformParallel() {
+    std::vector<Vector3> points;
+    for(std::size_t i = 0; i != 1000; ++i)
+        points.push_back({0.1f*i, -3.7f + i, 1.0f/(i + 1)});
+
+    const Matrix4 matrix = Matrix4::translation(Vector3::yAxis(-1.0f))*Matrix4::rotation(Deg(37.0f), Vector3(1.0f, 2.0f, 3.0f).normalized());
+    const Quaternion quaternion = Quaternion::rotation(Deg(37.0f), Vector3(1.0f, 2.0f, 3.0f).normalized());
+
+    ThreadPool pool(4);
+    pool.setMinimalChunkSize(33);
+
+    /* The output must be bit-identical, not just fuzzy-equal */
+    const std::vector<Vector3> serialPoints = MeshTools::transformPoints(matrix, points);
+    const std::vector<Vector3> parallelPoints = MeshTools::transformPoints(pool, matrix, points);
+    CORRADE_COMPARE(parallelPoints.size(), serialPoints.size());
+    CORRADE_VERIFY(std::memcmp(parallelPoints.data(), serialPoints.data(), serialPoints.size()*sizeof(Vector3)) == 0);
+
+    const std::vector<Vector3> serialVectors = MeshTools::transformVectors(quaternion, points);
+    const std::vector<Vector3> parallelVectors = MeshTools::transformVectors(pool, quaternion, points);
+    CORRADE_COMPARE(parallelVectors.size(), serialVectors.size());
+    CORRADE_VERIFY(std::memcmp(parallelVectors.data(), serialVectors.data(), serialVectors.size()*sizeof(Vector3)) == 0);
+
+    const std::vector<Vector3> serialNormals = MeshTools::transformNormals(matrix*Matrix4::scaling({2.0f, 1.0f, 0.5f}), points);
+    const std::vector<Vector3> parallelNormals = MeshTools::transformNormals(pool, matrix*Matrix4::scaling({2.0f, 1.0f, 0.5f}), points);
+    CORRADE_COMPARE(parallelNormals.size(), serialNormals.size());
+    CORRADE_VERIFY(std::memcmp(parallelNormals.data(), serialNormals.data(), serialNormals.size()*sizeof(Vector3)) == 0);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::TransformTest)
@@ -0,0 +1,131 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <Utility/Assert.h>
+
+namespace Magnum { namespace MeshTools {
+
+UnsignedInt ThreadPool::defaultThreadCount() {
+    const UnsignedInt count = std::thread::hardware_concurrency();
+    return count ? count : 1;
+}
+
+ThreadPool::ThreadPool(UnsignedInt threadCount): _minimalChunkSize(4096), _function(nullptr), _count(0), _chunkCount(0), _nextChunk(0), _finishedChunks(0), _generation(0), _quit(false) {
+    if(!threadCount) threadCount = defaultThreadCount();
+
+    /* The calling thread does part of the work too */
+    _workers.reserve(threadCount-1);
+    for(UnsignedInt i = 1; i != threadCount; ++i)
+        _workers.emplace_back(&ThreadPool::work, this);
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _quit = true;
+    }
+    _jobAvailable.notify_all();
+
+    for(std::thread& worker: _workers) worker.join();
+}
+
+ThreadPool* ThreadPool::setMinimalChunkSize(std::size_t size) {
+    CORRADE_ASSERT(size, "MeshTools::ThreadPool::setMinimalChunkSize(): the size must not be zero", this);
+    _minimalChunkSize = size;
+    return this;
+}
+
+std::size_t ThreadPool::chunkCount(std::size_t count) const {
+    return std::max(std::min(std::size_t(threadCount()), count/_minimalChunkSize), std::size_t(1));
+}
+
+std::pair<std::size_t, std::size_t> ThreadPool::chunk(std::size_t count, std::size_t chunk) const {
+    /* First count%chunkCount chunks are one element larger */
+    const std::size_t chunkCount = this->chunkCount(count);
+    const std::size_t size = count/chunkCount;
+    const std::size_t remainder = count%chunkCount;
+    const std::size_t begin = chunk*size + std::min(chunk, remainder);
+    return {begin, begin + size + (chunk < remainder ? 1 : 0)};
+}
+
+void ThreadPool::run(std::size_t count, const std::function<void(std::size_t, std::size_t)>& function) {
+    /* Not worth the synchronization */
+    const std::size_t chunkCount = this->chunkCount(count);
+    if(chunkCount == 1) {
+        if(count) function(0, count);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _function = &function;
+        _count = count;
+        _chunkCount = chunkCount;
+        _nextChunk = 0;
+        _finishedChunks = 0;
+        ++_generation;
+    }
+    _jobAvailable.notify_all();
+
+    /* Help with the work and then wait for the rest */
+    processChunks();
+    std::unique_lock<std::mutex> lock(_mutex);
+    _jobDone.wait(lock, [this]() { return _finishedChunks == _chunkCount; });
+    _function = nullptr;
+}
+
+void ThreadPool::work() {
+    UnsignedInt generation = 0;
+    for(;;) {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _jobAvailable.wait(lock, [this, generation]() { return _quit || _generation != generation; });
+            if(_quit) return;
+            generation = _generation;
+        }
+
+        processChunks();
+    }
+}
+
+void ThreadPool::processChunks() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while(_function && _nextChunk != _chunkCount) {
+        const std::size_t chunk = _nextChunk++;
+        const std::function<void(std::size_t, std::size_t)>& function = *_function;
+        const std::pair<std::size_t, std::size_t> range = this->chunk(_count, chunk);
+
+        lock.unlock();
+        function(range.first, range.second);
+        lock.lock();
+
+        if(++_finishedChunks == _chunkCount) _jobDone.notify_one();
+    }
+}
+
+}}
@@ -0,0 +1,173 @@
+#ifndef Magnum_MeshTools_ThreadPool_h
+#define Magnum_MeshTools_ThreadPool_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class Magnum::MeshTools::ThreadPool
+ */
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Types.h"
+#include "magnumMeshToolsVisibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Thread pool for parallel mesh processing
+
+Persistent set of worker threads used by parallel variants of MeshTools
+functions, such as @ref flipNormals(ThreadPool&, std::vector<Vector3>&) "flipNormals()",
+@ref generateFlatNormals(ThreadPool&, const std::vector<UnsignedInt>&, const std::vector<Vector3>&) "generateFlatNormals()",
+transformPointsInPlace(), transformVectorsInPlace(), duplicate() or
+interleave(). The pool is meant to be created once and reused for many
+operations, as spawning the threads is not free:
+@code
+MeshTools::ThreadPool pool;
+for(Mesh& mesh: meshes) {
+    MeshTools::transformPointsInPlace(pool, transformation, mesh.positions);
+    MeshTools::flipNormals(pool, mesh.indices, mesh.normals);
+}
+@endcode
+
+The work is split into contiguous chunks, the split depends only on element
+count, thread count and minimal chunk size, so it is the same for every run.
+Every element is processed by exactly the same code as in the serial variant
+of given function, thus the output is bit-identical to it regardless of the
+thread count.
+
+The pool is not meant to be used from more than one thread at a time. The
+thread calling run() processes one of the chunks itself, so pool with thread
+count set to `1` doesn't create any worker threads and runs everything
+serially.
+*/
+class MAGNUM_MESHTOOLS_EXPORT ThreadPool {
+    public:
+        /**
+         * @brief Default thread count
+         *
+         * Count of hardware threads, or `1` if it cannot be detected.
+         */
+        static UnsignedInt defaultThreadCount();
+
+        /**
+         * @brief Constructor
+         * @param threadCount   Thread count, including the calling thread
+         *
+         * If @p threadCount is `0`, defaultThreadCount() is used.
+         */
+        explicit ThreadPool(UnsignedInt threadCount = 0);
+
+        /** @brief Copying is not allowed */
+        ThreadPool(const ThreadPool&) = delete;
+
+        /** @brief Moving is not allowed */
+        ThreadPool(ThreadPool&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Stops and joins all worker threads.
+         */
+        ~ThreadPool();
+
+        /** @brief Copying is not allowed */
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /** @brief Moving is not allowed */
+        ThreadPool& operator=(ThreadPool&&) = delete;
+
+        /** @brief Thread count, including the calling thread */
+        UnsignedInt threadCount() const { return _workers.size()+1; }
+
+        /** @brief Minimal chunk size */
+        std::size_t minimalChunkSize() const { return _minimalChunkSize; }
+
+        /**
+         * @brief Set minimal chunk size
+         * @return Pointer to self (for method chaining)
+         *
+         * Input smaller than twice this value is processed serially in the
+         * calling thread, as the synchronization would cost more than the
+         * work itself. Default is `4096`, minimal allowed value is `1`.
+         */
+        ThreadPool* setMinimalChunkSize(std::size_t size);
+
+        /**
+         * @brief Chunk count for given element count
+         *
+         * At most threadCount(), each chunk at least minimalChunkSize()
+         * elements large, unless there is only one chunk.
+         */
+        std::size_t chunkCount(std::size_t count) const;
+
+        /**
+         * @brief Range of given chunk
+         * @param count     Element count
+         * @param chunk     Chunk index, less than chunkCount()
+         * @return Index of first element and one past last element
+         *
+         * The chunks are contiguous, in increasing order and differ in size
+         * by at most one element.
+         */
+        std::pair<std::size_t, std::size_t> chunk(std::size_t count, std::size_t chunk) const;
+
+        /**
+         * @brief Run given function in parallel
+         * @param count     Element count
+         * @param function  Function processing elements in range
+         *      @f$ [ begin, end ) @f$
+         *
+         * Splits @p count elements into chunkCount() chunks and calls
+         * @p function for each of them in parallel, blocks until all chunks
+         * are processed. The function must not write to memory touched by
+         * other chunks.
+         */
+        void run(std::size_t count, const std::function<void(std::size_t, std::size_t)>& function);
+
+    private:
+        void work();
+        void processChunks();
+
+        std::vector<std::thread> _workers;
+        std::size_t _minimalChunkSize;
+
+        std::mutex _mutex;
+        std::condition_variable _jobAvailable, _jobDone;
+
+        /* Current job, guarded by the mutex */
+        const std::function<void(std::size_t, std::size_t)>* _function;
+        std::size_t _count, _chunkCount, _nextChunk, _finishedChunks;
+        UnsignedInt _generation;
+        bool _quit;
+};
+
+}}
+
+#endif
@@ -24,48 +24,64 @@
 
 #include "Tipsify.h"
 
-#include <stack>
-
 namespace Magnum { namespace MeshTools { namespace Implementation {
 
 void Tipsify::operator()(std::size_t cacheSize) {
+    TipsifyScratch scratch;
+    operator()(cacheSize, scratch);
+}
+
+void Tipsify::operator()(std::size_t cacheSize, TipsifyScratch& scratch) {
     /* Neighboring triangles for each vertex, per-vertex live triangle count */
-    std::vector<UnsignedInt> liveTriangleCount, neighborPosition, neighbors;
+    std::vector<UnsignedInt>& liveTriangleCount = scratch.liveTriangleCount;
+    std::vector<UnsignedInt>& neighborPosition = scratch.neighborOffset;
+    std::vector<UnsignedInt>& neighbors = scratch.neighbors;
     buildAdjacency(liveTriangleCount, neighborPosition, neighbors);
 
     /* Global time, per-vertex caching timestamps, per-triangle emmited flag */
     UnsignedInt time = cacheSize+1;
-    std::vector<UnsignedInt> timestamp(vertexCount);
-    std::vector<bool> emitted(indices.size()/3);
+    std::vector<UnsignedInt>& timestamp = scratch.timestamp;
+    timestamp.assign(vertexCount, 0);
+    std::vector<UnsignedByte>& emitted = scratch.emitted;
+    emitted.assign(indices.size()/3, 0);
 
-    /* Dead-end vertex stack */
-    std::stack<UnsignedInt> deadEndStack;
+    /* Dead-end vertex stack. Bounded, when full, the oldest entries are
+       overwritten, as they are most probably out of the cache anyway */
+    std::vector<UnsignedInt>& deadEndStack = scratch.deadEndStack;
+    const std::size_t deadEndStackCapacity = 4*cacheSize;
+    deadEndStack.resize(deadEndStackCapacity);
+    std::size_t deadEndStackTop = 0, deadEndStackSize = 0;
+
+    /* Candidates for next fanning vertex (in 1-ring around fanning vertex) */
+    std::vector<UnsignedInt>& candidates = scratch.candidates;
 
     /* Output index buffer */
-    std::vector<UnsignedInt> outputIndices;
+    std::vector<UnsignedInt>& outputIndices = scratch.outputIndices;
+    outputIndices.clear();
     outputIndices.reserve(indices.size());
 
     /* Starting vertex for fanning, cursor */
     UnsignedInt fanningVertex = 0;
     UnsignedInt i = 0;
     while(fanningVertex != 0xFFFFFFFFu) {
-        /* Array with candidates for next fanning vertex (in 1-ring around
-           fanning vertex) */
-        std::vector<UnsignedInt> candidates;
+        candidates.clear();
 
         /* For all neighbors of fanning vertex */
         for(UnsignedInt ti = neighborPosition[fanningVertex], t = neighbors[ti]; ti != neighborPosition[fanningVertex+1]; t = neighbors[++ti]) {
             /* Continue if already emitted */
             if(emitted[t]) continue;
-            emitted[t] = true;
+            emitted[t] = 1;
 
             /* Write all vertices of the triangle to output buffer */
             for(UnsignedInt vi = 0, v = indices[t*3]; vi != 3; v = indices[++vi+t*3]) {
                 outputIndices.push_back(v);
 
                 /* Add to dead end stack and candidates array */
-                /** @todo Limit size of dead end stack to cache size */
-                deadEndStack.push(v);
+                if(deadEndStackCapacity) {
+                    deadEndStack[deadEndStackTop] = v;
+                    if(++deadEndStackTop == deadEndStackCapacity) deadEndStackTop = 0;
+                    if(deadEndStackSize != deadEndStackCapacity) ++deadEndStackSize;
+                }
                 candidates.push_back(v);
 
                 /* Decrease live triangle count */
@@ -101,9 +117,10 @@ void Tipsify::operator()(std::size_t cacheSize) {
         /* On dead-end */
         if(fanningVertex == 0xFFFFFFFFu) {
             /* Find vertex with live triangles in dead-end stack */
-            while(!deadEndStack.empty()) {
-                unsigned int d = deadEndStack.top();
-                deadEndStack.pop();
+            while(deadEndStackSize) {
+                if(!deadEndStackTop) deadEndStackTop = deadEndStackCapacity;
+                const UnsignedInt d = deadEndStack[--deadEndStackTop];
+                --deadEndStackSize;
 
                 if(!liveTriangleCount[d]) continue;
                 fanningVertex = d;
@@ -112,7 +129,7 @@ void Tipsify::operator()(std::size_t cacheSize) {
 
             /* If not found, find next artbitrary vertex with live
                triangles */
-            while(++i < vertexCount) {
+            if(fanningVertex == 0xFFFFFFFFu) while(++i < vertexCount) {
                 if(!liveTriangleCount[i]) continue;
 
                 fanningVertex = i;
@@ -121,7 +138,8 @@ void Tipsify::operator()(std::size_t cacheSize) {
         }
     }
 
-    /* Swap original index buffer with optimized */
+    /* Swap original index buffer with optimized, keep the original one as
+       scratch memory for next run */
     std::swap(indices, outputIndices);
 }
 
@@ -154,4 +172,19 @@ void Tipsify::buildAdjacency(std::vector<UnsignedInt>& liveTriangleCount, std::v
         neighbors[neighborOffset[indices[i]+1]++] = i/3;
 }
 
+Float averageCacheMissRatio(const std::vector<UnsignedInt>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize, std::vector<UnsignedInt>& timestamp) {
+    if(indices.size() < 3) return 0.0f;
+
+    /* The same cache model as in Tipsify::operator() */
+    UnsignedInt time = cacheSize+1;
+    timestamp.assign(vertexCount, 0);
+    std::size_t misses = 0;
+    for(UnsignedInt v: indices) if(time-timestamp[v] > cacheSize) {
+        timestamp[v] = time++;
+        ++misses;
+    }
+
+    return Float(misses)/(indices.size()/3);
+}
+
 }}}
@@ -25,7 +25,7 @@
 */
 
 /** @file
- * @brief Function Magnum::MeshTools::tipsify()
+ * @brief Function Magnum::MeshTools::tipsify(), Magnum::MeshTools::averageCacheMissRatio(), class Magnum::MeshTools::TipsifyScratch
  */
 
 #include <vector>
@@ -35,6 +35,8 @@
 
 namespace Magnum { namespace MeshTools {
 
+class TipsifyScratch;
+
 namespace Implementation {
 
 class MAGNUM_MESHTOOLS_EXPORT Tipsify {
@@ -42,6 +44,7 @@ class MAGNUM_MESHTOOLS_EXPORT Tipsify {
         Tipsify(std::vector<UnsignedInt>& indices, UnsignedInt vertexCount): indices(indices), vertexCount(vertexCount) {}
 
         void operator()(std::size_t cacheSize);
+        void operator()(std::size_t cacheSize, TipsifyScratch& scratch);
 
         /**
          * @brief Build vertex-triangle adjacency
@@ -57,8 +60,28 @@ class MAGNUM_MESHTOOLS_EXPORT Tipsify {
         const UnsignedInt vertexCount;
 };
 
+Float MAGNUM_MESHTOOLS_EXPORT averageCacheMissRatio(const std::vector<UnsignedInt>& indices, UnsignedInt vertexCount, std::size_t cacheSize, std::vector<UnsignedInt>& timestamp);
+
 }
 
+/**
+@brief Scratch memory for tipsify()
+
+Holds all temporary arrays needed by tipsify(). Passing the same instance to
+subsequent tipsify() calls avoids all allocations except the ones needed for
+growing the arrays for larger meshes.
+@see averageCacheMissRatio()
+*/
+class TipsifyScratch {
+    friend class Implementation::Tipsify;
+    friend Float tipsify(std::vector<UnsignedInt>&, UnsignedInt, std::size_t, TipsifyScratch&);
+
+    private:
+        std::vector<UnsignedInt> liveTriangleCount, neighborOffset, neighbors;
+        std::vector<UnsignedInt> timestamp, deadEndStack, candidates, outputIndices;
+        std::vector<UnsignedByte> emitted;
+};
+
 /**
 @brief %Tipsify the mesh
 @param[in,out] indices  Indices array to operate on
@@ -70,11 +93,51 @@ array for beter usage of post-transform vertex cache. Algorithm used:
 *Pedro V. Sander, Diego Nehab, and Joshua Barczak - Fast Triangle Reordering
 for Vertex Locality and Reduced Overdraw, SIGGRAPH 2007,
 http://gfx.cs.princeton.edu/pubs/Sander_2007_%3ETR/index.php*.
+
+The algorithm runs in time linear to index count. The dead-end vertex stack
+is bounded to `4*cacheSize` most recently used vertices, older vertices are
+most probably not in cache anymore and thus are not better candidates than
+an arbitrary vertex.
+@see averageCacheMissRatio()
 */
 inline void tipsify(std::vector<UnsignedInt>& indices, UnsignedInt vertexCount, std::size_t cacheSize) {
     Implementation::Tipsify(indices, vertexCount)(cacheSize);
 }
 
+/**
+@brief %Tipsify the mesh using given scratch memory
+@param[in,out] indices  Indices array to operate on
+@param[in] vertexCount  Vertex count
+@param[in] cacheSize    Post-transform vertex cache size
+@param[in,out] scratch  Scratch memory
+@return Average cache miss ratio of the optimized mesh
+
+Same as tipsify(std::vector<UnsignedInt>&, UnsignedInt, std::size_t), but all
+temporary memory is taken from @p scratch, so processing many meshes doesn't
+allocate anything once the scratch memory is large enough. Returns ACMR of
+the result (see averageCacheMissRatio()).
+*/
+inline Float tipsify(std::vector<UnsignedInt>& indices, UnsignedInt vertexCount, std::size_t cacheSize, TipsifyScratch& scratch) {
+    Implementation::Tipsify(indices, vertexCount)(cacheSize, scratch);
+    return Implementation::averageCacheMissRatio(indices, vertexCount, cacheSize, scratch.timestamp);
+}
+
+/**
+@brief Average cache miss ratio
+@param indices          Indices array
+@param vertexCount      Vertex count
+@param cacheSize        Post-transform vertex cache size
+
+Simulates FIFO post-transform vertex cache of given size (the same model as
+used in tipsify()) and returns average count of cache misses per triangle.
+The value is between `0.5` (theoretical optimum for large regular meshes) and
+`3.0` (no vertex reuse at all). Returns `0.0` for empty mesh.
+*/
+inline Float averageCacheMissRatio(const std::vector<UnsignedInt>& indices, UnsignedInt vertexCount, std::size_t cacheSize) {
+    std::vector<UnsignedInt> timestamp;
+    return Implementation::averageCacheMissRatio(indices, vertexCount, cacheSize, timestamp);
+}
+
 }}
 
 #endif
@@ -25,14 +25,71 @@
 */
 
 /** @file
- * @brief Function Magnum::MeshTools::transformVectorsInPlace(), Magnum::MeshTools::transformVectors(), Magnum::MeshTools::transformPointsInPlace(), Magnum::MeshTools::transformPoints()
+ * @brief Function Magnum::MeshTools::transformVectorsInPlace(), Magnum::MeshTools::transformVectors(), Magnum::MeshTools::transformPointsInPlace(), Magnum::MeshTools::transformPoints(), Magnum::MeshTools::transformNormalsInPlace(), Magnum::MeshTools::transformNormals()
  */
 
+#include <vector>
+
 #include "Math/DualQuaternion.h"
 #include "Math/DualComplex.h"
+#include "Math/Algorithms/BatchTransform.h"
+#include "MeshTools/ThreadPool.h"
 
 namespace Magnum { namespace MeshTools {
 
+namespace Implementation {
+    /* Contiguous part of an array, forward-iterable */
+    template<class T> class ArrayRange {
+        public:
+            explicit ArrayRange(T* begin, T* end): _begin(begin), _end(end) {}
+
+            T* begin() const { return _begin; }
+            T* end() const { return _end; }
+
+        private:
+            T *_begin, *_end;
+    };
+
+    /* Contiguous arrays of three-component vectors are transformed with
+       Math::Algorithms kernels, everything else one by one */
+    template<class T, class U> inline void transformVectorsInPlace(const Math::Matrix4<T>& matrix, U& vectors) {
+        for(auto& vector: vectors) vector = matrix.transformVector(vector);
+    }
+
+    template<class T> inline void transformVectorsInPlace(const Math::Matrix4<T>& matrix, std::vector<Math::Vector3<T>>& vectors) {
+        Math::Algorithms::transformVectors(matrix, vectors.data(), vectors.data(), vectors.size());
+    }
+
+    template<class T> inline void transformVectorsInPlace(const Math::Matrix4<T>& matrix, ArrayRange<Math::Vector3<T>>& vectors) {
+        Math::Algorithms::transformVectors(matrix, vectors.begin(), vectors.begin(), vectors.end()-vectors.begin());
+    }
+
+    template<class T, class U> inline void transformPointsInPlace(const Math::Matrix4<T>& matrix, U& points) {
+        for(auto& point: points) point = matrix.transformPoint(point);
+    }
+
+    template<class T> inline void transformPointsInPlace(const Math::Matrix4<T>& matrix, std::vector<Math::Vector3<T>>& points) {
+        Math::Algorithms::transformPoints(matrix, points.data(), points.data(), points.size());
+    }
+
+    template<class T> inline void transformPointsInPlace(const Math::Matrix4<T>& matrix, ArrayRange<Math::Vector3<T>>& points) {
+        Math::Algorithms::transformPoints(matrix, points.begin(), points.begin(), points.end()-points.begin());
+    }
+
+    template<class T, class U> inline void transformNormalsInPlace(const Math::Matrix4<T>& matrix, U& normals) {
+        const Math::Matrix<3, T> normalMatrix = matrix.rotationScaling().inverted().transposed();
+        for(auto& normal: normals) normal = (normalMatrix*normal).normalized();
+    }
+
+    template<class T> inline void transformNormalsInPlace(const Math::Matrix4<T>& matrix, std::vector<Math::Vector3<T>>& normals) {
+        Math::Algorithms::transformNormals(matrix, normals.data(), normals.data(), normals.size());
+    }
+
+    template<class T> inline void transformNormalsInPlace(const Math::Matrix4<T>& matrix, ArrayRange<Math::Vector3<T>>& normals) {
+        Math::Algorithms::transformNormals(matrix, normals.begin(), normals.begin(), normals.end()-normals.begin());
+    }
+}
+
 /**
 @brief Transform vectors in-place using given transformation
 
@@ -43,7 +100,9 @@ is normalized, no further requirements are for other transformation
 representations.
 
 Unlike in transformPointsInPlace(), the transformation does not involve
-translation.
+translation. Contiguous arrays of three-component vectors transformed with
+@ref Math::Matrix4 "Matrix4" are processed with
+Math::Algorithms::transformVectors().
 
 Example usage:
 @code
@@ -72,7 +131,7 @@ template<class T, class U> void transformVectorsInPlace(const Math::Matrix3<T>&
 
 /** @overload */
 template<class T, class U> void transformVectorsInPlace(const Math::Matrix4<T>& matrix, U& vectors) {
-    for(auto& vector: vectors) vector = matrix.transformVector(vector);
+    Implementation::transformVectorsInPlace(matrix, vectors);
 }
 
 /**
@@ -97,7 +156,9 @@ with compatible vector type as @p vectors. Expects that
 requirements are for other transformation representations.
 
 Unlike in transformVectorsInPlace(), the transformation also involves
-translation.
+translation. Contiguous arrays of three-component vectors transformed with
+@ref Math::Matrix4 "Matrix4" are processed with
+Math::Algorithms::transformPoints().
 
 Example usage:
 @code
@@ -126,7 +187,7 @@ template<class T, class U> void transformPointsInPlace(const Math::Matrix3<T>& m
 
 /** @overload */
 template<class T, class U> void transformPointsInPlace(const Math::Matrix4<T>& matrix, U& points) {
-    for(auto& point: points) point = matrix.transformPoint(point);
+    Implementation::transformPointsInPlace(matrix, points);
 }
 
 /**
@@ -141,6 +202,126 @@ template<class T, class U> U transformPoints(const T& transformation, U vectors)
     return result;
 }
 
+/**
+@brief Transform normals in-place using given transformation
+
+Unlike transformVectorsInPlace() the normals are transformed with inverse
+transpose of the rotation and scaling part of the matrix, so they stay
+perpendicular to the surface also with non-uniform scaling, and are normalized
+afterwards. Accepts any forward-iterable type with compatible vector type as
+@p normals, contiguous arrays of three-component vectors transformed with
+@ref Math::Matrix4 "Matrix4" are processed with
+Math::Algorithms::transformNormals().
+
+Example usage:
+@code
+std::vector<Vector3> normals;
+auto transformation = Matrix4::scaling({2.0f, 1.0f, 0.5f});
+MeshTools::transformNormalsInPlace(transformation, normals);
+@endcode
+
+@see transformNormals(), Matrix4::rotationScaling()
+*/
+template<class T, class U> void transformNormalsInPlace(const Math::Matrix3<T>& matrix, U& normals) {
+    const Math::Matrix<2, T> normalMatrix = matrix.rotationScaling().inverted().transposed();
+    for(auto& normal: normals) normal = (normalMatrix*normal).normalized();
+}
+
+/** @overload */
+template<class T, class U> void transformNormalsInPlace(const Math::Matrix4<T>& matrix, U& normals) {
+    Implementation::transformNormalsInPlace(matrix, normals);
+}
+
+/**
+@brief Transform normals using given transformation
+
+Returns transformed normals instead of modifying them in-place. See
+transformNormalsInPlace() for more information.
+*/
+template<class T, class U> U transformNormals(const T& transformation, U normals) {
+    U result(std::move(normals));
+    transformNormalsInPlace(transformation, result);
+    return result;
+}
+
+/**
+@brief Transform vectors in-place in parallel
+
+Parallel variant of transformVectorsInPlace(), accepts only `std::vector`. Each
+chunk is processed with the serial variant, so the output is bit-identical to
+it. See ThreadPool for more information.
+*/
+template<class T, class U> void transformVectorsInPlace(ThreadPool& pool, const T& transformation, std::vector<U>& vectors) {
+    pool.run(vectors.size(), [&transformation, &vectors](std::size_t begin, std::size_t end) {
+        Implementation::ArrayRange<U> range(vectors.data()+begin, vectors.data()+end);
+        transformVectorsInPlace(transformation, range);
+    });
+}
+
+/**
+@brief Transform vectors in parallel
+
+Parallel variant of transformVectors(), see transformVectorsInPlace(ThreadPool&, const T&, std::vector<U>&)
+for more information.
+*/
+template<class T, class U> std::vector<U> transformVectors(ThreadPool& pool, const T& transformation, std::vector<U> vectors) {
+    std::vector<U> result(std::move(vectors));
+    transformVectorsInPlace(pool, transformation, result);
+    return result;
+}
+
+/**
+@brief Transform points in-place in parallel
+
+Parallel variant of transformPointsInPlace(), accepts only `std::vector`. Each
+chunk is processed with the serial variant, so the output is bit-identical to
+it. See ThreadPool for more information.
+*/
+template<class T, class U> void transformPointsInPlace(ThreadPool& pool, const T& transformation, std::vector<U>& points) {
+    pool.run(points.size(), [&transformation, &points](std::size_t begin, std::size_t end) {
+        Implementation::ArrayRange<U> range(points.data()+begin, points.data()+end);
+        transformPointsInPlace(transformation, range);
+    });
+}
+
+/**
+@brief Transform points in parallel
+
+Parallel variant of transformPoints(), see transformPointsInPlace(ThreadPool&, const T&, std::vector<U>&)
+for more information.
+*/
+template<class T, class U> std::vector<U> transformPoints(ThreadPool& pool, const T& transformation, std::vector<U> points) {
+    std::vector<U> result(std::move(points));
+    transformPointsInPlace(pool, transformation, result);
+    return result;
+}
+
+/**
+@brief Transform normals in-place in parallel
+
+Parallel variant of transformNormalsInPlace(), accepts only `std::vector`. Each
+chunk is processed with the serial variant, so the output is bit-identical to
+it. See ThreadPool for more information.
+*/
+template<class T, class U> void transformNormalsInPlace(ThreadPool& pool, const T& transformation, std::vector<U>& normals) {
+    pool.run(normals.size(), [&transformation, &normals](std::size_t begin, std::size_t end) {
+        Implementation::ArrayRange<U> range(normals.data()+begin, normals.data()+end);
+        transformNormalsInPlace(transformation, range);
+    });
+}
+
+/**
+@brief Transform normals in parallel
+
+Parallel variant of transformNormals(), see transformNormalsInPlace(ThreadPool&, const T&, std::vector<U>&)
+for more information.
+*/
+template<class T, class U> std::vector<U> transformNormals(ThreadPool& pool, const T& transformation, std::vector<U> normals) {
+    std::vector<U> result(std::move(normals));
+    transformNormalsInPlace(pool, transformation, result);
+    return result;
+}
+
 }}
 
 #endif
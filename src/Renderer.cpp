@@ -42,7 +42,17 @@ Renderer::ClearDepthfImplementation Renderer::clearDepthfImplementation = &Rende
 Renderer::GraphicsResetStatusImplementation Renderer::graphicsResetStatusImplementation = &Renderer::graphicsResetStatusImplementationDefault;
 #endif
 
+namespace {
+    inline Implementation::RendererState* state() {
+        return Context::current()->state()->renderer;
+    }
+}
+
 void Renderer::setFeature(const Feature feature, const bool enabled) {
+    Implementation::RendererState* const state = Magnum::state();
+    if(!state->update(state->cache.features[Implementation::RendererState::indexForFeature(feature)], enabled))
+        return;
+
     enabled ? glEnable(GLenum(feature)) : glDisable(GLenum(feature));
 }
 
@@ -51,120 +61,209 @@ void Renderer::setHint(const Hint target, const HintMode mode) {
 }
 
 void Renderer::setClearColor(const Color4<>& color) {
+    Implementation::RendererState* const state = Magnum::state();
+    if(!state->update(state->cache.clearColor, color)) return;
+
     glClearColor(color.r(), color.g(), color.b(), color.a());
 }
 
 #ifndef MAGNUM_TARGET_GLES
 void Renderer::setClearDepth(const Double depth) {
+    Implementation::RendererState* const state = Magnum::state();
+    if(!state->update(state->cache.clearDepth, depth)) return;
+
     glClearDepth(depth);
 }
 #endif
 
+void Renderer::setClearDepth(const Float depth) {
+    Implementation::RendererState* const state = Magnum::state();
+    #ifndef MAGNUM_TARGET_GLES
+    if(!state->update(state->cache.clearDepth, Double(depth))) return;
+    #else
+    if(!state->update(state->cache.clearDepth, depth)) return;
+    #endif
+
+    clearDepthfImplementation(depth);
+}
+
 void Renderer::setClearStencil(const Int stencil) {
+    Implementation::RendererState* const state = Magnum::state();
+    if(!state->update(state->cache.clearStencil, stencil)) return;
+
     glClearStencil(stencil);
 }
 
 void Renderer::setFrontFace(const FrontFace mode) {
+    Implementation::RendererState* const state = Magnum::state();
+    if(!state->update(state->cache.frontFace, mode)) return;
+
     glFrontFace(GLenum(mode));
 }
 
 void Renderer::setFaceCullingMode(const PolygonFacing mode) {
+    Implementation::RendererState* const state = Magnum::state();
+    if(!state->update(state->cache.faceCullingMode, mode)) return;
+
     glCullFace(GLenum(mode));
 }
 
 #ifndef MAGNUM_TARGET_GLES
 void Renderer::setProvokingVertex(const ProvokingVertex mode) {
+    Implementation::RendererState* const state = Magnum::state();
+    if(!state->update(state->cache.provokingVertex, mode)) return;
+
     glProvokingVertex(GLenum(mode));
 }
 
 void Renderer::setPolygonMode(const PolygonMode mode) {
+    Implementation::RendererState* const state = Magnum::state();
+    if(!state->update(state->cache.polygonMode, mode)) return;
+
     glPolygonMode(GL_FRONT_AND_BACK, GLenum(mode));
 }
 #endif
 
 void Renderer::setPolygonOffset(const Float factor, const Float units) {
+    Implementation::RendererState* const state = Magnum::state();
+    if(!state->update(state->cache.polygonOffset, std::make_pair(factor, units))) return;
+
     glPolygonOffset(factor, units);
 }
 
 void Renderer::setLineWidth(const Float width) {
+    Implementation::RendererState* const state = Magnum::state();
+    if(!state->update(state->cache.lineWidth, width)) return;
+
     glLineWidth(width);
 }
 
 #ifndef MAGNUM_TARGET_GLES
 void Renderer::setPointSize(const Float size) {
+    Implementation::RendererState* const state = Magnum::state();
+    if(!state->update(state->cache.pointSize, size)) return;
+
     glPointSize(size);
 }
 #endif
 
 void Renderer::setScissor(const Rectanglei& rectangle) {
+    Implementation::RendererState* const state = Magnum::state();
+    if(!state->update(state->cache.scissor, rectangle)) return;
+
     glScissor(rectangle.left(), rectangle.bottom(), rectangle.width(), rectangle.height());
 }
 
 void Renderer::setStencilFunction(const PolygonFacing facing, const StencilFunction function, const Int referenceValue, const UnsignedInt mask) {
+    Implementation::RendererState* const state = Magnum::state();
+    if(!state->update(state->cache.stencilFunction, facing, std::make_tuple(function, referenceValue, mask))) return;
+
     glStencilFuncSeparate(GLenum(facing), GLenum(function), referenceValue, mask);
 }
 
 void Renderer::setStencilFunction(const StencilFunction function, const Int referenceValue, const UnsignedInt mask) {
+    Implementation::RendererState* const state = Magnum::state();
+    if(!state->update(state->cache.stencilFunction, PolygonFacing::FrontAndBack, std::make_tuple(function, referenceValue, mask))) return;
+
     glStencilFunc(GLenum(function), referenceValue, mask);
 }
 
 void Renderer::setStencilOperation(const PolygonFacing facing, const StencilOperation stencilFail, const StencilOperation depthFail, const StencilOperation depthPass) {
+    Implementation::RendererState* const state = Magnum::state();
+    if(!state->update(state->cache.stencilOperation, facing, std::make_tuple(stencilFail, depthFail, depthPass))) return;
+
     glStencilOpSeparate(GLenum(facing), GLenum(stencilFail), GLenum(depthFail), GLenum(depthPass));
 }
 
 void Renderer::setStencilOperation(const StencilOperation stencilFail, const StencilOperation depthFail, const StencilOperation depthPass) {
+    Implementation::RendererState* const state = Magnum::state();
+    if(!state->update(state->cache.stencilOperation, PolygonFacing::FrontAndBack, std::make_tuple(stencilFail, depthFail, depthPass))) return;
+
     glStencilOp(GLenum(stencilFail), GLenum(depthFail), GLenum(depthPass));
 }
 
 void Renderer::setDepthFunction(const DepthFunction function) {
+    Implementation::RendererState* const state = Magnum::state();
+    if(!state->update(state->cache.depthFunction, function)) return;
+
     glDepthFunc(GLenum(function));
 }
 
 void Renderer::setColorMask(const GLboolean allowRed, const GLboolean allowGreen, const GLboolean allowBlue, const GLboolean allowAlpha) {
+    Implementation::RendererState* const state = Magnum::state();
+    if(!state->update(state->cache.colorMask, std::make_tuple(allowRed, allowGreen, allowBlue, allowAlpha))) return;
+
     glColorMask(allowRed, allowGreen, allowBlue, allowAlpha);
 }
 
 void Renderer::setDepthMask(const GLboolean allow) {
+    Implementation::RendererState* const state = Magnum::state();
+    if(!state->update(state->cache.depthMask, allow)) return;
+
     glDepthMask(allow);
 }
 
 void Renderer::setStencilMask(const PolygonFacing facing, const UnsignedInt allowBits) {
+    Implementation::RendererState* const state = Magnum::state();
+    if(!state->update(state->cache.stencilMask, facing, allowBits)) return;
+
     glStencilMaskSeparate(GLenum(facing), allowBits);
 }
 
 void Renderer::setStencilMask(const UnsignedInt allowBits) {
+    Implementation::RendererState* const state = Magnum::state();
+    if(!state->update(state->cache.stencilMask, PolygonFacing::FrontAndBack, allowBits)) return;
+
     glStencilMask(allowBits);
 }
 
 void Renderer::setBlendEquation(const BlendEquation equation) {
+    Implementation::RendererState* const state = Magnum::state();
+    if(!state->update(state->cache.blendEquation, std::make_pair(equation, equation))) return;
+
     glBlendEquation(GLenum(equation));
 }
 
 void Renderer::setBlendEquation(const BlendEquation rgb, const BlendEquation alpha) {
+    Implementation::RendererState* const state = Magnum::state();
+    if(!state->update(state->cache.blendEquation, std::make_pair(rgb, alpha))) return;
+
     glBlendEquationSeparate(GLenum(rgb), GLenum(alpha));
 }
 
 void Renderer::setBlendFunction(const BlendFunction source, const BlendFunction destination) {
+    Implementation::RendererState* const state = Magnum::state();
+    if(!state->update(state->cache.blendFunction, std::make_tuple(source, destination, source, destination))) return;
+
     glBlendFunc(GLenum(source), GLenum(destination));
 }
 
 void Renderer::setBlendFunction(const BlendFunction sourceRgb, const BlendFunction destinationRgb, const BlendFunction sourceAlpha, const BlendFunction destinationAlpha) {
+    Implementation::RendererState* const state = Magnum::state();
+    if(!state->update(state->cache.blendFunction, std::make_tuple(sourceRgb, destinationRgb, sourceAlpha, destinationAlpha))) return;
+
     glBlendFuncSeparate(GLenum(sourceRgb), GLenum(destinationRgb), GLenum(sourceAlpha), GLenum(destinationAlpha));
 }
 
 void Renderer::setBlendColor(const Color4<>& color) {
+    Implementation::RendererState* const state = Magnum::state();
+    if(!state->update(state->cache.blendColor, color)) return;
+
     glBlendColor(color.r(), color.g(), color.b(), color.a());
 }
 
 #ifndef MAGNUM_TARGET_GLES
 void Renderer::setLogicOperation(const LogicOperation operation) {
+    Implementation::RendererState* const state = Magnum::state();
+    if(!state->update(state->cache.logicOperation, operation)) return;
+
     glLogicOp(GLenum(operation));
 }
 #endif
 
 #ifndef MAGNUM_TARGET_GLES3
 Renderer::ResetNotificationStrategy Renderer::resetNotificationStrategy() {
-    ResetNotificationStrategy& strategy = Context::current()->state()->renderer->resetNotificationStrategy;
+    ResetNotificationStrategy& strategy = state()->resetNotificationStrategy;
 
     if(strategy == ResetNotificationStrategy()) {
         #ifndef MAGNUM_TARGET_GLES
@@ -178,6 +277,23 @@ Renderer::ResetNotificationStrategy Renderer::resetNotificationStrategy() {
 }
 #endif
 
+UnsignedInt Renderer::stateChangeCount() {
+    return state()->stateChangeCount;
+}
+
+UnsignedInt Renderer::elidedStateChangeCount() {
+    return state()->elidedStateChangeCount;
+}
+
+void Renderer::resetStateChangeCount() {
+    Implementation::RendererState* const state = Magnum::state();
+    state->stateChangeCount = state->elidedStateChangeCount = 0;
+}
+
+void Renderer::resetStateCache() {
+    state()->cache = Implementation::RendererState::Cache();
+}
+
 void Renderer::initializeContextBasedFunctionality(Context* context) {
     #ifndef MAGNUM_TARGET_GLES
     if(context->isExtensionSupported<Extensions::GL::ARB::ES2_compatibility>()) {
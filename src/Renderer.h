@@ -40,6 +40,18 @@ namespace Magnum {
 @brief %Renderer
 
 Access to global renderer configuration.
+
+@section Renderer-state-cache State caching
+
+The renderer remembers the state set through this class (except for hints)
+and calls to functions which wouldn't change anything are not passed to OpenGL at all,
+thus it's possible to set up the whole state for each drawn object without
+flooding the driver with redundant calls. The state is unknown at the
+beginning, so the first call to each function always goes to OpenGL. If the
+state is changed behind Magnum's back (e.g. by third-party library), call
+resetStateCache() afterwards. Count of passed and elided calls can be
+queried using stateChangeCount() and elidedStateChangeCount().
+
 @todo @extension{ARB,viewport_array}
 */
 class MAGNUM_EXPORT Renderer {
@@ -258,9 +270,7 @@ class MAGNUM_EXPORT Renderer {
          * If OpenGL ES, OpenGL 4.1 or extension @extension{ARB,ES2_compatibility}
          * is not available, this function behaves exactly as setClearDepth(Double).
          */
-        static void setClearDepth(Float depth) {
-            clearDepthfImplementation(depth);
-        }
+        static void setClearDepth(Float depth);
 
         /**
          * @brief Set clear stencil
@@ -1025,6 +1035,45 @@ class MAGNUM_EXPORT Renderer {
 
         /*@}*/
 
+        /** @{ @name State caching */
+
+        /**
+         * @brief Count of state changes passed to OpenGL
+         *
+         * Counted since context creation or last call to
+         * resetStateChangeCount().
+         * @see elidedStateChangeCount(), @ref Renderer-state-cache
+         */
+        static UnsignedInt stateChangeCount();
+
+        /**
+         * @brief Count of redundant state changes which weren't passed to OpenGL
+         *
+         * Counted since context creation or last call to
+         * resetStateChangeCount().
+         * @see stateChangeCount(), @ref Renderer-state-cache
+         */
+        static UnsignedInt elidedStateChangeCount();
+
+        /**
+         * @brief Reset state change counters
+         *
+         * @see stateChangeCount(), elidedStateChangeCount()
+         */
+        static void resetStateChangeCount();
+
+        /**
+         * @brief Reset state cache
+         *
+         * Marks all cached state as unknown, so next call to each function
+         * is passed to OpenGL. Call it after the state was changed without
+         * using this class. Doesn't affect state change counters.
+         * @see @ref Renderer-state-cache
+         */
+        static void resetStateCache();
+
+        /*@}*/
+
     private:
         static void MAGNUM_LOCAL initializeContextBasedFunctionality(Context* context);
 
@@ -28,6 +28,8 @@
  * @brief Class Magnum::SceneGraph::AbstractCamera, enum Magnum::SceneGraph::AspectRatioPolicy, alias Magnum::SceneGraph::AbstractCamera2D, Magnum::SceneGraph::AbstractCamera3D
  */
 
+#include <vector>
+
 #include "Math/Matrix3.h"
 #include "Math/Matrix4.h"
 #include "AbstractFeature.h"
@@ -141,10 +143,31 @@ class MAGNUM_SCENEGRAPH_EXPORT AbstractCamera: public AbstractFeature<dimensions
         /**
          * @brief Draw
          *
-         * Draws given group of drawables.
+         * Draws given group of drawables. Drawables with bounding volume
+         * outside of camera frustum are skipped, see
+         * @ref Drawable-culling "Drawable documentation" for more
+         * information.
+         * @see culledDrawableCount()
          */
         virtual void draw(DrawableGroup<dimensions, T>& group);
 
+        /**
+         * @brief Record drawables into draw list
+         *
+         * Calls Drawable::record() for all drawables in given group, except
+         * for culled ones. The list can be then drawn with DrawList::draw().
+         * @see culledDrawableCount()
+         */
+        void record(DrawableGroup<dimensions, T>& group, DrawList<dimensions, T>& list);
+
+        /**
+         * @brief Count of culled drawables
+         *
+         * Count of drawables which were outside of camera frustum in last
+         * call to draw() or record().
+         */
+        std::size_t culledDrawableCount() const { return _culledDrawableCount; }
+
     protected:
         /** Recalculates camera matrix */
         void cleanInverted(const typename DimensionTraits<dimensions, T>::MatrixType& invertedAbsoluteTransformationMatrix) override {
@@ -161,10 +184,13 @@ class MAGNUM_SCENEGRAPH_EXPORT AbstractCamera: public AbstractFeature<dimensions
         #endif
 
     private:
+        std::vector<typename DimensionTraits<dimensions, T>::MatrixType> MAGNUM_SCENEGRAPH_LOCAL drawableTransformations(AbstractObject<dimensions, T>* scene, DrawableGroup<dimensions, T>& group);
+
         typename DimensionTraits<dimensions, T>::MatrixType _projectionMatrix;
         typename DimensionTraits<dimensions, T>::MatrixType _cameraMatrix;
 
         Vector2i _viewport;
+        std::size_t _culledDrawableCount;
 };
 
 #ifndef CORRADE_GCC46_COMPATIBILITY
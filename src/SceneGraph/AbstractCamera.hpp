@@ -30,6 +30,9 @@
 
 #include "AbstractCamera.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "Drawable.h"
 
 using namespace std;
@@ -68,9 +71,86 @@ template<UnsignedInt dimensions, class T> typename DimensionTraits<dimensions, T
         Vector2(T(1.0), relativeAspectRatio.x()/relativeAspectRatio.y()));
 }
 
+/* Frustum planes in camera space, extracted from projection matrix. Point `p`
+   lies inside the plane if `dot(plane.xyz(), p) + plane.w() >= 0`. In 2D the
+   "planes" are lines bounding the visible rectangle. */
+template<UnsignedInt dimensions, class T> class Frustum {
+    public:
+        explicit Frustum(const typename DimensionTraits<dimensions, T>::MatrixType& projectionMatrix);
+
+        /* Whether bounding volume of the drawable with given camera-relative
+           transformation intersects the frustum */
+        bool isVisible(const Drawable<dimensions, T>& drawable, const typename DimensionTraits<dimensions, T>::MatrixType& transformationMatrix) const;
+
+    private:
+        Math::Vector<dimensions+1, T> planes[2*dimensions];
+};
+
+template<UnsignedInt dimensions, class T> Frustum<dimensions, T>::Frustum(const typename DimensionTraits<dimensions, T>::MatrixType& projectionMatrix) {
+    /* Clip space condition -w <= x_i <= w, thus each plane is sum or
+       difference of last matrix row and row of given coordinate */
+    const Math::Vector<dimensions+1, T> w = projectionMatrix.row(dimensions);
+    for(UnsignedInt i = 0; i != dimensions; ++i) {
+        const Math::Vector<dimensions+1, T> row = projectionMatrix.row(i);
+        planes[2*i] = w + row;
+        planes[2*i + 1] = w - row;
+    }
+
+    /* Normalize the planes, so the distances are in camera space units */
+    for(Math::Vector<dimensions+1, T>& plane: planes) {
+        T lengthSquared(0);
+        for(UnsignedInt i = 0; i != dimensions; ++i)
+            lengthSquared += plane[i]*plane[i];
+        plane /= std::sqrt(lengthSquared);
+    }
+}
+
+template<UnsignedInt dimensions, class T> bool Frustum<dimensions, T>::isVisible(const Drawable<dimensions, T>& drawable, const typename DimensionTraits<dimensions, T>::MatrixType& transformationMatrix) const {
+    typedef typename Drawable<dimensions, T>::BoundingVolume BoundingVolume;
+    if(drawable.boundingVolume() == BoundingVolume::None) return true;
+
+    const typename DimensionTraits<dimensions, T>::VectorType center = transformationMatrix.transformPoint(drawable.boundingCenter());
+
+    /* Sphere radius is scaled by largest scale factor of the transformation */
+    T radius(0);
+    if(drawable.boundingVolume() == BoundingVolume::Sphere) {
+        T scaleSquared(0);
+        for(UnsignedInt i = 0; i != dimensions; ++i) {
+            T lengthSquared(0);
+            for(UnsignedInt j = 0; j != dimensions; ++j)
+                lengthSquared += transformationMatrix[i][j]*transformationMatrix[i][j];
+            scaleSquared = std::max(scaleSquared, lengthSquared);
+        }
+        radius = drawable.boundingRadius()*std::sqrt(scaleSquared);
+    }
+
+    const typename DimensionTraits<dimensions, T>::VectorType halfSize = drawable.boundingHalfSize();
+    for(const Math::Vector<dimensions+1, T>& plane: planes) {
+        T distance = plane[dimensions];
+        for(UnsignedInt i = 0; i != dimensions; ++i)
+            distance += plane[i]*center[i];
+
+        /* Box extent projected onto plane normal */
+        if(drawable.boundingVolume() == BoundingVolume::Box) {
+            radius = T(0);
+            for(UnsignedInt i = 0; i != dimensions; ++i) {
+                T projected(0);
+                for(UnsignedInt j = 0; j != dimensions; ++j)
+                    projected += plane[j]*transformationMatrix[i][j];
+                radius += std::abs(projected)*halfSize[i];
+            }
+        }
+
+        /* Completely outside of this plane */
+        if(distance < -radius) return false;
+    }
+
+    return true;
+}
+
 }
 
-template<UnsignedInt dimensions, class T> AbstractCamera<dimensions, T>::AbstractCamera(AbstractObject<dimensions, T>* object): AbstractFeature<dimensions, T>(object), _aspectRatioPolicy(AspectRatioPolicy::NotPreserved) {
+template<UnsignedInt dimensions, class T> AbstractCamera<dimensions, T>::AbstractCamera(AbstractObject<dimensions, T>* object): AbstractFeature<dimensions, T>(object), _aspectRatioPolicy(AspectRatioPolicy::NotPreserved), _culledDrawableCount(0) {
     AbstractFeature<dimensions, T>::setCachedTransformations(CachedTransformation::InvertedAbsolute);
 }
 
@@ -91,6 +171,42 @@ template<UnsignedInt dimensions, class T> void AbstractCamera<dimensions, T>::dr
     AbstractObject<dimensions, T>* scene = AbstractFeature<dimensions, T>::object()->scene();
     CORRADE_ASSERT(scene, "Camera::draw(): cannot draw when camera is not part of any scene", );
 
+    std::vector<typename DimensionTraits<dimensions, T>::MatrixType> transformations = drawableTransformations(scene, group);
+
+    /* Perform the drawing, skip culled drawables */
+    const Implementation::Frustum<dimensions, T> frustum(_projectionMatrix);
+    _culledDrawableCount = 0;
+    for(std::size_t i = 0; i != transformations.size(); ++i) {
+        if(!frustum.isVisible(*group[i], transformations[i])) {
+            ++_culledDrawableCount;
+            continue;
+        }
+
+        group[i]->draw(transformations[i], this);
+    }
+}
+
+template<UnsignedInt dimensions, class T> void AbstractCamera<dimensions, T>::record(DrawableGroup<dimensions, T>& group, DrawList<dimensions, T>& list) {
+    AbstractObject<dimensions, T>* scene = AbstractFeature<dimensions, T>::object()->scene();
+    CORRADE_ASSERT(scene, "Camera::record(): cannot record when camera is not part of any scene", );
+
+    std::vector<typename DimensionTraits<dimensions, T>::MatrixType> transformations = drawableTransformations(scene, group);
+
+    /* Record the drawables, skip culled drawables */
+    const Implementation::Frustum<dimensions, T> frustum(_projectionMatrix);
+    _culledDrawableCount = 0;
+    list.reserve(list.size() + transformations.size());
+    for(std::size_t i = 0; i != transformations.size(); ++i) {
+        if(!frustum.isVisible(*group[i], transformations[i])) {
+            ++_culledDrawableCount;
+            continue;
+        }
+
+        group[i]->record(list, transformations[i], this);
+    }
+}
+
+template<UnsignedInt dimensions, class T> std::vector<typename DimensionTraits<dimensions, T>::MatrixType> AbstractCamera<dimensions, T>::drawableTransformations(AbstractObject<dimensions, T>* scene, DrawableGroup<dimensions, T>& group) {
     /* Compute camera matrix */
     AbstractFeature<dimensions, T>::object()->setClean();
 
@@ -98,12 +214,7 @@ template<UnsignedInt dimensions, class T> void AbstractCamera<dimensions, T>::dr
     std::vector<AbstractObject<dimensions, T>*> objects(group.size());
     for(std::size_t i = 0; i != group.size(); ++i)
         objects[i] = group[i]->object();
-    std::vector<typename DimensionTraits<dimensions, T>::MatrixType> transformations =
-        scene->transformationMatrices(objects, _cameraMatrix);
-
-    /* Perform the drawing */
-    for(std::size_t i = 0; i != transformations.size(); ++i)
-        group[i]->draw(transformations[i], this);
+    return scene->transformationMatrices(objects, _cameraMatrix);
 }
 
 }}
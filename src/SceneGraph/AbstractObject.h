@@ -178,10 +178,10 @@ template<UnsignedInt dimensions, class T> class MAGNUM_SCENEGRAPH_EXPORT Abstrac
         /**
          * @brief Set object absolute transformation as dirty
          *
-         * Calls AbstractFeature::markDirty() on all object features and
-         * recursively calls setDirty() on every child object which is not
-         * already dirty. If the object is already marked as dirty, the
-         * function does nothing.
+         * Calls AbstractFeature::markDirty() on all object features and on
+         * features of all children which are not already dirty. If the
+         * object is already marked as dirty, the function does nothing
+         * besides invalidating cached absolute transformations.
          * @see @ref scenegraph-caching, setClean(), isDirty()
          */
         void setDirty() { doSetDirty(); }
@@ -0,0 +1,214 @@
+#ifndef Magnum_SceneGraph_DrawList_h
+#define Magnum_SceneGraph_DrawList_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class Magnum::SceneGraph::DrawList, alias Magnum::SceneGraph::DrawList2D, Magnum::SceneGraph::DrawList3D
+ */
+
+#include <utility>
+#include <vector>
+
+#include "DimensionTraits.h"
+#include "SceneGraph/SceneGraph.h"
+
+#include "SceneGraph/magnumSceneGraphVisibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Sorted list of drawables
+
+Deferred alternative to drawing whole DrawableGroup with AbstractCamera::draw().
+The drawables are first recorded into the list together with their
+transformation and 64-bit sort key and then drawn at once in order given by
+the key. If the key is made of shader, texture and mesh used by the drawable,
+drawables using the same state are drawn after each other and the state
+tracking in AbstractShaderProgram::use(), AbstractTexture::bind() and
+Mesh::draw() can skip most of the redundant OpenGL calls.
+
+@section DrawList-usage Usage
+
+Each drawable is recorded with Drawable::record(), which by default adds the
+drawable to the list with zero key. Reimplement it to provide the key, see
+key() for details:
+@code
+class DrawableObject: public Object3D, SceneGraph::Drawable3D<> {
+    public:
+        void record(SceneGraph::DrawList3D<>& list, const Matrix4& transformationMatrix, SceneGraph::AbstractCamera3D<>* camera) override {
+            list.add(this, transformationMatrix, SceneGraph::DrawList3D<>::key(
+                shader->id(), texture->id(), meshId,
+                -transformationMatrix.translation().z()/100.0f));
+        }
+
+        // ...
+};
+@endcode
+
+The list is then filled using AbstractCamera::record() and drawn using
+draw(). The list can be reused in the next frame, clear() keeps the allocated
+memory:
+@code
+SceneGraph::DrawList3D<> list;
+
+void MyApplication::drawEvent() {
+    list.clear();
+    camera.record(drawables, list);
+    list.draw(&camera);
+
+    // ...
+}
+@endcode
+
+@see @ref scenegraph, DrawList2D, DrawList3D
+*/
+#ifndef DOXYGEN_GENERATING_OUTPUT
+template<UnsignedInt dimensions, class T>
+#else
+template<UnsignedInt dimensions, class T = Float>
+#endif
+class MAGNUM_SCENEGRAPH_EXPORT DrawList {
+    public:
+        /**
+         * @brief Compose sort key
+         * @param program   Shader program ID
+         * @param textures  ID of texture set
+         * @param mesh      Mesh ID
+         * @param depth     Depth in range @f$ [0, 1] @f$
+         *
+         * The drawables are sorted primarily by shader program, then by
+         * texture set, mesh and depth. Only lower 16 bits of each ID are
+         * used, depth is clamped and quantized to 16 bits. Using
+         * <tt>1.0 - depth</tt> sorts the drawables with the same state back
+         * to front.
+         */
+        static UnsignedLong key(UnsignedInt program, UnsignedInt textures, UnsignedInt mesh, T depth) {
+            return UnsignedLong(program & 0xffff) << 48 |
+                   UnsignedLong(textures & 0xffff) << 32 |
+                   UnsignedLong(mesh & 0xffff) << 16 |
+                   UnsignedLong((depth > T(0) ? (depth < T(1) ? depth : T(1)) : T(0))*T(0xffff));
+        }
+
+        /** @brief Constructor */
+        explicit DrawList();
+
+        /** @brief Count of recorded drawables */
+        std::size_t size() const { return packets.size(); }
+
+        /** @brief Whether the list is empty */
+        bool isEmpty() const { return packets.empty(); }
+
+        /**
+         * @brief Reserve memory for given count of drawables
+         *
+         * @see clear()
+         */
+        void reserve(std::size_t size);
+
+        /**
+         * @brief Add drawable
+         * @param drawable              Drawable
+         * @param transformationMatrix  %Object transformation relative to
+         *      camera
+         * @param key                   Sort key
+         * @return Pointer to self (for method chaining)
+         *
+         * Drawables with the same key are drawn in the order they were added.
+         * @see key(), Drawable::record()
+         */
+        DrawList<dimensions, T>* add(Drawable<dimensions, T>* drawable, const typename DimensionTraits<dimensions, T>::MatrixType& transformationMatrix, UnsignedLong key = 0);
+
+        /**
+         * @brief Clear the list
+         *
+         * Allocated memory is kept for next use.
+         */
+        void clear();
+
+        /**
+         * @brief Sort the list
+         *
+         * Called automatically from draw(), if the list is not already
+         * sorted.
+         */
+        void sort();
+
+        /**
+         * @brief Draw the list
+         *
+         * Calls Drawable::draw() for all recorded drawables in order given
+         * by their keys. The list is kept, so it can be drawn again.
+         */
+        void draw(AbstractCamera<dimensions, T>* camera);
+
+    private:
+        struct Packet {
+            Drawable<dimensions, T>* drawable;
+            typename DimensionTraits<dimensions, T>::MatrixType transformationMatrix;
+        };
+
+        std::vector<Packet> packets;
+
+        /* Sorting only the keys with packet index, not the packets
+           themselves. The index also keeps the sort stable. */
+        std::vector<std::pair<UnsignedLong, UnsignedInt>> order;
+        bool sorted;
+};
+
+#ifndef CORRADE_GCC46_COMPATIBILITY
+/**
+@brief Two-dimensional draw list
+
+Convenience alternative to <tt>%DrawList<2, T></tt>. See DrawList for more
+information.
+@note Not available on GCC < 4.7. Use <tt>%DrawList<2, T></tt> instead.
+@see DrawList3D
+*/
+#ifdef DOXYGEN_GENERATING_OUTPUT
+template<class T = Float>
+#else
+template<class T>
+#endif
+using DrawList2D = DrawList<2, T>;
+
+/**
+@brief Three-dimensional draw list
+
+Convenience alternative to <tt>%DrawList<3, T></tt>. See DrawList for more
+information.
+@note Not available on GCC < 4.7. Use <tt>%DrawList<3, T></tt> instead.
+@see DrawList2D
+*/
+#ifdef DOXYGEN_GENERATING_OUTPUT
+template<class T = Float>
+#else
+template<class T>
+#endif
+using DrawList3D = DrawList<3, T>;
+#endif
+
+}}
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef Magnum_SceneGraph_DrawList_hpp
+#define Magnum_SceneGraph_DrawList_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for DrawList.h
+ */
+
+#include "DrawList.h"
+
+#include <algorithm>
+
+#include "Drawable.h"
+
+namespace Magnum { namespace SceneGraph {
+
+template<UnsignedInt dimensions, class T> DrawList<dimensions, T>::DrawList(): sorted(true) {}
+
+template<UnsignedInt dimensions, class T> void DrawList<dimensions, T>::reserve(const std::size_t size) {
+    packets.reserve(size);
+    order.reserve(size);
+}
+
+template<UnsignedInt dimensions, class T> DrawList<dimensions, T>* DrawList<dimensions, T>::add(Drawable<dimensions, T>* drawable, const typename DimensionTraits<dimensions, T>::MatrixType& transformationMatrix, const UnsignedLong key) {
+    order.push_back({key, UnsignedInt(packets.size())});
+    packets.push_back({drawable, transformationMatrix});
+    sorted = false;
+    return this;
+}
+
+template<UnsignedInt dimensions, class T> void DrawList<dimensions, T>::clear() {
+    packets.clear();
+    order.clear();
+    sorted = true;
+}
+
+template<UnsignedInt dimensions, class T> void DrawList<dimensions, T>::sort() {
+    std::sort(order.begin(), order.end());
+    sorted = true;
+}
+
+template<UnsignedInt dimensions, class T> void DrawList<dimensions, T>::draw(AbstractCamera<dimensions, T>* camera) {
+    if(!sorted) sort();
+
+    for(const auto& i: order) {
+        const Packet& packet = packets[i.second];
+        packet.drawable->draw(packet.transformationMatrix, camera);
+    }
+}
+
+}}
+
+#endif
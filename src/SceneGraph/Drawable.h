@@ -29,6 +29,7 @@
  */
 
 #include "AbstractGroupedFeature.h"
+#include "DrawList.h"
 
 namespace Magnum { namespace SceneGraph {
 
@@ -114,6 +115,27 @@ void MyApplication::drawEvent() {
 }
 @endcode
 
+Alternatively you can record the drawables into DrawList, which draws them
+sorted by used shader, textures and mesh. See DrawList documentation for more
+information.
+
+@section Drawable-culling Frustum culling
+
+If the drawable has bounding volume specified, it is not drawn when the volume
+is completely outside of camera frustum. The bounding volume is in object
+local coordinates, so it needs to be set only once unless the drawn geometry
+changes:
+@code
+DrawableObject* o = new DrawableObject(&scene, &drawables);
+o->setBoundingSphere({}, 1.5f);
+@endcode
+
+The frustum is extracted from camera projection matrix and the test is done
+after computing drawable transformations, but before calling draw() or
+record(). Count of culled drawables is available through
+AbstractCamera::culledDrawableCount(). Drawables without bounding volume are
+always drawn.
+
 @see @ref scenegraph, Drawable2D, Drawable3D, DrawableGroup2D, DrawableGroup3D
 */
 #ifndef DOXYGEN_GENERATING_OUTPUT
@@ -123,6 +145,17 @@ template<UnsignedInt dimensions, class T = Float>
 #endif
 class Drawable: public AbstractGroupedFeature<dimensions, Drawable<dimensions, T>, T> {
     public:
+        /**
+         * @brief Bounding volume type
+         *
+         * @see boundingVolume(), @ref Drawable-culling
+         */
+        enum class BoundingVolume: UnsignedByte {
+            None,       /**< No bounding volume, the drawable is always drawn */
+            Sphere,     /**< Bounding sphere */
+            Box         /**< Axis-aligned bounding box */
+        };
+
         /**
          * @brief Constructor
          * @param object    %Object this drawable belongs to
@@ -131,7 +164,78 @@ class Drawable: public AbstractGroupedFeature<dimensions, Drawable<dimensions, T
          * Adds the feature to the object and also to the group, if specified.
          * Otherwise you can use DrawableGroup::add().
          */
-        explicit Drawable(AbstractObject<dimensions, T>* object, DrawableGroup<dimensions, T>* drawables = nullptr): AbstractGroupedFeature<dimensions, Drawable<dimensions, T>, T>(object, drawables) {}
+        explicit Drawable(AbstractObject<dimensions, T>* object, DrawableGroup<dimensions, T>* drawables = nullptr): AbstractGroupedFeature<dimensions, Drawable<dimensions, T>, T>(object, drawables), _boundingVolume(BoundingVolume::None), _boundingRadius(T(0)) {}
+
+        /** @brief Bounding volume type */
+        BoundingVolume boundingVolume() const { return _boundingVolume; }
+
+        /**
+         * @brief Center of bounding volume
+         *
+         * In object local coordinates.
+         */
+        typename DimensionTraits<dimensions, T>::VectorType boundingCenter() const { return _boundingCenter; }
+
+        /**
+         * @brief Radius of bounding sphere
+         *
+         * Returns `0` if the bounding volume is not a sphere.
+         */
+        T boundingRadius() const { return _boundingRadius; }
+
+        /**
+         * @brief Half size of bounding box
+         *
+         * Returns zero vector if the bounding volume is not a box.
+         */
+        typename DimensionTraits<dimensions, T>::VectorType boundingHalfSize() const { return _boundingHalfSize; }
+
+        /**
+         * @brief Set bounding sphere
+         * @param center    Sphere center in object local coordinates
+         * @param radius    Sphere radius
+         * @return Pointer to self (for method chaining)
+         *
+         * If the transformation contains non-uniform scaling, the sphere is
+         * scaled by the largest scale factor. See @ref Drawable-culling for
+         * more information.
+         */
+        Drawable<dimensions, T>* setBoundingSphere(const typename DimensionTraits<dimensions, T>::VectorType& center, T radius) {
+            _boundingVolume = BoundingVolume::Sphere;
+            _boundingCenter = center;
+            _boundingHalfSize = {};
+            _boundingRadius = radius;
+            return this;
+        }
+
+        /**
+         * @brief Set bounding box
+         * @param min       Minimal box corner in object local coordinates
+         * @param max       Maximal box corner in object local coordinates
+         * @return Pointer to self (for method chaining)
+         *
+         * See @ref Drawable-culling for more information.
+         */
+        Drawable<dimensions, T>* setBoundingBox(const typename DimensionTraits<dimensions, T>::VectorType& min, const typename DimensionTraits<dimensions, T>::VectorType& max) {
+            _boundingVolume = BoundingVolume::Box;
+            _boundingCenter = (min + max)/T(2);
+            _boundingHalfSize = (max - min)/T(2);
+            _boundingRadius = T(0);
+            return this;
+        }
+
+        /**
+         * @brief Remove bounding volume
+         * @return Pointer to self (for method chaining)
+         *
+         * The drawable is then never culled.
+         */
+        Drawable<dimensions, T>* resetBoundingVolume() {
+            _boundingVolume = BoundingVolume::None;
+            _boundingCenter = _boundingHalfSize = {};
+            _boundingRadius = T(0);
+            return this;
+        }
 
         /**
          * @brief Draw the object using given camera
@@ -142,6 +246,27 @@ class Drawable: public AbstractGroupedFeature<dimensions, Drawable<dimensions, T
          * Projection matrix can be retrieved from AbstractCamera::projectionMatrix().
          */
         virtual void draw(const typename DimensionTraits<dimensions, T>::MatrixType& transformationMatrix, AbstractCamera<dimensions, T>* camera) = 0;
+
+        /**
+         * @brief Record the object into draw list
+         * @param list                      Draw list
+         * @param transformationMatrix      %Object transformation relative
+         *      to camera
+         * @param camera                    Camera
+         *
+         * Called from AbstractCamera::record(). Default implementation adds
+         * the drawable to the list with zero key, reimplement it to provide
+         * sort key. See DrawList for more information.
+         */
+        virtual void record(DrawList<dimensions, T>& list, const typename DimensionTraits<dimensions, T>::MatrixType& transformationMatrix, AbstractCamera<dimensions, T>* camera) {
+            static_cast<void>(camera);
+            list.add(this, transformationMatrix);
+        }
+
+    private:
+        BoundingVolume _boundingVolume;
+        typename DimensionTraits<dimensions, T>::VectorType _boundingCenter, _boundingHalfSize;
+        T _boundingRadius;
 };
 
 #ifndef CORRADE_GCC46_COMPATIBILITY
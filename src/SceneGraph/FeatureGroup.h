@@ -115,6 +115,14 @@ class FeatureGroup: public AbstractFeatureGroup<dimensions, T> {
          * @see add()
          */
         FeatureGroup<dimensions, Feature, T>* remove(Feature* feature);
+
+    private:
+        /* Called after the feature was added to the group and before it is
+           removed from it, on all paths (including moving the feature from
+           other group). Subclasses can use these to keep their own state in
+           sync. */
+        virtual void featureAdded(Feature*) {}
+        virtual void featureRemoved(Feature*) {}
 };
 
 #ifndef CORRADE_GCC46_COMPATIBILITY
@@ -163,6 +171,7 @@ template<UnsignedInt dimensions, class Feature, class T> FeatureGroup<dimensions
     /* Crossreference the feature and group together */
     AbstractFeatureGroup<dimensions, T>::add(feature);
     feature->_group = this;
+    featureAdded(feature);
     return this;
 }
 
@@ -170,6 +179,7 @@ template<UnsignedInt dimensions, class Feature, class T> FeatureGroup<dimensions
     CORRADE_ASSERT(feature->_group == this,
         "SceneGraph::AbstractFeatureGroup::remove(): feature is not part of this group", this);
 
+    featureRemoved(feature);
     AbstractFeatureGroup<dimensions, T>::remove(feature);
     feature->_group = nullptr;
     return this;
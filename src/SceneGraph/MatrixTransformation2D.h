@@ -37,7 +37,9 @@ namespace Magnum { namespace SceneGraph {
 /**
 @brief Two-dimensional transformation implemented using matrices
 
-Uses Math::Matrix3 as underlying type.
+Uses Math::Matrix3 as underlying type. Inverse transformations (e.g. for
+cameras) are computed using Matrix3::invertedAffine() unless the transformation
+contains projection.
 @see @ref scenegraph, RigidMatrixTransformation2D, MatrixTransformation3D
 */
 #ifndef DOXYGEN_GENERATING_OUTPUT
@@ -64,7 +66,8 @@ class MatrixTransformation2D: public AbstractTranslationRotationScaling2D<T> {
         }
 
         static Math::Matrix3<T> inverted(const Math::Matrix3<T>& transformation) {
-            return transformation.inverted();
+            return transformation.isAffineTransformation() ?
+                transformation.invertedAffine() : transformation.inverted();
         }
 
         Math::Matrix3<T> transformation() const {
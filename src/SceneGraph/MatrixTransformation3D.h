@@ -37,7 +37,9 @@ namespace Magnum { namespace SceneGraph {
 /**
 @brief Three-dimensional transformation implemented using matrices
 
-Uses Math::Matrix4 as underlying type.
+Uses Math::Matrix4 as underlying type. Inverse transformations (e.g. for
+cameras) are computed using Matrix4::invertedAffine() unless the transformation
+contains projection.
 @see @ref scenegraph, RigidMatrixTransformation3D, MatrixTransformation2D
 */
 #ifndef DOXYGEN_GENERATING_OUTPUT
@@ -64,7 +66,8 @@ class MatrixTransformation3D: public AbstractTranslationRotationScaling3D<T> {
         }
 
         static Math::Matrix4<T> inverted(const Math::Matrix4<T>& transformation) {
-            return transformation.inverted();
+            return transformation.isAffineTransformation() ?
+                transformation.invertedAffine() : transformation.inverted();
         }
 
         Math::Matrix4<T> transformation() const {
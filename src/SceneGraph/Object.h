@@ -41,7 +41,7 @@ namespace Implementation {
     enum class ObjectFlag: UnsignedByte {
         Dirty = 1 << 0,
         Visited = 1 << 1,
-        Joint = 1 << 2
+        AbsoluteTransformationCached = 1 << 2
     };
 
     typedef Containers::EnumSet<ObjectFlag, UnsignedByte> ObjectFlags;
@@ -111,7 +111,7 @@ template<class Transformation> class MAGNUM_SCENEGRAPH_EXPORT Object: public Abs
          * @brief Constructor
          * @param parent    Parent object
          */
-        explicit Object(Object<Transformation>* parent = nullptr): counter(0xFFFFu), flags(Flag::Dirty) {
+        explicit Object(Object<Transformation>* parent = nullptr): counter(0xFFFFFFFFu), flags(Flag::Dirty), generation(++currentGeneration), cachedGeneration(0) {
             setParent(parent);
         }
 
@@ -230,7 +230,12 @@ template<class Transformation> class MAGNUM_SCENEGRAPH_EXPORT Object: public Abs
         /**
          * @brief Transformation relative to root object
          *
-         * @see absoluteTransformationMatrix()
+         * If caching is enabled for this object, returns cached value, which
+         * is recomputed only if transformation of the object or any of its
+         * parents changed since. Otherwise the transformation is computed
+         * from scratch on every call.
+         * @see absoluteTransformationMatrix(),
+         *      setAbsoluteTransformationCached()
          */
         typename Transformation::DataType absoluteTransformation() const;
 
@@ -280,6 +285,29 @@ template<class Transformation> class MAGNUM_SCENEGRAPH_EXPORT Object: public Abs
         /** @copydoc AbstractObject::setClean() */
         void setClean();
 
+        /**
+         * @brief Whether absolute transformation is cached
+         *
+         * @see setAbsoluteTransformationCached()
+         */
+        bool isAbsoluteTransformationCached() const {
+            return !!(flags & Flag::AbsoluteTransformationCached);
+        }
+
+        /**
+         * @brief Enable or disable caching of absolute transformation
+         * @return Pointer to self (for method chaining)
+         *
+         * Disabled by default. See @ref scenegraph-caching-absolute for more
+         * information.
+         * @see absoluteTransformation()
+         */
+        Object<Transformation>* setAbsoluteTransformationCached(bool cached) {
+            if(cached) flags |= Flag::AbsoluteTransformationCached;
+            else flags &= ~Flag::AbsoluteTransformationCached;
+            return this;
+        }
+
         /*@}*/
 
     #ifndef DOXYGEN_GENERATING_OUTPUT
@@ -300,8 +328,6 @@ template<class Transformation> class MAGNUM_SCENEGRAPH_EXPORT Object: public Abs
 
         std::vector<MatrixType> doTransformationMatrices(const std::vector<AbstractObject<Transformation::Dimensions, typename Transformation::Type>*>& objects, const MatrixType& initialTransformationMatrix) const override final;
 
-        typename Transformation::DataType MAGNUM_SCENEGRAPH_LOCAL computeJointTransformation(const std::vector<Object<Transformation>*>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const std::size_t joint, const typename Transformation::DataType& initialTransformation) const;
-
         bool MAGNUM_SCENEGRAPH_LOCAL doIsDirty() const override final { return isDirty(); }
         void MAGNUM_SCENEGRAPH_LOCAL doSetDirty() override final { setDirty(); }
         void MAGNUM_SCENEGRAPH_LOCAL doSetClean() override final { setClean(); }
@@ -311,8 +337,17 @@ template<class Transformation> class MAGNUM_SCENEGRAPH_EXPORT Object: public Abs
 
         typedef Implementation::ObjectFlag Flag;
         typedef Implementation::ObjectFlags Flags;
-        UnsignedShort counter;
+        UnsignedInt counter;
         Flags flags;
+
+        /* Generation counter, incremented on every transformation or parent
+           change of any object. Each object remembers the generation of its
+           last change and the generation at which its cached absolute
+           transformation was computed. */
+        static UnsignedLong currentGeneration;
+        UnsignedLong generation;
+        mutable UnsignedLong cachedGeneration;
+        mutable typename Transformation::DataType cachedAbsoluteTransformation;
 };
 
 }}
@@ -34,16 +34,36 @@
 #include <algorithm>
 #include <stack>
 
+#include "Math/Algorithms/BatchTransform.h"
 #include "Scene.h"
 
 namespace Magnum { namespace SceneGraph {
 
+namespace Implementation {
+    /* Composes parent transformation with consecutive transformations of its
+       children, three-dimensional matrices are multiplied in a batch */
+    template<class Transformation, class DataType = typename Transformation::DataType> struct ComposeChildren {
+        static void compose(const DataType& parent, DataType* children, std::size_t count) {
+            for(std::size_t i = 0; i != count; ++i)
+                children[i] = Transformation::compose(parent, children[i]);
+        }
+    };
+
+    template<class Transformation> struct ComposeChildren<Transformation, Math::Matrix4<Float>> {
+        static void compose(const Math::Matrix4<Float>& parent, Math::Matrix4<Float>* children, std::size_t count) {
+            Math::Algorithms::multiply(parent, children, children, count);
+        }
+    };
+}
+
 template<UnsignedInt dimensions, class T> AbstractObject<dimensions, T>::AbstractObject() {}
 template<UnsignedInt dimensions, class T> AbstractObject<dimensions, T>::~AbstractObject() {}
 
 template<UnsignedInt dimensions, class T> AbstractTransformation<dimensions, T>::AbstractTransformation() {}
 template<UnsignedInt dimensions, class T> AbstractTransformation<dimensions, T>::~AbstractTransformation() {}
 
+template<class Transformation> UnsignedLong Object<Transformation>::currentGeneration = 0;
+
 template<class Transformation> Object<Transformation>::~Object() = default;
 
 template<class Transformation> Scene<Transformation>* Object<Transformation>::scene() {
@@ -100,28 +120,112 @@ template<class Transformation> Object<Transformation>* Object<Transformation>::s
     return this;
 }
 
+/*
+Computing absolute transformation
+
+All objects on the path to the root are collected and their transformations
+are composed going down from the root, without recursion, so deep hierarchies
+don't exhaust the stack.
+
+If caching is enabled, each object remembers generation of its last
+transformation or parent change and generation in which its cached absolute
+transformation was computed. The cached value of an object is valid if it was
+computed after the last change of the object and all its parents, i.e. it is
+not older than the newest generation on the path from the root down to the
+object. If nothing in the scene changed since the cached value was computed,
+it is returned right away. Otherwise the path is walked once without touching
+any transformations, then the composition starts from the deepest parent with
+valid cached transformation (usually the parent itself, if objects are queried
+from the root down or only the object itself changed) and the cache of every
+object on the way is updated.
+*/
 template<class Transformation> typename Transformation::DataType Object<Transformation>::absoluteTransformation() const {
-    if(!parent()) return Transformation::transformation();
-    return Transformation::compose(parent()->absoluteTransformation(), Transformation::transformation());
+    const bool cached = !!(flags & Flag::AbsoluteTransformationCached);
+
+    /* Nothing in the scene changed since the cached value was computed */
+    if(cached && cachedGeneration == currentGeneration)
+        return cachedAbsoluteTransformation;
+
+    /* Collect all objects on the path, avoid allocation for reasonably
+       shallow hierarchies */
+    std::size_t count = 0;
+    for(const Object<Transformation>* p = this; p; p = p->parent())
+        ++count;
+    const Object<Transformation>* stackObjects[32];
+    std::vector<const Object<Transformation>*> heapObjects;
+    const Object<Transformation>** objects = stackObjects;
+    if(count > 32) {
+        heapObjects.resize(count);
+        objects = heapObjects.data();
+    }
+
+    std::size_t i = 0;
+    for(const Object<Transformation>* p = this; p; p = p->parent())
+        objects[i++] = p;
+
+    /* Going down from the root, find the deepest parent with valid cache.
+       Its validity depends only on generations of the path above it, not on
+       generation of this object. */
+    std::size_t begin = count;
+    if(cached) {
+        UnsignedLong newest = 0;
+        for(i = count; i != 1; --i) {
+            newest = std::max(newest, objects[i-1]->generation);
+            if(objects[i-1]->cachedGeneration >= newest) begin = i-1;
+        }
+
+        /* Cache of this object is valid too */
+        newest = std::max(newest, generation);
+        if(cachedGeneration >= newest) return cachedAbsoluteTransformation;
+    }
+
+    /* Compose the transformations going down */
+    typename Transformation::DataType absoluteTransformation = begin != count ?
+        Transformation::compose(objects[begin]->cachedAbsoluteTransformation, objects[begin-1]->transformation()) :
+        objects[count-1]->transformation();
+    for(i = begin; i != 0; --i) {
+        if(i != begin) absoluteTransformation = Transformation::compose(absoluteTransformation, objects[i-1]->transformation());
+
+        if(cached) {
+            objects[i-1]->cachedAbsoluteTransformation = absoluteTransformation;
+            objects[i-1]->cachedGeneration = currentGeneration;
+        }
+    }
+
+    return absoluteTransformation;
 }
 
 template<class Transformation> void Object<Transformation>::setDirty() {
+    /* Invalidate cached absolute transformations of this object and all
+       children */
+    generation = ++currentGeneration;
+
     /* The transformation of this object (and all children) is already dirty,
        nothing to do */
     if(flags & Flag::Dirty) return;
 
-    Object<Transformation>* self = static_cast<Object<Transformation>*>(this);
-
-    /* Make all features dirty */
-    for(AbstractFeature<Transformation::Dimensions, typename Transformation::Type>* i = self->firstFeature(); i; i = i->nextFeature())
-        i->markDirty();
-
-    /* Make all children dirty */
-    for(Object<Transformation>* i = self->firstChild(); i; i = i->nextSibling())
-        i->setDirty();
+    /* Mark features of this object and all children dirty, skipping subtrees
+       which are already dirty. Iterative preorder traversal, so deep
+       hierarchies don't exhaust the stack. */
+    Object<Transformation>* o = static_cast<Object<Transformation>*>(this);
+    for(;;) {
+        if(!(o->flags & Flag::Dirty)) {
+            for(AbstractFeature<Transformation::Dimensions, typename Transformation::Type>* i = o->firstFeature(); i; i = i->nextFeature())
+                i->markDirty();
+            o->flags |= Flag::Dirty;
+
+            /* Go to children */
+            if(o->firstChild()) {
+                o = o->firstChild();
+                continue;
+            }
+        }
 
-    /* Mark object as dirty */
-    flags |= Flag::Dirty;
+        /* Go to next sibling of this or nearest parent below this object */
+        while(o != this && !o->nextSibling()) o = o->parent();
+        if(o == this) break;
+        o = o->nextSibling();
+    }
 }
 
 template<class Transformation> void Object<Transformation>::setClean() {
@@ -183,144 +287,88 @@ template<class Transformation> auto Object<Transformation>::transformationMatric
 Computing absolute transformations for given list of objects
 
 The goal is to compute absolute transformation only once for each object
-involved. Objects contained in the subtree specified by `object` list are
-divided into two groups:
- - "joints", which are either part of `object` list or they have more than one
-   child in the subtree
- - "non-joints", i.e. paths between joints
-
-Then for all joints their transformation (relative to parent joint) is
-computed and recursively concatenated together. Resulting transformations for
-joints which were originally in `object` list is then returned.
+involved. All objects on the paths from the objects in the list up to the root
+are put into one flat array in such order that each parent comes before all its
+children (each object also remembers index of its parent in that array). The
+hierarchy is then resolved in one linear pass over the array, composing
+transformation of each object with the already computed transformation of its
+parent. The array index of each object is temporarily stored in its `counter`
+field, which also serves as a "visited" mark -- every object is thus processed
+only once and the whole operation is linear in count of involved objects.
 */
 template<class Transformation> std::vector<typename Transformation::DataType> Object<Transformation>::transformations(std::vector<Object<Transformation>*> objects, const typename Transformation::DataType& initialTransformation) const {
-    CORRADE_ASSERT(objects.size() < 0xFFFFu, "SceneGraph::Object::transformations(): too large scene", {});
-
-    /* Remember object count for later */
-    std::size_t objectCount = objects.size();
-
-    /* Mark all original objects as joints and create initial list of joints
-       from them */
-    for(std::size_t i = 0; i != objects.size(); ++i) {
-        /* Multiple occurences of one object in the array, don't overwrite it
-           with different counter */
-        if(objects[i]->counter != 0xFFFFu) continue;
-
-        objects[i]->counter = i;
-        objects[i]->flags |= Flag::Joint;
-    }
-    std::vector<Object<Transformation>*> jointObjects(objects);
-
     /* Scene object */
     const Scene<Transformation>* scene = this->scene();
 
     /* Nearest common ancestor not yet implemented - assert this is done on scene */
     CORRADE_ASSERT(scene == this, "SceneGraph::Object::transformationMatrices(): currently implemented only for Scene", {});
 
-    /* Mark all objects up the hierarchy as visited */
-    auto it = objects.begin();
-    while(!objects.empty()) {
-        /* Already visited, remove and continue to next (duplicate occurence) */
-        if((*it)->flags & Flag::Visited) {
-            it = objects.erase(it);
-            continue;
-        }
-
-        /* Mark the object as visited */
-        (*it)->flags |= Flag::Visited;
-
-        Object<Transformation>* parent = (*it)->parent();
-
-        /* If this is root object, remove from list */
-        if(!parent) {
-            CORRADE_ASSERT(*it == scene, "SceneGraph::Object::transformations(): the objects are not part of the same tree", {});
-            it = objects.erase(it);
-
-        /* Parent is an joint or already visited - remove current from list */
-        } else if(parent->flags & (Flag::Visited|Flag::Joint)) {
-            it = objects.erase(it);
-
-            /* If not already marked as joint, mark it as such and add it to
-               list of joint objects */
-            if(!(parent->flags & Flag::Joint)) {
-                CORRADE_ASSERT(jointObjects.size() < 0xFFFFu,
-                               "SceneGraph::Object::transformations(): too large scene", {});
-                CORRADE_INTERNAL_ASSERT(parent->counter == 0xFFFFu);
-                parent->counter = jointObjects.size();
-                parent->flags |= Flag::Joint;
-                jointObjects.push_back(parent);
+    /* Flattened hierarchy, parent indices of each object (or 0xFFFFFFFFu for
+       root) and path from currently processed object to first already
+       flattened one */
+    std::vector<Object<Transformation>*> flattened;
+    std::vector<UnsignedInt> parents;
+    std::vector<Object<Transformation>*> path;
+    flattened.reserve(objects.size());
+    parents.reserve(objects.size());
+
+    for(Object<Transformation>* o: objects) {
+        /* Go up the hierarchy until already visited object or root is found */
+        UnsignedInt parentIndex = 0xFFFFFFFFu;
+        for(Object<Transformation>* p = o; p; p = p->parent()) {
+            if(p->counter != 0xFFFFFFFFu) {
+                parentIndex = p->counter;
+                break;
             }
 
-        /* Else go up the hierarchy */
-        } else *it = parent;
-
-        /* Cycle if reached end */
-        if(it == objects.end()) it = objects.begin();
-    }
+            /* The root is not the scene, clean up the marks and exit */
+            if(!p->parent() && p != scene) {
+                for(Object<Transformation>* i: flattened) i->counter = 0xFFFFFFFFu;
+                CORRADE_ASSERT(false, "SceneGraph::Object::transformations(): the objects are not part of the same tree", {});
+                return {};
+            }
 
-    /* Array of absolute transformations in joints */
-    std::vector<typename Transformation::DataType> jointTransformations(jointObjects.size());
+            path.push_back(p);
+        }
 
-    /* Compute transformations for all joints */
-    for(std::size_t i = 0; i != jointTransformations.size(); ++i)
-        computeJointTransformation(jointObjects, jointTransformations, i, initialTransformation);
+        /* Add the path to flattened hierarchy, going from the top so each
+           parent is added before its children */
+        for(auto it = path.rbegin(); it != path.rend(); ++it) {
+            (*it)->counter = flattened.size();
+            flattened.push_back(*it);
+            parents.push_back(parentIndex);
+            parentIndex = (*it)->counter;
+        }
 
-    /* Copy transformation for second or next occurences from first occurence
-       of duplicate object */
-    for(std::size_t i = 0; i != objectCount; ++i) {
-        if(jointObjects[i]->counter != i)
-            jointTransformations[i] = jointTransformations[jointObjects[i]->counter];
+        path.clear();
     }
 
-    /* All visited marks are now cleaned, clean joint marks and counters */
-    for(auto i: jointObjects) {
-        /* All not-already cleaned objects (...duplicate occurences) should
-           have joint mark */
-        CORRADE_INTERNAL_ASSERT(i->counter = 0xFFFFu || i->flags & Flag::Joint);
-        i->flags &= ~Flag::Joint;
-        i->counter = 0xFFFFu;
+    /* Compute transformations of all objects in the flattened hierarchy.
+       Each parent precedes its children, so consecutive objects with the same
+       parent can be composed with it in one batch. */
+    std::vector<typename Transformation::DataType> flattenedTransformations(flattened.size());
+    for(std::size_t i = 0; i != flattened.size(); ) {
+        std::size_t end = i;
+        do {
+            flattenedTransformations[end] = flattened[end]->transformation();
+        } while(++end != flattened.size() && parents[end] == parents[i]);
+
+        Implementation::ComposeChildren<Transformation>::compose(
+            parents[i] == 0xFFFFFFFFu ? initialTransformation : flattenedTransformations[parents[i]],
+            flattenedTransformations.data()+i, end-i);
+        i = end;
     }
 
-    /* Shrink the array to contain only transformations of requested objects and return */
-    jointTransformations.resize(objectCount);
-    return jointTransformations;
-}
-
-template<class Transformation> typename Transformation::DataType Object<Transformation>::computeJointTransformation(const std::vector<Object<Transformation>*>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const std::size_t joint, const typename Transformation::DataType& initialTransformation) const {
-    Object<Transformation>* o = jointObjects[joint];
-
-    /* Transformation already computed ("unvisited" by this function before
-       either due to recursion or duplicate object occurences), done */
-    if(!(o->flags & Flag::Visited)) return jointTransformations[joint];
-
-    /* Initialize transformation */
-    jointTransformations[joint] = o->transformation();
-
-    /* Go up until next joint or root */
-    for(;;) {
-        /* Clean visited mark */
-        CORRADE_INTERNAL_ASSERT(o->flags & Flag::Visited);
-        o->flags &= ~Flag::Visited;
+    /* Gather transformations of requested objects (possibly with duplicate
+       occurences) */
+    std::vector<typename Transformation::DataType> transformations(objects.size());
+    for(std::size_t i = 0; i != objects.size(); ++i)
+        transformations[i] = flattenedTransformations[objects[i]->counter];
 
-        Object<Transformation>* parent = o->parent();
+    /* Clean all marks */
+    for(Object<Transformation>* i: flattened) i->counter = 0xFFFFFFFFu;
 
-        /* Root object, compose transformation with initial, done */
-        if(!parent) {
-            CORRADE_INTERNAL_ASSERT(o->isScene());
-            return (jointTransformations[joint] =
-                Transformation::compose(initialTransformation, jointTransformations[joint]));
-
-        /* Joint object, compose transformation with the joint, done */
-        } else if(parent->flags & Flag::Joint) {
-            return (jointTransformations[joint] =
-                Transformation::compose(computeJointTransformation(jointObjects, jointTransformations, parent->counter, initialTransformation), jointTransformations[joint]));
-
-        /* Else compose transformation with parent, go up the hierarchy */
-        } else {
-            jointTransformations[joint] = Transformation::compose(parent->transformation(), jointTransformations[joint]);
-            o = parent;
-        }
-    }
+    return transformations;
 }
 
 template<class Transformation> void Object<Transformation>::doSetClean(const std::vector<AbstractObject<Transformation::Dimensions, typename Transformation::Type>*>& objects) {
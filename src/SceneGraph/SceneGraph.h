@@ -106,6 +106,12 @@ template<class T = Float> using Drawable2D = Drawable<2, T>;
 template<class T = Float> using Drawable3D = Drawable<3, T>;
 #endif
 
+template<UnsignedInt dimensions, class T = Float> class DrawList;
+#ifndef CORRADE_GCC46_COMPATIBILITY
+template<class T = Float> using DrawList2D = DrawList<2, T>;
+template<class T = Float> using DrawList3D = DrawList<3, T>;
+#endif
+
 template<class T = Float> class DualComplexTransformation;
 template<class T = Float> class DualQuaternionTransformation;
 
@@ -24,7 +24,7 @@
 
 #include <TestSuite/Tester.h>
 
-#include "SceneGraph/AbstractCamera.hpp" /* only for aspectRatioFix(), so it doesn't have to be exported */
+#include "SceneGraph/AbstractCamera.hpp" /* only for aspectRatioFix() and Frustum, so they don't have to be exported */
 #include "SceneGraph/Camera2D.h"
 #include "SceneGraph/Camera3D.h"
 #include "SceneGraph/Drawable.h"
@@ -46,10 +46,15 @@ class CameraTest: public TestSuite::Tester {
         void projectionSizePerspective();
         void projectionSizeViewport();
         void draw();
+        void frustumSphere();
+        void frustumBox();
+        void frustum2D();
+        void drawCulled();
 };
 
 typedef SceneGraph::Object<SceneGraph::MatrixTransformation2D<>> Object2D;
 typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D<>> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation2D<>> Scene2D;
 typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D<>> Scene3D;
 typedef SceneGraph::Camera2D<> Camera2D;
 typedef SceneGraph::Camera3D<> Camera3D;
@@ -62,7 +67,11 @@ CameraTest::CameraTest() {
               &CameraTest::projectionSizeOrthographic,
               &CameraTest::projectionSizePerspective,
               &CameraTest::projectionSizeViewport,
-              &CameraTest::draw});
+              &CameraTest::draw,
+              &CameraTest::frustumSphere,
+              &CameraTest::frustumBox,
+              &CameraTest::frustum2D,
+              &CameraTest::drawCulled});
 }
 
 void CameraTest::fixAspectRatio() {
@@ -197,6 +206,118 @@ void CameraTest::draw() {
     CORRADE_COMPARE(thirdTransformation, Matrix4());
 }
 
+namespace {
+
+template<UnsignedInt dimensions> class NullDrawable: public SceneGraph::Drawable<dimensions> {
+    public:
+        NullDrawable(AbstractObject<dimensions>* object, DrawableGroup<dimensions>* group = nullptr, UnsignedInt* drawCount = nullptr): SceneGraph::Drawable<dimensions>(object, group), drawCount(drawCount) {}
+
+    protected:
+        void draw(const typename DimensionTraits<dimensions>::MatrixType&, AbstractCamera<dimensions>*) override {
+            if(drawCount) ++*drawCount;
+        }
+
+    private:
+        UnsignedInt* drawCount;
+};
+
+}
+
+void CameraTest::frustumSphere() {
+    Object3D o;
+    NullDrawable<3> d(&o);
+    d.setBoundingSphere({}, 1.0f);
+    CORRADE_VERIFY(d.boundingVolume() == Drawable<3>::BoundingVolume::Sphere);
+    CORRADE_COMPARE(d.boundingRadius(), 1.0f);
+
+    /* 90 degree field of view, near plane at 1, far at 100 */
+    const Implementation::Frustum<3, Float> frustum(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 1.0f, 100.0f));
+
+    /* In front of the camera, behind it, past the far plane */
+    CORRADE_VERIFY(frustum.isVisible(d, Matrix4::translation(Vector3::zAxis(-10.0f))));
+    CORRADE_VERIFY(!frustum.isVisible(d, Matrix4::translation(Vector3::zAxis(10.0f))));
+    CORRADE_VERIFY(!frustum.isVisible(d, Matrix4::translation(Vector3::zAxis(-102.0f))));
+    CORRADE_VERIFY(frustum.isVisible(d, Matrix4::translation(Vector3::zAxis(-100.5f))));
+
+    /* Beside the frustum, touching it and intersecting when scaled */
+    CORRADE_VERIFY(!frustum.isVisible(d, Matrix4::translation({12.0f, 0.0f, -10.0f})));
+    CORRADE_VERIFY(frustum.isVisible(d, Matrix4::translation({11.0f, 0.0f, -10.0f})));
+    CORRADE_VERIFY(frustum.isVisible(d, Matrix4::translation({12.0f, 0.0f, -10.0f})*Matrix4::scaling({1.0f, 2.0f, 1.0f})));
+
+    /* No bounding volume, never culled */
+    d.resetBoundingVolume();
+    CORRADE_VERIFY(d.boundingVolume() == Drawable<3>::BoundingVolume::None);
+    CORRADE_VERIFY(frustum.isVisible(d, Matrix4::translation(Vector3::zAxis(10.0f))));
+}
+
+void CameraTest::frustumBox() {
+    Object3D o;
+    NullDrawable<3> d(&o);
+    d.setBoundingBox({-1.0f, -1.0f, -1.0f}, {3.0f, 1.0f, 1.0f});
+    CORRADE_VERIFY(d.boundingVolume() == Drawable<3>::BoundingVolume::Box);
+    CORRADE_COMPARE(d.boundingCenter(), Vector3::xAxis(1.0f));
+    CORRADE_COMPARE(d.boundingHalfSize(), Vector3(2.0f, 1.0f, 1.0f));
+
+    const Implementation::Frustum<3, Float> frustum(Matrix4::orthographicProjection({10.0f, 10.0f}, 1.0f, 100.0f));
+    CORRADE_VERIFY(frustum.isVisible(d, Matrix4::translation(Vector3::zAxis(-10.0f))));
+    CORRADE_VERIFY(!frustum.isVisible(d, Matrix4::translation({-8.5f, 0.0f, -10.0f})));
+    CORRADE_VERIFY(frustum.isVisible(d, Matrix4::translation({-7.5f, 0.0f, -10.0f})));
+
+    /* Rotated box reaches into the frustum */
+    CORRADE_VERIFY(!frustum.isVisible(d, Matrix4::translation({7.0f, 0.0f, -10.0f})));
+    CORRADE_VERIFY(frustum.isVisible(d, Matrix4::translation({7.0f, 0.0f, -10.0f})*Matrix4::rotationZ(Deg(180.0f))));
+}
+
+void CameraTest::frustum2D() {
+    Object2D o;
+    NullDrawable<2> d(&o);
+    d.setBoundingSphere({}, 1.0f);
+
+    const Implementation::Frustum<2, Float> frustum(Matrix3::projection({4.0f, 2.0f}));
+    CORRADE_VERIFY(frustum.isVisible(d, Matrix3::translation({2.5f, 0.0f})));
+    CORRADE_VERIFY(!frustum.isVisible(d, Matrix3::translation({3.5f, 0.0f})));
+    CORRADE_VERIFY(!frustum.isVisible(d, Matrix3::translation({0.0f, -2.5f})));
+
+    d.setBoundingBox({-1.0f, -1.0f}, {1.0f, 1.0f});
+    CORRADE_VERIFY(!frustum.isVisible(d, Matrix3::translation({0.0f, 2.3f})));
+    CORRADE_VERIFY(frustum.isVisible(d, Matrix3::translation({0.0f, 2.3f})*Matrix3::rotation(Deg(45.0f))));
+}
+
+void CameraTest::drawCulled() {
+    DrawableGroup<3> group;
+    Scene3D scene;
+    UnsignedInt drawCount = 0;
+
+    /* In front of the camera */
+    Object3D first(&scene);
+    first.translate(Vector3::zAxis(-5.0f));
+    (new NullDrawable<3>(&first, &group, &drawCount))->setBoundingSphere({}, 1.0f);
+
+    /* Behind the camera */
+    Object3D second(&scene);
+    second.translate(Vector3::zAxis(5.0f));
+    (new NullDrawable<3>(&second, &group, &drawCount))->setBoundingSphere({}, 1.0f);
+
+    /* Behind the camera, but without bounding volume */
+    new NullDrawable<3>(&second, &group, &drawCount);
+
+    Object3D cameraObject(&scene);
+    Camera3D camera(&cameraObject);
+    camera.setPerspective(Deg(90.0f), 1.0f, 0.1f, 100.0f);
+    CORRADE_COMPARE(camera.culledDrawableCount(), 0);
+
+    camera.draw(group);
+    CORRADE_COMPARE(drawCount, 2);
+    CORRADE_COMPARE(camera.culledDrawableCount(), 1);
+
+    /* Turn the camera around */
+    cameraObject.rotateY(Deg(180.0f));
+    DrawList<3> list;
+    camera.record(group, list);
+    CORRADE_COMPARE(list.size(), 2);
+    CORRADE_COMPARE(camera.culledDrawableCount(), 1);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::CameraTest)
@@ -0,0 +1,142 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <memory>
+#include <TestSuite/Tester.h>
+
+#include "SceneGraph/Camera3D.h"
+#include "SceneGraph/Drawable.h"
+#include "SceneGraph/MatrixTransformation3D.h"
+#include "SceneGraph/Scene.h"
+#include "Test/Benchmark.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+using Magnum::Test::measure;
+
+class DrawListBenchmark: public TestSuite::Tester {
+    public:
+        DrawListBenchmark();
+
+        void draw10k();
+        void draw100k();
+
+    private:
+        void draw(std::size_t count);
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D<>> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D<>> Scene3D;
+
+namespace {
+
+/* Drawable which only counts state changes it would cause */
+class Drawable: public SceneGraph::Drawable<3> {
+    public:
+        Drawable(AbstractObject<3>* object, UnsignedInt program, UnsignedInt texture, UnsignedInt mesh, UnsignedInt& stateChanges): SceneGraph::Drawable<3>(object), program(program), texture(texture), mesh(mesh), stateChanges(stateChanges) {}
+
+        UnsignedLong key(const Matrix4& transformationMatrix) const {
+            return DrawList<3>::key(program, texture, mesh, -transformationMatrix.translation().z()/100.0f);
+        }
+
+        void draw(const Matrix4&, AbstractCamera<3>*) override {
+            if(current[0] != program) ++stateChanges;
+            if(current[1] != texture) ++stateChanges;
+            if(current[2] != mesh) ++stateChanges;
+            current[0] = program;
+            current[1] = texture;
+            current[2] = mesh;
+        }
+
+    private:
+        static UnsignedInt current[3];
+
+        UnsignedInt program, texture, mesh;
+        UnsignedInt& stateChanges;
+};
+
+UnsignedInt Drawable::current[3];
+
+}
+
+DrawListBenchmark::DrawListBenchmark() {
+    addTests({&DrawListBenchmark::draw10k,
+              &DrawListBenchmark::draw100k});
+}
+
+void DrawListBenchmark::draw10k() { draw(10000); }
+void DrawListBenchmark::draw100k() { draw(100000); }
+
+void DrawListBenchmark::draw(const std::size_t count) {
+    /* Drawables with random combination of 8 shaders, 64 textures and 256
+       meshes at random depth */
+    Scene3D scene;
+    Object3D object(&scene);
+    Camera3D<> camera(&scene);
+    std::vector<std::unique_ptr<Drawable>> drawables;
+    std::vector<Matrix4> transformations;
+    drawables.reserve(count);
+    transformations.reserve(count);
+    UnsignedInt stateChanges = 0;
+    UnsignedInt seed = 17;
+    for(std::size_t i = 0; i != count; ++i) {
+        seed = seed*1103515245u + 12345u;
+        drawables.emplace_back(new Drawable(&object, (seed >> 8) % 8, (seed >> 12) % 64, (seed >> 18) % 256, stateChanges));
+        transformations.push_back(Matrix4::translation(Vector3::zAxis(-Float((seed >> 4) % 100))));
+    }
+
+    DrawList<3> list;
+    const std::size_t repeats = 1000000/count + 1;
+    Debug() << count << "drawables:";
+    Debug() << "  unsorted draw:" << measure([&]() {
+        for(std::size_t i = 0; i != count; ++i)
+            drawables[i]->draw(transformations[i], &camera);
+    }, repeats) << "ms";
+    Debug() << "  record:" << measure([&]() {
+        list.clear();
+        for(std::size_t i = 0; i != count; ++i)
+            list.add(drawables[i].get(), transformations[i], drawables[i]->key(transformations[i]));
+    }, repeats) << "ms";
+    Debug() << "  sort and draw:" << measure([&]() {
+        list.clear();
+        for(std::size_t i = 0; i != count; ++i)
+            list.add(drawables[i].get(), transformations[i], drawables[i]->key(transformations[i]));
+        list.draw(&camera);
+    }, repeats) << "ms";
+
+    /* Count of state changes in both cases */
+    stateChanges = 0;
+    for(std::size_t i = 0; i != count; ++i)
+        drawables[i]->draw(transformations[i], &camera);
+    const UnsignedInt unsortedStateChanges = stateChanges;
+    stateChanges = 0;
+    list.draw(&camera);
+    Debug() << "  state changes:" << unsortedStateChanges << "unsorted," << stateChanges << "sorted";
+    CORRADE_VERIFY(stateChanges < unsortedStateChanges);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::DrawListBenchmark)
@@ -0,0 +1,209 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <limits>
+#include <memory>
+#include <TestSuite/Tester.h>
+
+#include "SceneGraph/Camera3D.h"
+#include "SceneGraph/Drawable.h"
+#include "SceneGraph/MatrixTransformation3D.h"
+#include "SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+class DrawListTest: public TestSuite::Tester {
+    public:
+        DrawListTest();
+
+        void key();
+        void draw();
+        void drawSameKey();
+        void clear();
+        void record();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D<>> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D<>> Scene3D;
+typedef SceneGraph::Camera3D<> Camera3D;
+
+namespace {
+
+class Drawable: public SceneGraph::Drawable<3> {
+    public:
+        Drawable(AbstractObject<3>* object, DrawableGroup<3>* group, Int id, UnsignedLong key, std::vector<std::pair<Int, Matrix4>>& drawn): SceneGraph::Drawable<3>(object, group), id(id), key(key), drawn(drawn) {}
+
+    protected:
+        void draw(const Matrix4& transformationMatrix, AbstractCamera<3>*) override {
+            drawn.push_back({id, transformationMatrix});
+        }
+
+        void record(DrawList<3>& list, const Matrix4& transformationMatrix, AbstractCamera<3>*) override {
+            list.add(this, transformationMatrix, key);
+        }
+
+    private:
+        Int id;
+        UnsignedLong key;
+        std::vector<std::pair<Int, Matrix4>>& drawn;
+};
+
+}
+
+DrawListTest::DrawListTest() {
+    addTests({&DrawListTest::key,
+              &DrawListTest::draw,
+              &DrawListTest::drawSameKey,
+              &DrawListTest::clear,
+              &DrawListTest::record});
+}
+
+void DrawListTest::key() {
+    CORRADE_COMPARE(DrawList<3>::key(0x1234, 0x5678, 0x9abc, 1.0f), 0x123456789abcffffull);
+
+    /* Only lower 16 bits are used */
+    CORRADE_COMPARE(DrawList<3>::key(0x51234, 0x5678, 0x9abc, 0.0f), 0x123456789abc0000ull);
+
+    /* Program has precedence over everything else */
+    CORRADE_VERIFY(DrawList<3>::key(2, 0, 0, 0.0f) > DrawList<3>::key(1, 0xffff, 0xffff, 1.0f));
+    CORRADE_VERIFY(DrawList<3>::key(1, 1, 0, 0.0f) > DrawList<3>::key(1, 0, 0xffff, 1.0f));
+    CORRADE_VERIFY(DrawList<3>::key(1, 1, 1, 0.25f) > DrawList<3>::key(1, 1, 1, 0.125f));
+
+    /* Depth is clamped */
+    CORRADE_COMPARE(DrawList<3>::key(0, 0, 0, -1.0f), 0);
+    CORRADE_COMPARE(DrawList<3>::key(0, 0, 0, 2.0f), 0xffff);
+    CORRADE_COMPARE(DrawList<3>::key(0, 0, 0, std::numeric_limits<Float>::quiet_NaN()), 0);
+}
+
+void DrawListTest::draw() {
+    Scene3D scene;
+    Object3D object(&scene);
+    Camera3D camera(&scene);
+    std::vector<std::pair<Int, Matrix4>> drawn;
+    Drawable a(&object, nullptr, 0, 0, drawn);
+    Drawable b(&object, nullptr, 1, 0, drawn);
+    Drawable c(&object, nullptr, 2, 0, drawn);
+
+    DrawList<3> list;
+    CORRADE_VERIFY(list.isEmpty());
+    list.add(&a, Matrix4::translation(Vector3::xAxis()), 30)
+       ->add(&b, Matrix4::translation(Vector3::yAxis()), 10)
+       ->add(&c, Matrix4::translation(Vector3::zAxis()), 20);
+    CORRADE_COMPARE(list.size(), 3);
+
+    list.draw(&camera);
+    CORRADE_COMPARE(drawn.size(), 3);
+    CORRADE_COMPARE(drawn[0].first, 1);
+    CORRADE_COMPARE(drawn[0].second, Matrix4::translation(Vector3::yAxis()));
+    CORRADE_COMPARE(drawn[1].first, 2);
+    CORRADE_COMPARE(drawn[1].second, Matrix4::translation(Vector3::zAxis()));
+    CORRADE_COMPARE(drawn[2].first, 0);
+    CORRADE_COMPARE(drawn[2].second, Matrix4::translation(Vector3::xAxis()));
+
+    /* The list is kept for drawing again */
+    list.draw(&camera);
+    CORRADE_COMPARE(drawn.size(), 6);
+    CORRADE_COMPARE(drawn[3].first, 1);
+    CORRADE_COMPARE(drawn[4].first, 2);
+    CORRADE_COMPARE(drawn[5].first, 0);
+}
+
+void DrawListTest::drawSameKey() {
+    Scene3D scene;
+    Object3D object(&scene);
+    Camera3D camera(&scene);
+    std::vector<std::pair<Int, Matrix4>> drawn;
+    std::vector<std::unique_ptr<Drawable>> drawables;
+
+    /* Drawables with the same key are drawn in order of addition */
+    DrawList<3> list;
+    for(Int i = 0; i != 100; ++i) {
+        drawables.emplace_back(new Drawable(&object, nullptr, i, 0, drawn));
+        list.add(drawables.back().get(), {}, i % 2);
+    }
+
+    list.draw(&camera);
+    CORRADE_COMPARE(drawn.size(), 100);
+    for(Int i = 0; i != 50; ++i) {
+        CORRADE_COMPARE(drawn[i].first, i*2);
+        CORRADE_COMPARE(drawn[50 + i].first, i*2 + 1);
+    }
+}
+
+void DrawListTest::clear() {
+    Scene3D scene;
+    Object3D object(&scene);
+    Camera3D camera(&scene);
+    std::vector<std::pair<Int, Matrix4>> drawn;
+    Drawable a(&object, nullptr, 0, 0, drawn);
+
+    DrawList<3> list;
+    list.add(&a, {});
+    list.clear();
+    CORRADE_VERIFY(list.isEmpty());
+
+    list.draw(&camera);
+    CORRADE_VERIFY(drawn.empty());
+}
+
+void DrawListTest::record() {
+    Scene3D scene;
+    DrawableGroup<3> group;
+    std::vector<std::pair<Int, Matrix4>> drawn;
+
+    Object3D first(&scene);
+    first.translate(Vector3::xAxis(2.0f));
+    new Drawable(&first, &group, 0, DrawList<3>::key(2, 0, 0, 0.0f), drawn);
+
+    Object3D second(&scene);
+    second.translate(Vector3::yAxis(3.0f));
+    new Drawable(&second, &group, 1, DrawList<3>::key(1, 0, 0, 0.0f), drawn);
+
+    Object3D third(&scene);
+    third.translate(Vector3::zAxis(-1.5f));
+    new Drawable(&third, &group, 2, DrawList<3>::key(1, 0, 0, 0.5f), drawn);
+
+    Object3D cameraObject(&scene);
+    cameraObject.translate(Vector3::zAxis(5.0f));
+    Camera3D camera(&cameraObject);
+
+    DrawList<3> list;
+    camera.record(group, list);
+    CORRADE_COMPARE(list.size(), 3);
+    CORRADE_VERIFY(drawn.empty());
+
+    list.draw(&camera);
+    CORRADE_COMPARE(drawn.size(), 3);
+    CORRADE_COMPARE(drawn[0].first, 1);
+    CORRADE_COMPARE(drawn[0].second, Matrix4::translation({0.0f, 3.0f, -5.0f}));
+    CORRADE_COMPARE(drawn[1].first, 2);
+    CORRADE_COMPARE(drawn[1].second, Matrix4::translation({0.0f, 0.0f, -6.5f}));
+    CORRADE_COMPARE(drawn[2].first, 0);
+    CORRADE_COMPARE(drawn[2].second, Matrix4::translation({2.0f, 0.0f, -5.0f}));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::DrawListTest)
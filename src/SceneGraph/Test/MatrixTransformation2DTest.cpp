@@ -84,6 +84,12 @@ void MatrixTransformation2DTest::compose() {
 void MatrixTransformation2DTest::inverted() {
     Matrix3 m = Matrix3::rotation(Deg(17.0f))*Matrix3::translation({1.0f, -0.3f});
     CORRADE_COMPARE(MatrixTransformation2D<>::inverted(m)*m, Matrix3());
+
+    /* Non-affine transformation uses the general algorithm */
+    Matrix3 projective = Matrix3({1.0f, 0.0f, 0.5f},
+                                 {0.0f, 1.0f, 0.0f},
+                                 {0.0f, 0.0f, 1.0f})*m;
+    CORRADE_COMPARE(MatrixTransformation2D<>::inverted(projective)*projective, Matrix3());
 }
 
 void MatrixTransformation2DTest::setTransformation() {
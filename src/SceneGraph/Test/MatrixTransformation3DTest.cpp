@@ -84,6 +84,10 @@ void MatrixTransformation3DTest::compose() {
 void MatrixTransformation3DTest::inverted() {
     Matrix4 m = Matrix4::rotationX(Deg(17.0f))*Matrix4::translation({1.0f, -0.3f, 2.3f})*Matrix4::scaling({2.0f, 1.4f, -2.1f});
     CORRADE_COMPARE(MatrixTransformation3D<>::inverted(m)*m, Matrix4());
+
+    /* Non-affine transformation uses the general algorithm */
+    Matrix4 projection = Matrix4::perspectiveProjection(Deg(35.0f), 1.333f, 0.5f, 10.0f)*m;
+    CORRADE_COMPARE(MatrixTransformation3D<>::inverted(projection)*projection, Matrix4());
 }
 
 void MatrixTransformation3DTest::setTransformation() {
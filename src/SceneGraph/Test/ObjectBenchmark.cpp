@@ -0,0 +1,260 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <unordered_map>
+#include <TestSuite/Tester.h>
+
+#include "SceneGraph/MatrixTransformation3D.h"
+#include "SceneGraph/Scene.h"
+#include "Test/Benchmark.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+using Magnum::Test::measure;
+
+class ObjectBenchmark: public TestSuite::Tester {
+    public:
+        ObjectBenchmark();
+
+        void transformations1k();
+        void transformations10k();
+        void transformations1M();
+        void transformationsFlat();
+        void absoluteTransformationDeep();
+
+    private:
+        void transformations(std::size_t count, bool withJoints);
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D<>> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D<>> Scene3D;
+
+namespace {
+
+/* Previous "joint" algorithm for computing transformations, used as baseline.
+   The per-object marks and counters are stored in external hash map, as the
+   original 16bit counter doesn't allow more than 65535 objects. */
+class JointTransformations {
+    public:
+        std::vector<Matrix4> operator()(const Scene3D& scene, std::vector<Object3D*> objects) {
+            const std::size_t objectCount = objects.size();
+
+            for(std::size_t i = 0; i != objects.size(); ++i) {
+                Data& d = data[objects[i]];
+                if(d.joint) continue;
+                d.counter = i;
+                d.joint = true;
+            }
+            std::vector<Object3D*> jointObjects(objects);
+
+            auto it = objects.begin();
+            while(!objects.empty()) {
+                Data& d = data[*it];
+                if(d.visited) {
+                    it = objects.erase(it);
+                } else {
+                    d.visited = true;
+
+                    Object3D* parent = (*it)->parent();
+                    if(!parent) {
+                        CORRADE_INTERNAL_ASSERT(*it == &scene);
+                        it = objects.erase(it);
+                    } else {
+                        Data& p = data[parent];
+                        if(p.visited || p.joint) {
+                            it = objects.erase(it);
+                            if(!p.joint) {
+                                p.counter = jointObjects.size();
+                                p.joint = true;
+                                jointObjects.push_back(parent);
+                            }
+                        } else *it = parent;
+                    }
+                }
+
+                if(it == objects.end()) it = objects.begin();
+            }
+
+            std::vector<Matrix4> jointTransformations(jointObjects.size());
+            for(std::size_t i = 0; i != jointTransformations.size(); ++i)
+                computeJointTransformation(jointObjects, jointTransformations, i);
+
+            for(std::size_t i = 0; i != objectCount; ++i) {
+                const std::size_t counter = data[jointObjects[i]].counter;
+                if(counter != i) jointTransformations[i] = jointTransformations[counter];
+            }
+
+            data.clear();
+            jointTransformations.resize(objectCount);
+            return jointTransformations;
+        }
+
+    private:
+        struct Data {
+            Data(): counter(~std::size_t(0)), visited(false), joint(false) {}
+
+            std::size_t counter;
+            bool visited, joint;
+        };
+
+        Matrix4 computeJointTransformation(const std::vector<Object3D*>& jointObjects, std::vector<Matrix4>& jointTransformations, const std::size_t joint) {
+            Object3D* o = jointObjects[joint];
+            if(!data[o].visited) return jointTransformations[joint];
+
+            jointTransformations[joint] = o->transformation();
+            for(;;) {
+                data[o].visited = false;
+
+                Object3D* parent = o->parent();
+                if(!parent) return jointTransformations[joint];
+
+                const Data& p = data[parent];
+                if(p.joint) return (jointTransformations[joint] =
+                    computeJointTransformation(jointObjects, jointTransformations, p.counter)*jointTransformations[joint]);
+
+                jointTransformations[joint] = parent->transformation()*jointTransformations[joint];
+                o = parent;
+            }
+        }
+
+        std::unordered_map<Object3D*, Data> data;
+};
+
+}
+
+ObjectBenchmark::ObjectBenchmark() {
+    addTests({&ObjectBenchmark::transformations1k,
+              &ObjectBenchmark::transformations10k,
+              &ObjectBenchmark::transformations1M,
+              &ObjectBenchmark::transformationsFlat,
+              &ObjectBenchmark::absoluteTransformationDeep});
+}
+
+void ObjectBenchmark::transformations1k() { transformations(1000, true); }
+void ObjectBenchmark::transformations10k() { transformations(10000, true); }
+
+void ObjectBenchmark::transformations1M() {
+    /* The joint algorithm is quadratic in object count, don't even try */
+    transformations(1000000, false);
+}
+
+void ObjectBenchmark::transformations(const std::size_t count, const bool withJoints) {
+    /* Random-ish tree with depth growing logarithmically with object count */
+    Scene3D scene;
+    std::vector<Object3D*> objects;
+    objects.reserve(count);
+    UnsignedInt seed = 17;
+    for(std::size_t i = 0; i != count; ++i) {
+        seed = seed*1103515245u + 12345u;
+        Object3D* parent = i ? objects[(seed >> 8) % i] : static_cast<Object3D*>(&scene);
+        Object3D* o = new Object3D(parent);
+        o->translate(Vector3::xAxis(1.0f))
+         ->rotateY(Deg(Float(i % 360)));
+        objects.push_back(o);
+    }
+
+    /* Verify that the algorithms give the same results */
+    const std::vector<Matrix4> transformations = scene.transformations(objects);
+    for(std::size_t i = 0; i < count; i += count/100)
+        CORRADE_COMPARE(transformations[i], objects[i]->absoluteTransformation());
+    if(withJoints)
+        CORRADE_VERIFY(JointTransformations()(scene, objects) == transformations);
+
+    const std::size_t repeats = 1000000/count + 1;
+    Debug() << count << "objects:";
+    Debug() << "  transformations():" << measure([&]() {
+        scene.transformations(objects);
+    }, repeats) << "ms";
+    if(withJoints) Debug() << "  joint algorithm:" << measure([&]() {
+        JointTransformations()(scene, objects);
+    }, repeats) << "ms";
+    Debug() << "  absoluteTransformation() for each:" << measure([&]() {
+        for(Object3D* o: objects) o->absoluteTransformation();
+    }, repeats) << "ms";
+}
+
+void ObjectBenchmark::transformationsFlat() {
+    /* 100 groups of 1000 siblings, composed in batches with their parent */
+    Scene3D scene;
+    std::vector<Object3D*> objects;
+    objects.reserve(100000);
+    for(std::size_t i = 0; i != 100; ++i) {
+        Object3D* group = new Object3D(&scene);
+        group->rotateX(Deg(Float(i)));
+        for(std::size_t j = 0; j != 1000; ++j) {
+            Object3D* o = new Object3D(group);
+            o->translate(Vector3::xAxis(Float(j)))
+             ->rotateY(Deg(Float(j % 360)));
+            objects.push_back(o);
+        }
+    }
+
+    const std::vector<Matrix4> transformations = scene.transformations(objects);
+    for(std::size_t i = 0; i < objects.size(); i += 1000)
+        CORRADE_COMPARE(transformations[i], objects[i]->absoluteTransformation());
+
+    Debug() << objects.size() << "objects in groups of 1000 siblings:";
+    Debug() << "  transformations():" << measure([&]() {
+        scene.transformations(objects);
+    }, 10) << "ms";
+    Debug() << "  absoluteTransformation() for each:" << measure([&]() {
+        for(Object3D* o: objects) o->absoluteTransformation();
+    }, 10) << "ms";
+}
+
+void ObjectBenchmark::absoluteTransformationDeep() {
+    /* 5000 chains of depth 20 hanging from one root */
+    Scene3D scene;
+    Object3D* root = new Object3D(&scene);
+    std::vector<Object3D*> objects;
+    objects.reserve(100000);
+    for(std::size_t i = 0; i != 5000; ++i) {
+        Object3D* parent = root;
+        for(std::size_t j = 0; j != 20; ++j) {
+            parent = new Object3D(parent);
+            parent->translate(Vector3::xAxis(1.0f))
+                  ->rotateY(Deg(Float(j)));
+            objects.push_back(parent);
+        }
+    }
+
+    auto moveRootAndQuery = [&]() {
+        root->translate(Vector3::yAxis(1.0f));
+        for(Object3D* o: objects) o->absoluteTransformation();
+    };
+
+    Debug() << objects.size() << "objects in depth 20, moving the root:";
+    Debug() << "  uncached absoluteTransformation() for each:" << measure(moveRootAndQuery, 10) << "ms";
+
+    for(Object3D* o: objects) o->setAbsoluteTransformationCached(true);
+    Debug() << "  cached absoluteTransformation() for each:" << measure(moveRootAndQuery, 10) << "ms";
+    Debug() << "  cached absoluteTransformation() for each, no change:" << measure([&]() {
+        for(Object3D* o: objects) o->absoluteTransformation();
+    }, 10) << "ms";
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::ObjectBenchmark)
@@ -26,6 +26,7 @@
 #include <TestSuite/Tester.h>
 
 #include "SceneGraph/MatrixTransformation3D.h"
+#include "SceneGraph/Object.hpp"
 #include "SceneGraph/Scene.h"
 
 namespace Magnum { namespace SceneGraph { namespace Test {
@@ -38,10 +39,14 @@ class ObjectTest: public TestSuite::Tester {
         void scene();
         void setParentKeepTransformation();
         void absoluteTransformation();
+        void absoluteTransformationCached();
+        void absoluteTransformationCachedRecompute();
+        void absoluteTransformationDeep();
         void transformations();
         void transformationsRelative();
         void transformationsOrphan();
         void transformationsDuplicate();
+        void transformationsLarge();
         void setClean();
         void setCleanListHierarchy();
         void setCleanListBulk();
@@ -64,15 +69,52 @@ class CachingObject: public Object3D, AbstractFeature<3> {
         }
 };
 
+/* Transformation counting how many times the transformations were composed */
+class CountingTransformation: public AbstractTransformation<3, Float> {
+    public:
+        typedef Matrix4 DataType;
+
+        static std::size_t composeCount;
+
+        static Matrix4 fromMatrix(const Matrix4& matrix) { return matrix; }
+        static Matrix4 toMatrix(const Matrix4& transformation) { return transformation; }
+        static Matrix4 compose(const Matrix4& parent, const Matrix4& child) {
+            ++composeCount;
+            return parent*child;
+        }
+        static Matrix4 inverted(const Matrix4& transformation) { return transformation.inverted(); }
+
+        Matrix4 transformation() const { return _transformation; }
+
+        Object<CountingTransformation>* setTransformation(const Matrix4& transformation) {
+            _transformation = transformation;
+            static_cast<Object<CountingTransformation>*>(this)->setDirty();
+            return static_cast<Object<CountingTransformation>*>(this);
+        }
+
+    private:
+        void doResetTransformation() override { setTransformation({}); }
+
+        Matrix4 _transformation;
+};
+
+std::size_t CountingTransformation::composeCount = 0;
+
+typedef SceneGraph::Object<CountingTransformation> CountingObject3D;
+
 ObjectTest::ObjectTest() {
     addTests({&ObjectTest::parenting,
               &ObjectTest::scene,
               &ObjectTest::setParentKeepTransformation,
               &ObjectTest::absoluteTransformation,
+              &ObjectTest::absoluteTransformationCached,
+              &ObjectTest::absoluteTransformationCachedRecompute,
+              &ObjectTest::absoluteTransformationDeep,
               &ObjectTest::transformations,
               &ObjectTest::transformationsRelative,
               &ObjectTest::transformationsOrphan,
               &ObjectTest::transformationsDuplicate,
+              &ObjectTest::transformationsLarge,
               &ObjectTest::setClean,
               &ObjectTest::setCleanListHierarchy,
               &ObjectTest::setCleanListBulk});
@@ -167,6 +209,112 @@ void ObjectTest::absoluteTransformation() {
     CORRADE_COMPARE(o3.absoluteTransformation(), Matrix4::translation({1.0f, 2.0f, 3.0f}));
 }
 
+void ObjectTest::absoluteTransformationCached() {
+    Scene3D s;
+    Object3D* a = new Object3D(&s);
+    a->translate(Vector3::xAxis(2.0f));
+    Object3D* b = new Object3D(a);
+    b->rotateY(Deg(90.0f));
+    Object3D* c = new Object3D(b);
+    c->scale(Vector3(3.0f));
+    Object3D* d = new Object3D(&s);
+    d->translate(Vector3::yAxis(5.0f));
+
+    CORRADE_VERIFY(!c->isAbsoluteTransformationCached());
+    c->setAbsoluteTransformationCached(true);
+    b->setAbsoluteTransformationCached(true);
+    CORRADE_VERIFY(c->isAbsoluteTransformationCached());
+    CORRADE_COMPARE(c->absoluteTransformation(), Matrix4::translation(Vector3::xAxis(2.0f))*Matrix4::rotationY(Deg(90.0f))*Matrix4::scaling(Vector3(3.0f)));
+    CORRADE_COMPARE(b->absoluteTransformation(), Matrix4::translation(Vector3::xAxis(2.0f))*Matrix4::rotationY(Deg(90.0f)));
+
+    /* Transformation of parent changed */
+    a->setTransformation(Matrix4::translation(Vector3::zAxis(1.0f)));
+    CORRADE_COMPARE(c->absoluteTransformation(), Matrix4::translation(Vector3::zAxis(1.0f))*Matrix4::rotationY(Deg(90.0f))*Matrix4::scaling(Vector3(3.0f)));
+    CORRADE_COMPARE(b->absoluteTransformation(), Matrix4::translation(Vector3::zAxis(1.0f))*Matrix4::rotationY(Deg(90.0f)));
+
+    /* Transformation of parent changed while the object was already dirty */
+    CORRADE_VERIFY(c->isDirty());
+    b->setTransformation(Matrix4());
+    CORRADE_COMPARE(c->absoluteTransformation(), Matrix4::translation(Vector3::zAxis(1.0f))*Matrix4::scaling(Vector3(3.0f)));
+
+    /* Transformation of unrelated object changed */
+    d->translate(Vector3::yAxis(1.0f));
+    CORRADE_COMPARE(c->absoluteTransformation(), Matrix4::translation(Vector3::zAxis(1.0f))*Matrix4::scaling(Vector3(3.0f)));
+
+    /* Parent changed */
+    b->setParent(d);
+    CORRADE_COMPARE(c->absoluteTransformation(), Matrix4::translation(Vector3::yAxis(6.0f))*Matrix4::scaling(Vector3(3.0f)));
+    CORRADE_COMPARE(b->absoluteTransformation(), Matrix4::translation(Vector3::yAxis(6.0f)));
+
+    /* Disabling the cache gives the same results */
+    c->setAbsoluteTransformationCached(false);
+    CORRADE_VERIFY(!c->isAbsoluteTransformationCached());
+    CORRADE_COMPARE(c->absoluteTransformation(), Matrix4::translation(Vector3::yAxis(6.0f))*Matrix4::scaling(Vector3(3.0f)));
+}
+
+void ObjectTest::absoluteTransformationCachedRecompute() {
+    CountingObject3D root;
+    CountingObject3D* o = &root;
+    for(std::size_t i = 0; i != 10; ++i) {
+        o = new CountingObject3D(o);
+        o->setTransformation(Matrix4::translation(Vector3::xAxis(1.0f)));
+        o->setAbsoluteTransformationCached(true);
+    }
+    CountingObject3D* leaf = o;
+    CountingObject3D* middle = leaf->parent()->parent()->parent();
+
+    /* Whole path is computed and cached */
+    CountingTransformation::composeCount = 0;
+    CORRADE_COMPARE(leaf->absoluteTransformation(), Matrix4::translation(Vector3::xAxis(10.0f)));
+    CORRADE_COMPARE(CountingTransformation::composeCount, 10);
+
+    /* Nothing changed, nothing is computed */
+    CountingTransformation::composeCount = 0;
+    CORRADE_COMPARE(leaf->absoluteTransformation(), Matrix4::translation(Vector3::xAxis(10.0f)));
+    CORRADE_COMPARE(CountingTransformation::composeCount, 0);
+
+    /* Only the leaf changed, only the leaf is recomputed from cached
+       transformation of its parent */
+    leaf->setTransformation(Matrix4::translation(Vector3::yAxis(1.0f)));
+    CountingTransformation::composeCount = 0;
+    CORRADE_COMPARE(leaf->absoluteTransformation(), Matrix4::translation({9.0f, 1.0f, 0.0f}));
+    CORRADE_COMPARE(CountingTransformation::composeCount, 1);
+
+    /* Object in the middle changed, only the part below it is recomputed */
+    middle->setTransformation(Matrix4::translation(Vector3::zAxis(1.0f)));
+    CountingTransformation::composeCount = 0;
+    CORRADE_COMPARE(leaf->absoluteTransformation(), Matrix4::translation({8.0f, 1.0f, 1.0f}));
+    CORRADE_COMPARE(CountingTransformation::composeCount, 4);
+}
+
+void ObjectTest::absoluteTransformationDeep() {
+    /* Deep hierarchy, caching and dirty marking should be done without
+       recursion */
+    Scene3D s;
+    Object3D* root = new Object3D(&s);
+    Object3D* o = root;
+    for(std::size_t i = 0; i != 20000; ++i) {
+        o = new Object3D(o);
+        o->translate(Vector3::xAxis(1.0f));
+    }
+
+    o->setAbsoluteTransformationCached(true);
+    CORRADE_COMPARE(o->absoluteTransformation(), Matrix4::translation(Vector3::xAxis(20000.0f)));
+
+    o->setClean();
+    CORRADE_VERIFY(!o->isDirty());
+    root->translate(Vector3::yAxis(1.0f));
+    CORRADE_VERIFY(o->isDirty());
+    CORRADE_COMPARE(o->absoluteTransformation(), Matrix4::translation({20000.0f, 1.0f, 0.0f}));
+
+    /* Destroy the hierarchy bottom-up, as destruction is recursive */
+    while(o != root) {
+        Object3D* parent = o->parent();
+        delete o;
+        o = parent;
+    }
+}
+
 void ObjectTest::transformations() {
     Scene3D s;
 
@@ -266,6 +414,34 @@ void ObjectTest::transformationsDuplicate() {
     }));
 }
 
+void ObjectTest::transformationsLarge() {
+    Scene3D s;
+    Object3D first(&s);
+    first.translate(Vector3::xAxis(1.0f));
+
+    /* More objects than fit into 16bit counter, first thousand of them in
+       a chain, others directly under the first object */
+    std::vector<Object3D*> objects;
+    for(std::size_t i = 0; i != 0x10000; ++i) {
+        Object3D* o = new Object3D(i && i < 1000 ? objects.back() : &first);
+        o->translate(Vector3::yAxis(1.0f));
+        objects.push_back(o);
+    }
+
+    std::vector<Matrix4> transformations = s.transformations(objects);
+    CORRADE_COMPARE(transformations.size(), 0x10000);
+    CORRADE_COMPARE(transformations[0], Matrix4::translation({1.0f, 1.0f, 0.0f}));
+    CORRADE_COMPARE(transformations[999], Matrix4::translation({1.0f, 1000.0f, 0.0f}));
+    CORRADE_COMPARE(transformations[1000], Matrix4::translation({1.0f, 1.0f, 0.0f}));
+    CORRADE_COMPARE(transformations[0xFFFF], Matrix4::translation({1.0f, 1.0f, 0.0f}));
+
+    /* Subsequent call gives the same result (i.e., all marks are cleaned) */
+    CORRADE_COMPARE(s.transformations({objects[999], objects[0xFFFF]}), (std::vector<Matrix4>{
+        Matrix4::translation({1.0f, 1000.0f, 0.0f}),
+        Matrix4::translation({1.0f, 1.0f, 0.0f})
+    }));
+}
+
 void ObjectTest::setClean() {
     Scene3D scene;
 
@@ -25,6 +25,7 @@
 #include "SceneGraph/AbstractFeature.hpp"
 #include "SceneGraph/Camera2D.hpp"
 #include "SceneGraph/Camera3D.hpp"
+#include "SceneGraph/DrawList.hpp"
 #include "SceneGraph/DualComplexTransformation.h"
 #include "SceneGraph/DualQuaternionTransformation.h"
 #include "SceneGraph/FeatureGroup.hpp"
@@ -52,6 +53,9 @@ template class AbstractCamera<3, Float>;
 template class Camera2D<Float>;
 template class Camera3D<Float>;
 
+template class DrawList<2, Float>;
+template class DrawList<3, Float>;
+
 template class MAGNUM_SCENEGRAPH_EXPORT Object<DualComplexTransformation<Float>>;
 template class MAGNUM_SCENEGRAPH_EXPORT Object<DualQuaternionTransformation<Float>>;
 template class MAGNUM_SCENEGRAPH_EXPORT Object<MatrixTransformation2D<Float>>;
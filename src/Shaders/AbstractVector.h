@@ -47,6 +47,14 @@ template<UnsignedInt dimensions> class AbstractVector: public AbstractShaderProg
         /** @brief Texture coordinates */
         typedef Attribute<1, Vector2> TextureCoordinates;
 
+        /**
+         * @brief Vertex color
+         *
+         * Used only if the shader supports it, e.g. Vector with
+         * @ref Vector::Flag "Vector::Flag::VertexColor".
+         */
+        typedef Attribute<2, Color4<>> Color;
+
         enum: Int {
             VectorTextureLayer = 16 /**< Layer for vector texture */
         };
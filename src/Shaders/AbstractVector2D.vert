@@ -41,9 +41,23 @@ in highp vec2 position;
 in mediump vec2 textureCoordinates;
 #endif
 
+#ifdef VERTEX_COLOR
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = 2) in lowp vec4 color;
+#else
+in lowp vec4 color;
+#endif
+
+out lowp vec4 interpolatedColor;
+#endif
+
 out vec2 fragmentTextureCoordinates;
 
 void main() {
     gl_Position.xywz = vec4(transformationProjectionMatrix*vec3(position, 1.0), 0.0);
     fragmentTextureCoordinates = textureCoordinates;
+
+    #ifdef VERTEX_COLOR
+    interpolatedColor = color;
+    #endif
 }
@@ -41,9 +41,23 @@ in highp vec4 position;
 in mediump vec2 textureCoordinates;
 #endif
 
+#ifdef VERTEX_COLOR
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = 2) in lowp vec4 color;
+#else
+in lowp vec4 color;
+#endif
+
+out lowp vec4 interpolatedColor;
+#endif
+
 out vec2 fragmentTextureCoordinates;
 
 void main() {
     gl_Position = transformationProjectionMatrix*position;
     fragmentTextureCoordinates = textureCoordinates;
+
+    #ifdef VERTEX_COLOR
+    interpolatedColor = color;
+    #endif
 }
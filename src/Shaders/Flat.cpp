@@ -37,7 +37,7 @@ namespace {
     template<> constexpr const char* vertexShaderName<3>() { return "Flat3D.vert"; }
 }
 
-template<UnsignedInt dimensions> Flat<dimensions>::Flat(): transformationProjectionMatrixUniform(0), colorUniform(1) {
+template<UnsignedInt dimensions> Flat<dimensions>::Flat(const Flags flags): transformationProjectionMatrixUniform(0), colorUniform(1) {
     Utility::Resource rs("MagnumShaders");
 
     #ifndef MAGNUM_TARGET_GLES
@@ -47,7 +47,8 @@ template<UnsignedInt dimensions> Flat<dimensions>::Flat(): transformationProject
     #endif
 
     Shader frag(v, Shader::Type::Vertex);
-    frag.addSource(rs.get("compatibility.glsl"))
+    frag.addSource(flags & Flag::InstancedTransformation ? "#define INSTANCED_TRANSFORMATION\n" : "")
+        .addSource(rs.get("compatibility.glsl"))
         .addSource(rs.get(vertexShaderName<dimensions>()));
     CORRADE_INTERNAL_ASSERT_OUTPUT(frag.compile());
     attachShader(frag);
@@ -66,6 +67,8 @@ template<UnsignedInt dimensions> Flat<dimensions>::Flat(): transformationProject
     #endif
     {
         bindAttributeLocation(Position::Location, "position");
+        if(flags & Flag::InstancedTransformation)
+            bindAttributeLocation(TransformationMatrix::Location, "instancedTransformationMatrix");
     }
 
     CORRADE_INTERNAL_ASSERT_OUTPUT(link());
@@ -28,6 +28,8 @@
  * @brief Class Magnum::Shaders::Flat
  */
 
+#include <Containers/EnumSet.h>
+
 #include "Math/Matrix3.h"
 #include "Math/Matrix4.h"
 #include "AbstractShaderProgram.h"
@@ -38,10 +40,28 @@
 
 namespace Magnum { namespace Shaders {
 
+namespace Implementation {
+    enum class FlatFlag: UnsignedByte {
+        InstancedTransformation = 1 << 0
+    };
+
+    typedef Containers::EnumSet<FlatFlag, UnsignedByte> FlatFlags;
+
+    CORRADE_ENUMSET_OPERATORS(FlatFlags)
+}
+
 /**
 @brief Flat shader
 
 Draws whole mesh with one color.
+
+@section Flat-instancing Instanced rendering
+
+If @ref Flag "Flag::InstancedTransformation" is enabled, the shader takes
+additional per-instance TransformationMatrix attribute, which is applied
+before the matrix set with setTransformationProjectionMatrix(). Many copies of
+the same mesh can be then drawn in single draw call, see
+@ref Mesh-instancing "Mesh documentation" for more information.
 @see Flat2D, Flat3D
 */
 template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT Flat: public AbstractShaderProgram {
@@ -49,11 +69,50 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT Flat: public Abstra
         /** @brief Vertex position */
         typedef Attribute<0, typename DimensionTraits<dimensions>::VectorType> Position;
 
-        explicit Flat();
+        /**
+         * @brief Per-instance transformation matrix
+         *
+         * Used only if @ref Flag "Flag::InstancedTransformation" is set.
+         * Occupies three (in 2D) or four (in 3D) attribute locations.
+         */
+        typedef Attribute<1, typename DimensionTraits<dimensions>::MatrixType> TransformationMatrix;
+
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        /**
+         * @brief %Flag
+         *
+         * @see Flags, Flat()
+         */
+        enum class Flag: UnsignedByte {
+            /**
+             * Take object transformation from per-instance
+             * @ref TransformationMatrix attribute.
+             * @requires_gl33 %Extension @extension{ARB,instanced_arrays}
+             * @requires_gles30 Instanced rendering is not available in
+             *      OpenGL ES 2.0.
+             */
+            InstancedTransformation = 1 << 0
+        };
+
+        /** @brief %Flags */
+        typedef Containers::EnumSet<Flag, UnsignedByte> Flags;
+        #else
+        typedef Implementation::FlatFlag Flag;
+        typedef Implementation::FlatFlags Flags;
+        #endif
+
+        /**
+         * @brief Constructor
+         * @param flags     %Flags
+         */
+        explicit Flat(Flags flags = Flags());
 
         /**
          * @brief Set transformation and projection matrix
          * @return Pointer to self (for method chaining)
+         *
+         * If @ref Flag "Flag::InstancedTransformation" is set, the matrix is
+         * applied after per-instance transformation.
          */
         Flat<dimensions>* setTransformationProjectionMatrix(const typename DimensionTraits<dimensions>::MatrixType& matrix) {
             setUniform(transformationProjectionMatrixUniform, matrix);
@@ -34,10 +34,20 @@ uniform highp mat3 transformationProjectionMatrix;
 
 #ifdef EXPLICIT_ATTRIB_LOCATION
 layout(location = 0) in highp vec2 position;
+#ifdef INSTANCED_TRANSFORMATION
+layout(location = 1) in highp mat3 instancedTransformationMatrix;
+#endif
 #else
 in highp vec2 position;
+#ifdef INSTANCED_TRANSFORMATION
+in highp mat3 instancedTransformationMatrix;
+#endif
 #endif
 
 void main() {
+    #ifdef INSTANCED_TRANSFORMATION
+    gl_Position.xywz = vec4(transformationProjectionMatrix*instancedTransformationMatrix*vec3(position, 1.0), 0.0);
+    #else
     gl_Position.xywz = vec4(transformationProjectionMatrix*vec3(position, 1.0), 0.0);
+    #endif
 }
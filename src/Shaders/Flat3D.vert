@@ -34,10 +34,20 @@ uniform highp mat4 transformationProjectionMatrix;
 
 #ifdef EXPLICIT_ATTRIB_LOCATION
 layout(location = 0) in highp vec4 position;
+#ifdef INSTANCED_TRANSFORMATION
+layout(location = 1) in highp mat4 instancedTransformationMatrix;
+#endif
 #else
 in highp vec4 position;
+#ifdef INSTANCED_TRANSFORMATION
+in highp mat4 instancedTransformationMatrix;
+#endif
 #endif
 
 void main() {
+    #ifdef INSTANCED_TRANSFORMATION
+    gl_Position = transformationProjectionMatrix*instancedTransformationMatrix*position;
+    #else
     gl_Position = transformationProjectionMatrix*position;
+    #endif
 }
@@ -31,7 +31,7 @@
 
 namespace Magnum { namespace Shaders {
 
-Phong::Phong(): transformationMatrixUniform(0), projectionMatrixUniform(1), normalMatrixUniform(2), lightUniform(3), diffuseColorUniform(4), ambientColorUniform(5), specularColorUniform(6), lightColorUniform(7), shininessUniform(8) {
+Phong::Phong(const Flags flags): transformationMatrixUniform(0), projectionMatrixUniform(1), normalMatrixUniform(2), lightUniform(3), diffuseColorUniform(4), ambientColorUniform(5), specularColorUniform(6), lightColorUniform(7), shininessUniform(8) {
     Utility::Resource rs("MagnumShaders");
 
     #ifndef MAGNUM_TARGET_GLES
@@ -41,7 +41,8 @@ Phong::Phong(): transformationMatrixUniform(0), projectionMatrixUniform(1), norm
     #endif
 
     Shader vert(v, Shader::Type::Vertex);
-    vert.addSource(rs.get("compatibility.glsl"))
+    vert.addSource(flags & Flag::InstancedTransformation ? "#define INSTANCED_TRANSFORMATION\n" : "")
+        .addSource(rs.get("compatibility.glsl"))
         .addSource(rs.get("Phong.vert"));
     CORRADE_INTERNAL_ASSERT_OUTPUT(vert.compile());
     attachShader(vert);
@@ -61,6 +62,8 @@ Phong::Phong(): transformationMatrixUniform(0), projectionMatrixUniform(1), norm
     {
         bindAttributeLocation(Position::Location, "position");
         bindAttributeLocation(Normal::Location, "normal");
+        if(flags & Flag::InstancedTransformation)
+            bindAttributeLocation(TransformationMatrix::Location, "instancedTransformationMatrix");
     }
 
     CORRADE_INTERNAL_ASSERT_OUTPUT(link());
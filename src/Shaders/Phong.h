@@ -41,13 +41,54 @@ namespace Magnum { namespace Shaders {
 
 If supported, uses GLSL 3.20 and @extension{ARB,explicit_attrib_location},
 otherwise falls back to GLSL 1.20.
+
+@section Phong-instancing Instanced rendering
+
+If @ref Flag "Flag::InstancedTransformation" is enabled, the shader takes
+additional per-instance TransformationMatrix attribute, which is applied
+before the matrix set with setTransformationMatrix(). The uniform matrix then
+acts as camera matrix common for all instances. The per-instance matrices
+are used also for transforming normals, thus they shouldn't contain
+non-uniform scaling. See @ref Mesh-instancing "Mesh documentation" for more
+information.
 */
 class MAGNUM_SHADERS_EXPORT Phong: public AbstractShaderProgram {
     public:
         typedef Attribute<0, Vector3> Position; /**< @brief Vertex position */
         typedef Attribute<1, Vector3> Normal;   /**< @brief Normal direction */
 
-        explicit Phong();
+        /**
+         * @brief Per-instance transformation matrix
+         *
+         * Used only if @ref Flag "Flag::InstancedTransformation" is set.
+         * Occupies four attribute locations.
+         */
+        typedef Attribute<2, Matrix4> TransformationMatrix;
+
+        /**
+         * @brief %Flag
+         *
+         * @see Flags, Phong()
+         */
+        enum class Flag: UnsignedByte {
+            /**
+             * Take object transformation from per-instance
+             * TransformationMatrix attribute.
+             * @requires_gl33 %Extension @extension{ARB,instanced_arrays}
+             * @requires_gles30 Instanced rendering is not available in
+             *      OpenGL ES 2.0.
+             */
+            InstancedTransformation = 1 << 0
+        };
+
+        /** @brief %Flags */
+        typedef Containers::EnumSet<Flag, UnsignedByte> Flags;
+
+        /**
+         * @brief Constructor
+         * @param flags     %Flags
+         */
+        explicit Phong(Flags flags = Flags());
 
         /**
          * @brief Set ambient color
@@ -95,6 +136,9 @@ class MAGNUM_SHADERS_EXPORT Phong: public AbstractShaderProgram {
         /**
          * @brief Set transformation and normal matrix
          * @return Pointer to self (for method chaining)
+         *
+         * If @ref Flag "Flag::InstancedTransformation" is set, the matrix is
+         * applied after per-instance transformation.
          */
         Phong* setTransformationMatrix(const Matrix4& matrix) {
             setUniform(transformationMatrixUniform, matrix);
@@ -143,6 +187,8 @@ class MAGNUM_SHADERS_EXPORT Phong: public AbstractShaderProgram {
             shininessUniform;
 };
 
+CORRADE_ENUMSET_OPERATORS(Phong::Flags)
+
 }}
 
 #endif
@@ -42,9 +42,15 @@ uniform highp vec3 light;
 #ifdef EXPLICIT_ATTRIB_LOCATION
 layout(location = 0) in highp vec4 position;
 layout(location = 1) in mediump vec3 normal;
+#ifdef INSTANCED_TRANSFORMATION
+layout(location = 2) in highp mat4 instancedTransformationMatrix;
+#endif
 #else
 in highp vec4 position;
 in mediump vec3 normal;
+#ifdef INSTANCED_TRANSFORMATION
+in highp mat4 instancedTransformationMatrix;
+#endif
 #endif
 
 out mediump vec3 transformedNormal;
@@ -53,11 +59,19 @@ out highp vec3 cameraDirection;
 
 void main() {
     /* Transformed vertex position */
+    #ifdef INSTANCED_TRANSFORMATION
+    highp vec4 transformedPosition4 = transformationMatrix*instancedTransformationMatrix*position;
+    #else
     highp vec4 transformedPosition4 = transformationMatrix*position;
+    #endif
     highp vec3 transformedPosition = transformedPosition4.xyz/transformedPosition4.w;
 
     /* Transformed normal vector */
+    #ifdef INSTANCED_TRANSFORMATION
+    transformedNormal = normalMatrix*mat3(instancedTransformationMatrix)*normal;
+    #else
     transformedNormal = normalMatrix*normal;
+    #endif
 
     /* Direction to the light */
     lightDirection = normalize(light - transformedPosition);
@@ -38,7 +38,7 @@ namespace {
     template<> constexpr const char* vertexShaderName<3>() { return "AbstractVector3D.vert"; }
 }
 
-template<UnsignedInt dimensions> Vector<dimensions>::Vector(): transformationProjectionMatrixUniform(0), colorUniform(1) {
+template<UnsignedInt dimensions> Vector<dimensions>::Vector(const Flags flags): transformationProjectionMatrixUniform(0), colorUniform(flags & Flag::VertexColor ? -1 : 1) {
     Utility::Resource rs("MagnumShaders");
 
     #ifndef MAGNUM_TARGET_GLES
@@ -48,13 +48,15 @@ template<UnsignedInt dimensions> Vector<dimensions>::Vector(): transformationPro
     #endif
 
     Shader vert(v, Shader::Type::Vertex);
-    vert.addSource(rs.get("compatibility.glsl"))
+    vert.addSource(flags & Flag::VertexColor ? "#define VERTEX_COLOR\n" : "")
+        .addSource(rs.get("compatibility.glsl"))
         .addSource(rs.get(vertexShaderName<dimensions>()));
     CORRADE_INTERNAL_ASSERT_OUTPUT(vert.compile());
     AbstractShaderProgram::attachShader(vert);
 
     Shader frag(v, Shader::Type::Fragment);
-    frag.addSource(rs.get("compatibility.glsl"))
+    frag.addSource(flags & Flag::VertexColor ? "#define VERTEX_COLOR\n" : "")
+        .addSource(rs.get("compatibility.glsl"))
         .addSource(rs.get("Vector.frag"));
     CORRADE_INTERNAL_ASSERT_OUTPUT(frag.compile());
     AbstractShaderProgram::attachShader(frag);
@@ -68,6 +70,8 @@ template<UnsignedInt dimensions> Vector<dimensions>::Vector(): transformationPro
     {
         AbstractShaderProgram::bindAttributeLocation(AbstractVector<dimensions>::Position::Location, "position");
         AbstractShaderProgram::bindAttributeLocation(AbstractVector<dimensions>::TextureCoordinates::Location, "textureCoordinates");
+        if(flags & Flag::VertexColor)
+            AbstractShaderProgram::bindAttributeLocation(AbstractVector<dimensions>::Color::Location, "color");
     }
 
     CORRADE_INTERNAL_ASSERT_OUTPUT(AbstractShaderProgram::link());
@@ -77,7 +81,8 @@ template<UnsignedInt dimensions> Vector<dimensions>::Vector(): transformationPro
     #endif
     {
         transformationProjectionMatrixUniform = AbstractShaderProgram::uniformLocation("transformationProjectionMatrix");
-        colorUniform = AbstractShaderProgram::uniformLocation("color");
+        if(!(flags & Flag::VertexColor))
+            colorUniform = AbstractShaderProgram::uniformLocation("color");
     }
 
     #ifndef MAGNUM_TARGET_GLES
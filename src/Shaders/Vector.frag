@@ -28,7 +28,9 @@
 #define texture texture2D
 #endif
 
-#ifdef EXPLICIT_UNIFORM_LOCATION
+#ifdef VERTEX_COLOR
+in lowp vec4 interpolatedColor;
+#elif defined(EXPLICIT_UNIFORM_LOCATION)
 layout(location = 1) uniform vec4 color;
 #else
 uniform lowp vec4 color;
@@ -48,5 +50,9 @@ out lowp vec4 fragmentColor;
 
 void main() {
     lowp float intensity = texture(vectorTexture, fragmentTextureCoordinates).r;
+    #ifdef VERTEX_COLOR
+    fragmentColor = intensity*interpolatedColor;
+    #else
     fragmentColor = intensity*color;
+    #endif
 }
@@ -28,6 +28,8 @@
  * @brief Class Magnum::Shaders::Vector, typedef Magnum::Shaders::Vector2D, Magnum::Shaders::Vector3D
  */
 
+#include <Containers/EnumSet.h>
+
 #include "Math/Matrix3.h"
 #include "Math/Matrix4.h"
 #include "AbstractVector.h"
@@ -36,6 +38,16 @@
 
 namespace Magnum { namespace Shaders {
 
+namespace Implementation {
+    enum class VectorFlag: UnsignedByte {
+        VertexColor = 1 << 0
+    };
+
+    typedef Containers::EnumSet<VectorFlag, UnsignedByte> VectorFlags;
+
+    CORRADE_ENUMSET_OPERATORS(VectorFlags)
+}
+
 /**
 @brief Vector shader
 
@@ -45,7 +57,34 @@ for more advanced effects.
 */
 template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT Vector: public AbstractVector<dimensions> {
     public:
-        Vector();
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        /**
+         * @brief %Flag
+         *
+         * @see Flags, Vector()
+         */
+        enum class Flag: UnsignedByte {
+            /**
+             * Take fill color from @ref AbstractVector::Color "Color"
+             * attribute instead of setColor(). Useful for rendering many
+             * differently colored texts in one draw call, see
+             * Text::TextBatchRenderer.
+             */
+            VertexColor = 1 << 0
+        };
+
+        /** @brief %Flags */
+        typedef Containers::EnumSet<Flag, UnsignedByte> Flags;
+        #else
+        typedef Implementation::VectorFlag Flag;
+        typedef Implementation::VectorFlags Flags;
+        #endif
+
+        /**
+         * @brief Constructor
+         * @param flags     %Flags
+         */
+        explicit Vector(Flags flags = Flags());
 
         /**
          * @brief Set transformation and projection matrix
@@ -59,9 +98,13 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT Vector: public Abst
         /**
          * @brief Set fill color
          * @return Pointer to self (for method chaining)
+         *
+         * Has no effect if @ref Flag "Flag::VertexColor" is set, as the
+         * shader has no color uniform in that case.
          */
         Vector* setColor(const Color4<>& color) {
-            AbstractShaderProgram::setUniform(colorUniform, color);
+            if(colorUniform != -1)
+                AbstractShaderProgram::setUniform(colorUniform, color);
             return this;
         }
 
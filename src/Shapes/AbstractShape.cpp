@@ -31,8 +31,17 @@
 
 namespace Magnum { namespace Shapes {
 
-template<UnsignedInt dimensions> AbstractShape<dimensions>::AbstractShape(SceneGraph::AbstractObject<dimensions>* object, ShapeGroup<dimensions>* group): SceneGraph::AbstractGroupedFeature<dimensions, AbstractShape<dimensions>>(object, group) {
+template<UnsignedInt dimensions> AbstractShape<dimensions>::AbstractShape(SceneGraph::AbstractObject<dimensions>* object, ShapeGroup<dimensions>* group): SceneGraph::AbstractGroupedFeature<dimensions, AbstractShape<dimensions>>(object), _leaf(-1), _dirtyIndex(-1), _unbounded(false) {
     this->setCachedTransformations(SceneGraph::CachedTransformation::Absolute);
+
+    /* Added here and not in base constructor, as the group inserts the shape
+       into the broadphase, which needs fully constructed shape */
+    if(group) group->add(this);
+}
+
+template<UnsignedInt dimensions> AbstractShape<dimensions>::~AbstractShape() {
+    /* Removed here and not in base destructor for the same reason */
+    if(group()) group()->remove(this);
 }
 
 template<UnsignedInt dimensions> ShapeGroup<dimensions>* AbstractShape<dimensions>::group() {
@@ -52,7 +61,7 @@ template<UnsignedInt dimensions> bool AbstractShape<dimensions>::collides(const
 }
 
 template<UnsignedInt dimensions> void AbstractShape<dimensions>::markDirty() {
-    if(group()) group()->setDirty();
+    if(group()) group()->setDirty(this);
 }
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
@@ -51,6 +51,7 @@ brief introduction.
 */
 template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT AbstractShape: public SceneGraph::AbstractGroupedFeature<dimensions, AbstractShape<dimensions>> {
     friend const Implementation::AbstractShape<dimensions>* Implementation::getAbstractShape<>(const AbstractShape<dimensions>*);
+    friend class ShapeGroup<dimensions>;
 
     public:
         enum: UnsignedInt {
@@ -81,6 +82,8 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT AbstractShape: publi
          */
         explicit AbstractShape(SceneGraph::AbstractObject<dimensions>* object, ShapeGroup<dimensions>* group = nullptr);
 
+        ~AbstractShape();
+
         /**
          * @brief Shape group containing this shape
          *
@@ -107,6 +110,10 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT AbstractShape: publi
 
     private:
         virtual const Implementation::AbstractShape<dimensions> MAGNUM_SHAPES_LOCAL * abstractTransformedShape() const = 0;
+
+        /* Broadphase state managed by ShapeGroup */
+        Int _leaf, _dirtyIndex;
+        bool _unbounded;
 };
 
 /** @brief Base class for two-dimensional object shapes */
@@ -40,6 +40,15 @@ template<UnsignedInt dimensions> bool AxisAlignedBox<dimensions>::operator%(cons
            (other.position() < _max).all();
 }
 
+template<UnsignedInt dimensions> bool AxisAlignedBox<dimensions>::operator%(const AxisAlignedBox<dimensions>& other) const {
+    /* Not using BoolVector::all(), so the test ends on first separating
+       axis */
+    for(UnsignedInt i = 0; i != dimensions; ++i)
+        if(other._min[i] >= _max[i] || _min[i] >= other._max[i]) return false;
+
+    return true;
+}
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 template class MAGNUM_SHAPES_EXPORT AxisAlignedBox<2>;
 template class MAGNUM_SHAPES_EXPORT AxisAlignedBox<3>;
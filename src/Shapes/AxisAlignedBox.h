@@ -84,6 +84,9 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT AxisAlignedBox {
         /** @brief Collision with point */
         bool operator%(const Point<dimensions>& other) const;
 
+        /** @brief Collision with axis-aligned box */
+        bool operator%(const AxisAlignedBox<dimensions>& other) const;
+
     private:
         typename DimensionTraits<dimensions>::VectorType _min, _max;
 };
@@ -24,12 +24,163 @@
 
 #include "Box.h"
 
+#include "Math/Functions.h"
+#include "Magnum.h"
+#include "Shapes/AxisAlignedBox.h"
+#include "Shapes/Sphere.h"
+
 namespace Magnum { namespace Shapes {
 
+namespace {
+
+/* Box decomposed into center, normalized axes and half extents along them */
+template<UnsignedInt dimensions> struct OrientedBox {
+    explicit OrientedBox(const typename DimensionTraits<dimensions>::MatrixType& transformation);
+    explicit OrientedBox(const AxisAlignedBox<dimensions>& box);
+
+    typename DimensionTraits<dimensions>::VectorType center, halfExtents;
+    typename DimensionTraits<dimensions>::VectorType axes[dimensions];
+};
+
+template<UnsignedInt dimensions> OrientedBox<dimensions>::OrientedBox(const typename DimensionTraits<dimensions>::MatrixType& transformation): center(transformation.translation()) {
+    const Math::Matrix<dimensions, Float> rotationScaling = transformation.rotationScaling();
+    for(UnsignedInt i = 0; i != dimensions; ++i) {
+        const typename DimensionTraits<dimensions>::VectorType axis = rotationScaling[i];
+        halfExtents[i] = axis.length();
+        axes[i] = halfExtents[i] == 0.0f ? typename DimensionTraits<dimensions>::VectorType() : axis/halfExtents[i];
+    }
+}
+
+template<UnsignedInt dimensions> OrientedBox<dimensions>::OrientedBox(const AxisAlignedBox<dimensions>& box): center((box.min() + box.max())/2.0f), halfExtents((box.max() - box.min())/2.0f) {
+    for(UnsignedInt i = 0; i != dimensions; ++i) {
+        axes[i] = typename DimensionTraits<dimensions>::VectorType();
+        axes[i][i] = 1.0f;
+    }
+}
+
+/* Squared half length of box diagonal, i.e. squared radius of its bounding
+   sphere, computed without decomposing the transformation */
+template<UnsignedInt dimensions> Float boundingRadiusSquared(const typename DimensionTraits<dimensions>::MatrixType& transformation) {
+    const Math::Matrix<dimensions, Float> rotationScaling = transformation.rotationScaling();
+    Float radiusSquared = 0.0f;
+    for(UnsignedInt i = 0; i != dimensions; ++i)
+        radiusSquared += rotationScaling[i].dot();
+    return radiusSquared;
+}
+
+template<UnsignedInt dimensions> inline Float boundingRadiusSquared(const AxisAlignedBox<dimensions>& box) {
+    return ((box.max() - box.min())/2.0f).dot();
+}
+
+/* Cheap rejection using bounding spheres, which catches most of the
+   far-away pairs before doing anything expensive */
+inline bool boundingSpheresSeparated(const Float distanceSquared, const Float radiusSquaredA, const Float radiusSquaredB) {
+    return distanceSquared >= radiusSquaredA + radiusSquaredB + 2.0f*std::sqrt(radiusSquaredA*radiusSquaredB);
+}
+
+/* Edge-edge axes of separating axis test, present only in 3D */
+template<UnsignedInt dimensions> inline bool edgesSeparated(const OrientedBox<dimensions>&, const OrientedBox<dimensions>&, const Float(&)[dimensions][dimensions], const Float(&)[dimensions][dimensions], const typename DimensionTraits<dimensions>::VectorType&) {
+    return false;
+}
+
+template<> inline bool edgesSeparated<3>(const OrientedBox<3>& a, const OrientedBox<3>& b, const Float(&r)[3][3], const Float(&absR)[3][3], const Vector3& t) {
+    const Vector3& ea = a.halfExtents;
+    const Vector3& eb = b.halfExtents;
+
+    /* Cross products of each axis of A with each axis of B */
+    for(UnsignedInt i = 0; i != 3; ++i) {
+        const UnsignedInt i1 = (i+1)%3, i2 = (i+2)%3;
+        for(UnsignedInt j = 0; j != 3; ++j) {
+            const UnsignedInt j1 = (j+1)%3, j2 = (j+2)%3;
+            const Float ra = ea[i1]*absR[i2][j] + ea[i2]*absR[i1][j];
+            const Float rb = eb[j1]*absR[i][j2] + eb[j2]*absR[i][j1];
+            if(std::abs(t[i2]*r[i1][j] - t[i1]*r[i2][j]) >= ra + rb) return true;
+        }
+    }
+
+    return false;
+}
+
+/* Source: Christer Ericson, Real Time Collision Detection, section 4.4.1 */
+template<UnsignedInt dimensions> bool collides(const OrientedBox<dimensions>& a, const OrientedBox<dimensions>& b) {
+    const typename DimensionTraits<dimensions>::VectorType distance = b.center - a.center;
+
+    /* Rotation of B and translation expressed in coordinate frame of A.
+       Epsilon is added to absolute values to counteract arithmetic errors
+       when two edges are parallel and their cross product is near zero. */
+    Float r[dimensions][dimensions], absR[dimensions][dimensions];
+    typename DimensionTraits<dimensions>::VectorType t;
+    for(UnsignedInt i = 0; i != dimensions; ++i) {
+        for(UnsignedInt j = 0; j != dimensions; ++j) {
+            r[i][j] = DimensionTraits<dimensions>::VectorType::dot(a.axes[i], b.axes[j]);
+            absR[i][j] = std::abs(r[i][j]) + Math::TypeTraits<Float>::epsilon();
+        }
+        t[i] = DimensionTraits<dimensions>::VectorType::dot(distance, a.axes[i]);
+    }
+
+    /* Axes of A */
+    for(UnsignedInt i = 0; i != dimensions; ++i) {
+        Float rb = 0.0f;
+        for(UnsignedInt j = 0; j != dimensions; ++j)
+            rb += b.halfExtents[j]*absR[i][j];
+        if(std::abs(t[i]) >= a.halfExtents[i] + rb) return false;
+    }
+
+    /* Axes of B */
+    for(UnsignedInt j = 0; j != dimensions; ++j) {
+        Float ra = 0.0f, tb = 0.0f;
+        for(UnsignedInt i = 0; i != dimensions; ++i) {
+            ra += a.halfExtents[i]*absR[i][j];
+            tb += t[i]*r[i][j];
+        }
+        if(std::abs(tb) >= ra + b.halfExtents[j]) return false;
+    }
+
+    return !edgesSeparated(a, b, r, absR, t);
+}
+
+}
+
 template<UnsignedInt dimensions> Box<dimensions> Box<dimensions>::transformed(const typename DimensionTraits<dimensions>::MatrixType& matrix) const {
     return Box<dimensions>(matrix*_transformation);
 }
 
+template<UnsignedInt dimensions> bool Box<dimensions>::operator%(const Sphere<dimensions>& other) const {
+    const typename DimensionTraits<dimensions>::VectorType distance = other.position() - _transformation.translation();
+    const Float radiusSquared = Math::pow<2>(other.radius());
+    if(boundingSpheresSeparated(distance.dot(), boundingRadiusSquared<dimensions>(_transformation), radiusSquared))
+        return false;
+
+    const OrientedBox<dimensions> box(_transformation);
+
+    /* Squared distance of sphere center from the box, end as soon as it is
+       larger than the radius */
+    Float distanceSquared = 0.0f;
+    for(UnsignedInt i = 0; i != dimensions; ++i) {
+        const Float outside = std::abs(DimensionTraits<dimensions>::VectorType::dot(distance, box.axes[i])) - box.halfExtents[i];
+        if(outside <= 0.0f) continue;
+
+        distanceSquared += outside*outside;
+        if(distanceSquared >= radiusSquared) return false;
+    }
+
+    return distanceSquared < radiusSquared;
+}
+
+template<UnsignedInt dimensions> bool Box<dimensions>::operator%(const AxisAlignedBox<dimensions>& other) const {
+    if(boundingSpheresSeparated((_transformation.translation() - (other.min() + other.max())/2.0f).dot(), boundingRadiusSquared<dimensions>(_transformation), boundingRadiusSquared(other)))
+        return false;
+
+    return collides(OrientedBox<dimensions>(_transformation), OrientedBox<dimensions>(other));
+}
+
+template<UnsignedInt dimensions> bool Box<dimensions>::operator%(const Box<dimensions>& other) const {
+    if(boundingSpheresSeparated((_transformation.translation() - other._transformation.translation()).dot(), boundingRadiusSquared<dimensions>(_transformation), boundingRadiusSquared<dimensions>(other._transformation)))
+        return false;
+
+    return collides(OrientedBox<dimensions>(_transformation), OrientedBox<dimensions>(other._transformation));
+}
+
 template class Box<2>;
 template class Box<3>;
 
@@ -31,6 +31,7 @@
 #include "Math/Matrix3.h"
 #include "Math/Matrix4.h"
 #include "DimensionTraits.h"
+#include "Shapes/Shapes.h"
 #include "Shapes/magnumShapesVisibility.h"
 
 namespace Magnum { namespace Shapes {
@@ -39,7 +40,13 @@ namespace Magnum { namespace Shapes {
 @brief Unit-size box with assigned transformation matrix
 
 Unit-size means that half extents are equal to 1, equivalent to e.g. sphere
-radius. See @ref shapes for brief introduction.
+radius. The transformation can contain rotation, translation and scaling
+(also non-uniform), but no skew. See @ref shapes for brief introduction.
+
+Collisions with other boxes are detected using separating axis theorem, axes
+of both boxes are tested first, as they separate most of the disjoint pairs.
+Bounding spheres of both shapes are compared before that to cheaply reject
+pairs which are far from each other.
 @todo Use quat + position + size instead?
 @see Box2D, Box3D
 @todo Assert for skew
@@ -73,6 +80,15 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT Box {
             _transformation = transformation;
         }
 
+        /** @brief Collision with sphere */
+        bool operator%(const Sphere<dimensions>& other) const;
+
+        /** @brief Collision with axis-aligned box */
+        bool operator%(const AxisAlignedBox<dimensions>& other) const;
+
+        /** @brief Collision with box */
+        bool operator%(const Box<dimensions>& other) const;
+
     private:
         typename DimensionTraits<dimensions>::MatrixType _transformation;
 };
@@ -83,6 +99,12 @@ typedef Box<2> Box2D;
 /** @brief Three-dimensional box */
 typedef Box<3> Box3D;
 
+/** @collisionoperator{Sphere,Box} */
+template<UnsignedInt dimensions> inline bool operator%(const Sphere<dimensions>& a, const Box<dimensions>& b) { return b % a; }
+
+/** @collisionoperator{AxisAlignedBox,Box} */
+template<UnsignedInt dimensions> inline bool operator%(const AxisAlignedBox<dimensions>& a, const Box<dimensions>& b) { return b % a; }
+
 }}
 
 #endif
@@ -51,6 +51,11 @@ template<UnsignedInt dimensions> bool Capsule<dimensions>::operator%(const Spher
         Math::pow<2>(_radius+other.radius());
 }
 
+template<UnsignedInt dimensions> bool Capsule<dimensions>::operator%(const Capsule<dimensions>& other) const {
+    return Distance::lineSegmentLineSegmentSquared(_a, _b, other._a, other._b) <
+        Math::pow<2>(_radius+other._radius);
+}
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 template class MAGNUM_SHAPES_EXPORT Capsule<2>;
 template class MAGNUM_SHAPES_EXPORT Capsule<3>;
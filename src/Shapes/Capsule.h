@@ -95,6 +95,9 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT Capsule {
         /** @brief Collision with sphere */
         bool operator%(const Sphere<dimensions>& other) const;
 
+        /** @brief Collision with capsule */
+        bool operator%(const Capsule<dimensions>& other) const;
+
     private:
         typename DimensionTraits<dimensions>::VectorType _a, _b;
         Float _radius;
@@ -66,6 +66,7 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT Composition {
     friend Implementation::AbstractShape<dimensions>* Implementation::getAbstractShape<>(Composition<dimensions>&, std::size_t);
     friend const Implementation::AbstractShape<dimensions>* Implementation::getAbstractShape<>(const Composition<dimensions>&, std::size_t);
     friend struct Implementation::ShapeHelper<Composition<dimensions>>;
+    friend Implementation::Bounds<dimensions> Implementation::shapeBounds<>(const Composition<dimensions>&);
 
     public:
         enum: UnsignedInt {
@@ -0,0 +1,334 @@
+#ifndef Magnum_Shapes_Implementation_AabbTree_h
+#define Magnum_Shapes_Implementation_AabbTree_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+
+#include "Math/Functions.h"
+#include "Shapes/shapeImplementation.h"
+
+namespace Magnum { namespace Shapes { namespace Implementation {
+
+/* Dynamic bounding volume hierarchy of axis-aligned boxes. Leaves store
+   slightly enlarged bounds, so small movements don't need any tree update.
+   The tree is kept balanced using AVL rotations. */
+template<UnsignedInt dimensions, class T> class AabbTree {
+    public:
+        explicit AabbTree(): root(-1), freeList(-1), _leafCount(0) {}
+
+        std::size_t leafCount() const { return _leafCount; }
+
+        /* Height of the tree, zero for empty tree */
+        Int height() const { return root == -1 ? 0 : nodes[root].height + 1; }
+
+        T data(Int leaf) const { return nodes[leaf].data; }
+
+        /* Enlarged bounds of given leaf */
+        const Bounds<dimensions>& bounds(Int leaf) const { return nodes[leaf].bounds; }
+
+        /* Returns leaf ID */
+        Int insert(const Bounds<dimensions>& bounds, T data);
+
+        void remove(Int leaf);
+
+        /* Returns false if the bounds still fit into the enlarged ones and
+           the tree didn't need to be updated */
+        bool update(Int leaf, const Bounds<dimensions>& bounds);
+
+        /* Calls callback(T) for all leaves overlapping given bounds until it
+           returns false */
+        template<class Callback> void query(const Bounds<dimensions>& bounds, Callback callback) const;
+
+        /* Calls callback(T, T) for each pair of leaves with overlapping
+           bounds */
+        template<class Callback> void pairs(Callback callback) const;
+
+        static bool overlaps(const Bounds<dimensions>& a, const Bounds<dimensions>& b) {
+            for(UnsignedInt i = 0; i != dimensions; ++i)
+                if(a.max[i] < b.min[i] || b.max[i] < a.min[i]) return false;
+            return true;
+        }
+
+    private:
+        struct Node {
+            Bounds<dimensions> bounds;
+            T data;
+
+            /* Next free node for unused nodes */
+            Int parent;
+
+            /* -1 for leaf nodes */
+            Int left, right;
+
+            /* Zero for leaf nodes, -1 for unused nodes */
+            Int height;
+
+            bool isLeaf() const { return left == -1; }
+        };
+
+        static Bounds<dimensions> merged(const Bounds<dimensions>& a, const Bounds<dimensions>& b) {
+            return {Math::min(a.min, b.min), Math::max(a.max, b.max)};
+        }
+
+        static bool contains(const Bounds<dimensions>& a, const Bounds<dimensions>& b) {
+            for(UnsignedInt i = 0; i != dimensions; ++i)
+                if(b.min[i] < a.min[i] || a.max[i] < b.max[i]) return false;
+            return true;
+        }
+
+        /* Sum of extents, used as insertion heuristic */
+        static Float cost(const Bounds<dimensions>& bounds) {
+            return (bounds.max - bounds.min).sum();
+        }
+
+        static Bounds<dimensions> enlarged(const Bounds<dimensions>& bounds) {
+            const typename DimensionTraits<dimensions>::VectorType margin = (bounds.max - bounds.min)*0.1f;
+            return {bounds.min - margin, bounds.max + margin};
+        }
+
+        Int allocateNode();
+        void freeNode(Int node);
+        void insertLeaf(Int leaf);
+        void removeLeaf(Int leaf);
+        void refit(Int node);
+        Int balance(Int node);
+
+        std::vector<Node> nodes;
+        Int root, freeList;
+        std::size_t _leafCount;
+};
+
+template<UnsignedInt dimensions, class T> Int AabbTree<dimensions, T>::insert(const Bounds<dimensions>& bounds, T data) {
+    const Int leaf = allocateNode();
+    nodes[leaf].bounds = enlarged(bounds);
+    nodes[leaf].data = data;
+    nodes[leaf].left = nodes[leaf].right = -1;
+    nodes[leaf].height = 0;
+    insertLeaf(leaf);
+    ++_leafCount;
+    return leaf;
+}
+
+template<UnsignedInt dimensions, class T> void AabbTree<dimensions, T>::remove(const Int leaf) {
+    removeLeaf(leaf);
+    freeNode(leaf);
+    --_leafCount;
+}
+
+template<UnsignedInt dimensions, class T> bool AabbTree<dimensions, T>::update(const Int leaf, const Bounds<dimensions>& bounds) {
+    if(contains(nodes[leaf].bounds, bounds)) return false;
+
+    removeLeaf(leaf);
+    nodes[leaf].bounds = enlarged(bounds);
+    insertLeaf(leaf);
+    return true;
+}
+
+template<UnsignedInt dimensions, class T> template<class Callback> void AabbTree<dimensions, T>::query(const Bounds<dimensions>& bounds, Callback callback) const {
+    if(root == -1) return;
+
+    std::vector<Int> stack;
+    stack.reserve(nodes[root].height + 1);
+    stack.push_back(root);
+    while(!stack.empty()) {
+        const Node& node = nodes[stack.back()];
+        stack.pop_back();
+        if(!overlaps(node.bounds, bounds)) continue;
+
+        if(node.isLeaf()) {
+            if(!callback(node.data)) return;
+        } else {
+            stack.push_back(node.left);
+            stack.push_back(node.right);
+        }
+    }
+}
+
+template<UnsignedInt dimensions, class T> template<class Callback> void AabbTree<dimensions, T>::pairs(Callback callback) const {
+    /* Query the tree with each leaf, report each pair only once */
+    std::vector<Int> stack;
+    for(std::size_t i = 0; i != nodes.size(); ++i) {
+        if(nodes[i].height != 0) continue;
+
+        stack.push_back(root);
+        while(!stack.empty()) {
+            const Int index = stack.back();
+            stack.pop_back();
+            const Node& node = nodes[index];
+            if(!overlaps(node.bounds, nodes[i].bounds)) continue;
+
+            if(!node.isLeaf()) {
+                stack.push_back(node.left);
+                stack.push_back(node.right);
+            } else if(std::size_t(index) > i) callback(nodes[i].data, node.data);
+        }
+    }
+}
+
+template<UnsignedInt dimensions, class T> Int AabbTree<dimensions, T>::allocateNode() {
+    if(freeList == -1) {
+        nodes.push_back(Node());
+        return nodes.size()-1;
+    }
+
+    const Int node = freeList;
+    freeList = nodes[node].parent;
+    return node;
+}
+
+template<UnsignedInt dimensions, class T> void AabbTree<dimensions, T>::freeNode(const Int node) {
+    nodes[node].parent = freeList;
+    nodes[node].height = -1;
+    nodes[node].data = T();
+    freeList = node;
+}
+
+template<UnsignedInt dimensions, class T> void AabbTree<dimensions, T>::insertLeaf(const Int leaf) {
+    if(root == -1) {
+        root = leaf;
+        nodes[root].parent = -1;
+        return;
+    }
+
+    /* Find the best sibling, descend into the child which would be enlarged
+       less, until creating new parent is cheaper than descending */
+    const Bounds<dimensions> leafBounds = nodes[leaf].bounds;
+    Int sibling = root;
+    while(!nodes[sibling].isLeaf()) {
+        const Node& node = nodes[sibling];
+        const Float area = cost(node.bounds);
+        const Float combinedArea = cost(merged(node.bounds, leafBounds));
+
+        /* Cost of creating new parent for this node and the leaf, minimum
+           cost of pushing the leaf further down */
+        const Float newParentCost = 2.0f*combinedArea;
+        const Float inheritanceCost = 2.0f*(combinedArea - area);
+
+        Float childCost[2];
+        const Int children[]{node.left, node.right};
+        for(std::size_t i = 0; i != 2; ++i) {
+            const Node& child = nodes[children[i]];
+            childCost[i] = cost(merged(child.bounds, leafBounds)) + inheritanceCost;
+            if(!child.isLeaf()) childCost[i] -= cost(child.bounds);
+        }
+
+        if(newParentCost < childCost[0] && newParentCost < childCost[1]) break;
+        sibling = childCost[0] < childCost[1] ? node.left : node.right;
+    }
+
+    /* Create new parent for the sibling and the leaf */
+    const Int oldParent = nodes[sibling].parent;
+    const Int newParent = allocateNode();
+    nodes[newParent].parent = oldParent;
+    nodes[newParent].data = T();
+    nodes[newParent].left = sibling;
+    nodes[newParent].right = leaf;
+    nodes[sibling].parent = nodes[leaf].parent = newParent;
+    if(oldParent == -1) root = newParent;
+    else if(nodes[oldParent].left == sibling) nodes[oldParent].left = newParent;
+    else nodes[oldParent].right = newParent;
+
+    /* Update bounds and heights of all ancestors */
+    for(Int node = newParent; node != -1; node = nodes[node].parent)
+        refit(node = balance(node));
+}
+
+template<UnsignedInt dimensions, class T> void AabbTree<dimensions, T>::removeLeaf(const Int leaf) {
+    if(leaf == root) {
+        root = -1;
+        return;
+    }
+
+    /* Replace the parent with sibling */
+    const Int parent = nodes[leaf].parent;
+    const Int grandParent = nodes[parent].parent;
+    const Int sibling = nodes[parent].left == leaf ? nodes[parent].right : nodes[parent].left;
+    nodes[sibling].parent = grandParent;
+    freeNode(parent);
+    if(grandParent == -1) {
+        root = sibling;
+        return;
+    }
+
+    if(nodes[grandParent].left == parent) nodes[grandParent].left = sibling;
+    else nodes[grandParent].right = sibling;
+
+    /* Update bounds and heights of all ancestors */
+    for(Int node = grandParent; node != -1; node = nodes[node].parent)
+        refit(node = balance(node));
+}
+
+template<UnsignedInt dimensions, class T> void AabbTree<dimensions, T>::refit(const Int node) {
+    Node& n = nodes[node];
+    n.bounds = merged(nodes[n.left].bounds, nodes[n.right].bounds);
+    n.height = 1 + Math::max(nodes[n.left].height, nodes[n.right].height);
+}
+
+template<UnsignedInt dimensions, class T> Int AabbTree<dimensions, T>::balance(const Int a) {
+    Node& nodeA = nodes[a];
+    if(nodeA.isLeaf()) return a;
+
+    /* Rotate the higher child up */
+    const Int b = nodeA.left, c = nodeA.right;
+    const Int difference = nodes[c].height - nodes[b].height;
+    if(difference >= -1 && difference <= 1) return a;
+
+    const Int up = difference > 1 ? c : b;
+    const Int other = difference > 1 ? b : c;
+    Node& nodeUp = nodes[up];
+
+    /* The higher child takes place of A */
+    nodeUp.parent = nodeA.parent;
+    nodeA.parent = up;
+    if(nodeUp.parent == -1) root = up;
+    else if(nodes[nodeUp.parent].left == a) nodes[nodeUp.parent].left = up;
+    else nodes[nodeUp.parent].right = up;
+
+    /* The higher grandchild stays under the rotated node, the lower one goes
+       to A */
+    const Int f = nodeUp.left, g = nodeUp.right;
+    const bool fHigher = nodes[f].height > nodes[g].height;
+    const Int keep = fHigher ? f : g;
+    const Int move = fHigher ? g : f;
+
+    nodeUp.left = a;
+    nodeUp.right = keep;
+    nodes[move].parent = a;
+    if(difference > 1) {
+        nodeA.left = other;
+        nodeA.right = move;
+    } else {
+        nodeA.left = move;
+        nodeA.right = other;
+    }
+
+    refit(a);
+    refit(up);
+    return up;
+}
+
+}}}
+
+#endif
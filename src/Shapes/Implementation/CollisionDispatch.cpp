@@ -49,8 +49,14 @@ template<> bool collides(const AbstractShape<2>* const a, const AbstractShape<2>
 
         _c(Capsule, Capsule2D, Point, Point2D)
         _c(Capsule, Capsule2D, Sphere, Sphere2D)
+        _c(Capsule, Capsule2D, Capsule, Capsule2D)
 
         _c(AxisAlignedBox, AxisAlignedBox2D, Point, Point2D)
+        _c(AxisAlignedBox, AxisAlignedBox2D, AxisAlignedBox, AxisAlignedBox2D)
+
+        _c(Box, Box2D, Sphere, Sphere2D)
+        _c(Box, Box2D, AxisAlignedBox, AxisAlignedBox2D)
+        _c(Box, Box2D, Box, Box2D)
         #undef _c
     }
 
@@ -71,8 +77,14 @@ template<> bool collides(const AbstractShape<3>* const a, const AbstractShape<3>
 
         _c(Capsule, Capsule3D, Point, Point3D)
         _c(Capsule, Capsule3D, Sphere, Sphere3D)
+        _c(Capsule, Capsule3D, Capsule, Capsule3D)
 
         _c(AxisAlignedBox, AxisAlignedBox3D, Point, Point3D)
+        _c(AxisAlignedBox, AxisAlignedBox3D, AxisAlignedBox, AxisAlignedBox3D)
+
+        _c(Box, Box3D, Sphere, Sphere3D)
+        _c(Box, Box3D, AxisAlignedBox, AxisAlignedBox3D)
+        _c(Box, Box3D, Box, Box3D)
 
         _c(Plane, Plane, Line, Line3D)
         _c(Plane, Plane, LineSegment, LineSegment3D)
@@ -24,30 +24,198 @@
 
 #include "ShapeGroup.h"
 
+#include <algorithm>
+#include <limits>
+
 #include "Shapes/AbstractShape.h"
+#include "Shapes/Implementation/AabbTree.h"
 
 namespace Magnum { namespace Shapes {
 
+namespace {
+    /* Infinite, NaN or empty bounds (e.g. intersection of disjoint shapes)
+       are tested with everything */
+    template<UnsignedInt dimensions> bool isUnbounded(const Implementation::Bounds<dimensions>& bounds) {
+        for(UnsignedInt i = 0; i != dimensions; ++i)
+            if(!(bounds.min[i] <= bounds.max[i]) || bounds.max[i]-bounds.min[i] == std::numeric_limits<Float>::infinity())
+                return true;
+        return false;
+    }
+}
+
+template<UnsignedInt dimensions> ShapeGroup<dimensions>::ShapeGroup(): dirty(true), tree(new Implementation::AabbTree<dimensions, AbstractShape<dimensions>*>) {}
+
+template<UnsignedInt dimensions> ShapeGroup<dimensions>::~ShapeGroup() {
+    /* Reset broadphase state of shapes which outlive the group */
+    for(std::size_t i = 0; i != this->size(); ++i) {
+        AbstractShape<dimensions>* shape = (*this)[i];
+        shape->_leaf = shape->_dirtyIndex = -1;
+        shape->_unbounded = false;
+    }
+
+    delete tree;
+}
+
+template<UnsignedInt dimensions> void ShapeGroup<dimensions>::featureAdded(AbstractShape<dimensions>* shape) {
+    /* Insert into the broadphase on next setClean() */
+    setDirty(shape);
+}
+
 template<UnsignedInt dimensions> void ShapeGroup<dimensions>::setClean() {
-    /* Clean all objects */
-    if(!this->isEmpty()) {
-        std::vector<SceneGraph::AbstractObject<dimensions>*> objects(this->size());
-        for(std::size_t i = 0; i != this->size(); ++i)
-            objects[i] = (*this)[i]->object();
+    if(!dirty) return;
+
+    /* Clean objects of all changed shapes */
+    if(!dirtyShapes.empty()) {
+        std::vector<SceneGraph::AbstractObject<dimensions>*> objects(dirtyShapes.size());
+        for(std::size_t i = 0; i != dirtyShapes.size(); ++i)
+            objects[i] = dirtyShapes[i]->object();
 
         SceneGraph::AbstractObject<dimensions>::setClean(objects);
     }
 
+    /* Update their bounds in the broadphase */
+    for(auto it = dirtyShapes.begin(); it != dirtyShapes.end(); ++it) {
+        (*it)->_dirtyIndex = -1;
+        updateBounds(*it);
+    }
+
+    dirtyShapes.clear();
     dirty = false;
 }
 
 template<UnsignedInt dimensions> AbstractShape<dimensions>* ShapeGroup<dimensions>::firstCollision(const AbstractShape<dimensions>* shape) {
     setClean();
-    for(std::size_t i = 0; i != this->size(); ++i)
-        if((*this)[i] != shape && (*this)[i]->collides(shape))
-            return (*this)[i];
 
-    return nullptr;
+    AbstractShape<dimensions>* collision = nullptr;
+    candidates(shape, [shape, &collision](AbstractShape<dimensions>* other) {
+        if(!other->collides(shape)) return true;
+        collision = other;
+        return false;
+    });
+
+    return collision;
+}
+
+template<UnsignedInt dimensions> std::vector<AbstractShape<dimensions>*> ShapeGroup<dimensions>::collisions(const AbstractShape<dimensions>* shape) {
+    setClean();
+
+    std::vector<AbstractShape<dimensions>*> out;
+    candidates(shape, [shape, &out](AbstractShape<dimensions>* other) {
+        if(other->collides(shape)) out.push_back(other);
+        return true;
+    });
+
+    return out;
+}
+
+template<UnsignedInt dimensions> std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>> ShapeGroup<dimensions>::collisionPairs() {
+    setClean();
+
+    std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>> out;
+
+    /* Bounded pairs with overlapping bounds */
+    tree->pairs([&out](AbstractShape<dimensions>* a, AbstractShape<dimensions>* b) {
+        if(a->collides(b)) out.emplace_back(a, b);
+    });
+
+    /* Unbounded shapes with all bounded shapes and with unbounded shapes
+       after them */
+    for(std::size_t i = 0; i != unboundedShapes.size(); ++i) {
+        AbstractShape<dimensions>* a = unboundedShapes[i];
+        for(std::size_t j = 0; j != this->size(); ++j) {
+            AbstractShape<dimensions>* b = (*this)[j];
+            if(b->_unbounded) continue;
+            if(a->collides(b)) out.emplace_back(a, b);
+        }
+
+        for(std::size_t j = i+1; j != unboundedShapes.size(); ++j)
+            if(a->collides(unboundedShapes[j])) out.emplace_back(a, unboundedShapes[j]);
+    }
+
+    return out;
+}
+
+template<UnsignedInt dimensions> void ShapeGroup<dimensions>::setDirty(AbstractShape<dimensions>* shape) {
+    dirty = true;
+    if(shape->_dirtyIndex != -1) return;
+
+    shape->_dirtyIndex = dirtyShapes.size();
+    dirtyShapes.push_back(shape);
+}
+
+template<UnsignedInt dimensions> void ShapeGroup<dimensions>::featureRemoved(AbstractShape<dimensions>* shape) {
+    /* Remove from dirty list, move the last shape in its place */
+    if(shape->_dirtyIndex != -1) {
+        AbstractShape<dimensions>* last = dirtyShapes.back();
+        dirtyShapes[shape->_dirtyIndex] = last;
+        last->_dirtyIndex = shape->_dirtyIndex;
+        dirtyShapes.pop_back();
+    }
+
+    if(shape->_leaf != -1) tree->remove(shape->_leaf);
+    if(shape->_unbounded)
+        unboundedShapes.erase(std::find(unboundedShapes.begin(), unboundedShapes.end(), shape));
+
+    shape->_leaf = shape->_dirtyIndex = -1;
+    shape->_unbounded = false;
+}
+
+template<UnsignedInt dimensions> void ShapeGroup<dimensions>::updateBounds(AbstractShape<dimensions>* shape) {
+    const Implementation::Bounds<dimensions> bounds = shape->abstractTransformedShape()->bounds();
+
+    if(isUnbounded(bounds)) {
+        if(shape->_leaf != -1) {
+            tree->remove(shape->_leaf);
+            shape->_leaf = -1;
+        }
+
+        if(!shape->_unbounded) {
+            unboundedShapes.push_back(shape);
+            shape->_unbounded = true;
+        }
+
+        return;
+    }
+
+    if(shape->_unbounded) {
+        unboundedShapes.erase(std::find(unboundedShapes.begin(), unboundedShapes.end(), shape));
+        shape->_unbounded = false;
+    }
+
+    if(shape->_leaf == -1) shape->_leaf = tree->insert(bounds, shape);
+    else tree->update(shape->_leaf, bounds);
+}
+
+template<UnsignedInt dimensions> template<class Callback> void ShapeGroup<dimensions>::candidates(const AbstractShape<dimensions>* shape, Callback callback) {
+    /* Shape is part of this group, use its bounds from the tree */
+    Implementation::Bounds<dimensions> bounds;
+    bool unbounded;
+    if(shape->group() == this) {
+        unbounded = shape->_unbounded;
+        if(!unbounded) bounds = tree->bounds(shape->_leaf);
+
+    /* Otherwise compute the bounds */
+    } else {
+        bounds = shape->abstractTransformedShape()->bounds();
+        unbounded = isUnbounded(bounds);
+    }
+
+    /* Unbounded shape, test with everything */
+    if(unbounded) {
+        for(std::size_t i = 0; i != this->size(); ++i)
+            if((*this)[i] != shape && !callback((*this)[i])) return;
+        return;
+    }
+
+    bool stopped = false;
+    tree->query(bounds, [shape, &callback, &stopped](AbstractShape<dimensions>* other) {
+        if(other == shape) return true;
+        return !(stopped = !callback(other));
+    });
+    if(stopped) return;
+
+    for(auto it = unboundedShapes.begin(); it != unboundedShapes.end(); ++it)
+        if(*it != shape && !callback(*it)) return;
 }
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
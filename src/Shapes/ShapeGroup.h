@@ -28,6 +28,7 @@
  * @brief Class Magnum::Shapes::ShapeGroup, typedef Magnum::Shapes::ShapeGroup2D, Magnum::Shapes::ShapeGroup3D
  */
 
+#include <utility>
 #include <vector>
 
 #include "Shapes/AbstractShape.h"
@@ -37,10 +38,23 @@
 
 namespace Magnum { namespace Shapes {
 
+namespace Implementation {
+    template<UnsignedInt, class> class AabbTree;
+}
+
 /**
 @brief Group of shapes
 
 See Shape for more information. See @ref shapes for brief introduction.
+
+@section ShapeGroup-broadphase Broadphase
+
+The group keeps axis-aligned bounding boxes of all shapes in a dynamic
+bounding volume hierarchy, so collision queries test only shapes with
+overlapping bounds instead of all shapes in the group. Only shapes which
+changed since last query are cleaned and updated in the hierarchy. Shapes
+without finite bounds (e.g. Line, Plane or Composition with
+@ref CompositionOperation "CompositionOperation::Not") are always tested.
 @see @ref scenegraph, ShapeGroup2D, ShapeGroup3D
 */
 template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT ShapeGroup: public SceneGraph::FeatureGroup<dimensions, AbstractShape<dimensions>> {
@@ -52,7 +66,15 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT ShapeGroup: public S
          *
          * Marks the group as dirty.
          */
-        explicit ShapeGroup(): dirty(true) {}
+        explicit ShapeGroup();
+
+        ShapeGroup(const ShapeGroup<dimensions>&) = delete;
+        ShapeGroup(ShapeGroup<dimensions>&&) = delete;
+
+        ~ShapeGroup();
+
+        ShapeGroup<dimensions>& operator=(const ShapeGroup<dimensions>&) = delete;
+        ShapeGroup<dimensions>& operator=(ShapeGroup<dimensions>&&) = delete;
 
         /**
          * @brief Whether the group is dirty
@@ -75,21 +97,50 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT ShapeGroup: public S
          * @brief Set the group and all bodies as clean
          *
          * This function is called before computing any collisions to ensure
-         * all objects are cleaned.
+         * all objects are cleaned. Only objects of shapes which were marked
+         * as dirty since last call are cleaned and their bounds are updated.
          */
         void setClean();
 
         /**
          * @brief First collision of given shape with other shapes in the group
          *
-         * Returns first shape colliding with given one. If there aren't any
-         * collisions, returns `nullptr`. Calls setClean() before the
+         * Returns first found shape colliding with given one. If there aren't
+         * any collisions, returns `nullptr`. Calls setClean() before the
          * operation.
          */
         AbstractShape<dimensions>* firstCollision(const AbstractShape<dimensions>* shape);
 
+        /**
+         * @brief All collisions of given shape with other shapes in the group
+         *
+         * Returns all shapes colliding with given one, in no particular
+         * order. Calls setClean() before the operation.
+         */
+        std::vector<AbstractShape<dimensions>*> collisions(const AbstractShape<dimensions>* shape);
+
+        /**
+         * @brief All colliding pairs of shapes in the group
+         *
+         * Returns each colliding pair once, in no particular order. Calls
+         * setClean() before the operation.
+         */
+        std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>> collisionPairs();
+
     private:
+        void featureAdded(AbstractShape<dimensions>* shape) override;
+        void featureRemoved(AbstractShape<dimensions>* shape) override;
+
+        void MAGNUM_SHAPES_LOCAL setDirty(AbstractShape<dimensions>* shape);
+        void MAGNUM_SHAPES_LOCAL updateBounds(AbstractShape<dimensions>* shape);
+
+        /* Calls callback(AbstractShape*) for all shapes which may collide
+           with given one until it returns false */
+        template<class Callback> void MAGNUM_SHAPES_LOCAL candidates(const AbstractShape<dimensions>* shape, Callback callback);
+
         bool dirty;
+        Implementation::AabbTree<dimensions, AbstractShape<dimensions>*>* tree;
+        std::vector<AbstractShape<dimensions>*> dirtyShapes, unboundedShapes;
 };
 
 /**
@@ -0,0 +1,159 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <algorithm>
+#include <TestSuite/Tester.h>
+
+#include "Shapes/Implementation/AabbTree.h"
+
+namespace Magnum { namespace Shapes { namespace Test {
+
+class AabbTreeTest: public TestSuite::Tester {
+    public:
+        AabbTreeTest();
+
+        void insertRemove();
+        void update();
+        void query();
+        void pairs();
+        void balanced();
+};
+
+typedef Implementation::AabbTree<2, Int> AabbTree;
+typedef Implementation::Bounds<2> Bounds;
+
+AabbTreeTest::AabbTreeTest() {
+    addTests({&AabbTreeTest::insertRemove,
+              &AabbTreeTest::update,
+              &AabbTreeTest::query,
+              &AabbTreeTest::pairs,
+              &AabbTreeTest::balanced});
+}
+
+void AabbTreeTest::insertRemove() {
+    AabbTree tree;
+    CORRADE_COMPARE(tree.leafCount(), 0);
+    CORRADE_COMPARE(tree.height(), 0);
+
+    const Int a = tree.insert({{0.0f, 0.0f}, {1.0f, 1.0f}}, 1);
+    const Int b = tree.insert({{2.0f, 0.0f}, {3.0f, 1.0f}}, 2);
+    const Int c = tree.insert({{4.0f, 0.0f}, {5.0f, 1.0f}}, 3);
+    CORRADE_COMPARE(tree.leafCount(), 3);
+    CORRADE_COMPARE(tree.data(a), 1);
+    CORRADE_COMPARE(tree.data(b), 2);
+    CORRADE_COMPARE(tree.data(c), 3);
+
+    /* Bounds are enlarged */
+    CORRADE_COMPARE(tree.bounds(a).min, Vector2(-0.1f));
+    CORRADE_COMPARE(tree.bounds(a).max, Vector2(1.1f));
+
+    tree.remove(b);
+    CORRADE_COMPARE(tree.leafCount(), 2);
+    CORRADE_COMPARE(tree.height(), 2);
+
+    /* Removed node is reused */
+    CORRADE_COMPARE(tree.insert({{2.0f, 0.0f}, {3.0f, 1.0f}}, 4), b);
+    CORRADE_COMPARE(tree.data(b), 4);
+
+    tree.remove(a);
+    tree.remove(b);
+    tree.remove(c);
+    CORRADE_COMPARE(tree.leafCount(), 0);
+    CORRADE_COMPARE(tree.height(), 0);
+}
+
+void AabbTreeTest::update() {
+    AabbTree tree;
+    const Int a = tree.insert({{0.0f, 0.0f}, {1.0f, 1.0f}}, 1);
+    tree.insert({{2.0f, 0.0f}, {3.0f, 1.0f}}, 2);
+
+    /* Small movement fits into enlarged bounds */
+    CORRADE_VERIFY(!tree.update(a, {{0.05f, 0.0f}, {1.05f, 1.0f}}));
+
+    /* Larger doesn't */
+    CORRADE_VERIFY(tree.update(a, {{5.0f, 0.0f}, {6.0f, 1.0f}}));
+    CORRADE_COMPARE(tree.bounds(a).min, Vector2(4.9f, -0.1f));
+
+    std::vector<Int> found;
+    tree.query({{5.5f, 0.5f}, {5.5f, 0.5f}}, [&found](Int data) {
+        found.push_back(data);
+        return true;
+    });
+    CORRADE_COMPARE(found, std::vector<Int>{1});
+}
+
+void AabbTreeTest::query() {
+    AabbTree tree;
+    for(Int i = 0; i != 10; ++i)
+        tree.insert({Vector2(Float(i)), Vector2(Float(i)+0.5f)}, i);
+
+    std::vector<Int> found;
+    tree.query({Vector2(2.75f), Vector2(5.25f)}, [&found](Int data) {
+        found.push_back(data);
+        return true;
+    });
+    std::sort(found.begin(), found.end());
+    CORRADE_COMPARE(found, (std::vector<Int>{3, 4, 5}));
+
+    /* Stopping the query */
+    found.clear();
+    tree.query({Vector2(2.75f), Vector2(5.25f)}, [&found](Int data) {
+        found.push_back(data);
+        return false;
+    });
+    CORRADE_COMPARE(found.size(), 1);
+}
+
+void AabbTreeTest::pairs() {
+    AabbTree tree;
+    tree.insert({{0.0f, 0.0f}, {2.0f, 2.0f}}, 0);
+    tree.insert({{1.0f, 1.0f}, {3.0f, 3.0f}}, 1);
+    tree.insert({{2.5f, 2.5f}, {4.0f, 4.0f}}, 2);
+    tree.insert({{10.0f, 10.0f}, {11.0f, 11.0f}}, 3);
+
+    std::vector<std::pair<Int, Int>> found;
+    tree.pairs([&found](Int a, Int b) {
+        found.push_back(a < b ? std::make_pair(a, b) : std::make_pair(b, a));
+    });
+    std::sort(found.begin(), found.end());
+    CORRADE_COMPARE(found.size(), 2);
+    CORRADE_VERIFY(found[0] == std::make_pair(0, 1));
+    CORRADE_VERIFY(found[1] == std::make_pair(1, 2));
+}
+
+void AabbTreeTest::balanced() {
+    /* Inserting sorted boxes would create degenerate tree without
+       balancing */
+    AabbTree tree;
+    for(Int i = 0; i != 1024; ++i)
+        tree.insert({Vector2(Float(i), 0.0f), Vector2(Float(i)+0.5f, 0.5f)}, i);
+
+    CORRADE_COMPARE(tree.leafCount(), 1024);
+    CORRADE_VERIFY(tree.height() <= 2*11);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shapes::Test::AabbTreeTest)
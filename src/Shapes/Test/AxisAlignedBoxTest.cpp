@@ -37,11 +37,13 @@ class AxisAlignedBoxTest: public TestSuite::Tester {
 
         void transformed();
         void collisionPoint();
+        void collisionAxisAlignedBox();
 };
 
 AxisAlignedBoxTest::AxisAlignedBoxTest() {
     addTests({&AxisAlignedBoxTest::transformed,
-              &AxisAlignedBoxTest::collisionPoint});
+              &AxisAlignedBoxTest::collisionPoint,
+              &AxisAlignedBoxTest::collisionAxisAlignedBox});
 }
 
 void AxisAlignedBoxTest::transformed() {
@@ -60,6 +62,26 @@ void AxisAlignedBoxTest::collisionPoint() {
     VERIFY_COLLIDES(box, point2);
 }
 
+void AxisAlignedBoxTest::collisionAxisAlignedBox() {
+    Shapes::AxisAlignedBox2D box({-1.0f, -2.0f}, {1.0f, 2.0f});
+    Shapes::AxisAlignedBox2D box1({0.5f, 1.5f}, {3.0f, 3.0f});
+    Shapes::AxisAlignedBox2D box2({0.5f, 2.5f}, {3.0f, 3.0f});
+    Shapes::AxisAlignedBox2D box3({1.0f, -3.0f}, {2.0f, 3.0f});
+
+    VERIFY_COLLIDES(box, box1);
+    VERIFY_NOT_COLLIDES(box, box2);
+
+    /* Touching boxes don't collide */
+    VERIFY_NOT_COLLIDES(box, box3);
+
+    Shapes::AxisAlignedBox3D box3D({-1.0f, -2.0f, -3.0f}, {1.0f, 2.0f, 3.0f});
+    Shapes::AxisAlignedBox3D box3D1({-0.5f, -0.5f, -0.5f}, {0.5f, 0.5f, 0.5f});
+    Shapes::AxisAlignedBox3D box3D2({-0.5f, -0.5f, 3.5f}, {0.5f, 0.5f, 4.5f});
+
+    VERIFY_COLLIDES(box3D, box3D1);
+    VERIFY_NOT_COLLIDES(box3D, box3D2);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Shapes::Test::AxisAlignedBoxTest)
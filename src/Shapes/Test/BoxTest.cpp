@@ -24,9 +24,14 @@
 
 #include <TestSuite/Tester.h>
 
+#include "Math/Matrix3.h"
 #include "Math/Matrix4.h"
 #include "Magnum.h"
+#include "Shapes/AxisAlignedBox.h"
 #include "Shapes/Box.h"
+#include "Shapes/Sphere.h"
+
+#include "ShapeTestBase.h"
 
 namespace Magnum { namespace Shapes { namespace Test {
 
@@ -35,10 +40,18 @@ class BoxTest: public TestSuite::Tester {
         BoxTest();
 
         void transformed();
+        void collisionSphere();
+        void collisionAxisAlignedBox();
+        void collisionBox2D();
+        void collisionBox3D();
 };
 
 BoxTest::BoxTest() {
-    addTests({&BoxTest::transformed});
+    addTests({&BoxTest::transformed,
+              &BoxTest::collisionSphere,
+              &BoxTest::collisionAxisAlignedBox,
+              &BoxTest::collisionBox2D,
+              &BoxTest::collisionBox3D});
 }
 
 void BoxTest::transformed() {
@@ -47,6 +60,78 @@ void BoxTest::transformed() {
     CORRADE_COMPARE(box.transformation(), Matrix4::scaling({2.0f, -1.0f, 1.5f})*Matrix4::translation({1.0f, 2.0f, -3.0f}));
 }
 
+void BoxTest::collisionSphere() {
+    /* Box rotated by 45 degrees, scaled to 2x1 */
+    Shapes::Box2D box(Matrix3::rotation(Deg(45.0f))*Matrix3::scaling({2.0f, 1.0f}));
+
+    /* Near the corner along the long side, outside of the axis-aligned
+       bounds of unrotated box */
+    Shapes::Sphere2D sphere(Vector2(1.4f), 0.2f);
+    Shapes::Sphere2D sphere1(Vector2(1.7f), 0.2f);
+
+    /* Near the short side, within its bounding circle */
+    Shapes::Sphere2D sphere2(Vector2(-1.0f, 1.0f)*Constants::sqrt2()/2, 0.1f);
+    Shapes::Sphere2D sphere3(Vector2(-1.0f, 1.0f)*Constants::sqrt2()*0.6f, 0.1f);
+
+    VERIFY_COLLIDES(box, sphere);
+    VERIFY_NOT_COLLIDES(box, sphere1);
+    VERIFY_COLLIDES(box, sphere2);
+    VERIFY_NOT_COLLIDES(box, sphere3);
+
+    /* Sphere near the corner */
+    Shapes::Box3D box3D(Matrix4::translation({1.0f, 2.0f, 3.0f}));
+    Shapes::Sphere3D sphere3D(Vector3(1.0f, 2.0f, 3.0f) + Vector3(1.5f), 0.9f);
+    Shapes::Sphere3D sphere3D1(Vector3(1.0f, 2.0f, 3.0f) + Vector3(1.5f), 0.8f);
+
+    VERIFY_COLLIDES(box3D, sphere3D);
+    VERIFY_NOT_COLLIDES(box3D, sphere3D1);
+}
+
+void BoxTest::collisionAxisAlignedBox() {
+    Shapes::Box2D box(Matrix3::translation({3.0f, 0.0f})*Matrix3::rotation(Deg(45.0f)));
+    Shapes::AxisAlignedBox2D aabb({-1.0f, -1.0f}, {1.7f, 1.0f});
+    Shapes::AxisAlignedBox2D aabb1({-1.0f, -1.0f}, {1.5f, 1.0f});
+
+    VERIFY_COLLIDES(box, aabb);
+    VERIFY_NOT_COLLIDES(box, aabb1);
+}
+
+void BoxTest::collisionBox2D() {
+    Shapes::Box2D box(Matrix3::scaling({2.0f, 1.0f}));
+
+    /* Separated along axis of the first box */
+    Shapes::Box2D box1(Matrix3::translation({3.5f, 0.0f})*Matrix3::rotation(Deg(30.0f)));
+    Shapes::Box2D box2(Matrix3::translation({2.5f, 0.0f})*Matrix3::rotation(Deg(30.0f)));
+
+    /* Separated only along axis of the second box */
+    Shapes::Box2D box3(Matrix3::translation({2.5f, 2.5f})*Matrix3::rotation(Deg(45.0f)));
+    Shapes::Box2D box4(Matrix3::translation({2.0f, 2.0f})*Matrix3::rotation(Deg(45.0f)));
+
+    VERIFY_NOT_COLLIDES(box, box1);
+    VERIFY_COLLIDES(box, box2);
+    VERIFY_NOT_COLLIDES(box, box3);
+    VERIFY_COLLIDES(box, box4);
+}
+
+void BoxTest::collisionBox3D() {
+    const Shapes::Box3D box = Matrix4();
+
+    /* Separated along axis of the first box */
+    Shapes::Box3D box1(Matrix4::translation({2.1f, 0.0f, 0.0f}));
+    Shapes::Box3D box2(Matrix4::translation({1.9f, 0.0f, 0.0f}));
+
+    /* Boxes with perpendicular edges facing each other along X, separated
+       only by cross product of the edges */
+    Shapes::Box3D box3(Matrix4::rotationZ(Deg(45.0f)));
+    Shapes::Box3D box4(Matrix4::translation(Vector3::xAxis(2*Constants::sqrt2() + 0.2f))*Matrix4::rotationY(Deg(45.0f)));
+    Shapes::Box3D box5(Matrix4::translation(Vector3::xAxis(2*Constants::sqrt2() - 0.2f))*Matrix4::rotationY(Deg(45.0f)));
+
+    VERIFY_NOT_COLLIDES(box, box1);
+    VERIFY_COLLIDES(box, box2);
+    VERIFY_NOT_COLLIDES(box3, box4);
+    VERIFY_COLLIDES(box3, box5);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Shapes::Test::BoxTest)
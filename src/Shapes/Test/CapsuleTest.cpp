@@ -40,12 +40,14 @@ class CapsuleTest: public TestSuite::Tester {
         void transformedAverageScaling();
         void collisionPoint();
         void collisionSphere();
+        void collisionCapsule();
 };
 
 CapsuleTest::CapsuleTest() {
     addTests({&CapsuleTest::transformed,
               &CapsuleTest::collisionPoint,
-              &CapsuleTest::collisionSphere});
+              &CapsuleTest::collisionSphere,
+              &CapsuleTest::collisionCapsule});
 }
 
 void CapsuleTest::transformed() {
@@ -83,6 +85,30 @@ void CapsuleTest::collisionSphere() {
     VERIFY_NOT_COLLIDES(capsule, sphere2);
 }
 
+void CapsuleTest::collisionCapsule() {
+    Shapes::Capsule3D capsule({-1.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 0.0f}, 2.0f);
+
+    /* Crossing above, distance of the segments is 3 */
+    Shapes::Capsule3D capsule1({-1.0f, 1.0f, 3.0f}, {1.0f, -1.0f, 3.0f}, 1.1f);
+    Shapes::Capsule3D capsule2({-1.0f, 1.0f, 3.0f}, {1.0f, -1.0f, 3.0f}, 0.9f);
+
+    /* Parallel, next to end */
+    Shapes::Capsule3D capsule3({2.0f, 3.0f, 0.0f}, {4.0f, 5.0f, 0.0f}, 0.5f);
+    Shapes::Capsule3D capsule4({3.0f, 4.0f, 0.0f}, {4.0f, 5.0f, 0.0f}, 0.5f);
+
+    VERIFY_COLLIDES(capsule, capsule1);
+    VERIFY_NOT_COLLIDES(capsule, capsule2);
+    VERIFY_COLLIDES(capsule, capsule3);
+    VERIFY_NOT_COLLIDES(capsule, capsule4);
+
+    Shapes::Capsule2D capsule2D({-1.0f, 0.0f}, {1.0f, 0.0f}, 0.5f);
+    Shapes::Capsule2D capsule2D1({0.0f, -1.0f}, {0.0f, 1.0f}, 0.1f);
+    Shapes::Capsule2D capsule2D2({0.0f, 1.0f}, {0.0f, 2.0f}, 0.4f);
+
+    VERIFY_COLLIDES(capsule2D, capsule2D1);
+    VERIFY_NOT_COLLIDES(capsule2D, capsule2D2);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Shapes::Test::CapsuleTest)
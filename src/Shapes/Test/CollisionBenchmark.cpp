@@ -0,0 +1,158 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <vector>
+#include <TestSuite/Tester.h>
+
+#include "Math/Matrix3.h"
+#include "Math/Matrix4.h"
+#include "Magnum.h"
+#include "Shapes/AxisAlignedBox.h"
+#include "Shapes/Box.h"
+#include "Shapes/Capsule.h"
+#include "Shapes/Sphere.h"
+#include "Test/Benchmark.h"
+
+namespace Magnum { namespace Shapes { namespace Test {
+
+using Magnum::Test::measure;
+
+class CollisionBenchmark: public TestSuite::Tester {
+    public:
+        explicit CollisionBenchmark();
+
+        void boxBox();
+        void boxSphere();
+        void boxAxisAlignedBox();
+        void axisAlignedBoxAxisAlignedBox();
+        void capsuleCapsule();
+};
+
+namespace {
+
+UnsignedInt seed = 1;
+Float random() {
+    seed = seed*1103515245 + 12345;
+    return Float((seed >> 8)%10000)/10000.0f;
+}
+
+/* Random shapes of unit-ish size scattered in cube of given size, the larger
+   the cube, the more misses */
+template<UnsignedInt dimensions> typename DimensionTraits<dimensions>::VectorType randomVector(Float size) {
+    typename DimensionTraits<dimensions>::VectorType v;
+    for(UnsignedInt i = 0; i != dimensions; ++i) v[i] = random()*size;
+    return v;
+}
+
+Matrix3 randomTransformation(Float size, Matrix3*) {
+    return Matrix3::translation(randomVector<2>(size))*
+        Matrix3::rotation(Deg(random()*360.0f))*
+        Matrix3::scaling(randomVector<2>(1.0f) + Vector2(0.25f));
+}
+
+Matrix4 randomTransformation(Float size, Matrix4*) {
+    return Matrix4::translation(randomVector<3>(size))*
+        Matrix4::rotation(Deg(random()*360.0f), (randomVector<3>(1.0f) - Vector3(0.5f)).normalized())*
+        Matrix4::scaling(randomVector<3>(1.0f) + Vector3(0.25f));
+}
+
+template<UnsignedInt dimensions> Box<dimensions> randomBox(Float size) {
+    return randomTransformation(size, static_cast<typename DimensionTraits<dimensions>::MatrixType*>(nullptr));
+}
+
+template<UnsignedInt dimensions> Sphere<dimensions> randomSphere(Float size) {
+    return {randomVector<dimensions>(size), random() + 0.25f};
+}
+
+template<UnsignedInt dimensions> AxisAlignedBox<dimensions> randomAxisAlignedBox(Float size) {
+    const typename DimensionTraits<dimensions>::VectorType min = randomVector<dimensions>(size);
+    return {min, min + randomVector<dimensions>(2.0f) + typename DimensionTraits<dimensions>::VectorType(0.5f)};
+}
+
+template<UnsignedInt dimensions> Capsule<dimensions> randomCapsule(Float size) {
+    const typename DimensionTraits<dimensions>::VectorType a = randomVector<dimensions>(size);
+    return {a, a + randomVector<dimensions>(2.0f), random()*0.5f + 0.25f};
+}
+
+/* Tests all pairs of given shapes for given hit/miss mix */
+template<class T, class U> void benchmark(const char* name, T(*generateA)(Float), U(*generateB)(Float)) {
+    for(const Float size: {4.0f, 16.0f, 64.0f}) {
+        std::vector<T> a;
+        std::vector<U> b;
+        for(std::size_t i = 0; i != 1000; ++i) {
+            a.push_back(generateA(size));
+            b.push_back(generateB(size));
+        }
+
+        std::size_t collisions = 0;
+        const double time = measure([&]() {
+            collisions = 0;
+            for(const T& first: a) for(const U& second: b)
+                if(first % second) ++collisions;
+        }, 1);
+
+        Debug() << name << "in cube of size" << size << "with" << Float(collisions)*100.0f/(a.size()*b.size())
+                << "% collisions:" << time*1.0e6/(a.size()*b.size()) << "ns per pair";
+    }
+}
+
+}
+
+CollisionBenchmark::CollisionBenchmark() {
+    addTests({&CollisionBenchmark::boxBox,
+              &CollisionBenchmark::boxSphere,
+              &CollisionBenchmark::boxAxisAlignedBox,
+              &CollisionBenchmark::axisAlignedBoxAxisAlignedBox,
+              &CollisionBenchmark::capsuleCapsule});
+}
+
+void CollisionBenchmark::boxBox() {
+    benchmark("Box2D % Box2D", randomBox<2>, randomBox<2>);
+    benchmark("Box3D % Box3D", randomBox<3>, randomBox<3>);
+}
+
+void CollisionBenchmark::boxSphere() {
+    benchmark("Box2D % Sphere2D", randomBox<2>, randomSphere<2>);
+    benchmark("Box3D % Sphere3D", randomBox<3>, randomSphere<3>);
+}
+
+void CollisionBenchmark::boxAxisAlignedBox() {
+    benchmark("Box2D % AxisAlignedBox2D", randomBox<2>, randomAxisAlignedBox<2>);
+    benchmark("Box3D % AxisAlignedBox3D", randomBox<3>, randomAxisAlignedBox<3>);
+}
+
+void CollisionBenchmark::axisAlignedBoxAxisAlignedBox() {
+    benchmark("AxisAlignedBox2D % AxisAlignedBox2D", randomAxisAlignedBox<2>, randomAxisAlignedBox<2>);
+    benchmark("AxisAlignedBox3D % AxisAlignedBox3D", randomAxisAlignedBox<3>, randomAxisAlignedBox<3>);
+}
+
+void CollisionBenchmark::capsuleCapsule() {
+    benchmark("Capsule2D % Capsule2D", randomCapsule<2>, randomCapsule<2>);
+    benchmark("Capsule3D % Capsule3D", randomCapsule<3>, randomCapsule<3>);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shapes::Test::CollisionBenchmark)
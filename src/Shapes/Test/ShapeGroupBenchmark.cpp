@@ -0,0 +1,128 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <cmath>
+#include <memory>
+#include <TestSuite/Tester.h>
+
+#include "Shapes/ShapeGroup.h"
+#include "Shapes/Shape.h"
+#include "Shapes/Sphere.h"
+#include "SceneGraph/MatrixTransformation3D.h"
+#include "SceneGraph/Scene.h"
+#include "Test/Benchmark.h"
+
+namespace Magnum { namespace Shapes { namespace Test {
+
+using Magnum::Test::measure;
+
+class ShapeGroupBenchmark: public TestSuite::Tester {
+    public:
+        explicit ShapeGroupBenchmark();
+
+        void collisionPairs();
+        void collisionPairsMoving();
+};
+
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D<>> Scene3D;
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D<>> Object3D;
+
+namespace {
+
+UnsignedInt seed = 1;
+Float random() {
+    seed = seed*1103515245 + 12345;
+    return Float((seed >> 8)%10000)/10000.0f;
+}
+
+/* Spheres with radius 0.5 randomly scattered in cube of given size */
+void populate(Scene3D& scene, ShapeGroup3D& shapes, std::vector<std::unique_ptr<Object3D>>& objects, const std::size_t count, const Float size) {
+    for(std::size_t i = 0; i != count; ++i) {
+        objects.emplace_back(new Object3D(&scene));
+        objects.back()->translate(Vector3(random(), random(), random())*size);
+        new Shape<Sphere3D>(objects.back().get(), {{}, 0.5f}, &shapes);
+    }
+}
+
+std::size_t linearCollisionPairs(ShapeGroup3D& shapes) {
+    shapes.setClean();
+    std::size_t count = 0;
+    for(std::size_t i = 0; i != shapes.size(); ++i)
+        for(std::size_t j = i+1; j != shapes.size(); ++j)
+            if(shapes[i]->collides(shapes[j])) ++count;
+    return count;
+}
+
+}
+
+ShapeGroupBenchmark::ShapeGroupBenchmark() {
+    addTests({&ShapeGroupBenchmark::collisionPairs,
+              &ShapeGroupBenchmark::collisionPairsMoving});
+}
+
+void ShapeGroupBenchmark::collisionPairs() {
+    for(const std::size_t count: {100, 1000, 5000}) {
+        Scene3D scene;
+        ShapeGroup3D shapes;
+        std::vector<std::unique_ptr<Object3D>> objects;
+        populate(scene, shapes, objects, count, 20.0f*std::cbrt(Float(count)/1000.0f));
+
+        std::size_t linearCount = 0, broadphaseCount = 0;
+        const double linear = measure([&]() {
+            linearCount = linearCollisionPairs(shapes);
+        }, 1);
+        const double broadphase = measure([&]() {
+            broadphaseCount = shapes.collisionPairs().size();
+        }, 10);
+
+        CORRADE_COMPARE(broadphaseCount, linearCount);
+        Debug() << count << "static spheres," << linearCount << "colliding pairs:";
+        Debug() << "  linear:" << linear << "ms, broadphase:" << broadphase << "ms";
+    }
+}
+
+void ShapeGroupBenchmark::collisionPairsMoving() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+    std::vector<std::unique_ptr<Object3D>> objects;
+    populate(scene, shapes, objects, 5000, 34.0f);
+    shapes.setClean();
+
+    /* Every tenth object moves slightly each frame */
+    std::size_t frame = 0;
+    const double time = measure([&]() {
+        for(std::size_t i = frame%10; i < objects.size(); i += 10)
+            objects[i]->translate(Vector3(random() - 0.5f, random() - 0.5f, random() - 0.5f)*0.2f);
+        ++frame;
+
+        shapes.collisionPairs();
+    }, 50);
+
+    Debug() << "5000 spheres, 500 moving each frame:" << time << "ms per frame";
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shapes::Test::ShapeGroupBenchmark)
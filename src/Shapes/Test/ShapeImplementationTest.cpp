@@ -22,9 +22,16 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <limits>
 #include <sstream>
 #include <TestSuite/Tester.h>
 
+#include "Math/Matrix3.h"
+#include "Shapes/AxisAlignedBox.h"
+#include "Shapes/Box.h"
+#include "Shapes/Composition.h"
+#include "Shapes/Line.h"
+#include "Shapes/Sphere.h"
 #include "Shapes/shapeImplementation.h"
 
 namespace Magnum { namespace Shapes { namespace Test {
@@ -34,10 +41,14 @@ class ShapeImplementationTest: public TestSuite::Tester {
         ShapeImplementationTest();
 
         void debug();
+        void bounds();
+        void boundsComposition();
 };
 
 ShapeImplementationTest::ShapeImplementationTest() {
-    addTests({&ShapeImplementationTest::debug});
+    addTests({&ShapeImplementationTest::debug,
+              &ShapeImplementationTest::bounds,
+              &ShapeImplementationTest::boundsComposition});
 }
 
 void ShapeImplementationTest::debug() {
@@ -50,6 +61,37 @@ void ShapeImplementationTest::debug() {
     CORRADE_COMPARE(o.str(), "Shapes::Shape3D::Type::Plane\n");
 }
 
+namespace {
+    constexpr Float inf = std::numeric_limits<Float>::infinity();
+}
+
+void ShapeImplementationTest::bounds() {
+    const Implementation::Bounds<2> sphere = Implementation::shapeBounds(Shapes::Sphere2D({1.0f, -2.0f}, 0.5f));
+    CORRADE_COMPARE(sphere.min, Vector2(0.5f, -2.5f));
+    CORRADE_COMPARE(sphere.max, Vector2(1.5f, -1.5f));
+
+    /* Rotated box has larger bounds */
+    const Implementation::Bounds<2> box = Implementation::shapeBounds(Shapes::Box2D(Matrix3::translation({3.0f, 1.0f})*Matrix3::rotation(Deg(45.0f))));
+    CORRADE_COMPARE(box.min, Vector2(3.0f-Constants::sqrt2(), 1.0f-Constants::sqrt2()));
+    CORRADE_COMPARE(box.max, Vector2(3.0f+Constants::sqrt2(), 1.0f+Constants::sqrt2()));
+
+    const Implementation::Bounds<2> line = Implementation::shapeBounds(Shapes::Line2D({}, {1.0f, 0.0f}));
+    CORRADE_VERIFY(line.min.x() == -inf && line.min.y() == -inf);
+    CORRADE_VERIFY(line.max.x() == inf && line.max.y() == inf);
+}
+
+void ShapeImplementationTest::boundsComposition() {
+    /* Union of all shapes */
+    const Implementation::Bounds<2> a = Implementation::shapeBounds(Shapes::Sphere2D({}, 1.0f) && Shapes::AxisAlignedBox2D({2.0f, 3.0f}, {4.0f, 5.0f}));
+    CORRADE_COMPARE(a.min, Vector2(-1.0f));
+    CORRADE_COMPARE(a.max, Vector2(4.0f, 5.0f));
+
+    /* Complement is unbounded */
+    const Implementation::Bounds<2> b = Implementation::shapeBounds(!Shapes::Sphere2D({}, 1.0f));
+    CORRADE_VERIFY(b.min.x() == -inf && b.min.y() == -inf);
+    CORRADE_VERIFY(b.max.x() == inf && b.max.y() == inf);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Shapes::Test::ShapeImplementationTest)
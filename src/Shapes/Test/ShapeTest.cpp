@@ -22,12 +22,14 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <algorithm>
 #include <TestSuite/Tester.h>
 
 #include "Shapes/ShapeGroup.h"
 #include "Shapes/Shape.h"
 #include "Shapes/Point.h"
 #include "Shapes/Composition.h"
+#include "Shapes/Line.h"
 #include "Shapes/Sphere.h"
 #include "SceneGraph/MatrixTransformation2D.h"
 #include "SceneGraph/MatrixTransformation3D.h"
@@ -41,6 +43,11 @@ class ShapeTest: public TestSuite::Tester {
 
         void clean();
         void firstCollision();
+        void collisions();
+        void collisionPairs();
+        void collisionsUnbounded();
+        void addRemove();
+        void addRemoveBaseClass();
         void shapeGroup();
 };
 
@@ -52,6 +59,11 @@ typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D<>> Object3D;
 ShapeTest::ShapeTest() {
     addTests({&ShapeTest::clean,
               &ShapeTest::firstCollision,
+              &ShapeTest::collisions,
+              &ShapeTest::collisionPairs,
+              &ShapeTest::collisionsUnbounded,
+              &ShapeTest::addRemove,
+              &ShapeTest::addRemoveBaseClass,
               &ShapeTest::shapeGroup});
 }
 
@@ -123,6 +135,171 @@ void ShapeTest::firstCollision() {
     CORRADE_VERIFY(!shapes.isDirty());
 }
 
+void ShapeTest::collisions() {
+    Scene2D scene;
+    ShapeGroup2D shapes;
+
+    Object2D a(&scene);
+    auto aShape = new Shape<Shapes::Sphere2D>(&a, {{}, 1.0f}, &shapes);
+
+    Object2D b(&scene);
+    auto bShape = new Shape<Shapes::Point2D>(&b, {{0.5f, 0.0f}}, &shapes);
+
+    Object2D c(&scene);
+    auto cShape = new Shape<Shapes::Point2D>(&c, {{-0.5f, 0.0f}}, &shapes);
+
+    Object2D d(&scene);
+    new Shape<Shapes::Point2D>(&d, {{5.0f, 0.0f}}, &shapes);
+
+    std::vector<AbstractShape2D*> collisions = shapes.collisions(aShape);
+    std::sort(collisions.begin(), collisions.end());
+    std::vector<AbstractShape2D*> expected{bShape, cShape};
+    std::sort(expected.begin(), expected.end());
+    CORRADE_VERIFY(collisions == expected);
+
+    /* Move the objects far away */
+    b.translate(Vector2::xAxis(100.0f));
+    c.translate(Vector2::yAxis(100.0f));
+    CORRADE_VERIFY(shapes.collisions(aShape).empty());
+
+    /* Move the sphere after one of them */
+    a.translate(Vector2::yAxis(100.0f));
+    CORRADE_VERIFY(shapes.collisions(aShape) == std::vector<AbstractShape2D*>{cShape});
+    CORRADE_VERIFY(shapes.firstCollision(cShape) == aShape);
+    CORRADE_VERIFY(!shapes.firstCollision(bShape));
+}
+
+void ShapeTest::collisionPairs() {
+    Scene2D scene;
+    ShapeGroup2D shapes;
+
+    Object2D a(&scene);
+    auto aShape = new Shape<Shapes::Sphere2D>(&a, {{}, 1.0f}, &shapes);
+
+    Object2D b(&scene);
+    auto bShape = new Shape<Shapes::Point2D>(&b, {{0.5f, 0.0f}}, &shapes);
+
+    Object2D c(&scene);
+    new Shape<Shapes::Point2D>(&c, {{5.0f, 0.0f}}, &shapes);
+
+    auto pairs = shapes.collisionPairs();
+    CORRADE_COMPARE(pairs.size(), 1);
+    CORRADE_VERIFY((pairs[0] == std::make_pair<AbstractShape2D*, AbstractShape2D*>(aShape, bShape) ||
+                    pairs[0] == std::make_pair<AbstractShape2D*, AbstractShape2D*>(bShape, aShape)));
+
+    /* Move the point out of the sphere */
+    b.translate(Vector2::xAxis(2.0f));
+    CORRADE_VERIFY(shapes.collisionPairs().empty());
+}
+
+void ShapeTest::collisionsUnbounded() {
+    Scene2D scene;
+    ShapeGroup2D shapes;
+
+    /* Line is unbounded, thus always tested */
+    Object2D a(&scene);
+    auto aShape = new Shape<Shapes::Line2D>(&a, {{}, Vector2::xAxis()}, &shapes);
+
+    Object2D b(&scene);
+    auto bShape = new Shape<Shapes::Sphere2D>(&b, {{1000.0f, 0.0f}, 1.0f}, &shapes);
+
+    Object2D c(&scene);
+    new Shape<Shapes::Sphere2D>(&c, {{0.0f, 1000.0f}, 1.0f}, &shapes);
+
+    CORRADE_VERIFY(shapes.firstCollision(bShape) == aShape);
+    CORRADE_VERIFY(shapes.collisions(aShape) == std::vector<AbstractShape2D*>{bShape});
+
+    auto pairs = shapes.collisionPairs();
+    CORRADE_COMPARE(pairs.size(), 1);
+    CORRADE_VERIFY((pairs[0] == std::make_pair<AbstractShape2D*, AbstractShape2D*>(aShape, bShape)));
+
+    /* Moving the line away */
+    a.translate(Vector2::yAxis(10.0f));
+    CORRADE_VERIFY(!shapes.firstCollision(bShape));
+    CORRADE_VERIFY(shapes.collisionPairs().empty());
+}
+
+void ShapeTest::addRemove() {
+    Scene2D scene;
+    ShapeGroup2D shapes, other;
+
+    Object2D a(&scene);
+    auto aShape = new Shape<Shapes::Sphere2D>(&a, {{}, 1.0f}, &shapes);
+
+    Object2D b(&scene);
+    auto bShape = new Shape<Shapes::Point2D>(&b, {{0.5f, 0.0f}}, &shapes);
+
+    CORRADE_VERIFY(shapes.firstCollision(aShape) == bShape);
+
+    /* Moving to other group */
+    other.add(bShape);
+    CORRADE_COMPARE(shapes.size(), 1);
+    CORRADE_VERIFY(!shapes.firstCollision(aShape));
+    CORRADE_VERIFY(!other.firstCollision(bShape));
+
+    /* And back */
+    other.remove(bShape);
+    shapes.add(bShape);
+    CORRADE_VERIFY(shapes.firstCollision(aShape) == bShape);
+
+    /* Destroying the shape removes it from the group */
+    {
+        Object2D c(&scene);
+        auto cShape = new Shape<Shapes::Point2D>(&c, {{-0.5f, 0.0f}}, &shapes);
+        CORRADE_COMPARE(shapes.collisions(aShape).size(), 2);
+        CORRADE_VERIFY(shapes.firstCollision(cShape) == aShape);
+    }
+    CORRADE_COMPARE(shapes.size(), 2);
+    CORRADE_VERIFY(shapes.collisions(aShape) == std::vector<AbstractShape2D*>{bShape});
+
+    /* Destroying dirty shape */
+    {
+        Object2D c(&scene);
+        new Shape<Shapes::Point2D>(&c, {{-0.5f, 0.0f}}, &shapes);
+        CORRADE_VERIFY(shapes.isDirty());
+    }
+    CORRADE_VERIFY(shapes.collisions(aShape) == std::vector<AbstractShape2D*>{bShape});
+}
+
+void ShapeTest::addRemoveBaseClass() {
+    Scene2D scene;
+    ShapeGroup2D shapes, other;
+
+    Object2D a(&scene);
+    auto aShape = new Shape<Shapes::Sphere2D>(&a, {{}, 1.0f}, &shapes);
+
+    Object2D b(&scene);
+    auto bShape = new Shape<Shapes::Point2D>(&b, {{0.5f, 0.0f}}, &shapes);
+
+    Object2D c(&scene);
+    auto cShape = new Shape<Shapes::Sphere2D>(&c, {{1.0f, 0.0f}, 1.0f}, &other);
+
+    /* Both groups have their shapes in the broadphase */
+    CORRADE_VERIFY(shapes.firstCollision(aShape) == bShape);
+    CORRADE_VERIFY(other.collisionPairs().empty());
+
+    /* Moving through the base class removes the shape from broadphase of
+       the old group and inserts it into the new one */
+    SceneGraph::FeatureGroup<2, AbstractShape2D>& otherBase = other;
+    otherBase.add(bShape);
+    CORRADE_VERIFY(bShape->group() == &other);
+    CORRADE_VERIFY(!shapes.firstCollision(aShape));
+    CORRADE_VERIFY(shapes.collisionPairs().empty());
+    CORRADE_VERIFY(other.firstCollision(bShape) == cShape);
+    CORRADE_COMPARE(other.collisionPairs().size(), 1);
+
+    /* Removing through the base class */
+    otherBase.remove(bShape);
+    CORRADE_VERIFY(!bShape->group());
+    CORRADE_VERIFY(!other.firstCollision(cShape));
+    CORRADE_VERIFY(other.collisionPairs().empty());
+
+    /* And adding back */
+    SceneGraph::FeatureGroup<2, AbstractShape2D>& shapesBase = shapes;
+    shapesBase.add(bShape);
+    CORRADE_VERIFY(shapes.firstCollision(aShape) == bShape);
+}
+
 void ShapeTest::shapeGroup() {
     Scene2D scene;
     ShapeGroup2D shapes;
@@ -24,8 +24,19 @@
 
 #include "shapeImplementation.h"
 
+#include <limits>
 #include <Utility/Debug.h>
 
+#include "Math/Functions.h"
+#include "Shapes/AxisAlignedBox.h"
+#include "Shapes/Box.h"
+#include "Shapes/Capsule.h"
+#include "Shapes/Composition.h"
+#include "Shapes/LineSegment.h"
+#include "Shapes/Plane.h"
+#include "Shapes/Point.h"
+#include "Shapes/Sphere.h"
+
 namespace Magnum { namespace Shapes { namespace Implementation {
 
 Debug operator<<(Debug debug, ShapeDimensionTraits<2>::Type value) {
@@ -63,6 +74,89 @@ Debug operator<<(Debug debug, ShapeDimensionTraits<3>::Type value) {
     return debug << "Shapes::Shape3D::Type::(unknown)";
 }
 
+namespace {
+    template<UnsignedInt dimensions> inline Bounds<dimensions> infiniteBounds() {
+        return {typename DimensionTraits<dimensions>::VectorType(-std::numeric_limits<Float>::infinity()),
+                typename DimensionTraits<dimensions>::VectorType(std::numeric_limits<Float>::infinity())};
+    }
+}
+
+template<UnsignedInt dimensions> Bounds<dimensions> shapeBounds(const Shapes::Point<dimensions>& shape) {
+    return {shape.position(), shape.position()};
+}
+
+template<UnsignedInt dimensions> Bounds<dimensions> shapeBounds(const Shapes::Line<dimensions>&) {
+    return infiniteBounds<dimensions>();
+}
+
+template<UnsignedInt dimensions> Bounds<dimensions> shapeBounds(const Shapes::LineSegment<dimensions>& shape) {
+    return {Math::min(shape.a(), shape.b()), Math::max(shape.a(), shape.b())};
+}
+
+template<UnsignedInt dimensions> Bounds<dimensions> shapeBounds(const Shapes::Sphere<dimensions>& shape) {
+    return {shape.position() - typename DimensionTraits<dimensions>::VectorType(shape.radius()),
+            shape.position() + typename DimensionTraits<dimensions>::VectorType(shape.radius())};
+}
+
+template<UnsignedInt dimensions> Bounds<dimensions> shapeBounds(const Shapes::Capsule<dimensions>& shape) {
+    return {Math::min(shape.a(), shape.b()) - typename DimensionTraits<dimensions>::VectorType(shape.radius()),
+            Math::max(shape.a(), shape.b()) + typename DimensionTraits<dimensions>::VectorType(shape.radius())};
+}
+
+template<UnsignedInt dimensions> Bounds<dimensions> shapeBounds(const Shapes::AxisAlignedBox<dimensions>& shape) {
+    return {shape.min(), shape.max()};
+}
+
+template<UnsignedInt dimensions> Bounds<dimensions> shapeBounds(const Shapes::Box<dimensions>& shape) {
+    /* Half extent in each axis is sum of absolute values of all basis vectors
+       in that axis */
+    typename DimensionTraits<dimensions>::VectorType halfExtent;
+    for(UnsignedInt i = 0; i != dimensions; ++i)
+        for(UnsignedInt j = 0; j != dimensions; ++j)
+            halfExtent[i] += std::abs(shape.transformation()[j][i]);
+
+    const typename DimensionTraits<dimensions>::VectorType center = shape.transformation().translation();
+    return {center - halfExtent, center + halfExtent};
+}
+
+template<UnsignedInt dimensions> Bounds<dimensions> shapeBounds(const Shapes::Composition<dimensions>& shape) {
+    /* Complement of a shape is unbounded */
+    for(std::size_t i = 0; i != shape._nodeCount; ++i)
+        if(shape._nodes[i].operation == CompositionOperation::Not)
+            return infiniteBounds<dimensions>();
+
+    /* Union of all shapes is conservative for both AND and OR */
+    Bounds<dimensions> bounds{typename DimensionTraits<dimensions>::VectorType(std::numeric_limits<Float>::infinity()),
+                              typename DimensionTraits<dimensions>::VectorType(-std::numeric_limits<Float>::infinity())};
+    for(std::size_t i = 0; i != shape._shapeCount; ++i) {
+        const Bounds<dimensions> shapeBounds = shape._shapes[i]->bounds();
+        bounds.min = Math::min(bounds.min, shapeBounds.min);
+        bounds.max = Math::max(bounds.max, shapeBounds.max);
+    }
+    return bounds;
+}
+
+Bounds<3> shapeBounds(const Shapes::Plane&) {
+    return infiniteBounds<3>();
+}
+
+template Bounds<2> MAGNUM_SHAPES_EXPORT shapeBounds(const Shapes::Point<2>&);
+template Bounds<3> MAGNUM_SHAPES_EXPORT shapeBounds(const Shapes::Point<3>&);
+template Bounds<2> MAGNUM_SHAPES_EXPORT shapeBounds(const Shapes::Line<2>&);
+template Bounds<3> MAGNUM_SHAPES_EXPORT shapeBounds(const Shapes::Line<3>&);
+template Bounds<2> MAGNUM_SHAPES_EXPORT shapeBounds(const Shapes::LineSegment<2>&);
+template Bounds<3> MAGNUM_SHAPES_EXPORT shapeBounds(const Shapes::LineSegment<3>&);
+template Bounds<2> MAGNUM_SHAPES_EXPORT shapeBounds(const Shapes::Sphere<2>&);
+template Bounds<3> MAGNUM_SHAPES_EXPORT shapeBounds(const Shapes::Sphere<3>&);
+template Bounds<2> MAGNUM_SHAPES_EXPORT shapeBounds(const Shapes::Capsule<2>&);
+template Bounds<3> MAGNUM_SHAPES_EXPORT shapeBounds(const Shapes::Capsule<3>&);
+template Bounds<2> MAGNUM_SHAPES_EXPORT shapeBounds(const Shapes::AxisAlignedBox<2>&);
+template Bounds<3> MAGNUM_SHAPES_EXPORT shapeBounds(const Shapes::AxisAlignedBox<3>&);
+template Bounds<2> MAGNUM_SHAPES_EXPORT shapeBounds(const Shapes::Box<2>&);
+template Bounds<3> MAGNUM_SHAPES_EXPORT shapeBounds(const Shapes::Box<3>&);
+template Bounds<2> MAGNUM_SHAPES_EXPORT shapeBounds(const Shapes::Composition<2>&);
+template Bounds<3> MAGNUM_SHAPES_EXPORT shapeBounds(const Shapes::Composition<3>&);
+
 template<UnsignedInt dimensions> AbstractShape<dimensions>::~AbstractShape() = default;
 template<UnsignedInt dimensions> AbstractShape<dimensions>::AbstractShape() = default;
 
@@ -27,6 +27,7 @@
 #include <utility>
 #include <Utility/Assert.h>
 
+#include "Math/Vector3.h"
 #include "DimensionTraits.h"
 #include "Magnum.h"
 #include "Shapes/Shapes.h"
@@ -118,6 +119,22 @@ template<UnsignedInt dimensions> struct TypeOf<Shapes::Composition<dimensions>>
     }
 };
 
+/* Axis-aligned bounds of a shape. Unbounded shapes have infinite bounds,
+   empty shapes have min larger than max. */
+template<UnsignedInt dimensions> struct Bounds {
+    typename DimensionTraits<dimensions>::VectorType min, max;
+};
+
+template<UnsignedInt dimensions> Bounds<dimensions> MAGNUM_SHAPES_EXPORT shapeBounds(const Shapes::Point<dimensions>& shape);
+template<UnsignedInt dimensions> Bounds<dimensions> MAGNUM_SHAPES_EXPORT shapeBounds(const Shapes::Line<dimensions>& shape);
+template<UnsignedInt dimensions> Bounds<dimensions> MAGNUM_SHAPES_EXPORT shapeBounds(const Shapes::LineSegment<dimensions>& shape);
+template<UnsignedInt dimensions> Bounds<dimensions> MAGNUM_SHAPES_EXPORT shapeBounds(const Shapes::Sphere<dimensions>& shape);
+template<UnsignedInt dimensions> Bounds<dimensions> MAGNUM_SHAPES_EXPORT shapeBounds(const Shapes::Capsule<dimensions>& shape);
+template<UnsignedInt dimensions> Bounds<dimensions> MAGNUM_SHAPES_EXPORT shapeBounds(const Shapes::AxisAlignedBox<dimensions>& shape);
+template<UnsignedInt dimensions> Bounds<dimensions> MAGNUM_SHAPES_EXPORT shapeBounds(const Shapes::Box<dimensions>& shape);
+template<UnsignedInt dimensions> Bounds<dimensions> MAGNUM_SHAPES_EXPORT shapeBounds(const Shapes::Composition<dimensions>& shape);
+Bounds<3> MAGNUM_SHAPES_EXPORT shapeBounds(const Shapes::Plane& shape);
+
 /* Polymorphic shape wrappers */
 
 template<UnsignedInt dimensions> struct MAGNUM_SHAPES_EXPORT AbstractShape {
@@ -125,6 +142,7 @@ template<UnsignedInt dimensions> struct MAGNUM_SHAPES_EXPORT AbstractShape {
     virtual ~AbstractShape();
 
     virtual typename ShapeDimensionTraits<dimensions>::Type MAGNUM_SHAPES_LOCAL type() const = 0;
+    virtual Bounds<dimensions> MAGNUM_SHAPES_LOCAL bounds() const = 0;
     virtual AbstractShape<dimensions> MAGNUM_SHAPES_LOCAL * clone() const = 0;
     virtual void MAGNUM_SHAPES_LOCAL transform(const typename DimensionTraits<dimensions>::MatrixType& matrix, AbstractShape<dimensions>* result) const = 0;
 };
@@ -140,6 +158,10 @@ template<class T> struct Shape: AbstractShape<T::Dimensions> {
         return TypeOf<T>::type();
     }
 
+    Bounds<T::Dimensions> bounds() const override {
+        return shapeBounds(shape);
+    }
+
     AbstractShape<T::Dimensions>* clone() const override {
         return new Shape<T>(shape);
     }
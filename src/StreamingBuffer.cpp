@@ -0,0 +1,90 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "StreamingBuffer.h"
+
+#include <cstring>
+#include <Utility/Assert.h>
+
+#include "Context.h"
+#include "Extensions.h"
+
+namespace Magnum {
+
+StreamingBuffer::StreamingBuffer(const GLsizeiptr segmentSize, const UnsignedInt segmentCount, const Buffer::Target targetHint): _buffer(targetHint), allocator(segmentSize, segmentCount), mapFlags(Buffer::MapFlag::Write|Buffer::MapFlag::InvalidateRange), _stallCount(0) {
+    CORRADE_ASSERT(segmentCount, "StreamingBuffer: at least one segment is needed", );
+
+    _buffer.setData(segmentSize*segmentCount, nullptr, Buffer::Usage::StreamDraw);
+
+    /* Without fences let the driver synchronize the mapping */
+    #ifndef MAGNUM_TARGET_GLES2
+    #ifndef MAGNUM_TARGET_GLES
+    if(Context::current()->isExtensionSupported<Extensions::GL::ARB::sync>())
+    #endif
+    {
+        fences.resize(segmentCount);
+        mapFlags |= Buffer::MapFlag::Unsynchronized;
+    }
+    #endif
+}
+
+void StreamingBuffer::beginFrame() {
+    #ifndef MAGNUM_TARGET_GLES2
+    if(fences.empty()) return;
+
+    Fence& fence = fences[allocator.segment()];
+    if(fence.isSignaled()) return;
+
+    ++_stallCount;
+    Fence::Status status;
+    do status = fence.wait(1000000000ull);
+    while(status == Fence::Status::TimeoutExpired);
+    #endif
+}
+
+void* StreamingBuffer::map(const GLintptr offset, const GLsizeiptr size) {
+    CORRADE_ASSERT(offset >= GLintptr(allocator.segment()*allocator.segmentSize) && offset + size <= GLintptr((allocator.segment() + 1)*allocator.segmentSize),
+        "StreamingBuffer::map(): the range is outside current segment", nullptr);
+
+    return _buffer.map(offset, size, mapFlags);
+}
+
+GLintptr StreamingBuffer::upload(const void* const data, const GLsizeiptr size, const GLsizeiptr alignment) {
+    const GLintptr offset = allocator.allocate(size, alignment);
+    if(offset == -1 || !size) return offset;
+
+    std::memcpy(map(offset, size), data, size);
+    CORRADE_INTERNAL_ASSERT_OUTPUT(unmap());
+    return offset;
+}
+
+void StreamingBuffer::endFrame() {
+    #ifndef MAGNUM_TARGET_GLES2
+    if(!fences.empty()) fences[allocator.segment()].insert();
+    #endif
+
+    allocator.next();
+}
+
+}
@@ -0,0 +1,249 @@
+#ifndef Magnum_StreamingBuffer_h
+#define Magnum_StreamingBuffer_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class Magnum::StreamingBuffer
+ */
+
+#include <vector>
+#include <Utility/Assert.h>
+
+#include "Buffer.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+#include "Fence.h"
+#endif
+
+namespace Magnum {
+
+namespace Implementation {
+
+    /* CPU-side bookkeeping of StreamingBuffer: the buffer is divided into
+       equally sized segments, each frame allocates from one segment and the
+       segments are reused in round-robin fashion */
+    class StreamingBufferAllocator {
+        public:
+            explicit StreamingBufferAllocator(GLsizeiptr segmentSize, UnsignedInt segmentCount): segmentSize(segmentSize), segmentCount(segmentCount), _segment(0), _used(0) {}
+
+            /* Current segment and count of bytes used in it */
+            UnsignedInt segment() const { return _segment; }
+            GLsizeiptr used() const { return _used; }
+
+            /* Allocates aligned range in current segment, returns its
+               absolute offset in the buffer or -1 if it doesn't fit */
+            GLintptr allocate(GLsizeiptr size, GLsizeiptr alignment) {
+                CORRADE_ASSERT(alignment > 0 && !(alignment & (alignment - 1)),
+                    "StreamingBuffer::allocate(): alignment must be a non-zero power of two", -1);
+
+                const GLintptr begin = _segment*segmentSize;
+                const GLintptr offset = (begin + _used + alignment - 1)/alignment*alignment;
+                if(offset + size > begin + segmentSize) return -1;
+
+                _used = offset + size - begin;
+                return offset;
+            }
+
+            /* Advances to next segment */
+            void next() {
+                _segment = (_segment + 1) % segmentCount;
+                _used = 0;
+            }
+
+            const GLsizeiptr segmentSize;
+            const UnsignedInt segmentCount;
+
+        private:
+            UnsignedInt _segment;
+            GLsizeiptr _used;
+    };
+}
+
+/**
+@brief Streaming buffer
+
+Buffer for data rewritten every frame, such as particles, text or debug
+lines. Rewriting whole buffer with Buffer::setData() or mapping it without
+synchronization flags stalls the pipeline if the GPU is still reading the
+previous contents. This class instead divides the buffer into ring of
+segments, each frame writes only into one segment and the segment is reused
+only after the GPU finished all commands issued in the frame which used it.
+
+@section StreamingBuffer-usage Usage
+
+Call beginFrame() before first upload in the frame and endFrame() after
+last draw call using the data. Between them, upload the data with upload() or
+allocate() and map(), and use returned offset when configuring the mesh:
+@code
+StreamingBuffer buffer(1024*1024);
+
+// Each frame
+buffer.beginFrame();
+GLintptr offset = buffer.upload(particlePositions);
+Mesh mesh(Mesh::Primitive::Points);
+mesh.setVertexCount(particlePositions.size())
+    ->addVertexBuffer(buffer.buffer(), offset, Shader::Position());
+mesh.draw();
+buffer.endFrame();
+@endcode
+
+If the data don't fit into the segment, upload() and allocate() return `-1`.
+Segment size should be thus chosen large enough for all data uploaded in one
+frame.
+
+@section StreamingBuffer-performance Performance optimizations
+
+The memory is mapped using @ref Buffer::MapFlag "Buffer::MapFlag::Unsynchronized"
+and @ref Buffer::MapFlag "Buffer::MapFlag::InvalidateRange", so the driver
+doesn't wait for the GPU nor copies the previous contents. Reuse of each
+segment is guarded with a Fence, inserted in endFrame() and waited for in
+beginFrame(), which blocks only if the GPU is more than segmentCount() frames
+behind. Count of such blocking waits can be queried with stallCount().
+
+If @extension{ARB,sync} (part of OpenGL 3.2) is not available or on OpenGL ES
+2.0, the mapping is synchronized by the driver instead, which may stall.
+
+@requires_gl30 %Extension @extension{ARB,map_buffer_range}
+@requires_gles30 %Extension @es_extension{EXT,map_buffer_range}
+*/
+class MAGNUM_EXPORT StreamingBuffer {
+    StreamingBuffer(const StreamingBuffer&) = delete;
+    StreamingBuffer& operator=(const StreamingBuffer&) = delete;
+
+    public:
+        /**
+         * @brief Constructor
+         * @param segmentSize   Size of one segment in bytes
+         * @param segmentCount  Count of segments. Should be larger than
+         *      count of frames the GPU can be behind the CPU.
+         * @param targetHint    Target hint for the buffer
+         *
+         * Allocates buffer storage for all segments.
+         * @see Buffer::setData()
+         */
+        explicit StreamingBuffer(GLsizeiptr segmentSize, UnsignedInt segmentCount = 3, Buffer::Target targetHint = Buffer::Target::Array);
+
+        /** @brief Underlying buffer */
+        Buffer* buffer() { return &_buffer; }
+
+        /** @brief Size of one segment in bytes */
+        GLsizeiptr segmentSize() const { return allocator.segmentSize; }
+
+        /** @brief Count of segments */
+        UnsignedInt segmentCount() const { return allocator.segmentCount; }
+
+        /** @brief Segment used in current frame */
+        UnsignedInt segment() const { return allocator.segment(); }
+
+        /** @brief Count of bytes used in current segment */
+        GLsizeiptr used() const { return allocator.used(); }
+
+        /**
+         * @brief Count of blocking waits in beginFrame()
+         *
+         * Non-zero value means the GPU is lagging behind and more segments
+         * are needed.
+         */
+        UnsignedInt stallCount() const { return _stallCount; }
+
+        /**
+         * @brief Begin frame
+         *
+         * Waits until the GPU finished commands of the frame which used
+         * current segment previously.
+         * @see Fence::wait()
+         */
+        void beginFrame();
+
+        /**
+         * @brief Allocate memory in current segment
+         * @param size      Size in bytes
+         * @param alignment Alignment of returned offset, must be non-zero
+         *      power of two
+         * @return Offset into the buffer or `-1` if there is not enough
+         *      space in current segment
+         */
+        GLintptr allocate(GLsizeiptr size, GLsizeiptr alignment = 4) {
+            return allocator.allocate(size, alignment);
+        }
+
+        /**
+         * @brief Map allocated memory
+         * @param offset    Offset returned by allocate()
+         * @param size      Size of the memory
+         *
+         * Call unmap() after writing the data.
+         * @see @ref StreamingBuffer-performance "Performance optimizations",
+         *      Buffer::map(GLintptr, GLsizeiptr, Buffer::MapFlags)
+         */
+        void* map(GLintptr offset, GLsizeiptr size);
+
+        /**
+         * @brief Unmap memory
+         *
+         * @see Buffer::unmap()
+         */
+        bool unmap() { return _buffer.unmap(); }
+
+        /**
+         * @brief Upload data
+         * @param data      Data
+         * @param size      Data size in bytes
+         * @param alignment Alignment of returned offset, must be non-zero
+         *      power of two
+         * @return Offset of the data in the buffer or `-1` if there is not
+         *      enough space in current segment
+         *
+         * Allocates the memory, maps it, copies the data and unmaps it.
+         */
+        GLintptr upload(const void* data, GLsizeiptr size, GLsizeiptr alignment = 4);
+
+        /** @overload */
+        template<class T> GLintptr upload(const std::vector<T>& data, GLsizeiptr alignment = 4) {
+            return upload(data.data(), data.size()*sizeof(T), alignment);
+        }
+
+        /**
+         * @brief End frame
+         *
+         * Inserts fence guarding current segment and advances to next
+         * segment.
+         * @see Fence::insert()
+         */
+        void endFrame();
+
+    private:
+        Buffer _buffer;
+        Implementation::StreamingBufferAllocator allocator;
+        #ifndef MAGNUM_TARGET_GLES2
+        std::vector<Fence> fences;
+        #endif
+        Buffer::MapFlags mapFlags;
+        UnsignedInt _stallCount;
+};
+
+}
+
+#endif
@@ -0,0 +1,148 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <TestSuite/Tester.h>
+
+#include "BufferImageQueue.h"
+
+namespace Magnum { namespace Test {
+
+class BufferImageQueueTest: public TestSuite::Tester {
+    public:
+        BufferImageQueueTest();
+
+        void acquire();
+        void full();
+        void release();
+        void inOrder();
+        void wraparound();
+};
+
+BufferImageQueueTest::BufferImageQueueTest() {
+    addTests({&BufferImageQueueTest::acquire,
+              &BufferImageQueueTest::full,
+              &BufferImageQueueTest::release,
+              &BufferImageQueueTest::inOrder,
+              &BufferImageQueueTest::wraparound});
+}
+
+void BufferImageQueueTest::acquire() {
+    Implementation::BufferImageQueueSlots slots(3);
+    CORRADE_COMPARE(slots.capacity(), 3);
+    CORRADE_COMPARE(slots.freeCount(), 3);
+    CORRADE_COMPARE(slots.front(), -1);
+
+    CORRADE_COMPARE(slots.acquire(), 0);
+    CORRADE_COMPARE(slots.acquire(), 1);
+    CORRADE_VERIFY(slots.isAcquired(0));
+    CORRADE_VERIFY(slots.isAcquired(1));
+    CORRADE_VERIFY(!slots.isAcquired(2));
+    CORRADE_VERIFY(!slots.isAcquired(3));
+    CORRADE_COMPARE(slots.freeCount(), 1);
+
+    /* Submitted slot is no longer acquired */
+    slots.submit(1);
+    CORRADE_VERIFY(!slots.isAcquired(1));
+    CORRADE_COMPARE(slots.pendingCount(), 1);
+    CORRADE_COMPARE(slots.front(), 1);
+}
+
+void BufferImageQueueTest::full() {
+    Implementation::BufferImageQueueSlots slots(2);
+    slots.submit(slots.acquire());
+    slots.acquire();
+
+    /* Both slots are either pending or acquired */
+    CORRADE_COMPARE(slots.freeCount(), 0);
+    CORRADE_COMPARE(slots.acquire(), -1);
+    CORRADE_COMPARE(slots.acquire(), -1);
+
+    /* Completed slot is acquired by the caller until released */
+    CORRADE_COMPARE(slots.complete(), 0);
+    CORRADE_VERIFY(slots.isAcquired(0));
+    CORRADE_COMPARE(slots.acquire(), -1);
+    slots.release(0);
+    CORRADE_COMPARE(slots.acquire(), 0);
+}
+
+void BufferImageQueueTest::release() {
+    Implementation::BufferImageQueueSlots slots(2);
+    CORRADE_COMPARE(slots.acquire(), 0);
+    slots.release(0);
+    CORRADE_VERIFY(!slots.isAcquired(0));
+    CORRADE_COMPARE(slots.freeCount(), 2);
+    CORRADE_COMPARE(slots.pendingCount(), 0);
+
+    /* Released slot is reused after the other free ones */
+    CORRADE_COMPARE(slots.acquire(), 1);
+    CORRADE_COMPARE(slots.acquire(), 0);
+}
+
+void BufferImageQueueTest::inOrder() {
+    Implementation::BufferImageQueueSlots slots(3);
+    const Int a = slots.acquire();
+    const Int b = slots.acquire();
+    const Int c = slots.acquire();
+
+    /* Slots are completed in submission order, not in acquisition order */
+    slots.submit(c);
+    slots.submit(a);
+    slots.submit(b);
+    CORRADE_COMPARE(slots.pendingCount(), 3);
+    CORRADE_COMPARE(slots.front(), c);
+    CORRADE_COMPARE(slots.complete(), c);
+    CORRADE_COMPARE(slots.front(), a);
+    CORRADE_COMPARE(slots.complete(), a);
+    CORRADE_COMPARE(slots.complete(), b);
+    CORRADE_COMPARE(slots.front(), -1);
+    CORRADE_COMPARE(slots.pendingCount(), 0);
+}
+
+void BufferImageQueueTest::wraparound() {
+    Implementation::BufferImageQueueSlots slots(3);
+
+    /* Keep two transfers in flight for ten frames, the slots are reused in
+       round-robin fashion and completed in submission order */
+    Int expected = 0;
+    for(Int frame = 0; frame != 10; ++frame) {
+        const Int slot = slots.acquire();
+        CORRADE_COMPARE(slot, frame % 3);
+        slots.submit(slot);
+
+        if(slots.pendingCount() == 2) {
+            CORRADE_COMPARE(slots.front(), expected);
+            const UnsignedInt completed = slots.complete();
+            CORRADE_COMPARE(completed, expected);
+            slots.release(completed);
+            expected = (expected + 1) % 3;
+        }
+
+        CORRADE_COMPARE(slots.pendingCount(), 1);
+        CORRADE_COMPARE(slots.freeCount(), 2);
+    }
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::BufferImageQueueTest)
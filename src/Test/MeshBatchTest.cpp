@@ -0,0 +1,112 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <TestSuite/Tester.h>
+
+#include "MeshBatch.h"
+
+namespace Magnum { namespace Test {
+
+class MeshBatchTest: public TestSuite::Tester {
+    public:
+        MeshBatchTest();
+
+        void allocate();
+        void allocateNonIndexed();
+        void mixedIndexed();
+        void clear();
+};
+
+MeshBatchTest::MeshBatchTest() {
+    addTests({&MeshBatchTest::allocate,
+              &MeshBatchTest::allocateNonIndexed,
+              &MeshBatchTest::mixedIndexed,
+              &MeshBatchTest::clear});
+}
+
+void MeshBatchTest::allocate() {
+    /* Allocation doesn't touch the mesh */
+    MeshBatch batch(nullptr);
+    CORRADE_VERIFY(batch.isEmpty());
+
+    CORRADE_COMPARE(batch.add(4, 6), 0);
+    CORRADE_COMPARE(batch.add(3, 3), 1);
+    CORRADE_COMPARE(batch.add(24, 36), 2);
+
+    CORRADE_COMPARE(batch.size(), 3);
+    CORRADE_COMPARE(batch.vertexCount(), 31);
+    CORRADE_COMPARE(batch.indexCount(), 45);
+
+    CORRADE_COMPARE(batch.vertexOffset(0), 0);
+    CORRADE_COMPARE(batch.vertexOffset(1), 4);
+    CORRADE_COMPARE(batch.vertexOffset(2), 7);
+    CORRADE_COMPARE(batch.indexOffset(0), 0);
+    CORRADE_COMPARE(batch.indexOffset(1), 6);
+    CORRADE_COMPARE(batch.indexOffset(2), 9);
+
+    /* No context, thus no base vertex support */
+    CORRADE_COMPARE(batch.indexBias(2), 7);
+}
+
+void MeshBatchTest::allocateNonIndexed() {
+    MeshBatch batch(nullptr);
+    batch.add(3);
+    batch.add(5);
+
+    CORRADE_COMPARE(batch.vertexCount(), 8);
+    CORRADE_COMPARE(batch.indexCount(), 0);
+    CORRADE_COMPARE(batch.vertexOffset(1), 3);
+    CORRADE_COMPARE(batch.indexOffset(1), 0);
+}
+
+void MeshBatchTest::mixedIndexed() {
+    std::ostringstream o;
+    Error::setOutput(&o);
+
+    MeshBatch batch(nullptr);
+    batch.add(3, 3);
+    CORRADE_COMPARE(batch.add(3), 0);
+    CORRADE_COMPARE(batch.size(), 1);
+    CORRADE_COMPARE(o.str(), "MeshBatch::add(): either all meshes must be indexed or none\n");
+}
+
+void MeshBatchTest::clear() {
+    MeshBatch batch(nullptr);
+    batch.add(4, 6);
+    batch.add(3, 3);
+    batch.clear();
+
+    CORRADE_VERIFY(batch.isEmpty());
+    CORRADE_COMPARE(batch.vertexCount(), 0);
+    CORRADE_COMPARE(batch.indexCount(), 0);
+
+    /* Non-indexed mesh can be added after clear */
+    CORRADE_COMPARE(batch.add(3), 0);
+    CORRADE_COMPARE(batch.vertexOffset(0), 0);
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::MeshBatchTest)
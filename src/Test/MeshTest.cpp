@@ -26,6 +26,7 @@
 #include <TestSuite/Tester.h>
 #include <Utility/Configuration.h>
 
+#include "Math/Matrix4.h"
 #include "Mesh.h"
 
 namespace Magnum { namespace Test {
@@ -38,13 +39,22 @@ class MeshTest: public TestSuite::Tester {
         void debugIndexType();
         void configurationPrimitive();
         void configurationIndexType();
+
+        void matrixAttributeColumns();
+        void matrixAttributeColumnsInterleaved();
 };
 
+namespace {
+    typedef AbstractShaderProgram::Attribute<3, Matrix4> Transformation;
+}
+
 MeshTest::MeshTest() {
     addTests({&MeshTest::debugPrimitive,
               &MeshTest::debugIndexType,
               &MeshTest::configurationPrimitive,
-              &MeshTest::configurationIndexType});
+              &MeshTest::configurationIndexType,
+              &MeshTest::matrixAttributeColumns,
+              &MeshTest::matrixAttributeColumnsInterleaved});
 }
 
 void MeshTest::debugPrimitive() {
@@ -75,6 +85,30 @@ void MeshTest::configurationIndexType() {
     CORRADE_COMPARE(c.value<Mesh::IndexType>("type"), Mesh::IndexType::UnsignedByte);
 }
 
+void MeshTest::matrixAttributeColumns() {
+    Transformation attribute;
+    CORRADE_COMPARE(attribute.vectorSize(), std::size_t(4*sizeof(Float)));
+    CORRADE_COMPARE(attribute.dataSize(), std::size_t(16*sizeof(Float)));
+
+    /* Per-instance transformations in non-interleaved buffer, each column is
+       one vector further and the stride is the whole matrix, not one column */
+    for(UnsignedInt i = 0; i != 4; ++i) {
+        const Implementation::AttributeColumnLayout layout = Implementation::attributeColumnLayout(attribute, 256, 0, i);
+        CORRADE_COMPARE(layout.offset, GLintptr(256 + i*16));
+        CORRADE_COMPARE(layout.stride, GLsizei(64));
+    }
+}
+
+void MeshTest::matrixAttributeColumnsInterleaved() {
+    /* Transformation interleaved with four-component color, stride is kept */
+    Transformation attribute;
+    for(UnsignedInt i = 0; i != 4; ++i) {
+        const Implementation::AttributeColumnLayout layout = Implementation::attributeColumnLayout(attribute, 16, 80, i);
+        CORRADE_COMPARE(layout.offset, GLintptr(16 + i*16));
+        CORRADE_COMPARE(layout.stride, GLsizei(80));
+    }
+}
+
 }}
 
 CORRADE_TEST_MAIN(Magnum::Test::MeshTest)
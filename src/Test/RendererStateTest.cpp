@@ -0,0 +1,152 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <set>
+#include <TestSuite/Tester.h>
+
+#include "Implementation/RendererState.h"
+
+namespace Magnum { namespace Test {
+
+class RendererStateTest: public TestSuite::Tester {
+    public:
+        explicit RendererStateTest();
+
+        void update();
+        void updateFacing();
+        void resetCache();
+        void indexForFeature();
+};
+
+typedef Implementation::RendererState RendererState;
+
+RendererStateTest::RendererStateTest() {
+    addTests({&RendererStateTest::update,
+              &RendererStateTest::updateFacing,
+              &RendererStateTest::resetCache,
+              &RendererStateTest::indexForFeature});
+}
+
+void RendererStateTest::update() {
+    RendererState state;
+
+    /* First call always goes through, even if it sets the default value */
+    CORRADE_VERIFY(state.update(state.cache.depthFunction, Renderer::DepthFunction::Less));
+    CORRADE_COMPARE(state.stateChangeCount, 1);
+    CORRADE_COMPARE(state.elidedStateChangeCount, 0);
+
+    /* Redundant call is elided */
+    CORRADE_VERIFY(!state.update(state.cache.depthFunction, Renderer::DepthFunction::Less));
+    CORRADE_COMPARE(state.stateChangeCount, 1);
+    CORRADE_COMPARE(state.elidedStateChangeCount, 1);
+
+    /* Changed value goes through */
+    CORRADE_VERIFY(state.update(state.cache.depthFunction, Renderer::DepthFunction::LessOrEqual));
+    CORRADE_COMPARE(state.stateChangeCount, 2);
+    CORRADE_COMPARE(state.elidedStateChangeCount, 1);
+
+    /* Compound values are compared as a whole */
+    CORRADE_VERIFY(state.update(state.cache.blendFunction, std::make_tuple(Renderer::BlendFunction::SourceAlpha, Renderer::BlendFunction::OneMinusSourceAlpha, Renderer::BlendFunction::SourceAlpha, Renderer::BlendFunction::OneMinusSourceAlpha)));
+    CORRADE_VERIFY(!state.update(state.cache.blendFunction, std::make_tuple(Renderer::BlendFunction::SourceAlpha, Renderer::BlendFunction::OneMinusSourceAlpha, Renderer::BlendFunction::SourceAlpha, Renderer::BlendFunction::OneMinusSourceAlpha)));
+    CORRADE_VERIFY(state.update(state.cache.blendFunction, std::make_tuple(Renderer::BlendFunction::SourceAlpha, Renderer::BlendFunction::OneMinusSourceAlpha, Renderer::BlendFunction::One, Renderer::BlendFunction::Zero)));
+    CORRADE_VERIFY(state.update(state.cache.scissor, Rectanglei({0, 0}, {640, 480})));
+    CORRADE_VERIFY(!state.update(state.cache.scissor, Rectanglei({0, 0}, {640, 480})));
+    CORRADE_COMPARE(state.stateChangeCount, 5);
+    CORRADE_COMPARE(state.elidedStateChangeCount, 3);
+}
+
+void RendererStateTest::updateFacing() {
+    RendererState state;
+
+    /* Setting front and back separately */
+    CORRADE_VERIFY(state.update(state.cache.stencilMask, Renderer::PolygonFacing::Front, 0xffu));
+    CORRADE_VERIFY(state.update(state.cache.stencilMask, Renderer::PolygonFacing::Back, 0xffu));
+    CORRADE_COMPARE(state.stateChangeCount, 2);
+
+    /* Both are already set to the same value */
+    CORRADE_VERIFY(!state.update(state.cache.stencilMask, Renderer::PolygonFacing::FrontAndBack, 0xffu));
+    CORRADE_VERIFY(!state.update(state.cache.stencilMask, Renderer::PolygonFacing::Back, 0xffu));
+    CORRADE_COMPARE(state.elidedStateChangeCount, 2);
+
+    /* Changing only one face still goes through for both */
+    CORRADE_VERIFY(state.update(state.cache.stencilMask, Renderer::PolygonFacing::Front, 0x0fu));
+    CORRADE_VERIFY(state.update(state.cache.stencilMask, Renderer::PolygonFacing::FrontAndBack, 0x0fu));
+    CORRADE_VERIFY(!state.update(state.cache.stencilMask, Renderer::PolygonFacing::Back, 0x0fu));
+    CORRADE_COMPARE(state.stateChangeCount, 4);
+    CORRADE_COMPARE(state.elidedStateChangeCount, 3);
+}
+
+void RendererStateTest::resetCache() {
+    RendererState state;
+
+    CORRADE_VERIFY(state.update(state.cache.clearColor, Color4<>(0.5f)));
+    CORRADE_VERIFY(!state.update(state.cache.clearColor, Color4<>(0.5f)));
+
+    /* After reset the state is unknown again */
+    state.cache = RendererState::Cache();
+    CORRADE_VERIFY(state.update(state.cache.clearColor, Color4<>(0.5f)));
+    CORRADE_COMPARE(state.stateChangeCount, 2);
+    CORRADE_COMPARE(state.elidedStateChangeCount, 1);
+}
+
+void RendererStateTest::indexForFeature() {
+    const Renderer::Feature features[] = {
+        Renderer::Feature::Blending,
+        #ifndef MAGNUM_TARGET_GLES
+        Renderer::Feature::DepthClamp,
+        #endif
+        Renderer::Feature::DepthTest,
+        Renderer::Feature::Dithering,
+        Renderer::Feature::FaceCulling,
+        #ifndef MAGNUM_TARGET_GLES
+        Renderer::Feature::LogicOperation,
+        Renderer::Feature::Multisampling,
+        #endif
+        Renderer::Feature::PolygonOffsetFill,
+        #ifndef MAGNUM_TARGET_GLES
+        Renderer::Feature::PolygonOffsetLine,
+        Renderer::Feature::PolygonOffsetPoint,
+        Renderer::Feature::ProgramPointSize,
+        #endif
+        Renderer::Feature::ScissorTest,
+        #ifndef MAGNUM_TARGET_GLES
+        Renderer::Feature::SeamlessCubeMapTexture,
+        #endif
+        Renderer::Feature::StencilTest
+    };
+
+    /* All features have unique index in the cache */
+    std::set<std::size_t> indices;
+    for(Renderer::Feature feature: features) {
+        const std::size_t index = RendererState::indexForFeature(feature);
+        CORRADE_VERIFY(index < RendererState::FeatureCount);
+        indices.insert(index);
+    }
+    CORRADE_COMPARE(indices.size(), RendererState::FeatureCount);
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::RendererStateTest)
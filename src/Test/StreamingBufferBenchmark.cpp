@@ -0,0 +1,95 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <vector>
+#include <TestSuite/Tester.h>
+
+#include "StreamingBuffer.h"
+#include "Test/Benchmark.h"
+
+namespace Magnum { namespace Test {
+
+class StreamingBufferBenchmark: public TestSuite::Tester {
+    public:
+        StreamingBufferBenchmark();
+
+        void particles();
+        void text();
+        void debugLines();
+
+    private:
+        void stream(GLsizeiptr chunkSize, std::size_t chunkCount);
+};
+
+namespace {
+
+}
+
+StreamingBufferBenchmark::StreamingBufferBenchmark() {
+    addTests({&StreamingBufferBenchmark::particles,
+              &StreamingBufferBenchmark::text,
+              &StreamingBufferBenchmark::debugLines});
+}
+
+/* 10k particle emitters, 64 bytes each */
+void StreamingBufferBenchmark::particles() { stream(64, 10000); }
+
+/* 1000 labels, 4 kB each */
+void StreamingBufferBenchmark::text() { stream(4096, 1000); }
+
+/* 16 batches of debug lines, 256 kB each */
+void StreamingBufferBenchmark::debugLines() { stream(256*1024, 16); }
+
+void StreamingBufferBenchmark::stream(const GLsizeiptr chunkSize, const std::size_t chunkCount) {
+    /* Only the CPU side can be measured without a context, host memory
+       stands in for the mapped buffer */
+    const GLsizeiptr segmentSize = chunkSize*chunkCount + 256*chunkCount;
+    Implementation::StreamingBufferAllocator allocator(segmentSize, 3);
+    std::vector<char> memory(segmentSize*3);
+    std::vector<char> data(chunkSize, 'x');
+
+    std::size_t failed = 0;
+    const double time = measure([&]() {
+        for(std::size_t i = 0; i != chunkCount; ++i) {
+            const GLintptr offset = allocator.allocate(chunkSize, 256);
+            if(offset == -1) {
+                ++failed;
+                continue;
+            }
+            std::memcpy(memory.data() + offset, data.data(), chunkSize);
+        }
+        allocator.next();
+    }, 100);
+
+    const double megabytes = double(chunkSize*chunkCount)/(1024*1024);
+    Debug() << chunkCount << "uploads of" << chunkSize << "bytes:";
+    Debug() << "  upload:" << megabytes << "MB in" << time << "ms";
+    Debug() << "  throughput:" << megabytes*(1000.0/60.0)/time << "MB per 60 FPS frame";
+    CORRADE_COMPARE(failed, 0);
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::StreamingBufferBenchmark)
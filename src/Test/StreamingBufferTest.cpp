@@ -0,0 +1,123 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <TestSuite/Tester.h>
+
+#include "StreamingBuffer.h"
+
+namespace Magnum { namespace Test {
+
+class StreamingBufferTest: public TestSuite::Tester {
+    public:
+        StreamingBufferTest();
+
+        void allocate();
+        void allocateAligned();
+        void allocateOverflow();
+        void allocateInvalidAlignment();
+        void nextSegment();
+};
+
+StreamingBufferTest::StreamingBufferTest() {
+    addTests({&StreamingBufferTest::allocate,
+              &StreamingBufferTest::allocateAligned,
+              &StreamingBufferTest::allocateOverflow,
+              &StreamingBufferTest::allocateInvalidAlignment,
+              &StreamingBufferTest::nextSegment});
+}
+
+void StreamingBufferTest::allocate() {
+    Implementation::StreamingBufferAllocator allocator(1024, 3);
+    CORRADE_COMPARE(allocator.segment(), 0);
+    CORRADE_COMPARE(allocator.used(), 0);
+
+    CORRADE_COMPARE(allocator.allocate(100, 1), 0);
+    CORRADE_COMPARE(allocator.allocate(24, 1), 100);
+    CORRADE_COMPARE(allocator.used(), 124);
+}
+
+void StreamingBufferTest::allocateAligned() {
+    Implementation::StreamingBufferAllocator allocator(1000, 3);
+
+    CORRADE_COMPARE(allocator.allocate(3, 1), 0);
+    CORRADE_COMPARE(allocator.allocate(8, 16), 16);
+    CORRADE_COMPARE(allocator.used(), 24);
+
+    /* Alignment is relative to buffer beginning, not to segment */
+    allocator.next();
+    CORRADE_COMPARE(allocator.allocate(4, 16), 1008);
+    CORRADE_COMPARE(allocator.used(), 12);
+}
+
+void StreamingBufferTest::allocateOverflow() {
+    Implementation::StreamingBufferAllocator allocator(64, 2);
+
+    CORRADE_COMPARE(allocator.allocate(48, 4), 0);
+    CORRADE_COMPARE(allocator.allocate(32, 4), -1);
+    CORRADE_COMPARE(allocator.used(), 48);
+
+    /* Remaining space can be still used */
+    CORRADE_COMPARE(allocator.allocate(16, 4), 48);
+    CORRADE_COMPARE(allocator.allocate(1, 1), -1);
+
+    /* Aligning past the end also fails */
+    allocator.next();
+    CORRADE_COMPARE(allocator.allocate(60, 1), 64);
+    CORRADE_COMPARE(allocator.allocate(1, 8), -1);
+}
+
+void StreamingBufferTest::allocateInvalidAlignment() {
+    std::ostringstream o;
+    Error::setOutput(&o);
+
+    Implementation::StreamingBufferAllocator allocator(64, 2);
+    CORRADE_COMPARE(allocator.allocate(4, 0), -1);
+    CORRADE_COMPARE(allocator.allocate(4, 12), -1);
+    CORRADE_COMPARE(allocator.used(), 0);
+    CORRADE_COMPARE(o.str(), "StreamingBuffer::allocate(): alignment must be a non-zero power of two\n"
+                             "StreamingBuffer::allocate(): alignment must be a non-zero power of two\n");
+}
+
+void StreamingBufferTest::nextSegment() {
+    Implementation::StreamingBufferAllocator allocator(256, 3);
+    allocator.allocate(200, 4);
+
+    allocator.next();
+    CORRADE_COMPARE(allocator.segment(), 1);
+    CORRADE_COMPARE(allocator.used(), 0);
+    CORRADE_COMPARE(allocator.allocate(200, 4), 256);
+
+    allocator.next();
+    CORRADE_COMPARE(allocator.allocate(200, 4), 512);
+
+    /* Wraps around to the first segment */
+    allocator.next();
+    CORRADE_COMPARE(allocator.segment(), 0);
+    CORRADE_COMPARE(allocator.allocate(200, 4), 0);
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::StreamingBufferTest)
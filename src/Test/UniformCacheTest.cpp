@@ -0,0 +1,108 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <TestSuite/Tester.h>
+
+#include "Math/Matrix4.h"
+#include "Implementation/UniformCache.h"
+
+namespace Magnum { namespace Test {
+
+class UniformCacheTest: public TestSuite::Tester {
+    public:
+        explicit UniformCacheTest();
+
+        void update();
+        void updateArray();
+        void invalidLocation();
+};
+
+UniformCacheTest::UniformCacheTest() {
+    addTests({&UniformCacheTest::update,
+              &UniformCacheTest::updateArray,
+              &UniformCacheTest::invalidLocation});
+}
+
+void UniformCacheTest::update() {
+    Implementation::UniformCache cache;
+
+    /* First upload always goes through */
+    const Matrix4 a = Matrix4::translation(Vector3::xAxis());
+    CORRADE_VERIFY(cache.update(3, 1, &a, sizeof(Matrix4)));
+    CORRADE_COMPARE(cache.uploadCount, 1);
+    CORRADE_COMPARE(cache.elidedUploadCount, 0);
+
+    /* Same value is elided */
+    const Matrix4 b = a;
+    CORRADE_VERIFY(!cache.update(3, 1, &b, sizeof(Matrix4)));
+    CORRADE_COMPARE(cache.uploadCount, 1);
+    CORRADE_COMPARE(cache.elidedUploadCount, 1);
+
+    /* Same value on different location goes through */
+    CORRADE_VERIFY(cache.update(0, 1, &b, sizeof(Matrix4)));
+
+    /* Different value goes through */
+    const Matrix4 c = Matrix4::translation(Vector3::yAxis());
+    CORRADE_VERIFY(cache.update(3, 1, &c, sizeof(Matrix4)));
+    CORRADE_COMPARE(cache.uploadCount, 3);
+    CORRADE_COMPARE(cache.elidedUploadCount, 1);
+
+    /* Forgotten values go through again */
+    cache.values.clear();
+    CORRADE_VERIFY(cache.update(3, 1, &c, sizeof(Matrix4)));
+    CORRADE_COMPARE(cache.uploadCount, 4);
+}
+
+void UniformCacheTest::updateArray() {
+    Implementation::UniformCache cache;
+
+    const Float a[] = {1.0f, 2.0f, 3.0f};
+    CORRADE_VERIFY(cache.update(1, 3, a, sizeof(Float)));
+    CORRADE_VERIFY(!cache.update(1, 3, a, sizeof(Float)));
+
+    /* Array elements are cached separately */
+    CORRADE_VERIFY(!cache.update(2, 1, a+1, sizeof(Float)));
+    CORRADE_VERIFY(cache.update(2, 1, a, sizeof(Float)));
+
+    /* The whole array needs to be uploaded again after one element changed */
+    CORRADE_VERIFY(cache.update(1, 3, a, sizeof(Float)));
+    CORRADE_COMPARE(cache.uploadCount, 3);
+    CORRADE_COMPARE(cache.elidedUploadCount, 2);
+}
+
+void UniformCacheTest::invalidLocation() {
+    Implementation::UniformCache cache;
+
+    /* Not cached, not counted */
+    const Int a = 5;
+    CORRADE_VERIFY(cache.update(-1, 1, &a, sizeof(Int)));
+    CORRADE_VERIFY(cache.update(-1, 1, &a, sizeof(Int)));
+    CORRADE_COMPARE(cache.uploadCount, 0);
+    CORRADE_COMPARE(cache.elidedUploadCount, 0);
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::UniformCacheTest)
@@ -24,14 +24,19 @@
 
 #include "GlyphCache.h"
 
+#include <algorithm>
+#include <memory>
+#include <Utility/Debug.h>
+
 #include "Extensions.h"
 #include "Image.h"
 #include "TextureFormat.h"
-#include "TextureTools/Atlas.h"
 
 namespace Magnum { namespace Text {
 
-GlyphCache::GlyphCache(const Vector2i& size): _size(size) {
+AbstractGlyphRasterizer::~AbstractGlyphRasterizer() {}
+
+GlyphCache::GlyphCache(const Vector2i& size): _size(size), _atlas(size), _rasterizer(nullptr) {
     #ifndef MAGNUM_TARGET_GLES
     MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::ARB::texture_rg);
     #endif
@@ -47,11 +52,11 @@ GlyphCache::GlyphCache(const Vector2i& size): _size(size) {
     initialize(internalFormat, size);
 }
 
-GlyphCache::GlyphCache(const Vector2i& size, const TextureFormat internalFormat): _size(size) {
+GlyphCache::GlyphCache(const Vector2i& size, const TextureFormat internalFormat): _size(size), _atlas(size), _rasterizer(nullptr) {
     initialize(internalFormat, size);
 }
 
-GlyphCache::GlyphCache(const Vector2i& size, const Vector2i& padding): _size(size), _padding(padding) {}
+GlyphCache::GlyphCache(const Vector2i& size, const Vector2i& padding): _size(size), _padding(padding), _atlas(size, padding), _rasterizer(nullptr) {}
 
 GlyphCache::~GlyphCache() = default;
 
@@ -63,22 +68,54 @@ void GlyphCache::initialize(const TextureFormat internalFormat, const Vector2i&
         ->setStorage(1, internalFormat, size);
 }
 
-std::vector<Rectanglei> GlyphCache::reserve(const std::vector<Vector2i>& sizes) {
-    CORRADE_ASSERT(glyphs.empty(), "Text::GlyphCache::reserve(): reserving space in non-empty cache is not yet implemented", {});
-    glyphs.reserve(glyphs.size() + sizes.size());
-    return TextureTools::atlas(_size, sizes, _padding);
-}
+std::pair<Vector2i, Rectanglei> GlyphCache::operator[](const UnsignedInt glyph) const {
+    const std::pair<Vector2i, Rectanglei>* found = _atlas.find(glyph);
+    if(found) return *found;
 
-void GlyphCache::insert(const UnsignedInt glyph, Vector2i position, Rectanglei rectangle) {
-    position -= _padding;
-    rectangle.bottomLeft() -= _padding;
-    rectangle.topRight() += _padding;
+    /* Rasterize the glyph on demand. The cache contents are modified, but
+       that's not visible from outside except for the texture contents. */
+    if(_rasterizer) {
+        const std::pair<Vector2i, Rectanglei>* rasterized = const_cast<GlyphCache*>(this)->rasterize(glyph);
+        if(rasterized) return *rasterized;
+    }
 
-    glyphs.insert({glyph, {position, rectangle}});
+    return _atlas.fallback();
 }
 
 void GlyphCache::setImage(const Vector2i& offset, Image2D* const image) {
     _texture.setSubImage(0, offset, image);
 }
 
+const std::pair<Vector2i, Rectanglei>* GlyphCache::rasterize(const UnsignedInt glyph) {
+    Vector2i position;
+    std::unique_ptr<Image2D> image(_rasterizer->rasterize(glyph, position));
+    if(!image) return nullptr;
+
+    Rectanglei rectangle;
+    if(!_atlas.allocate(image->size(), rectangle)) {
+        Error() << "Text::GlyphCache: cannot fit glyph" << glyph << "into the cache";
+        return nullptr;
+    }
+
+    /* Copy the image into zero-filled one with padding, so the padding area
+       of previously evicted glyph is cleared too. Rows of both images are
+       aligned to four bytes. */
+    if(image->size().product()) {
+        const std::size_t pixelSize = image->pixelSize();
+        const Vector2i paddedSize = image->size() + 2*_padding;
+        const std::size_t rowLength = (image->size().x()*pixelSize + 3)/4*4;
+        const std::size_t paddedRowLength = (paddedSize.x()*pixelSize + 3)/4*4;
+        unsigned char* const data = new unsigned char[paddedRowLength*paddedSize.y()]();
+        for(Int y = 0; y != image->size().y(); ++y)
+            std::copy_n(image->data() + y*rowLength, image->size().x()*pixelSize,
+                data + (y + _padding.y())*paddedRowLength + _padding.x()*pixelSize);
+
+        /* Upload only the glyph region */
+        Image2D padded(paddedSize, image->format(), image->type(), data);
+        setImage(rectangle.bottomLeft() - _padding, &padded);
+    }
+
+    return &_atlas.insertAllocated(glyph, position, rectangle);
+}
+
 }}
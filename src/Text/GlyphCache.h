@@ -25,18 +25,40 @@
 */
 
 /** @file
- * @brief Class Magnum::Text::GlyphCache
+ * @brief Class Magnum::Text::GlyphCache, Magnum::Text::AbstractGlyphRasterizer
  */
 
 #include <vector>
-#include <unordered_map>
 
 #include "Math/Geometry/Rectangle.h"
 #include "Texture.h"
+#include "Text/Implementation/GlyphCacheAtlas.h"
 #include "Text/magnumTextVisibility.h"
 
 namespace Magnum { namespace Text {
 
+/**
+@brief Base for glyph rasterizers
+
+Used by GlyphCache to render glyphs on demand, see
+@ref GlyphCache-lazy "GlyphCache documentation" for more information.
+*/
+class MAGNUM_TEXT_EXPORT AbstractGlyphRasterizer {
+    public:
+        virtual ~AbstractGlyphRasterizer() = 0;
+
+        /**
+         * @brief Rasterize glyph
+         * @param[in]  glyph     Glyph ID
+         * @param[out] position  Glyph position relative to point on baseline
+         *
+         * Returns glyph image in format suitable for given cache, with rows
+         * aligned to four bytes, or `nullptr` if the glyph cannot be
+         * rasterized. Deleting the image is up to the caller.
+         */
+        virtual Image2D* rasterize(UnsignedInt glyph, Vector2i& position) = 0;
+};
+
 /**
 @brief Glyph cache
 
@@ -55,6 +77,26 @@ font->createGlyphCache(cache, "abcdefghijklmnopqrstuvwxyz"
 @endcode
 
 See TextRenderer for information about text rendering.
+
+@section GlyphCache-lazy Lazy filling
+
+Prerendering all glyphs is not possible for large character sets, such as
+CJK. If you set glyph rasterizer using setRasterizer(), glyphs which are not
+in the cache are rendered on first access from layouter, placed into free
+space in the cache and only their region of the texture is uploaded. When
+the cache is full, least recently used glyphs are evicted to make room for the
+new ones. Glyphs inserted without calling reserve() first and glyph with ID
+`0`, which is used as a fallback, are never evicted.
+
+Glyphs used by text layout in progress are pinned using pinGlyphs() and
+unpinGlyphs(), so a layout never evicts its own glyphs. If the layout needs
+more glyphs than the cache can hold, the remaining ones are replaced with the
+fallback glyph. Text renderers do the pinning automatically.
+
+Note that evicted glyphs are overwritten in the texture, thus the cache should
+be large enough to contain at least all glyphs of currently displayed text.
+Use hitCount(), missCount() and evictionCount() to find out proper cache
+size.
 @todo Some way for Font to negotiate or check internal texture format
 */
 class MAGNUM_TEXT_EXPORT GlyphCache {
@@ -87,36 +129,98 @@ class MAGNUM_TEXT_EXPORT GlyphCache {
         Vector2i textureSize() const { return _size; }
 
         /** @brief Count of glyphs in the cache */
-        std::size_t glyphCount() const { return glyphs.size(); }
+        std::size_t glyphCount() const { return _atlas.glyphCount(); }
 
         /** @brief Cache texture */
         Texture2D* texture() { return &_texture; }
 
+        /** @brief Glyph rasterizer */
+        AbstractGlyphRasterizer* rasterizer() const { return _rasterizer; }
+
+        /**
+         * @brief Set glyph rasterizer
+         *
+         * Enables lazy filling of the cache and eviction of least recently
+         * used glyphs, see @ref GlyphCache-lazy "class documentation" for
+         * more information. The rasterizer is not deleted on destruction.
+         * Set to `nullptr` to disable lazy filling.
+         */
+        void setRasterizer(AbstractGlyphRasterizer* rasterizer) {
+            _rasterizer = rasterizer;
+            _atlas.setEvictionEnabled(rasterizer);
+        }
+
+        /**
+         * @brief Pin glyphs used by text layout
+         *
+         * Glyphs looked up using operator[]() until matching unpinGlyphs()
+         * call are not evicted. Calls can be nested. Used by text renderers
+         * around each layout, see @ref GlyphCache-lazy for more information.
+         */
+        void pinGlyphs() const { _atlas.pin(); }
+
+        /**
+         * @brief Unpin glyphs used by text layout
+         *
+         * The pinned glyphs become most recently used ones.
+         * @see pinGlyphs()
+         */
+        void unpinGlyphs() const { _atlas.unpin(); }
+
+        /**
+         * @brief Count of cache hits
+         *
+         * Count of glyph lookups using operator[]() which found the glyph in
+         * the cache.
+         * @see resetStatistics()
+         */
+        std::size_t hitCount() const { return _atlas.hitCount(); }
+
+        /**
+         * @brief Count of cache misses
+         *
+         * Count of glyph lookups using operator[]() which didn't found the
+         * glyph in the cache. In lazy mode the glyph is then rasterized and
+         * inserted into the cache.
+         * @see resetStatistics()
+         */
+        std::size_t missCount() const { return _atlas.missCount(); }
+
+        /**
+         * @brief Count of evicted glyphs
+         *
+         * @see @ref GlyphCache-lazy, resetStatistics()
+         */
+        std::size_t evictionCount() const { return _atlas.evictionCount(); }
+
+        /** @brief Reset hit, miss and eviction counters */
+        void resetStatistics() { _atlas.resetStatistics(); }
+
         /**
          * @brief Parameters of given glyph
          * @param glyph         Glyph ID
          *
          * First tuple element is glyph position relative to point on baseline,
          * second element is glyph region in texture atlas. If no glyph is
-         * found, glyph on zero index is returned.
+         * found and it cannot be rasterized, glyph on zero index is returned.
+         * @see @ref GlyphCache-lazy
          */
-        std::pair<Vector2i, Rectanglei> operator[](UnsignedInt glyph) const {
-            auto it = glyphs.find(glyph);
-            return it == glyphs.end() ? glyphs.at(0) : it->second;
-        }
+        std::pair<Vector2i, Rectanglei> operator[](UnsignedInt glyph) const;
 
         /**
          * @brief Layout glyphs with given sizes to the cache
          *
-         * Returns non-overlapping regions in cache texture to store glyphs.
-         * The reserved space is reused on next call to reserve() if no glyph
-         * was stored there, use insert() to store actual glyph on given
-         * position and setImage() to upload glyph image.
-         *
-         * @attention Cache size must be large enough to contain all rendered
-         *      glyphs.
+         * Returns non-overlapping regions in free space of cache texture to
+         * store glyphs. The reserved space is reused on next call to
+         * reserve() if no glyph was stored there, use insert() to store
+         * actual glyph on given position and setImage() to upload glyph
+         * image. If there is not enough free space, least recently used
+         * glyphs are evicted in lazy mode. If there is still not enough space,
+         * empty vector is returned.
          */
-        std::vector<Rectanglei> reserve(const std::vector<Vector2i>& sizes);
+        std::vector<Rectanglei> reserve(const std::vector<Vector2i>& sizes) {
+            return _atlas.reserve(sizes);
+        }
 
         /**
          * @brief Insert glyph to cache
@@ -127,7 +231,9 @@ class MAGNUM_TEXT_EXPORT GlyphCache {
          * You can obtain unused non-overlapping regions with reserve(). See
          * also setImage() to upload glyph image.
          */
-        void insert(UnsignedInt glyph, Vector2i position, Rectanglei rectangle);
+        void insert(UnsignedInt glyph, Vector2i position, Rectanglei rectangle) {
+            _atlas.insert(glyph, position, rectangle);
+        }
 
         /**
          * @brief Set cache image
@@ -151,8 +257,14 @@ class MAGNUM_TEXT_EXPORT GlyphCache {
         Texture2D _texture;
 
     private:
+        const std::pair<Vector2i, Rectanglei>* rasterize(UnsignedInt glyph);
+
         const Vector2i _padding;
-        std::unordered_map<UnsignedInt, std::pair<Vector2i, Rectanglei>> glyphs;
+
+        /* Lookups modify LRU order and statistics */
+        mutable Implementation::GlyphCacheAtlas _atlas;
+
+        AbstractGlyphRasterizer* _rasterizer;
 };
 
 }}
@@ -0,0 +1,152 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "GlyphCacheAtlas.h"
+
+#include <algorithm>
+#include <numeric>
+#include <Utility/Assert.h>
+#include <Utility/Debug.h>
+
+namespace Magnum { namespace Text { namespace Implementation {
+
+GlyphCacheAtlas::GlyphCacheAtlas(const Vector2i& size, const Vector2i& padding): _padding(padding), _allocator(size, padding), _evictionEnabled(false), _pinCount(0), _hitCount(0), _missCount(0), _evictionCount(0) {}
+
+void GlyphCacheAtlas::unpin() {
+    CORRADE_ASSERT(_pinCount, "Text::GlyphCache::unpinGlyphs(): glyphs are not pinned", );
+    if(--_pinCount) return;
+
+    /* Pinned glyphs were used most recently */
+    for(UnsignedInt glyph: _pinned) glyphs.at(glyph).pinned = false;
+    _lru.splice(_lru.begin(), _pinned);
+}
+
+const std::pair<Vector2i, Rectanglei>* GlyphCacheAtlas::find(const UnsignedInt glyph) {
+    auto it = glyphs.find(glyph);
+    if(it == glyphs.end()) {
+        ++_missCount;
+        return nullptr;
+    }
+
+    ++_hitCount;
+
+    /* Move the glyph to the front, pin it if layout is in progress */
+    Glyph& found = it->second;
+    if(found.evictable) {
+        std::list<UnsignedInt>& from = found.pinned ? _pinned : _lru;
+        std::list<UnsignedInt>& to = _pinCount ? _pinned : _lru;
+        to.splice(to.begin(), from, found.lru);
+        found.pinned = !!_pinCount;
+    }
+
+    return &found.data;
+}
+
+std::vector<Rectanglei> GlyphCacheAtlas::reserve(const std::vector<Vector2i>& sizes) {
+    /* Reuse space reserved in previous call which wasn't filled with glyphs */
+    for(const auto& reserved: _reserved) _allocator.free(reserved.second);
+    _reserved.clear();
+
+    /* Allocate tallest glyphs first so the shelves are filled evenly */
+    std::vector<std::size_t> order(sizes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&sizes](std::size_t a, std::size_t b) {
+        return sizes[a].y() > sizes[b].y();
+    });
+
+    std::vector<Rectanglei> rectangles(sizes.size());
+    for(std::size_t i: order) {
+        if(allocate(sizes[i], rectangles[i])) {
+            _reserved.insert({{rectangles[i].left(), rectangles[i].bottom()}, rectangles[i]});
+            continue;
+        }
+
+        for(const auto& reserved: _reserved) _allocator.free(reserved.second);
+        _reserved.clear();
+        Error() << "Text::GlyphCache::reserve(): cannot fit" << sizes.size() << "glyphs into the cache";
+        return {};
+    }
+
+    glyphs.reserve(glyphs.size() + sizes.size());
+    return rectangles;
+}
+
+void GlyphCacheAtlas::insert(const UnsignedInt glyph, const Vector2i position, const Rectanglei rectangle) {
+    /* Glyph is already in the cache, nothing to do */
+    if(glyphs.find(glyph) != glyphs.end()) return;
+
+    /* If the glyph space was reserved, it can be evicted later */
+    bool evictable = false;
+    const auto range = _reserved.equal_range(std::make_pair(rectangle.left(), rectangle.bottom()));
+    for(auto it = range.first; it != range.second; ++it) {
+        if(it->second != rectangle) continue;
+        _reserved.erase(it);
+        evictable = glyph != 0;
+        break;
+    }
+
+    add(glyph, position, rectangle, evictable);
+}
+
+bool GlyphCacheAtlas::allocate(const Vector2i& size, Rectanglei& rectangle) {
+    while(!_allocator.allocate(size, rectangle))
+        if(!evict()) return false;
+    return true;
+}
+
+const std::pair<Vector2i, Rectanglei>& GlyphCacheAtlas::insertAllocated(const UnsignedInt glyph, const Vector2i position, const Rectanglei rectangle) {
+    return add(glyph, position, rectangle, glyph != 0).data;
+}
+
+bool GlyphCacheAtlas::evict() {
+    /* Pinned glyphs are not in the LRU list, so they are never evicted */
+    if(!_evictionEnabled || _lru.empty()) return false;
+
+    auto it = glyphs.find(_lru.back());
+    CORRADE_INTERNAL_ASSERT(it != glyphs.end());
+    Rectanglei rectangle = it->second.data.second;
+    rectangle.bottomLeft() += _padding;
+    rectangle.topRight() -= _padding;
+    _allocator.free(rectangle);
+
+    glyphs.erase(it);
+    _lru.pop_back();
+    ++_evictionCount;
+    return true;
+}
+
+const GlyphCacheAtlas::Glyph& GlyphCacheAtlas::add(const UnsignedInt glyph, Vector2i position, Rectanglei rectangle, const bool evictable) {
+    position -= _padding;
+    rectangle.bottomLeft() -= _padding;
+    rectangle.topRight() += _padding;
+
+    auto lru = _lru.end();
+    const bool pinned = evictable && _pinCount;
+    if(pinned) lru = _pinned.insert(_pinned.begin(), glyph);
+    else if(evictable) lru = _lru.insert(_lru.begin(), glyph);
+    return glyphs.insert({glyph, {{position, rectangle}, lru, evictable, pinned}}).first->second;
+}
+
+}}}
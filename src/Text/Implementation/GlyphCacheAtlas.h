@@ -0,0 +1,115 @@
+#ifndef Magnum_Text_Implementation_GlyphCacheAtlas_h
+#define Magnum_Text_Implementation_GlyphCacheAtlas_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <list>
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Math/Geometry/Rectangle.h"
+#include "TextureTools/AtlasAllocator.h"
+#include "Text/magnumTextVisibility.h"
+
+namespace Magnum { namespace Text { namespace Implementation {
+
+/* GL-free bookkeeping of GlyphCache: glyph parameters, space in the atlas,
+   order of least recently used glyphs for eviction and glyphs pinned by
+   layout in progress */
+class MAGNUM_TEXT_EXPORT GlyphCacheAtlas {
+    public:
+        explicit GlyphCacheAtlas(const Vector2i& size, const Vector2i& padding = Vector2i());
+
+        std::size_t glyphCount() const { return glyphs.size(); }
+
+        std::size_t hitCount() const { return _hitCount; }
+        std::size_t missCount() const { return _missCount; }
+        std::size_t evictionCount() const { return _evictionCount; }
+        void resetStatistics() { _hitCount = _missCount = _evictionCount = 0; }
+
+        /* Glyphs are evicted only if enabled (i.e. in lazy mode), otherwise
+           they won't come back */
+        bool isEvictionEnabled() const { return _evictionEnabled; }
+        void setEvictionEnabled(bool enabled) { _evictionEnabled = enabled; }
+
+        /* Glyphs looked up or inserted between pin() and unpin() are not
+           evicted, calls can be nested */
+        bool isPinned() const { return _pinCount; }
+        void pin() { ++_pinCount; }
+        void unpin();
+
+        /* Looks up the glyph, counts hit or miss and marks the glyph as most
+           recently used. Returns nullptr if the glyph is not in the cache. */
+        const std::pair<Vector2i, Rectanglei>* find(UnsignedInt glyph);
+
+        /* Parameters of fallback glyph */
+        const std::pair<Vector2i, Rectanglei>& fallback() const {
+            return glyphs.at(0).data;
+        }
+
+        /* See GlyphCache::reserve() and GlyphCache::insert() */
+        std::vector<Rectanglei> reserve(const std::vector<Vector2i>& sizes);
+        void insert(UnsignedInt glyph, Vector2i position, Rectanglei rectangle);
+
+        /* Allocates space for glyph of given size, evicting least recently
+           used glyphs if necessary. Returns false if there's not enough
+           space. */
+        bool allocate(const Vector2i& size, Rectanglei& rectangle);
+
+        /* Inserts glyph into space returned from allocate(). The glyph is
+           evictable, except for fallback glyph. */
+        const std::pair<Vector2i, Rectanglei>& insertAllocated(UnsignedInt glyph, Vector2i position, Rectanglei rectangle);
+
+    private:
+        struct Glyph {
+            std::pair<Vector2i, Rectanglei> data;
+
+            /* Position in LRU list or in list of pinned glyphs, if the glyph
+               is evictable */
+            std::list<UnsignedInt>::iterator lru;
+            bool evictable, pinned;
+        };
+
+        bool evict();
+        const Glyph& add(UnsignedInt glyph, Vector2i position, Rectanglei rectangle, bool evictable);
+
+        const Vector2i _padding;
+        std::unordered_map<UnsignedInt, Glyph> glyphs;
+
+        TextureTools::AtlasAllocator _allocator;
+        std::multimap<std::pair<Int, Int>, Rectanglei> _reserved;
+
+        /* Most recently used glyphs are at the front */
+        std::list<UnsignedInt> _lru, _pinned;
+
+        bool _evictionEnabled;
+        UnsignedInt _pinCount;
+        std::size_t _hitCount, _missCount, _evictionCount;
+};
+
+}}}
+
+#endif
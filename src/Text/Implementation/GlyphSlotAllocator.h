@@ -0,0 +1,106 @@
+#ifndef Magnum_Text_Implementation_GlyphSlotAllocator_h
+#define Magnum_Text_Implementation_GlyphSlotAllocator_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "Magnum.h"
+
+namespace Magnum { namespace Text { namespace Implementation {
+
+/* Glyph slot bookkeeping of TextBatchRenderer: each label occupies contiguous
+   range of slots, freed ranges are reused by first-fit allocation */
+class GlyphSlotAllocator {
+    public:
+        explicit GlyphSlotAllocator(): _glyphCount(0) {}
+
+        /* Count of slots in use, including free ranges between them */
+        UnsignedInt glyphCount() const { return _glyphCount; }
+
+        /* Free ranges (offset and count) below glyphCount(), sorted and not
+           touching each other */
+        const std::vector<std::pair<UnsignedInt, UnsignedInt>>& freeSlots() const { return _freeSlots; }
+
+        /* Returns offset of range of given size */
+        UnsignedInt allocate(const UnsignedInt capacity) {
+            if(!capacity) return 0;
+
+            /* First free range which is large enough */
+            for(auto it = _freeSlots.begin(); it != _freeSlots.end(); ++it) {
+                if(it->second < capacity) continue;
+
+                const UnsignedInt offset = it->first;
+                it->first += capacity;
+                it->second -= capacity;
+                if(!it->second) _freeSlots.erase(it);
+                return offset;
+            }
+
+            /* Append to the end. There is never a free range at the end, as
+               free() shrinks the used range instead. */
+            const UnsignedInt offset = _glyphCount;
+            _glyphCount += capacity;
+            return offset;
+        }
+
+        /* Returns false if the range was at the end and the used range was
+           just shrunk, so the slots are not drawn anymore and don't need to
+           be cleared */
+        bool free(const UnsignedInt offset, const UnsignedInt capacity) {
+            if(!capacity) return false;
+
+            if(offset + capacity == _glyphCount) {
+                _glyphCount = offset;
+                if(!_freeSlots.empty() && _freeSlots.back().first + _freeSlots.back().second == _glyphCount) {
+                    _glyphCount = _freeSlots.back().first;
+                    _freeSlots.pop_back();
+                }
+                return false;
+            }
+
+            /* Insert the range and merge it with neighbors */
+            auto it = std::lower_bound(_freeSlots.begin(), _freeSlots.end(), std::make_pair(offset, 0u));
+            it = _freeSlots.insert(it, {offset, capacity});
+            if(it+1 != _freeSlots.end() && it->first + it->second == (it+1)->first) {
+                it->second += (it+1)->second;
+                _freeSlots.erase(it+1);
+            }
+            if(it != _freeSlots.begin() && (it-1)->first + (it-1)->second == it->first) {
+                (it-1)->second += it->second;
+                _freeSlots.erase(it);
+            }
+            return true;
+        }
+
+    private:
+        std::vector<std::pair<UnsignedInt, UnsignedInt>> _freeSlots;
+        UnsignedInt _glyphCount;
+};
+
+}}}
+
+#endif
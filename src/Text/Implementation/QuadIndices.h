@@ -0,0 +1,81 @@
+#ifndef Magnum_Text_Implementation_QuadIndices_h
+#define Magnum_Text_Implementation_QuadIndices_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstddef>
+
+#include "Types.h"
+
+namespace Magnum { namespace Text { namespace Implementation {
+
+/* Fills index buffer for given count of glyph quads */
+template<class T> void createIndices(void* output, const UnsignedInt glyphCount) {
+    T* const out = reinterpret_cast<T*>(output);
+    for(UnsignedInt i = 0; i != glyphCount; ++i) {
+        /* 0---2 2
+           |  / /|
+           | / / |
+           |/ /  |
+           1 1---3 */
+
+        /* The position can be larger than the index type allows */
+        const T vertex = i*4;
+        const std::size_t pos = std::size_t(i)*6;
+        out[pos]   = vertex;
+        out[pos+1] = vertex+1;
+        out[pos+2] = vertex+2;
+        out[pos+3] = vertex+1;
+        out[pos+4] = vertex+3;
+        out[pos+5] = vertex+2;
+    }
+}
+
+/* Size of one index for given count of glyph quads, the smallest type which
+   can index all the vertices */
+inline std::size_t indexSize(const UnsignedInt glyphCount) {
+    const UnsignedInt vertexCount = glyphCount*4;
+    if(vertexCount < 255) return sizeof(UnsignedByte);
+    if(vertexCount < 65535) return sizeof(UnsignedShort);
+    return sizeof(UnsignedInt);
+}
+
+/* Fills index buffer for given count of glyph quads with indices of type
+   given by indexSize() */
+inline void createIndices(void* output, const UnsignedInt glyphCount) {
+    switch(indexSize(glyphCount)) {
+        case sizeof(UnsignedByte):
+            createIndices<UnsignedByte>(output, glyphCount);
+            return;
+        case sizeof(UnsignedShort):
+            createIndices<UnsignedShort>(output, glyphCount);
+            return;
+        default:
+            createIndices<UnsignedInt>(output, glyphCount);
+    }
+}
+
+}}}
+
+#endif
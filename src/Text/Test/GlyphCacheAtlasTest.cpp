@@ -0,0 +1,230 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <TestSuite/Tester.h>
+
+#include "Text/Implementation/GlyphCacheAtlas.h"
+
+namespace Magnum { namespace Text { namespace Test {
+
+class GlyphCacheAtlasTest: public TestSuite::Tester {
+    public:
+        GlyphCacheAtlasTest();
+
+        void insert();
+        void insertPadding();
+        void hitMiss();
+        void evictionOrder();
+        void evictionDisabled();
+        void evictionFallback();
+        void pin();
+        void pinOverflow();
+};
+
+GlyphCacheAtlasTest::GlyphCacheAtlasTest() {
+    addTests({&GlyphCacheAtlasTest::insert,
+              &GlyphCacheAtlasTest::insertPadding,
+              &GlyphCacheAtlasTest::hitMiss,
+              &GlyphCacheAtlasTest::evictionOrder,
+              &GlyphCacheAtlasTest::evictionDisabled,
+              &GlyphCacheAtlasTest::evictionFallback,
+              &GlyphCacheAtlasTest::pin,
+              &GlyphCacheAtlasTest::pinOverflow});
+}
+
+namespace {
+    /* Rasterizes given glyph the same way as GlyphCache does in lazy mode,
+       returns false if it doesn't fit */
+    bool rasterize(Implementation::GlyphCacheAtlas& atlas, UnsignedInt glyph) {
+        if(atlas.find(glyph)) return true;
+
+        Rectanglei rectangle;
+        if(!atlas.allocate(Vector2i(4), rectangle)) return false;
+        atlas.insertAllocated(glyph, {1, 2}, rectangle);
+        return true;
+    }
+}
+
+void GlyphCacheAtlasTest::insert() {
+    Implementation::GlyphCacheAtlas atlas({16, 8});
+    CORRADE_COMPARE(atlas.glyphCount(), 0);
+
+    const std::vector<Rectanglei> rectangles = atlas.reserve({Vector2i(4), {2, 3}});
+    CORRADE_COMPARE(rectangles.size(), 2);
+    atlas.insert(1, {1, 2}, rectangles[0]);
+    atlas.insert(2, {-1, 0}, rectangles[1]);
+    CORRADE_COMPARE(atlas.glyphCount(), 2);
+
+    const std::pair<Vector2i, Rectanglei>* glyph = atlas.find(2);
+    CORRADE_VERIFY(glyph);
+    CORRADE_COMPARE(glyph->first, Vector2i(-1, 0));
+    CORRADE_COMPARE(glyph->second, rectangles[1]);
+
+    /* Inserting again does nothing */
+    atlas.insert(2, {5, 5}, rectangles[0]);
+    CORRADE_COMPARE(atlas.glyphCount(), 2);
+    CORRADE_COMPARE(atlas.find(2)->first, Vector2i(-1, 0));
+}
+
+void GlyphCacheAtlasTest::insertPadding() {
+    Implementation::GlyphCacheAtlas atlas({16, 16}, Vector2i(1));
+
+    Rectanglei rectangle;
+    CORRADE_VERIFY(atlas.allocate(Vector2i(4), rectangle));
+    CORRADE_COMPARE(rectangle.size(), Vector2i(4));
+
+    /* Position and rectangle are expanded by the padding */
+    const std::pair<Vector2i, Rectanglei>& glyph = atlas.insertAllocated(3, {1, 2}, rectangle);
+    CORRADE_COMPARE(glyph.first, Vector2i(0, 1));
+    CORRADE_COMPARE(glyph.second, Rectanglei(rectangle.bottomLeft() - Vector2i(1), rectangle.topRight() + Vector2i(1)));
+}
+
+void GlyphCacheAtlasTest::hitMiss() {
+    Implementation::GlyphCacheAtlas atlas({16, 8});
+    rasterize(atlas, 1);
+    CORRADE_COMPARE(atlas.hitCount(), 0);
+    CORRADE_COMPARE(atlas.missCount(), 1);
+
+    CORRADE_VERIFY(atlas.find(1));
+    CORRADE_VERIFY(atlas.find(1));
+    CORRADE_VERIFY(!atlas.find(2));
+    CORRADE_COMPARE(atlas.hitCount(), 2);
+    CORRADE_COMPARE(atlas.missCount(), 2);
+    CORRADE_COMPARE(atlas.evictionCount(), 0);
+
+    atlas.resetStatistics();
+    CORRADE_COMPARE(atlas.hitCount(), 0);
+    CORRADE_COMPARE(atlas.missCount(), 0);
+}
+
+void GlyphCacheAtlasTest::evictionOrder() {
+    /* Space for eight glyphs */
+    Implementation::GlyphCacheAtlas atlas({16, 8});
+    atlas.setEvictionEnabled(true);
+    for(UnsignedInt i = 1; i != 9; ++i) CORRADE_VERIFY(rasterize(atlas, i));
+    CORRADE_COMPARE(atlas.glyphCount(), 8);
+    CORRADE_COMPARE(atlas.evictionCount(), 0);
+
+    /* Use the oldest glyphs again */
+    atlas.find(2);
+    atlas.find(1);
+
+    /* Least recently used glyphs are evicted */
+    CORRADE_VERIFY(rasterize(atlas, 9));
+    CORRADE_VERIFY(rasterize(atlas, 10));
+    CORRADE_COMPARE(atlas.evictionCount(), 2);
+    CORRADE_COMPARE(atlas.glyphCount(), 8);
+    CORRADE_VERIFY(!atlas.find(3));
+    CORRADE_VERIFY(!atlas.find(4));
+    CORRADE_VERIFY(atlas.find(5));
+
+    /* Glyphs 1 and 2 were used after 6, 7 and 8 */
+    CORRADE_VERIFY(rasterize(atlas, 11));
+    CORRADE_VERIFY(rasterize(atlas, 12));
+    CORRADE_VERIFY(rasterize(atlas, 13));
+    CORRADE_VERIFY(!atlas.find(6));
+    CORRADE_VERIFY(!atlas.find(7));
+    CORRADE_VERIFY(!atlas.find(8));
+    CORRADE_VERIFY(atlas.find(1));
+    CORRADE_VERIFY(atlas.find(2));
+}
+
+void GlyphCacheAtlasTest::evictionDisabled() {
+    Implementation::GlyphCacheAtlas atlas({16, 8});
+    for(UnsignedInt i = 1; i != 9; ++i) CORRADE_VERIFY(rasterize(atlas, i));
+
+    /* Glyphs are evicted only in lazy mode */
+    CORRADE_VERIFY(!rasterize(atlas, 9));
+    CORRADE_COMPARE(atlas.evictionCount(), 0);
+    CORRADE_COMPARE(atlas.glyphCount(), 8);
+}
+
+void GlyphCacheAtlasTest::evictionFallback() {
+    Implementation::GlyphCacheAtlas atlas({16, 8});
+    atlas.setEvictionEnabled(true);
+
+    /* Fallback glyph and glyphs inserted without reservation are never
+       evicted */
+    CORRADE_VERIFY(rasterize(atlas, 0));
+    atlas.insert(1, {}, {{12, 4}, {16, 8}});
+    for(UnsignedInt i = 2; i != 20; ++i) CORRADE_VERIFY(rasterize(atlas, i));
+    CORRADE_COMPARE(atlas.evictionCount(), 11);
+    CORRADE_VERIFY(!atlas.find(2));
+    CORRADE_VERIFY(atlas.find(0));
+    CORRADE_VERIFY(atlas.find(1));
+    CORRADE_VERIFY(atlas.fallback() == *atlas.find(0));
+}
+
+void GlyphCacheAtlasTest::pin() {
+    Implementation::GlyphCacheAtlas atlas({16, 8});
+    atlas.setEvictionEnabled(true);
+    for(UnsignedInt i = 1; i != 9; ++i) rasterize(atlas, i);
+
+    /* Glyphs 1 and 2 are used by the layout, together with new glyphs, the
+       nested pinning doesn't unpin them */
+    atlas.pin();
+    atlas.pin();
+    CORRADE_VERIFY(atlas.isPinned());
+    atlas.find(1);
+    atlas.find(2);
+    atlas.unpin();
+    for(UnsignedInt i = 9; i != 15; ++i) CORRADE_VERIFY(rasterize(atlas, i));
+    CORRADE_VERIFY(atlas.find(1));
+    CORRADE_VERIFY(atlas.find(2));
+    for(UnsignedInt i = 3; i != 9; ++i) CORRADE_VERIFY(!atlas.find(i));
+    atlas.unpin();
+    CORRADE_VERIFY(!atlas.isPinned());
+
+    /* After the layout, the pinned glyphs are evicted in LRU order */
+    atlas.find(9);
+    CORRADE_VERIFY(rasterize(atlas, 15));
+    CORRADE_VERIFY(!atlas.find(10));
+    CORRADE_VERIFY(atlas.find(9));
+}
+
+void GlyphCacheAtlasTest::pinOverflow() {
+    Implementation::GlyphCacheAtlas atlas({16, 8});
+    atlas.setEvictionEnabled(true);
+    for(UnsignedInt i = 1; i != 9; ++i) rasterize(atlas, i);
+
+    /* Layout needing ten glyphs, glyphs of previous layouts are evicted, but
+       not the glyphs of this one. The last two don't fit. */
+    atlas.pin();
+    for(UnsignedInt i = 11; i != 19; ++i) CORRADE_VERIFY(rasterize(atlas, i));
+    CORRADE_VERIFY(!rasterize(atlas, 19));
+    CORRADE_VERIFY(!rasterize(atlas, 20));
+    for(UnsignedInt i = 11; i != 19; ++i) CORRADE_VERIFY(atlas.find(i));
+    CORRADE_COMPARE(atlas.evictionCount(), 8);
+    atlas.unpin();
+
+    /* Next layout can evict them again, the least recently used first */
+    CORRADE_VERIFY(rasterize(atlas, 19));
+    CORRADE_VERIFY(!atlas.find(11));
+    CORRADE_VERIFY(atlas.find(12));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Text::Test::GlyphCacheAtlasTest)
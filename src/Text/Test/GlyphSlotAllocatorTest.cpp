@@ -0,0 +1,150 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <TestSuite/Tester.h>
+
+#include "Text/Implementation/GlyphSlotAllocator.h"
+
+namespace Magnum { namespace Text { namespace Test {
+
+class GlyphSlotAllocatorTest: public TestSuite::Tester {
+    public:
+        GlyphSlotAllocatorTest();
+
+        void allocate();
+        void allocateEmpty();
+        void freeMiddle();
+        void freeEnd();
+        void merge();
+        void reuseFirstFit();
+        void appendNoFit();
+};
+
+typedef std::vector<std::pair<UnsignedInt, UnsignedInt>> Ranges;
+
+GlyphSlotAllocatorTest::GlyphSlotAllocatorTest() {
+    addTests({&GlyphSlotAllocatorTest::allocate,
+              &GlyphSlotAllocatorTest::allocateEmpty,
+              &GlyphSlotAllocatorTest::freeMiddle,
+              &GlyphSlotAllocatorTest::freeEnd,
+              &GlyphSlotAllocatorTest::merge,
+              &GlyphSlotAllocatorTest::reuseFirstFit,
+              &GlyphSlotAllocatorTest::appendNoFit});
+}
+
+void GlyphSlotAllocatorTest::allocate() {
+    Implementation::GlyphSlotAllocator slots;
+    CORRADE_COMPARE(slots.glyphCount(), 0);
+
+    CORRADE_COMPARE(slots.allocate(5), 0);
+    CORRADE_COMPARE(slots.allocate(3), 5);
+    CORRADE_COMPARE(slots.glyphCount(), 8);
+    CORRADE_VERIFY(slots.freeSlots().empty());
+}
+
+void GlyphSlotAllocatorTest::allocateEmpty() {
+    Implementation::GlyphSlotAllocator slots;
+    slots.allocate(4);
+
+    /* Empty labels don't occupy anything */
+    CORRADE_COMPARE(slots.allocate(0), 0);
+    CORRADE_COMPARE(slots.glyphCount(), 4);
+    CORRADE_VERIFY(!slots.free(0, 0));
+    CORRADE_COMPARE(slots.glyphCount(), 4);
+}
+
+void GlyphSlotAllocatorTest::freeMiddle() {
+    Implementation::GlyphSlotAllocator slots;
+    slots.allocate(5);
+    slots.allocate(3);
+    slots.allocate(2);
+
+    /* Range in the middle needs to be cleared */
+    CORRADE_VERIFY(slots.free(5, 3));
+    CORRADE_COMPARE(slots.glyphCount(), 10);
+    CORRADE_VERIFY(slots.freeSlots() == (Ranges{{5, 3}}));
+}
+
+void GlyphSlotAllocatorTest::freeEnd() {
+    Implementation::GlyphSlotAllocator slots;
+    slots.allocate(5);
+    slots.allocate(3);
+    slots.allocate(2);
+    slots.free(5, 3);
+
+    /* Range at the end shrinks the used range, together with the free range
+       before it */
+    CORRADE_VERIFY(!slots.free(8, 2));
+    CORRADE_COMPARE(slots.glyphCount(), 5);
+    CORRADE_VERIFY(slots.freeSlots().empty());
+}
+
+void GlyphSlotAllocatorTest::merge() {
+    Implementation::GlyphSlotAllocator slots;
+    for(UnsignedInt i = 0; i != 5; ++i) slots.allocate(2);
+
+    slots.free(2, 2);
+    slots.free(6, 2);
+    CORRADE_VERIFY(slots.freeSlots() == (Ranges{{2, 2}, {6, 2}}));
+
+    /* Freeing the range between merges all three */
+    slots.free(4, 2);
+    CORRADE_VERIFY(slots.freeSlots() == (Ranges{{2, 6}}));
+    CORRADE_COMPARE(slots.glyphCount(), 10);
+}
+
+void GlyphSlotAllocatorTest::reuseFirstFit() {
+    Implementation::GlyphSlotAllocator slots;
+    for(UnsignedInt i = 0; i != 5; ++i) slots.allocate(i == 1 ? 1 : 4);
+    slots.free(4, 1);
+    slots.free(9, 4);
+    CORRADE_VERIFY(slots.freeSlots() == (Ranges{{4, 1}, {9, 4}}));
+
+    /* The first range is too small, the second one is split */
+    CORRADE_COMPARE(slots.allocate(3), 9);
+    CORRADE_VERIFY(slots.freeSlots() == (Ranges{{4, 1}, {12, 1}}));
+
+    /* Exact fit removes the range */
+    CORRADE_COMPARE(slots.allocate(1), 4);
+    CORRADE_VERIFY(slots.freeSlots() == (Ranges{{12, 1}}));
+    CORRADE_COMPARE(slots.glyphCount(), 17);
+}
+
+void GlyphSlotAllocatorTest::appendNoFit() {
+    Implementation::GlyphSlotAllocator slots;
+    slots.allocate(4);
+    slots.allocate(2);
+    slots.allocate(4);
+    slots.free(4, 2);
+
+    /* Nothing fits, the label is appended */
+    CORRADE_COMPARE(slots.allocate(3), 10);
+    CORRADE_COMPARE(slots.glyphCount(), 13);
+    CORRADE_VERIFY(slots.freeSlots() == (Ranges{{4, 2}}));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Text::Test::GlyphSlotAllocatorTest)
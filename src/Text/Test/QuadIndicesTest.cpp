@@ -0,0 +1,111 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+#include <TestSuite/Tester.h>
+
+#include "Text/Implementation/QuadIndices.h"
+
+namespace Magnum { namespace Text { namespace Test {
+
+class QuadIndicesTest: public Corrade::TestSuite::Tester {
+    public:
+        QuadIndicesTest();
+
+        void unsignedByte();
+        void unsignedShort();
+        void unsignedInt();
+        void typeThresholds();
+
+    private:
+        template<class T> void verify(UnsignedInt glyphCount);
+};
+
+QuadIndicesTest::QuadIndicesTest() {
+    addTests({&QuadIndicesTest::unsignedByte,
+              &QuadIndicesTest::unsignedShort,
+              &QuadIndicesTest::unsignedInt,
+              &QuadIndicesTest::typeThresholds});
+}
+
+template<class T> void QuadIndicesTest::verify(const UnsignedInt glyphCount) {
+    std::vector<T> indices(glyphCount*6);
+    Implementation::createIndices<T>(indices.data(), glyphCount);
+
+    for(UnsignedInt i = 0; i != glyphCount; ++i) {
+        const UnsignedInt vertex = i*4;
+        const T* quad = indices.data() + i*6;
+        if(quad[0] != vertex || quad[1] != vertex+1 || quad[2] != vertex+2 ||
+           quad[3] != vertex+1 || quad[4] != vertex+3 || quad[5] != vertex+2) {
+            CORRADE_COMPARE(i, glyphCount);
+            return;
+        }
+    }
+}
+
+void QuadIndicesTest::unsignedByte() {
+    /* Largest glyph count for which the renderers use 8-bit indices, the
+       position in the output doesn't fit into 8 bits */
+    verify<UnsignedByte>(63);
+
+    std::vector<UnsignedByte> indices(63*6);
+    Implementation::createIndices<UnsignedByte>(indices.data(), 63);
+    CORRADE_COMPARE(UnsignedInt(indices[62*6]), 248);
+    CORRADE_COMPARE(UnsignedInt(indices[62*6 + 4]), 251);
+}
+
+void QuadIndicesTest::unsignedShort() {
+    /* Largest glyph count for which the renderers use 16-bit indices */
+    verify<UnsignedShort>(16383);
+
+    std::vector<UnsignedShort> indices(16383*6);
+    Implementation::createIndices<UnsignedShort>(indices.data(), 16383);
+    CORRADE_COMPARE(indices[16382*6], 65528);
+    CORRADE_COMPARE(indices[16382*6 + 4], 65531);
+}
+
+void QuadIndicesTest::unsignedInt() {
+    verify<UnsignedInt>(16384);
+}
+
+void QuadIndicesTest::typeThresholds() {
+    CORRADE_COMPARE(Implementation::indexSize(63), 1);
+    CORRADE_COMPARE(Implementation::indexSize(64), 2);
+    CORRADE_COMPARE(Implementation::indexSize(16383), 2);
+    CORRADE_COMPARE(Implementation::indexSize(16384), 4);
+
+    /* Last index just below each threshold, as prefilled by
+       AbstractTextRenderer::reserve() */
+    std::vector<char> indices(16384*6*4);
+    Implementation::createIndices(indices.data(), 63);
+    CORRADE_COMPARE(UnsignedInt(reinterpret_cast<UnsignedByte*>(indices.data())[62*6 + 4]), 251);
+    Implementation::createIndices(indices.data(), 16383);
+    CORRADE_COMPARE(reinterpret_cast<UnsignedShort*>(indices.data())[16382*6 + 4], 65531);
+    Implementation::createIndices(indices.data(), 16384);
+    CORRADE_COMPARE(reinterpret_cast<UnsignedInt*>(indices.data())[16383*6 + 4], 65535);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Text::Test::QuadIndicesTest)
@@ -35,6 +35,7 @@
 namespace Magnum { namespace Text {
 
 class AbstractFont;
+class AbstractGlyphRasterizer;
 class AbstractLayouter;
 class DistanceFieldGlyphCache;
 class GlyphCache;
@@ -44,6 +45,10 @@ template<UnsignedInt> class TextRenderer;
 typedef TextRenderer<2> TextRenderer2D;
 typedef TextRenderer<3> TextRenderer3D;
 
+template<UnsignedInt> class TextBatchRenderer;
+typedef TextBatchRenderer<2> TextBatchRenderer2D;
+typedef TextBatchRenderer<3> TextBatchRenderer3D;
+
 }}
 
 #endif
@@ -0,0 +1,263 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "TextBatchRenderer.h"
+
+#include <algorithm>
+
+#include "Shaders/AbstractVector.h"
+#include "Text/AbstractFont.h"
+#include "Text/GlyphCache.h"
+#include "Text/Implementation/QuadIndices.h"
+
+namespace Magnum { namespace Text {
+
+namespace {
+    Vector2 transformPosition(const Matrix3& transformation, const Vector2& position) {
+        return transformation.transformPoint(position);
+    }
+
+    Vector3 transformPosition(const Matrix4& transformation, const Vector2& position) {
+        return transformation.transformPoint({position, 0.0f});
+    }
+}
+
+template<UnsignedInt dimensions> TextBatchRenderer<dimensions>::TextBatchRenderer(AbstractFont* const font, const GlyphCache* const cache, const Float size, const Buffer::Usage usage): font(font), cache(cache), size(size), usage(usage), vertexBuffer(Buffer::Target::Array), indexBuffer(Buffer::Target::ElementArray), _labelCount(0), bufferCapacity(0), dirtyBegin(0), dirtyEnd(0) {
+    _mesh.setPrimitive(Mesh::Primitive::Triangles)
+        ->setIndexCount(0)
+        ->addInterleavedVertexBuffer(&vertexBuffer, 0,
+            typename Shaders::AbstractVector<dimensions>::Position(),
+            typename Shaders::AbstractVector<dimensions>::TextureCoordinates(),
+            typename Shaders::AbstractVector<dimensions>::Color());
+}
+
+template<UnsignedInt dimensions> UnsignedInt TextBatchRenderer<dimensions>::add(const std::string& text, const typename DimensionTraits<dimensions>::MatrixType& transformation, const Color4<>& color, const UnsignedInt capacity) {
+    /* Reuse ID of removed label, if any */
+    UnsignedInt id = 0;
+    while(id != labels.size() && labels[id].used) ++id;
+    if(id == labels.size()) labels.emplace_back();
+
+    Label& label = labels[id];
+    label.text = text;
+    label.transformation = transformation;
+    label.color = color;
+    label.minimalCapacity = capacity;
+    label.used = true;
+    layout(label);
+    allocate(label, std::max(UnsignedInt(label.glyphs.size()), capacity));
+    fill(label);
+
+    ++_labelCount;
+    return id;
+}
+
+template<UnsignedInt dimensions> void TextBatchRenderer<dimensions>::remove(const UnsignedInt label) {
+    CORRADE_ASSERT(label < labels.size() && labels[label].used,
+        "Text::TextBatchRenderer::remove(): label" << label << "doesn't exist", );
+
+    free(labels[label].offset, labels[label].capacity);
+    labels[label] = Label();
+    --_labelCount;
+}
+
+template<UnsignedInt dimensions> std::string TextBatchRenderer<dimensions>::text(const UnsignedInt label) const {
+    CORRADE_ASSERT(label < labels.size() && labels[label].used,
+        "Text::TextBatchRenderer::text(): label" << label << "doesn't exist", {});
+
+    return labels[label].text;
+}
+
+template<UnsignedInt dimensions> void TextBatchRenderer<dimensions>::setText(const UnsignedInt id, const std::string& text) {
+    CORRADE_ASSERT(id < labels.size() && labels[id].used,
+        "Text::TextBatchRenderer::setText(): label" << id << "doesn't exist", );
+
+    Label& label = labels[id];
+    if(label.text == text) return;
+
+    label.text = text;
+    layout(label);
+
+    /* Move the label elsewhere if it doesn't fit into its slots anymore */
+    if(label.glyphs.size() > label.capacity) {
+        free(label.offset, label.capacity);
+        allocate(label, std::max(UnsignedInt(label.glyphs.size()), label.minimalCapacity));
+    }
+
+    fill(label);
+}
+
+template<UnsignedInt dimensions> typename DimensionTraits<dimensions>::MatrixType TextBatchRenderer<dimensions>::transformation(const UnsignedInt label) const {
+    CORRADE_ASSERT(label < labels.size() && labels[label].used,
+        "Text::TextBatchRenderer::transformation(): label" << label << "doesn't exist", {});
+
+    return labels[label].transformation;
+}
+
+template<UnsignedInt dimensions> void TextBatchRenderer<dimensions>::setTransformation(const UnsignedInt label, const typename DimensionTraits<dimensions>::MatrixType& transformation) {
+    CORRADE_ASSERT(label < labels.size() && labels[label].used,
+        "Text::TextBatchRenderer::setTransformation(): label" << label << "doesn't exist", );
+
+    labels[label].transformation = transformation;
+    fill(labels[label]);
+}
+
+template<UnsignedInt dimensions> Color4<> TextBatchRenderer<dimensions>::color(const UnsignedInt label) const {
+    CORRADE_ASSERT(label < labels.size() && labels[label].used,
+        "Text::TextBatchRenderer::color(): label" << label << "doesn't exist", {});
+
+    return labels[label].color;
+}
+
+template<UnsignedInt dimensions> void TextBatchRenderer<dimensions>::setColor(const UnsignedInt label, const Color4<>& color) {
+    CORRADE_ASSERT(label < labels.size() && labels[label].used,
+        "Text::TextBatchRenderer::setColor(): label" << label << "doesn't exist", );
+
+    labels[label].color = color;
+    fill(labels[label]);
+}
+
+template<UnsignedInt dimensions> Rectangle TextBatchRenderer<dimensions>::rectangle(const UnsignedInt label) const {
+    CORRADE_ASSERT(label < labels.size() && labels[label].used,
+        "Text::TextBatchRenderer::rectangle(): label" << label << "doesn't exist", {});
+
+    return labels[label].rectangle;
+}
+
+template<UnsignedInt dimensions> void TextBatchRenderer<dimensions>::flush() {
+    /* Buffer was enlarged, upload everything and regenerate indices */
+    if(bufferCapacity != vertices.size()/4) {
+        bufferCapacity = vertices.size()/4;
+        vertexBuffer.setData(vertices, usage);
+
+        const UnsignedInt vertexCount = bufferCapacity*4;
+        const UnsignedInt indexCount = bufferCapacity*6;
+        Mesh::IndexType indexType;
+        std::vector<char> indices;
+        if(vertexCount < 255) {
+            indexType = Mesh::IndexType::UnsignedByte;
+            indices.resize(indexCount*sizeof(UnsignedByte));
+            Implementation::createIndices<UnsignedByte>(indices.data(), bufferCapacity);
+        } else if(vertexCount < 65535) {
+            indexType = Mesh::IndexType::UnsignedShort;
+            indices.resize(indexCount*sizeof(UnsignedShort));
+            Implementation::createIndices<UnsignedShort>(indices.data(), bufferCapacity);
+        } else {
+            indexType = Mesh::IndexType::UnsignedInt;
+            indices.resize(indexCount*sizeof(UnsignedInt));
+            Implementation::createIndices<UnsignedInt>(indices.data(), bufferCapacity);
+        }
+        indexBuffer.setData(indices, Buffer::Usage::StaticDraw);
+        _mesh.setIndexBuffer(&indexBuffer, 0, indexType, 0, vertexCount);
+
+    /* Upload only the changed range */
+    } else if(dirtyBegin != dirtyEnd) {
+        vertexBuffer.setSubData(dirtyBegin*4*sizeof(Vertex), (dirtyEnd - dirtyBegin)*4*sizeof(Vertex), vertices.data() + dirtyBegin*4);
+    }
+
+    dirtyBegin = dirtyEnd = 0;
+    _mesh.setIndexCount(slots.glyphCount()*6);
+}
+
+template<UnsignedInt dimensions> void TextBatchRenderer<dimensions>::layout(Label& label) {
+    /* Don't evict glyphs of this layout while it's in progress */
+    cache->pinGlyphs();
+    AbstractLayouter* const layouter = font->layout(cache, size, label.text);
+    const UnsignedInt glyphCount = layouter->glyphCount();
+
+    label.glyphs.resize(glyphCount);
+    label.rectangle = {};
+    Vector2 cursorPosition;
+    for(UnsignedInt i = 0; i != glyphCount; ++i) {
+        /* Position of the texture in the resulting glyph, texture coordinates */
+        Rectangle quadPosition, textureCoordinates;
+        Vector2 advance;
+        std::tie(quadPosition, textureCoordinates, advance) = layouter->renderGlyph(cursorPosition, i);
+
+        if(i == 0)
+            label.rectangle.bottomLeft() = quadPosition.bottomLeft();
+        if(i == glyphCount-1)
+            label.rectangle.topRight() = quadPosition.topRight();
+
+        label.glyphs[i] = {quadPosition, textureCoordinates};
+
+        /* Advance cursor position to next character */
+        cursorPosition += advance;
+    }
+
+    delete layouter;
+    cache->unpinGlyphs();
+}
+
+template<UnsignedInt dimensions> void TextBatchRenderer<dimensions>::allocate(Label& label, const UnsignedInt capacity) {
+    label.capacity = capacity;
+    label.offset = slots.allocate(capacity);
+
+    /* Enlarge the buffer, it will be reallocated on next flush() */
+    if(slots.glyphCount()*4 > vertices.size())
+        vertices.resize(std::max(slots.glyphCount(), UnsignedInt(vertices.size()/2))*4);
+}
+
+template<UnsignedInt dimensions> void TextBatchRenderer<dimensions>::free(const UnsignedInt offset, const UnsignedInt capacity) {
+    /* Slots past the end of the used range are not drawn anymore, so only
+       ranges in the middle need to be cleared */
+    if(slots.free(offset, capacity)) clear(offset, capacity);
+}
+
+template<UnsignedInt dimensions> void TextBatchRenderer<dimensions>::fill(const Label& label) {
+    for(std::size_t i = 0; i != label.glyphs.size(); ++i) {
+        const Rectangle& quadPosition = label.glyphs[i].first;
+        const Rectangle& textureCoordinates = label.glyphs[i].second;
+        Vertex* const out = vertices.data() + (label.offset + i)*4;
+        out[0] = {transformPosition(label.transformation, quadPosition.topLeft()), textureCoordinates.topLeft(), label.color};
+        out[1] = {transformPosition(label.transformation, quadPosition.bottomLeft()), textureCoordinates.bottomLeft(), label.color};
+        out[2] = {transformPosition(label.transformation, quadPosition.topRight()), textureCoordinates.topRight(), label.color};
+        out[3] = {transformPosition(label.transformation, quadPosition.bottomRight()), textureCoordinates.bottomRight(), label.color};
+    }
+
+    /* Unused slots are degenerate */
+    clear(label.offset + label.glyphs.size(), label.capacity - label.glyphs.size());
+    markDirty(label.offset, label.glyphs.size());
+}
+
+template<UnsignedInt dimensions> void TextBatchRenderer<dimensions>::clear(const UnsignedInt offset, const UnsignedInt count) {
+    std::fill(vertices.begin() + offset*4, vertices.begin() + (offset + count)*4, Vertex());
+    markDirty(offset, count);
+}
+
+template<UnsignedInt dimensions> void TextBatchRenderer<dimensions>::markDirty(const UnsignedInt offset, const UnsignedInt count) {
+    if(!count) return;
+
+    if(dirtyBegin == dirtyEnd) {
+        dirtyBegin = offset;
+        dirtyEnd = offset + count;
+    } else {
+        dirtyBegin = std::min(dirtyBegin, offset);
+        dirtyEnd = std::max(dirtyEnd, offset + count);
+    }
+}
+
+template class TextBatchRenderer<2>;
+template class TextBatchRenderer<3>;
+
+}}
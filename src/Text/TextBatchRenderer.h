@@ -0,0 +1,246 @@
+#ifndef Magnum_Text_TextBatchRenderer_h
+#define Magnum_Text_TextBatchRenderer_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class Magnum::Text::TextBatchRenderer, typedef Magnum::Text::TextBatchRenderer2D, Magnum::Text::TextBatchRenderer3D
+ */
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Math/Matrix3.h"
+#include "Math/Matrix4.h"
+#include "Math/Geometry/Rectangle.h"
+#include "Buffer.h"
+#include "Color.h"
+#include "DimensionTraits.h"
+#include "Mesh.h"
+#include "Text/Text.h"
+#include "Text/Implementation/GlyphSlotAllocator.h"
+
+#include "magnumTextVisibility.h"
+
+namespace Magnum { namespace Text {
+
+/**
+@brief Batched text renderer
+
+Renders many independent labels, each with its own transformation and color,
+into one shared vertex buffer, so all of them are drawn with single draw call.
+Compared to having separate TextRenderer for each label, this saves both
+draw calls and buffer objects, which is useful for text-heavy user interfaces.
+
+@section TextBatchRenderer-usage Usage
+
+The mesh is meant to be used with Shaders::Vector with
+@ref Shaders::Vector::Flag "Shaders::Vector::Flag::VertexColor" enabled:
+@code
+Text::AbstractFont* font;
+Text::GlyphCache* cache;
+Shaders::Vector2D shader(Shaders::Vector2D::Flag::VertexColor);
+
+Text::TextBatchRenderer2D batch(font, cache, 0.05f);
+UnsignedInt fps = batch.add("FPS: 60", Matrix3::translation({-0.9f, 0.9f}), Color3<>(1.0f));
+batch.add("Score: 0", Matrix3::translation({0.5f, 0.9f}), Color3<>(1.0f, 0.8f, 0.0f));
+
+// Update single label
+batch.setText(fps, "FPS: 59");
+
+// Draw all labels
+shader.setTransformationProjectionMatrix(projection)
+    ->use();
+cache->texture()->bind(Shaders::Vector2D::VectorTextureLayer);
+batch.draw();
+@endcode
+
+@section TextBatchRenderer-slots Glyph slots
+
+Each label occupies contiguous range of glyph slots in the vertex buffer,
+sized for its glyph count or for capacity specified in add(), whichever is
+larger. Changing the text of a label re-renders only that label. If it no
+longer fits into its slots, it is moved to another free range. Unused slots
+are filled with degenerate quads. The vertex buffer grows as needed; only the
+changed range is uploaded on next flush(), unless the buffer had to be
+reallocated.
+
+@see TextBatchRenderer2D, TextBatchRenderer3D
+*/
+template<UnsignedInt dimensions> class MAGNUM_TEXT_EXPORT TextBatchRenderer {
+    public:
+        /**
+         * @brief Constructor
+         * @param font          Font
+         * @param cache         Glyph cache
+         * @param size          Font size
+         * @param usage         Vertex buffer usage
+         */
+        explicit TextBatchRenderer(AbstractFont* font, const GlyphCache* cache, Float size, Buffer::Usage usage = Buffer::Usage::DynamicDraw);
+
+        /** @brief Count of labels */
+        std::size_t labelCount() const { return _labelCount; }
+
+        /**
+         * @brief Count of glyph slots in use
+         *
+         * Including unused slots of labels and free slots between them.
+         */
+        UnsignedInt glyphCount() const { return slots.glyphCount(); }
+
+        /**
+         * @brief Add label
+         * @param text              %Text
+         * @param transformation    Transformation of the label
+         * @param color             Color of the label
+         * @param capacity          Count of glyph slots to reserve for the
+         *      label
+         *
+         * Specifying @p capacity large enough for all future texts of the
+         * label avoids moving the label around the buffer when the text
+         * changes. Returns label ID, which is reused after the label is
+         * removed.
+         */
+        UnsignedInt add(const std::string& text, const typename DimensionTraits<dimensions>::MatrixType& transformation, const Color4<>& color, UnsignedInt capacity = 0);
+
+        /**
+         * @brief Remove label
+         *
+         * The glyph slots are reused by labels added later.
+         */
+        void remove(UnsignedInt label);
+
+        /** @brief Label text */
+        std::string text(UnsignedInt label) const;
+
+        /**
+         * @brief Set label text
+         *
+         * Does nothing if the text didn't change.
+         */
+        void setText(UnsignedInt label, const std::string& text);
+
+        /** @brief Label transformation */
+        typename DimensionTraits<dimensions>::MatrixType transformation(UnsignedInt label) const;
+
+        /**
+         * @brief Set label transformation
+         *
+         * The glyphs are not laid out again, only their vertex positions are
+         * recalculated.
+         */
+        void setTransformation(UnsignedInt label, const typename DimensionTraits<dimensions>::MatrixType& transformation);
+
+        /** @brief Label color */
+        Color4<> color(UnsignedInt label) const;
+
+        /**
+         * @brief Set label color
+         *
+         * The glyphs are not laid out again.
+         */
+        void setColor(UnsignedInt label, const Color4<>& color);
+
+        /** @brief Untransformed rectangle spanning the label text */
+        Rectangle rectangle(UnsignedInt label) const;
+
+        /**
+         * @brief Upload changed data to vertex buffer
+         *
+         * Called automatically from draw(), call it explicitly if you need
+         * to draw mesh() in other way.
+         */
+        void flush();
+
+        /** @brief Mesh with all labels */
+        Mesh* mesh() { return &_mesh; }
+
+        /**
+         * @brief Draw all labels
+         *
+         * Calls flush() and draws the mesh. Shader and glyph cache texture
+         * must be set up before.
+         */
+        void draw() {
+            flush();
+            _mesh.draw();
+        }
+
+    private:
+        struct Vertex {
+            typename DimensionTraits<dimensions>::VectorType position;
+            Vector2 textureCoordinates;
+            Color4<> color;
+        };
+
+        struct Label {
+            std::string text;
+            typename DimensionTraits<dimensions>::MatrixType transformation;
+            Color4<> color;
+            Rectangle rectangle;
+
+            /* Untransformed quad positions and texture coordinates */
+            std::vector<std::pair<Rectangle, Rectangle>> glyphs;
+
+            /* Glyph slot range and capacity requested by the user */
+            UnsignedInt offset, capacity, minimalCapacity;
+
+            /* False for removed labels */
+            bool used;
+        };
+
+        void layout(Label& label);
+        void allocate(Label& label, UnsignedInt capacity);
+        void free(UnsignedInt offset, UnsignedInt capacity);
+        void fill(const Label& label);
+        void clear(UnsignedInt offset, UnsignedInt count);
+        void markDirty(UnsignedInt offset, UnsignedInt count);
+
+        AbstractFont* const font;
+        const GlyphCache* const cache;
+        const Float size;
+        const Buffer::Usage usage;
+
+        Mesh _mesh;
+        Buffer vertexBuffer, indexBuffer;
+
+        std::vector<Label> labels;
+        std::size_t _labelCount;
+
+        Implementation::GlyphSlotAllocator slots;
+
+        std::vector<Vertex> vertices;
+        UnsignedInt bufferCapacity, dirtyBegin, dirtyEnd;
+};
+
+/** @brief Two-dimensional batched text renderer */
+typedef TextBatchRenderer<2> TextBatchRenderer2D;
+
+/** @brief Three-dimensional batched text renderer */
+typedef TextBatchRenderer<3> TextBatchRenderer3D;
+
+}}
+
+#endif
@@ -24,36 +24,20 @@
 
 #include "TextRenderer.h"
 
+#include <algorithm>
+
 #include "Context.h"
 #include "Extensions.h"
 #include "Mesh.h"
 #include "Shaders/AbstractVector.h"
 #include "Text/AbstractFont.h"
+#include "Text/GlyphCache.h"
+#include "Text/Implementation/QuadIndices.h"
 
 namespace Magnum { namespace Text {
 
 namespace {
 
-template<class T> void createIndices(void* output, const UnsignedInt glyphCount) {
-    T* const out = reinterpret_cast<T*>(output);
-    for(UnsignedInt i = 0; i != glyphCount; ++i) {
-        /* 0---2 2
-           |  / /|
-           | / / |
-           |/ /  |
-           1 1---3 */
-
-        const T vertex = i*4;
-        const T pos = i*6;
-        out[pos]   = vertex;
-        out[pos+1] = vertex+1;
-        out[pos+2] = vertex+2;
-        out[pos+3] = vertex+1;
-        out[pos+4] = vertex+3;
-        out[pos+5] = vertex+2;
-    }
-}
-
 struct Vertex {
     Vector2 position, texcoords;
 };
@@ -61,6 +45,8 @@ struct Vertex {
 }
 
 std::tuple<std::vector<Vector2>, std::vector<Vector2>, std::vector<UnsignedInt>, Rectangle> AbstractTextRenderer::render(AbstractFont* const font, const GlyphCache* const cache, Float size, const std::string& text) {
+    /* Don't evict glyphs of this layout while it's in progress */
+    cache->pinGlyphs();
     AbstractLayouter* const layouter = font->layout(cache, size, text);
     const UnsignedInt vertexCount = layouter->glyphCount()*4;
 
@@ -96,17 +82,20 @@ std::tuple<std::vector<Vector2>, std::vector<Vector2>, std::vector<UnsignedInt>,
 
     /* Create indices */
     std::vector<UnsignedInt> indices(layouter->glyphCount()*6);
-    createIndices<UnsignedInt>(indices.data(), layouter->glyphCount());
+    Implementation::createIndices<UnsignedInt>(indices.data(), layouter->glyphCount());
 
     /* Rendered rectangle */
     Rectangle rectangle;
     if(layouter->glyphCount()) rectangle = {positions[1], positions[positions.size()-2]};
 
     delete layouter;
+    cache->unpinGlyphs();
     return std::make_tuple(std::move(positions), std::move(texcoords), std::move(indices), rectangle);
 }
 
 std::tuple<Mesh, Rectangle> AbstractTextRenderer::render(AbstractFont* const font, const GlyphCache* const cache, Float size, const std::string& text, Buffer* vertexBuffer, Buffer* indexBuffer, Buffer::Usage usage) {
+    /* Don't evict glyphs of this layout while it's in progress */
+    cache->pinGlyphs();
     AbstractLayouter* const layouter = font->layout(cache, size, text);
 
     const UnsignedInt vertexCount = layouter->glyphCount()*4;
@@ -144,20 +133,20 @@ std::tuple<Mesh, Rectangle> AbstractTextRenderer::render(AbstractFont* const fon
         indexType = Mesh::IndexType::UnsignedByte;
         indicesSize = indexCount*sizeof(UnsignedByte);
         indices = new char[indicesSize];
-        createIndices<UnsignedByte>(indices, layouter->glyphCount());
+        Implementation::createIndices<UnsignedByte>(indices, layouter->glyphCount());
     } else if(vertexCount < 65535) {
         indexType = Mesh::IndexType::UnsignedShort;
         indicesSize = indexCount*sizeof(UnsignedShort);
         indices = new char[indicesSize];
-        createIndices<UnsignedShort>(indices, layouter->glyphCount());
+        Implementation::createIndices<UnsignedShort>(indices, layouter->glyphCount());
     } else {
         indexType = Mesh::IndexType::UnsignedInt;
         indicesSize = indexCount*sizeof(UnsignedInt);
         indices = new char[indicesSize];
-        createIndices<UnsignedInt>(indices, layouter->glyphCount());
+        Implementation::createIndices<UnsignedInt>(indices, layouter->glyphCount());
     }
     indexBuffer->setData(indicesSize, indices, usage);
-    delete indices;
+    delete[] indices;
 
     /* Rendered rectangle */
     Rectangle rectangle;
@@ -171,6 +160,7 @@ std::tuple<Mesh, Rectangle> AbstractTextRenderer::render(AbstractFont* const fon
         ->setIndexBuffer(indexBuffer, 0, indexType, 0, vertexCount);
 
     delete layouter;
+    cache->unpinGlyphs();
     return std::make_tuple(std::move(mesh), rectangle);
 }
 
@@ -182,10 +172,10 @@ template<UnsignedInt dimensions> std::tuple<Mesh, Rectangle> TextRenderer<dimens
             typename Shaders::AbstractVector<dimensions>::Position(
                 Shaders::AbstractVector<dimensions>::Position::Components::Two),
             typename Shaders::AbstractVector<dimensions>::TextureCoordinates());
-    return std::move(r);
+    return r;
 }
 
-AbstractTextRenderer::AbstractTextRenderer(AbstractFont* const font, const GlyphCache* const cache, Float size): vertexBuffer(Buffer::Target::Array), indexBuffer(Buffer::Target::ElementArray), font(font), cache(cache), size(size), _capacity(0) {
+AbstractTextRenderer::AbstractTextRenderer(AbstractFont* const font, const GlyphCache* const cache, Float size): vertexBuffer(Buffer::Target::Array), indexBuffer(Buffer::Target::ElementArray), font(font), cache(cache), size(size), _capacity(0), _indexCapacity(0) {
     #ifndef MAGNUM_TARGET_GLES
     MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::ARB::map_buffer_range);
     #else
@@ -210,51 +200,59 @@ template<UnsignedInt dimensions> TextRenderer<dimensions>::TextRenderer(Abstract
 void AbstractTextRenderer::reserve(const uint32_t glyphCount, const Buffer::Usage vertexBufferUsage, const Buffer::Usage indexBufferUsage) {
     _capacity = glyphCount;
 
+    /* Allocate vertex buffer, reset vertex count and discard rendered text */
+    vertexBuffer.setData(glyphCount*4*sizeof(Vertex), nullptr, vertexBufferUsage);
+    _mesh.setVertexCount(0)
+        ->setIndexCount(0);
+    _rectangle = {};
+    _text.clear();
+    _glyphs.clear();
+
+    /* Indices for smaller capacity are prefix of indices for larger one, thus
+       regenerate the index buffer only if the capacity grows */
+    if(glyphCount <= _indexCapacity) return;
+    _indexCapacity = glyphCount;
+
     const UnsignedInt vertexCount = glyphCount*4;
     const UnsignedInt indexCount = glyphCount*6;
 
-    /* Allocate vertex buffer, reset vertex count */
-    vertexBuffer.setData(vertexCount*sizeof(Vertex), nullptr, vertexBufferUsage);
-    _mesh.setVertexCount(0);
-
-    /* Allocate index buffer, reset index count and reconfigure buffer binding */
+    /* Allocate index buffer and reconfigure buffer binding */
+    const std::size_t indexSize = Implementation::indexSize(glyphCount);
+    const std::size_t indicesSize = indexCount*indexSize;
     Mesh::IndexType indexType;
-    std::size_t indicesSize;
-    if(vertexCount < 255) {
+    if(indexSize == sizeof(UnsignedByte))
         indexType = Mesh::IndexType::UnsignedByte;
-        indicesSize = indexCount*sizeof(UnsignedByte);
-    } else if(vertexCount < 65535) {
+    else if(indexSize == sizeof(UnsignedShort))
         indexType = Mesh::IndexType::UnsignedShort;
-        indicesSize = indexCount*sizeof(UnsignedShort);
-    } else {
+    else
         indexType = Mesh::IndexType::UnsignedInt;
-        indicesSize = indexCount*sizeof(UnsignedInt);
-    }
     indexBuffer.setData(indicesSize, nullptr, indexBufferUsage);
-    _mesh.setIndexCount(0)
-        ->setIndexBuffer(&indexBuffer, 0, indexType, 0, vertexCount);
+    _mesh.setIndexBuffer(&indexBuffer, 0, indexType, 0, vertexCount);
 
     /* Prefill index buffer */
     void* indices = indexBuffer.map(0, indicesSize, Buffer::MapFlag::InvalidateBuffer|Buffer::MapFlag::Write);
-    if(vertexCount < 255)
-        createIndices<UnsignedByte>(indices, glyphCount);
-    else if(vertexCount < 65535)
-        createIndices<UnsignedShort>(indices, glyphCount);
-    else
-        createIndices<UnsignedInt>(indices, glyphCount);
+    Implementation::createIndices(indices, glyphCount);
     CORRADE_INTERNAL_ASSERT_OUTPUT(indexBuffer.unmap());
 }
 
 void AbstractTextRenderer::render(const std::string& text) {
+    /* Nothing changed. With lazily filled cache the glyphs need to be looked
+       up again, otherwise they might get evicted. */
+    if(text == _text && !cache->rasterizer()) return;
+
+    /* Don't evict glyphs of this layout while it's in progress */
+    cache->pinGlyphs();
     AbstractLayouter* layouter = font->layout(cache, size, text);
+    const UnsignedInt glyphCount = layouter->glyphCount();
 
-    CORRADE_ASSERT(layouter->glyphCount() <= _capacity, "Text::TextRenderer::render(): capacity" << _capacity << "too small to render" << layouter->glyphCount() << "glyphs", );
+    CORRADE_ASSERT(glyphCount <= _capacity, "Text::TextRenderer::render(): capacity" << _capacity << "too small to render" << glyphCount << "glyphs", );
 
-    /* Render all glyphs */
-    Vertex* const vertices = static_cast<Vertex*>(vertexBuffer.map(0, layouter->glyphCount()*4*sizeof(Vertex),
-        Buffer::MapFlag::InvalidateBuffer|Buffer::MapFlag::Write));
+    /* Lay out all glyphs and find range which differs from previous text */
+    const UnsignedInt previousGlyphCount = _glyphs.size();
+    _glyphs.resize(glyphCount);
+    UnsignedInt changedBegin = glyphCount, changedEnd = 0;
     Vector2 cursorPosition;
-    for(UnsignedInt i = 0; i != layouter->glyphCount(); ++i) {
+    for(UnsignedInt i = 0; i != glyphCount; ++i) {
         /* Position of the texture in the resulting glyph, texture coordinates */
         Rectangle quadPosition, textureCoordinates;
         Vector2 advance;
@@ -262,24 +260,42 @@ void AbstractTextRenderer::render(const std::string& text) {
 
         if(i == 0)
             _rectangle.bottomLeft() = quadPosition.bottomLeft();
-        else if(i == layouter->glyphCount()-1)
+        if(i == glyphCount-1)
             _rectangle.topRight() = quadPosition.topRight();
 
-        const std::size_t vertex = i*4;
-        vertices[vertex]   = {quadPosition.topLeft(), textureCoordinates.topLeft()};
-        vertices[vertex+1] = {quadPosition.bottomLeft(), textureCoordinates.bottomLeft()};
-        vertices[vertex+2] = {quadPosition.topRight(), textureCoordinates.topRight()};
-        vertices[vertex+3] = {quadPosition.bottomRight(), textureCoordinates.bottomRight()};
+        if(i >= previousGlyphCount || _glyphs[i].first != quadPosition || _glyphs[i].second != textureCoordinates) {
+            _glyphs[i] = {quadPosition, textureCoordinates};
+            changedBegin = std::min(changedBegin, i);
+            changedEnd = i + 1;
+        }
 
         /* Advance cursor position to next character */
         cursorPosition += advance;
     }
-    CORRADE_INTERNAL_ASSERT_OUTPUT(vertexBuffer.unmap());
+    if(!glyphCount) _rectangle = {};
+
+    /* Update only the changed glyphs */
+    if(changedBegin < changedEnd) {
+        Vertex* const vertices = static_cast<Vertex*>(vertexBuffer.map(changedBegin*4*sizeof(Vertex), (changedEnd - changedBegin)*4*sizeof(Vertex),
+            Buffer::MapFlag::InvalidateRange|Buffer::MapFlag::Write));
+        for(UnsignedInt i = changedBegin; i != changedEnd; ++i) {
+            const Rectangle& quadPosition = _glyphs[i].first;
+            const Rectangle& textureCoordinates = _glyphs[i].second;
+            const std::size_t vertex = (i - changedBegin)*4;
+            vertices[vertex]   = {quadPosition.topLeft(), textureCoordinates.topLeft()};
+            vertices[vertex+1] = {quadPosition.bottomLeft(), textureCoordinates.bottomLeft()};
+            vertices[vertex+2] = {quadPosition.topRight(), textureCoordinates.topRight()};
+            vertices[vertex+3] = {quadPosition.bottomRight(), textureCoordinates.bottomRight()};
+        }
+        CORRADE_INTERNAL_ASSERT_OUTPUT(vertexBuffer.unmap());
+    }
 
     /* Update index count */
-    _mesh.setIndexCount(layouter->glyphCount()*6);
+    _mesh.setIndexCount(glyphCount*6);
+    _text = text;
 
     delete layouter;
+    cache->unpinGlyphs();
 }
 
 template class TextRenderer<2>;
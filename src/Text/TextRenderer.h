@@ -91,8 +91,10 @@ class MAGNUM_TEXT_EXPORT AbstractTextRenderer {
          * Reallocates memory in buffers to hold @p glyphCount glyphs and
          * prefills index buffer. Consider using appropriate @p vertexBufferUsage
          * if the text will be changed frequently. Index buffer is changed
-         * only by calling this function, thus @p indexBufferUsage generally
-         * doesn't need to be so dynamic if the capacity won't be changed much.
+         * only by calling this function and only if @p glyphCount is larger
+         * than any capacity reserved before, thus @p indexBufferUsage
+         * generally doesn't need to be so dynamic. Previously rendered text
+         * is discarded.
          *
          * Initially zero capacity is reserved.
          * @see capacity()
@@ -106,6 +108,12 @@ class MAGNUM_TEXT_EXPORT AbstractTextRenderer {
          * filled with reserve(). Rectangle spanning the rendered text is
          * available through rectangle().
          *
+         * The text is compared to previously rendered one and only the range
+         * of changed glyphs is mapped and updated in the vertex buffer. If
+         * the text is the same as before, nothing is done, except when the
+         * glyph cache is filled lazily, in which case the text is laid out
+         * again to keep its glyphs in the cache.
+         *
          * Initially no text is rendered.
          * @attention The capacity must be large enough to contain all glyphs,
          *      see reserve() for more information.
@@ -126,8 +134,13 @@ class MAGNUM_TEXT_EXPORT AbstractTextRenderer {
         AbstractFont* const font;
         const GlyphCache* const cache;
         Float size;
-        UnsignedInt _capacity;
+        UnsignedInt _capacity, _indexCapacity;
         Rectangle _rectangle;
+
+        /* Currently rendered text and its glyph quad positions and texture
+           coordinates, used for updating only changed vertex data */
+        std::string _text;
+        std::vector<std::pair<Rectangle, Rectangle>> _glyphs;
 };
 
 /**
@@ -24,21 +24,204 @@
 
 #include "Atlas.h"
 
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
 #include "Math/Functions.h"
 #include "Math/Geometry/Rectangle.h"
 
 namespace Magnum { namespace TextureTools {
 
-std::vector<Rectanglei> atlas(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding) {
-    if(sizes.empty()) return {};
+namespace {
+
+inline Vector2i flipped(const Vector2i& size) { return {size.y(), size.x()}; }
+
+/* Skyline bottom-left packer. The skyline is list of horizontal segments
+   formed by top edges of placed textures, sorted by X and covering whole atlas
+   width, each new texture is placed on it as low as possible. */
+class SkylinePacker {
+    public:
+        explicit SkylinePacker(const Vector2i& size): _size(size), _skyline{{0, 0, size.x()}} {}
+
+        bool insert(const Vector2i& size, bool allowRotation, Vector2i& position, bool& rotated);
+
+    private:
+        struct Segment {
+            Int x, y, width;
+        };
+
+        Int fit(std::size_t i, const Vector2i& size) const;
+        void add(std::size_t i, const Vector2i& position, const Vector2i& size);
+
+        Vector2i _size;
+        std::vector<Segment> _skyline;
+};
+
+/* Y coordinate at which texture of given size fits when its left edge is at
+   the beginning of i-th segment, -1 if it doesn't fit */
+Int SkylinePacker::fit(std::size_t i, const Vector2i& size) const {
+    if(_skyline[i].x + size.x() > _size.x()) return -1;
+
+    Int y = _skyline[i].y;
+    for(Int widthLeft = size.x(); widthLeft > 0; widthLeft -= _skyline[i++].width) {
+        y = std::max(y, _skyline[i].y);
+        if(y + size.y() > _size.y()) return -1;
+    }
+
+    return y;
+}
+
+bool SkylinePacker::insert(const Vector2i& size, const bool allowRotation, Vector2i& position, bool& rotated) {
+    Int bestTop = std::numeric_limits<Int>::max();
+    std::size_t bestSegment = 0;
+
+    for(std::size_t i = 0; i != _skyline.size(); ++i) {
+        const Int y = fit(i, size);
+        if(y != -1 && y + size.y() < bestTop) {
+            bestTop = y + size.y();
+            bestSegment = i;
+            position = {_skyline[i].x, y};
+            rotated = false;
+        }
+
+        if(!allowRotation) continue;
+        const Int yRotated = fit(i, flipped(size));
+        if(yRotated != -1 && yRotated + size.x() < bestTop) {
+            bestTop = yRotated + size.x();
+            bestSegment = i;
+            position = {_skyline[i].x, yRotated};
+            rotated = true;
+        }
+    }
+
+    if(bestTop == std::numeric_limits<Int>::max()) return false;
+
+    add(bestSegment, position, rotated ? flipped(size) : size);
+    return true;
+}
+
+void SkylinePacker::add(const std::size_t i, const Vector2i& position, const Vector2i& size) {
+    _skyline.insert(_skyline.begin()+i, {position.x(), position.y() + size.y(), size.x()});
+
+    /* Shrink or remove segments covered by the new one */
+    const Int right = position.x() + size.x();
+    std::size_t j = i+1;
+    while(j != _skyline.size() && _skyline[j].x < right) {
+        const Int shrink = right - _skyline[j].x;
+        if(shrink < _skyline[j].width) {
+            _skyline[j].x += shrink;
+            _skyline[j].width -= shrink;
+            break;
+        }
+
+        ++j;
+    }
+    _skyline.erase(_skyline.begin()+i+1, _skyline.begin()+j);
+
+    /* Merge with neighbors on the same height */
+    if(i+1 != _skyline.size() && _skyline[i+1].y == _skyline[i].y) {
+        _skyline[i].width += _skyline[i+1].width;
+        _skyline.erase(_skyline.begin()+i+1);
+    }
+    if(i != 0 && _skyline[i-1].y == _skyline[i].y) {
+        _skyline[i-1].width += _skyline[i].width;
+        _skyline.erase(_skyline.begin()+i);
+    }
+}
+
+/* MaxRects packer with bottom-left rule. Keeps list of maximal free
+   rectangles (which may overlap), none of them is contained in another. */
+class MaxRectsPacker {
+    public:
+        explicit MaxRectsPacker(const Vector2i& size): _free{Rectanglei({}, size)} {}
+
+        bool insert(const Vector2i& size, bool allowRotation, Vector2i& position, bool& rotated);
+
+    private:
+        void place(const Rectanglei& used);
+
+        std::vector<Rectanglei> _free, _newFree;
+};
+
+bool MaxRectsPacker::insert(const Vector2i& size, const bool allowRotation, Vector2i& position, bool& rotated) {
+    Int bestTop = std::numeric_limits<Int>::max();
+    Int bestLeft = std::numeric_limits<Int>::max();
+
+    for(const Rectanglei& free: _free) {
+        for(const bool rotate: {false, true}) {
+            if(rotate && !allowRotation) break;
+
+            const Vector2i rotatedSize = rotate ? flipped(size) : size;
+            if(free.width() < rotatedSize.x() || free.height() < rotatedSize.y()) continue;
+
+            const Int top = free.bottom() + rotatedSize.y();
+            if(top < bestTop || (top == bestTop && free.left() < bestLeft)) {
+                bestTop = top;
+                bestLeft = free.left();
+                position = free.bottomLeft();
+                rotated = rotate;
+            }
+        }
+    }
+
+    if(bestTop == std::numeric_limits<Int>::max()) return false;
+
+    place(Rectanglei::fromSize(position, rotated ? flipped(size) : size));
+    return true;
+}
+
+void MaxRectsPacker::place(const Rectanglei& used) {
+    /* Split all free rectangles intersecting the used one into up to four
+       maximal rectangles around it */
+    _newFree.clear();
+    for(std::size_t i = 0; i != _free.size(); ) {
+        const Rectanglei free = _free[i];
+        if(used.left() >= free.right() || used.right() <= free.left() ||
+           used.bottom() >= free.top() || used.top() <= free.bottom()) {
+            ++i;
+            continue;
+        }
+
+        if(used.left() > free.left())
+            _newFree.push_back({free.bottomLeft(), {used.left(), free.top()}});
+        if(used.right() < free.right())
+            _newFree.push_back({{used.right(), free.bottom()}, free.topRight()});
+        if(used.bottom() > free.bottom())
+            _newFree.push_back({free.bottomLeft(), {free.right(), used.bottom()}});
+        if(used.top() < free.top())
+            _newFree.push_back({{free.left(), used.top()}, free.topRight()});
+
+        _free[i] = _free.back();
+        _free.pop_back();
+    }
+
+    /* The remaining free rectangles are not contained in each other and the
+       new ones are parts of removed ones, so it's enough to check the new
+       ones against all others */
+    auto contains = [](const Rectanglei& a, const Rectanglei& b) {
+        return a.left() <= b.left() && a.bottom() <= b.bottom() &&
+               a.right() >= b.right() && a.top() >= b.top();
+    };
+    for(std::size_t i = 0; i != _newFree.size(); ++i) {
+        bool contained = false;
+        for(std::size_t j = 0; j != _newFree.size() && !contained; ++j)
+            /* From two equal rectangles keep only the first one */
+            contained = i != j && contains(_newFree[j], _newFree[i]) && (j < i || _newFree[j] != _newFree[i]);
+        for(std::size_t j = 0; j != _free.size() && !contained; ++j)
+            contained = contains(_free[j], _newFree[i]);
 
+        if(!contained) _free.push_back(_newFree[i]);
+    }
+}
+
+/* Original grid layout, each cell has size of the largest texture */
+bool gridLayout(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding, std::vector<Rectanglei>& atlas) {
     /* Size of largest texture */
     Vector2i maxSize;
     for(const Vector2i& size: sizes)
         maxSize = Math::max(maxSize, size);
 
-    std::vector<Rectanglei> atlas;
-
     /* Columns and rows */
     const Vector2i paddedSize = maxSize+2*padding;
     const Vector2i gridSize = atlasSize/paddedSize;
@@ -46,16 +229,88 @@ std::vector<Rectanglei> atlas(const Vector2i& atlasSize, const std::vector<Vecto
         Error() << "TextureTools::atlas(): requested atlas size" << atlasSize
                 << "is too small to fit" << sizes.size() << paddedSize
                 << "textures. Generated atlas will be empty.";
-        return atlas;
+        return false;
     }
 
-    /** @todo actual magic implementation, not this joke */
-
     atlas.reserve(sizes.size());
     for(std::size_t i = 0; i != sizes.size(); ++i)
         atlas.push_back(Rectanglei::fromSize(Vector2i(i%gridSize.x(), i/gridSize.x())*paddedSize+padding, sizes[i]));
 
-    return atlas;
+    return true;
+}
+
+template<class Packer> bool packedLayout(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding, const bool allowRotation, std::vector<Rectanglei>& atlas, std::vector<bool>& rotated) {
+    /* Pack the textures from the largest, tallest first. Stable sort to have
+       deterministic output. */
+    std::vector<std::size_t> order(sizes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&sizes, allowRotation](std::size_t a, std::size_t b) {
+        const Vector2i sizeA = allowRotation ? Vector2i(Math::min(sizes[a].x(), sizes[a].y()), Math::max(sizes[a].x(), sizes[a].y())) : sizes[a];
+        const Vector2i sizeB = allowRotation ? Vector2i(Math::min(sizes[b].x(), sizes[b].y()), Math::max(sizes[b].x(), sizes[b].y())) : sizes[b];
+        return sizeA.y() > sizeB.y() || (sizeA.y() == sizeB.y() && sizeA.x() > sizeB.x());
+    });
+
+    Packer packer(atlasSize);
+    atlas.resize(sizes.size());
+    rotated.resize(sizes.size());
+    for(const std::size_t i: order) {
+        const Vector2i paddedSize = sizes[i]+2*padding;
+        Vector2i position;
+        bool rotate = false;
+
+        /* Empty textures don't need any space */
+        if(paddedSize.product() && !packer.insert(paddedSize, allowRotation, position, rotate)) {
+            Error() << "TextureTools::atlas(): requested atlas size" << atlasSize
+                    << "is too small to fit" << sizes.size()
+                    << "textures. Generated atlas will be empty.";
+            atlas.clear();
+            rotated.clear();
+            return false;
+        }
+
+        atlas[i] = Rectanglei::fromSize(position+(rotate ? flipped(padding) : padding), rotate ? flipped(sizes[i]) : sizes[i]);
+        rotated[i] = rotate;
+    }
+
+    return true;
+}
+
+}
+
+AtlasLayout atlas(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding, const AtlasPacking packing, const AtlasFlags flags) {
+    if(sizes.empty()) return AtlasLayout();
+
+    std::vector<Rectanglei> atlas;
+    std::vector<bool> rotated;
+    bool success = false;
+    switch(packing) {
+        case AtlasPacking::Grid:
+            success = gridLayout(atlasSize, sizes, padding, atlas);
+            rotated.resize(atlas.size());
+            break;
+        case AtlasPacking::Skyline:
+            success = packedLayout<SkylinePacker>(atlasSize, sizes, padding, bool(flags & AtlasFlag::AllowRotation), atlas, rotated);
+            break;
+        case AtlasPacking::MaxRects:
+            success = packedLayout<MaxRectsPacker>(atlasSize, sizes, padding, bool(flags & AtlasFlag::AllowRotation), atlas, rotated);
+            break;
+    }
+
+    if(!success) return AtlasLayout();
+
+    /* Texture area and used size, including padding */
+    UnsignedLong area = 0;
+    Vector2i usedSize;
+    for(std::size_t i = 0; i != atlas.size(); ++i) {
+        area += UnsignedLong(atlas[i].size().product());
+        usedSize = Math::max(usedSize, atlas[i].topRight()+(rotated[i] ? flipped(padding) : padding));
+    }
+
+    return AtlasLayout(std::move(atlas), std::move(rotated), Float(double(area)/atlasSize.product()), usedSize);
+}
+
+std::vector<Rectanglei> atlas(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding) {
+    return atlas(atlasSize, sizes, padding, AtlasPacking::Skyline).rectangles();
 }
 
 }}
@@ -25,10 +25,11 @@
 */
 
 /** @file
- * @brief Function Magnum::TextureTools::atlas()
+ * @brief Function Magnum::TextureTools::atlas(), class Magnum::TextureTools::AtlasLayout, enum Magnum::TextureTools::AtlasPacking, Magnum::TextureTools::AtlasFlag, typedef Magnum::TextureTools::AtlasFlags
  */
 
 #include <vector>
+#include <Containers/EnumSet.h>
 
 #include "Math/Vector2.h"
 #include "Magnum.h"
@@ -37,18 +38,156 @@
 
 namespace Magnum { namespace TextureTools {
 
+/**
+@brief Atlas packing algorithm
+
+@see atlas()
+*/
+enum class AtlasPacking: UnsignedByte {
+    /**
+     * Uniform grid with cell size of the largest texture. Very fast, but
+     * wastes most of the space if the texture sizes differ.
+     */
+    Grid,
+
+    /**
+     * Skyline packing. Textures are sorted by height and each is placed
+     * as low as possible on the "skyline" formed by top edges of already
+     * placed textures. Fast and with good occupancy for similarly sized
+     * textures, such as glyphs.
+     */
+    Skyline,
+
+    /**
+     * MaxRects packing. Keeps list of maximal free rectangles and places
+     * each texture as low as possible into one of them. Unlike
+     * @ref AtlasPacking "AtlasPacking::Skyline" it can fill holes below
+     * already placed textures, thus usually gives better occupancy, but is
+     * slower.
+     */
+    MaxRects
+};
+
+/**
+@brief Atlas packing flag
+
+@see AtlasFlags, atlas()
+*/
+enum class AtlasFlag: UnsignedByte {
+    /**
+     * Allow rotating the textures by 90° to achieve better fit. Rotated
+     * textures have width and height swapped in the resulting rectangle,
+     * see AtlasLayout::isRotated(). Useful mainly for elongated textures,
+     * makes the packing considerably slower. Ignored for
+     * @ref AtlasPacking "AtlasPacking::Grid".
+     */
+    AllowRotation = 1 << 0
+};
+
+/**
+@brief Atlas packing flags
+
+@see atlas()
+*/
+typedef Containers::EnumSet<AtlasFlag, UnsignedByte> AtlasFlags;
+
+CORRADE_ENUMSET_OPERATORS(AtlasFlags)
+
+/**
+@brief Texture atlas layout
+
+Result of atlas(const Vector2i&, const std::vector<Vector2i>&, const Vector2i&, AtlasPacking, AtlasFlags).
+*/
+class MAGNUM_TEXTURETOOLS_EXPORT AtlasLayout {
+    public:
+        /**
+         * @brief Default constructor
+         *
+         * Creates empty layout.
+         */
+        explicit AtlasLayout(): _occupancy(0.0f) {}
+
+        /**
+         * @brief Constructor
+         * @param rectangles    Texture placement in the atlas
+         * @param rotated       Whether given texture is rotated
+         * @param occupancy     Ratio of texture area to atlas area
+         * @param usedSize      Size of area occupied by the textures
+         */
+        explicit AtlasLayout(std::vector<Rectanglei> rectangles, std::vector<bool> rotated, Float occupancy, const Vector2i& usedSize): _rectangles(std::move(rectangles)), _rotated(std::move(rotated)), _occupancy(occupancy), _usedSize(usedSize) {}
+
+        /**
+         * @brief Whether the layout is empty
+         *
+         * The layout is empty if there were no textures or they couldn't
+         * be packed into the atlas.
+         */
+        bool isEmpty() const { return _rectangles.empty(); }
+
+        /**
+         * @brief Texture placement
+         *
+         * In the same order as input sizes, without the padding. Rotated
+         * textures have width and height swapped.
+         */
+        const std::vector<Rectanglei>& rectangles() const { return _rectangles; }
+
+        /** @brief Whether given texture is rotated by 90° */
+        bool isRotated(std::size_t i) const { return _rotated[i]; }
+
+        /**
+         * @brief Atlas occupancy
+         *
+         * Ratio of total area of all textures (without the padding) to the
+         * atlas area, in range @f$ [0, 1] @f$.
+         */
+        Float occupancy() const { return _occupancy; }
+
+        /**
+         * @brief Used size
+         *
+         * Size of the area in the bottom left corner of the atlas occupied by
+         * the textures, including the padding. The atlas can be shrunk to
+         * this size without affecting the layout.
+         */
+        Vector2i usedSize() const { return _usedSize; }
+
+    private:
+        std::vector<Rectanglei> _rectangles;
+        std::vector<bool> _rotated;
+        Float _occupancy;
+        Vector2i _usedSize;
+};
+
 /**
 @brief Pack textures into texture atlas
 @param atlasSize    Size of resulting atlas
 @param sizes        Sizes of all textures in the atlas
 @param padding      Padding around each texture
+@param packing      Packing algorithm
+@param flags        Packing flags
 
 Packs many small textures into one larger. If the textures cannot be packed
-into required size, empty vector is returned.
+into required size, empty layout is returned.
 
 Padding is added twice to each size and the atlas is laid out so the padding
-don't overlap. Returned sizes are the same as original sizes, i.e. without the
-padding.
+don't overlap. Returned rectangles have the same size as original sizes, i.e.
+without the padding (with width and height swapped if the texture is
+rotated). The layout is deterministic, i.e. the same input always results in
+the same layout.
+*/
+AtlasLayout MAGNUM_TEXTURETOOLS_EXPORT atlas(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding, AtlasPacking packing, AtlasFlags flags = AtlasFlags());
+
+/**
+@brief Pack textures into texture atlas
+@param atlasSize    Size of resulting atlas
+@param sizes        Sizes of all textures in the atlas
+@param padding      Padding around each texture
+
+Convenience alternative to atlas(const Vector2i&, const std::vector<Vector2i>&, const Vector2i&, AtlasPacking, AtlasFlags)
+using @ref AtlasPacking "AtlasPacking::Skyline" without rotation, returning
+only the texture placement. If the textures cannot be packed into required
+size, empty vector is returned.
 */
 std::vector<Rectanglei> MAGNUM_TEXTURETOOLS_EXPORT atlas(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding = Vector2i());
 
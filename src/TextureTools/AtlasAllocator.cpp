@@ -0,0 +1,187 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "AtlasAllocator.h"
+
+#include <algorithm>
+#include <limits>
+#include <Utility/Assert.h>
+
+namespace Magnum { namespace TextureTools {
+
+namespace {
+    /* Shelf heights are rounded up to multiples of this to make them more
+       reusable for glyphs of similar heights */
+    constexpr Int ShelfHeightGranularity = 4;
+}
+
+AtlasAllocator::AtlasAllocator(const Vector2i& size, const Vector2i& padding): _size(size), _padding(padding), _usedArea(0), _top(0) {}
+
+bool AtlasAllocator::allocate(const Vector2i& size, Rectanglei& rectangle) {
+    const Vector2i paddedSize = size + 2*_padding;
+    if(paddedSize.x() > _size.x() || paddedSize.y() > _size.y()) return false;
+
+    /* Empty textures (e.g. whitespace glyphs) don't need any space */
+    if(!paddedSize.product()) {
+        rectangle = Rectanglei::fromSize(_padding, size);
+        return true;
+    }
+
+    /* Non-empty shelf with the most similar height (i.e. wasting less than
+       the rounding or fourth of its height) */
+    std::size_t best = std::numeric_limits<std::size_t>::max();
+    for(std::size_t i = 0; i != _shelves.size(); ++i) {
+        const Shelf& shelf = _shelves[i];
+        if(shelf.height < paddedSize.y() || shelf.height - paddedSize.y() >= std::max(ShelfHeightGranularity, shelf.height/4) || shelf.isEmpty(_size.x()))
+            continue;
+        if(best != std::numeric_limits<std::size_t>::max() && _shelves[best].height <= shelf.height)
+            continue;
+
+        for(const std::pair<Int, Int>& span: shelf.free) if(span.second >= paddedSize.x()) {
+            best = i;
+            break;
+        }
+    }
+    if(best != std::numeric_limits<std::size_t>::max())
+        return allocateInShelf(best, paddedSize, rectangle);
+
+    /* Smallest empty shelf which is high enough, split it if needed */
+    for(std::size_t i = 0; i != _shelves.size(); ++i) {
+        const Shelf& shelf = _shelves[i];
+        if(shelf.height < paddedSize.y() || !shelf.isEmpty(_size.x()))
+            continue;
+        if(best != std::numeric_limits<std::size_t>::max() && _shelves[best].height <= shelf.height)
+            continue;
+        best = i;
+    }
+    if(best != std::numeric_limits<std::size_t>::max()) {
+        splitShelf(best, paddedSize.y());
+        return allocateInShelf(best, paddedSize, rectangle);
+    }
+
+    /* New shelf on top */
+    const Int height = std::min((paddedSize.y() + ShelfHeightGranularity - 1)/ShelfHeightGranularity*ShelfHeightGranularity, _size.y() - _top);
+    if(height >= paddedSize.y()) {
+        _shelves.push_back({_top, height, {{0, _size.x()}}});
+        _top += height;
+        return allocateInShelf(_shelves.size()-1, paddedSize, rectangle);
+    }
+
+    /* Any shelf with enough space, regardless of wasted height */
+    for(std::size_t i = 0; i != _shelves.size(); ++i) {
+        if(_shelves[i].height < paddedSize.y()) continue;
+        if(allocateInShelf(i, paddedSize, rectangle)) return true;
+    }
+
+    return false;
+}
+
+bool AtlasAllocator::allocateInShelf(const std::size_t shelf, const Vector2i& paddedSize, Rectanglei& rectangle) {
+    /* Best fit span */
+    std::vector<std::pair<Int, Int>>& free = _shelves[shelf].free;
+    std::size_t best = std::numeric_limits<std::size_t>::max();
+    for(std::size_t i = 0; i != free.size(); ++i) {
+        if(free[i].second < paddedSize.x()) continue;
+        if(best == std::numeric_limits<std::size_t>::max() || free[i].second < free[best].second)
+            best = i;
+    }
+    if(best == std::numeric_limits<std::size_t>::max()) return false;
+
+    rectangle = Rectanglei::fromSize(Vector2i(free[best].first, _shelves[shelf].y) + _padding, paddedSize - 2*_padding);
+    free[best].first += paddedSize.x();
+    free[best].second -= paddedSize.x();
+    if(!free[best].second) free.erase(free.begin()+best);
+
+    _usedArea += UnsignedLong(paddedSize.x())*_shelves[shelf].height;
+    return true;
+}
+
+void AtlasAllocator::free(const Rectanglei& rectangle) {
+    const Vector2i position = rectangle.bottomLeft() - _padding;
+    const Int width = rectangle.width() + 2*_padding.x();
+    if(!width || !(rectangle.height() + 2*_padding.y())) return;
+
+    /* Shelves are sorted by Y */
+    const auto found = std::upper_bound(_shelves.begin(), _shelves.end(), position.y(), [](Int y, const Shelf& shelf) {
+        return y < shelf.y;
+    });
+    CORRADE_INTERNAL_ASSERT(found != _shelves.begin());
+    const std::size_t shelf = found - _shelves.begin() - 1;
+    std::vector<std::pair<Int, Int>>& free = _shelves[shelf].free;
+    _usedArea -= UnsignedLong(width)*_shelves[shelf].height;
+
+    /* Insert the span and merge it with neighbors */
+    auto it = std::lower_bound(free.begin(), free.end(), std::make_pair(position.x(), 0));
+    it = free.insert(it, {position.x(), width});
+    if(it+1 != free.end() && it->first + it->second == (it+1)->first) {
+        it->second += (it+1)->second;
+        free.erase(it+1);
+    }
+    if(it != free.begin() && (it-1)->first + (it-1)->second == it->first) {
+        (it-1)->second += it->second;
+        free.erase(it);
+    }
+
+    if(_shelves[shelf].isEmpty(_size.x())) mergeEmptyShelves(shelf);
+}
+
+void AtlasAllocator::clear() {
+    _shelves.clear();
+    _usedArea = 0;
+    _top = 0;
+}
+
+void AtlasAllocator::splitShelf(const std::size_t shelf, const Int height) {
+    /* Keep the remainder as separate empty shelf if it's large enough */
+    const Int roundedHeight = (height + ShelfHeightGranularity - 1)/ShelfHeightGranularity*ShelfHeightGranularity;
+    if(_shelves[shelf].height - roundedHeight < ShelfHeightGranularity) return;
+
+    Shelf remainder{_shelves[shelf].y + roundedHeight, _shelves[shelf].height - roundedHeight, {{0, _size.x()}}};
+    _shelves[shelf].height = roundedHeight;
+    _shelves.insert(_shelves.begin()+shelf+1, remainder);
+}
+
+void AtlasAllocator::mergeEmptyShelves(std::size_t shelf) {
+    /* Merge with empty shelf above */
+    if(shelf+1 != _shelves.size() && _shelves[shelf+1].isEmpty(_size.x())) {
+        _shelves[shelf].height += _shelves[shelf+1].height;
+        _shelves.erase(_shelves.begin()+shelf+1);
+    }
+
+    /* Merge with empty shelf below */
+    if(shelf != 0 && _shelves[shelf-1].isEmpty(_size.x())) {
+        _shelves[shelf-1].height += _shelves[shelf].height;
+        _shelves.erase(_shelves.begin()+shelf);
+        --shelf;
+    }
+
+    /* Topmost empty shelf gives the space back */
+    if(shelf+1 == _shelves.size()) {
+        _top = _shelves[shelf].y;
+        _shelves.pop_back();
+    }
+}
+
+}}
@@ -0,0 +1,126 @@
+#ifndef Magnum_TextureTools_AtlasAllocator_h
+#define Magnum_TextureTools_AtlasAllocator_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class Magnum::TextureTools::AtlasAllocator
+ */
+
+#include <vector>
+
+#include "Math/Geometry/Rectangle.h"
+#include "Magnum.h"
+
+#include "magnumTextureToolsVisibility.h"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Incremental texture atlas allocator
+
+Unlike atlas(), which lays out all textures at once, this class allocates and
+frees space for textures one by one, which is useful for caches filled on
+demand, such as Text::GlyphCache.
+
+The atlas is divided into horizontal shelves. Each texture is put into shelf
+with the most similar height which has enough free space, new shelves are
+created on top of the existing ones. Freed space is reused for next
+allocations, empty neighboring shelves are merged together and empty shelves
+can be split again for textures of different heights.
+
+Padding is added twice to each size and the atlas is laid out so the padding
+don't overlap, the same as in atlas().
+*/
+class MAGNUM_TEXTURETOOLS_EXPORT AtlasAllocator {
+    public:
+        /**
+         * @brief Constructor
+         * @param size      Atlas size
+         * @param padding   Padding around each texture
+         */
+        explicit AtlasAllocator(const Vector2i& size, const Vector2i& padding = Vector2i());
+
+        /** @brief Atlas size */
+        Vector2i size() const { return _size; }
+
+        /** @brief Padding around each texture */
+        Vector2i padding() const { return _padding; }
+
+        /**
+         * @brief Atlas occupancy
+         *
+         * Ratio of area of all allocated textures (including the padding) to
+         * the atlas area, in range @f$ [0, 1] @f$.
+         */
+        Float occupancy() const { return Float(double(_usedArea)/_size.product()); }
+
+        /**
+         * @brief Allocate space for texture
+         * @param[in]  size         Texture size
+         * @param[out] rectangle    Texture region in the atlas, without the
+         *      padding
+         * @return `False` if there isn't enough free space, `true` otherwise
+         *
+         * @see free()
+         */
+        bool allocate(const Vector2i& size, Rectanglei& rectangle);
+
+        /**
+         * @brief Free space of given texture
+         * @param rectangle     Texture region returned by allocate()
+         *
+         * Passing rectangle which wasn't returned by allocate() or freeing
+         * the same rectangle twice results in undefined behavior.
+         */
+        void free(const Rectanglei& rectangle);
+
+        /** @brief Free space of all textures */
+        void clear();
+
+    private:
+        struct Shelf {
+            Int y, height;
+
+            /* Free horizontal spans, sorted by X and not touching each other */
+            std::vector<std::pair<Int, Int>> free;
+
+            bool isEmpty(Int width) const {
+                return free.size() == 1 && free[0].first == 0 && free[0].second == width;
+            }
+        };
+
+        bool allocateInShelf(std::size_t shelf, const Vector2i& paddedSize, Rectanglei& rectangle);
+        void splitShelf(std::size_t shelf, Int height);
+        void mergeEmptyShelves(std::size_t shelf);
+
+        Vector2i _size, _padding;
+        UnsignedLong _usedArea;
+        Int _top;
+        std::vector<Shelf> _shelves;
+};
+
+}}
+
+#endif
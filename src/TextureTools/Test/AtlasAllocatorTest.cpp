@@ -0,0 +1,215 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <TestSuite/Tester.h>
+
+#include "TextureTools/AtlasAllocator.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+class AtlasAllocatorTest: public TestSuite::Tester {
+    public:
+        explicit AtlasAllocatorTest();
+
+        void allocate();
+        void allocatePadding();
+        void allocateTooLarge();
+        void allocateEmpty();
+        void allocateFull();
+        void free();
+        void freeMergeShelves();
+        void splitShelf();
+        void clear();
+        void stress();
+};
+
+AtlasAllocatorTest::AtlasAllocatorTest() {
+    addTests({&AtlasAllocatorTest::allocate,
+              &AtlasAllocatorTest::allocatePadding,
+              &AtlasAllocatorTest::allocateTooLarge,
+              &AtlasAllocatorTest::allocateEmpty,
+              &AtlasAllocatorTest::allocateFull,
+              &AtlasAllocatorTest::free,
+              &AtlasAllocatorTest::freeMergeShelves,
+              &AtlasAllocatorTest::splitShelf,
+              &AtlasAllocatorTest::clear,
+              &AtlasAllocatorTest::stress});
+}
+
+void AtlasAllocatorTest::allocate() {
+    AtlasAllocator allocator({64, 64});
+    Rectanglei a, b, c;
+    CORRADE_VERIFY(allocator.allocate({20, 10}, a));
+    CORRADE_VERIFY(allocator.allocate({30, 11}, b));
+    CORRADE_VERIFY(allocator.allocate({10, 20}, c));
+
+    /* Similar heights share the same shelf, which is rounded up to 12 */
+    CORRADE_COMPARE(a, Rectanglei::fromSize({0, 0}, {20, 10}));
+    CORRADE_COMPARE(b, Rectanglei::fromSize({20, 0}, {30, 11}));
+    CORRADE_COMPARE(c, Rectanglei::fromSize({0, 12}, {10, 20}));
+    CORRADE_COMPARE(allocator.occupancy(), (50.0f*12.0f + 10.0f*20.0f)/(64.0f*64.0f));
+}
+
+void AtlasAllocatorTest::allocatePadding() {
+    AtlasAllocator allocator({64, 64}, {2, 1});
+    Rectanglei a, b;
+    CORRADE_VERIFY(allocator.allocate({20, 10}, a));
+    CORRADE_VERIFY(allocator.allocate({20, 10}, b));
+
+    CORRADE_COMPARE(a, Rectanglei::fromSize({2, 1}, {20, 10}));
+    CORRADE_COMPARE(b, Rectanglei::fromSize({26, 1}, {20, 10}));
+}
+
+void AtlasAllocatorTest::allocateTooLarge() {
+    AtlasAllocator allocator({64, 64}, {1, 1});
+    Rectanglei a;
+    CORRADE_VERIFY(!allocator.allocate({63, 10}, a));
+    CORRADE_VERIFY(!allocator.allocate({10, 63}, a));
+    CORRADE_VERIFY(allocator.allocate({62, 62}, a));
+}
+
+void AtlasAllocatorTest::allocateEmpty() {
+    AtlasAllocator allocator({64, 64});
+    Rectanglei a, b;
+    CORRADE_VERIFY(allocator.allocate({0, 10}, a));
+    CORRADE_VERIFY(allocator.allocate({10, 0}, b));
+    CORRADE_COMPARE(a.size(), Vector2i(0, 10));
+    CORRADE_COMPARE(b.size(), Vector2i(10, 0));
+    CORRADE_COMPARE(allocator.occupancy(), 0.0f);
+
+    allocator.free(a);
+    allocator.free(b);
+    CORRADE_COMPARE(allocator.occupancy(), 0.0f);
+    CORRADE_VERIFY(allocator.allocate({64, 64}, a));
+}
+
+void AtlasAllocatorTest::allocateFull() {
+    AtlasAllocator allocator({64, 64});
+    Rectanglei a;
+    for(std::size_t i = 0; i != 16; ++i)
+        CORRADE_VERIFY(allocator.allocate({16, 16}, a));
+    CORRADE_COMPARE(allocator.occupancy(), 1.0f);
+
+    CORRADE_VERIFY(!allocator.allocate({1, 1}, a));
+}
+
+void AtlasAllocatorTest::free() {
+    AtlasAllocator allocator({64, 16});
+    Rectanglei a, b, c, d;
+    CORRADE_VERIFY(allocator.allocate({16, 16}, a));
+    CORRADE_VERIFY(allocator.allocate({16, 16}, b));
+    CORRADE_VERIFY(allocator.allocate({32, 16}, c));
+    CORRADE_VERIFY(!allocator.allocate({32, 16}, d));
+
+    /* Two freed neighbors are merged into one span */
+    allocator.free(a);
+    allocator.free(b);
+    CORRADE_VERIFY(allocator.allocate({32, 16}, d));
+    CORRADE_COMPARE(d, Rectanglei::fromSize({0, 0}, {32, 16}));
+}
+
+void AtlasAllocatorTest::freeMergeShelves() {
+    AtlasAllocator allocator({64, 64});
+    Rectanglei a, b, c, d;
+    CORRADE_VERIFY(allocator.allocate({64, 16}, a));
+    CORRADE_VERIFY(allocator.allocate({64, 32}, b));
+    CORRADE_VERIFY(allocator.allocate({64, 16}, c));
+    CORRADE_VERIFY(!allocator.allocate({64, 48}, d));
+
+    /* Empty shelves are merged and the space can be used for taller
+       textures */
+    allocator.free(a);
+    allocator.free(b);
+    CORRADE_VERIFY(allocator.allocate({64, 48}, d));
+    CORRADE_COMPARE(d, Rectanglei::fromSize({0, 0}, {64, 48}));
+
+    /* Freeing everything gives back the whole atlas */
+    allocator.free(c);
+    allocator.free(d);
+    CORRADE_COMPARE(allocator.occupancy(), 0.0f);
+    CORRADE_VERIFY(allocator.allocate({64, 64}, a));
+}
+
+void AtlasAllocatorTest::splitShelf() {
+    AtlasAllocator allocator({64, 64});
+    Rectanglei a, b, c, d;
+    CORRADE_VERIFY(allocator.allocate({64, 32}, a));
+    CORRADE_VERIFY(allocator.allocate({64, 32}, b));
+    allocator.free(a);
+
+    /* Empty shelf is split for lower textures */
+    CORRADE_VERIFY(allocator.allocate({64, 8}, c));
+    CORRADE_VERIFY(allocator.allocate({64, 24}, d));
+    CORRADE_COMPARE(c, Rectanglei::fromSize({0, 0}, {64, 8}));
+    CORRADE_COMPARE(d, Rectanglei::fromSize({0, 8}, {64, 24}));
+}
+
+void AtlasAllocatorTest::clear() {
+    AtlasAllocator allocator({64, 64});
+    Rectanglei a;
+    CORRADE_VERIFY(allocator.allocate({64, 64}, a));
+    allocator.clear();
+    CORRADE_COMPARE(allocator.occupancy(), 0.0f);
+    CORRADE_VERIFY(allocator.allocate({64, 64}, a));
+}
+
+void AtlasAllocatorTest::stress() {
+    AtlasAllocator allocator({256, 256}, {1, 1});
+
+    /* Random allocations and frees, the rectangles must not overlap */
+    std::vector<Rectanglei> allocated;
+    UnsignedInt seed = 1;
+    for(std::size_t i = 0; i != 5000; ++i) {
+        seed = seed*1103515245 + 12345;
+        const UnsignedInt random = seed >> 8;
+
+        if(random%3 == 0 && !allocated.empty()) {
+            const std::size_t index = random%allocated.size();
+            allocator.free(allocated[index]);
+            allocated.erase(allocated.begin()+index);
+            continue;
+        }
+
+        Rectanglei rectangle;
+        if(!allocator.allocate({Int(1 + random%20), Int(1 + (random >> 8)%28)}, rectangle)) continue;
+
+        CORRADE_VERIFY(rectangle.left() >= 1 && rectangle.bottom() >= 1);
+        CORRADE_VERIFY(rectangle.right() <= 255 && rectangle.top() <= 255);
+        for(const Rectanglei& other: allocated)
+            CORRADE_VERIFY(rectangle.left() >= other.right() + 2 || rectangle.right() + 2 <= other.left() ||
+                           rectangle.bottom() >= other.top() + 2 || rectangle.top() + 2 <= other.bottom());
+        allocated.push_back(rectangle);
+    }
+
+    /* Everything freed, the whole atlas is available again */
+    for(const Rectanglei& rectangle: allocated) allocator.free(rectangle);
+    CORRADE_COMPARE(allocator.occupancy(), 0.0f);
+    Rectanglei rectangle;
+    CORRADE_VERIFY(allocator.allocate({254, 254}, rectangle));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::AtlasAllocatorTest)
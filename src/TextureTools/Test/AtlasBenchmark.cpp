@@ -0,0 +1,112 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <sstream>
+#include <TestSuite/Tester.h>
+
+#include "Math/Functions.h"
+#include "Math/Geometry/Rectangle.h"
+#include "TextureTools/Atlas.h"
+#include "Test/Benchmark.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+using Magnum::Test::measure;
+
+class AtlasBenchmark: public TestSuite::Tester {
+    public:
+        explicit AtlasBenchmark();
+
+        void glyphs();
+        void glyphsManySizes();
+};
+
+namespace {
+
+/* Glyph-like sizes for given font sizes: narrow punctuation, regular
+   lowercase letters, taller capitals and letters with ascenders or
+   descenders and occasional wide glyphs */
+std::vector<Vector2i> glyphSizes(const std::vector<Int>& fontSizes, const std::size_t glyphsPerSize) {
+    std::vector<Vector2i> sizes;
+    UnsignedInt seed = 1;
+    for(const Int fontSize: fontSizes) for(std::size_t i = 0; i != glyphsPerSize; ++i) {
+        seed = seed*1103515245 + 12345;
+        const UnsignedInt random = seed >> 8;
+        const Float width = 0.15f + 0.6f*(random%1000)/1000.0f + ((random%23) ? 0.0f : 0.4f);
+        const Float height = (random%3) ? 0.5f + 0.25f*(random%5)/4.0f : 0.75f + 0.25f*(random%7)/6.0f;
+        sizes.push_back({Math::max(1, Int(width*fontSize)), Math::max(1, Int(height*fontSize))});
+    }
+    return sizes;
+}
+
+void pack(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes) {
+    Debug() << sizes.size() << "glyphs into" << atlasSize << "atlas:";
+
+    /* Grid packing usually doesn't fit, silence the error */
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    for(const std::pair<AtlasPacking, const char*>& packing: {std::make_pair(AtlasPacking::Grid, "grid"),
+                                                             std::make_pair(AtlasPacking::Skyline, "skyline"),
+                                                             std::make_pair(AtlasPacking::MaxRects, "MaxRects")})
+        for(const AtlasFlags flags: {AtlasFlags(), AtlasFlags(AtlasFlag::AllowRotation)})
+    {
+        if(packing.first == AtlasPacking::Grid && flags) continue;
+
+        AtlasLayout layout;
+        const double time = measure([&]() {
+            layout = atlas(atlasSize, sizes, Vector2i(1), packing.first, flags);
+        }, packing.first == AtlasPacking::MaxRects ? 1 : 10);
+
+        Debug d;
+        d << " " << packing.second << (flags ? "with rotation:" : ":") << time << "ms,";
+        if(layout.isEmpty()) d << "doesn't fit";
+        else d << "occupancy" << layout.occupancy() << "used size" << layout.usedSize()
+               << "used occupancy" << layout.occupancy()*atlasSize.product()/layout.usedSize().product();
+    }
+}
+
+}
+
+AtlasBenchmark::AtlasBenchmark() {
+    addTests({&AtlasBenchmark::glyphs,
+              &AtlasBenchmark::glyphsManySizes});
+}
+
+void AtlasBenchmark::glyphs() {
+    /* Latin-ish font in one size, the grid fits only into the larger one */
+    pack({512, 256}, glyphSizes({32}, 256));
+    pack({1024, 512}, glyphSizes({32}, 256));
+}
+
+void AtlasBenchmark::glyphsManySizes() {
+    /* 10k glyphs of CJK-ish font in various sizes */
+    pack({2048, 2048}, glyphSizes({12, 16, 24, 32, 48}, 2000));
+    pack({4096, 4096}, glyphSizes({12, 16, 24, 32, 48}, 2000));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::AtlasBenchmark)
@@ -38,13 +38,27 @@ class AtlasTest: public TestSuite::Tester {
         void createPadding();
         void createEmpty();
         void createTooSmall();
+
+        void grid();
+        void gridTooSmall();
+        void maxRects();
+        void rotation();
+        void occupancy();
+        void noOverlap();
 };
 
 AtlasTest::AtlasTest() {
     addTests({&AtlasTest::create,
               &AtlasTest::createPadding,
               &AtlasTest::createEmpty,
-              &AtlasTest::createTooSmall});
+              &AtlasTest::createTooSmall,
+
+              &AtlasTest::grid,
+              &AtlasTest::gridTooSmall,
+              &AtlasTest::maxRects,
+              &AtlasTest::rotation,
+              &AtlasTest::occupancy,
+              &AtlasTest::noOverlap});
 }
 
 void AtlasTest::create() {
@@ -54,11 +68,12 @@ void AtlasTest::create() {
         {23, 25}
     });
 
+    /* Packed from the tallest */
     CORRADE_COMPARE(atlas.size(), 3);
     CORRADE_COMPARE(atlas, (std::vector<Rectanglei>{
-        Rectanglei::fromSize({0, 0}, {12, 18}),
-        Rectanglei::fromSize({32, 0}, {32, 15}),
-        Rectanglei::fromSize({0, 25}, {23, 25})}));
+        Rectanglei::fromSize({23, 0}, {12, 18}),
+        Rectanglei::fromSize({23, 18}, {32, 15}),
+        Rectanglei::fromSize({0, 0}, {23, 25})}));
 }
 
 void AtlasTest::createPadding() {
@@ -70,9 +85,9 @@ void AtlasTest::createPadding() {
 
     CORRADE_COMPARE(atlas.size(), 3);
     CORRADE_COMPARE(atlas, (std::vector<Rectanglei>{
-        Rectanglei::fromSize({2, 1}, {8, 16}),
-        Rectanglei::fromSize({34, 1}, {28, 13}),
-        Rectanglei::fromSize({2, 26}, {19, 23})}));
+        Rectanglei::fromSize({25, 1}, {8, 16}),
+        Rectanglei::fromSize({25, 19}, {28, 13}),
+        Rectanglei::fromSize({2, 1}, {19, 23})}));
 }
 
 void AtlasTest::createEmpty() {
@@ -84,15 +99,132 @@ void AtlasTest::createTooSmall() {
     std::ostringstream o;
     Error::setOutput(&o);
 
+    /* The last one is too high with the padding */
     std::vector<Rectanglei> atlas = TextureTools::atlas({64, 32}, {
         {8, 16},
         {21, 13},
-        {19, 29}
+        {19, 31}
     }, {2, 1});
     CORRADE_VERIFY(atlas.empty());
+    CORRADE_COMPARE(o.str(), "TextureTools::atlas(): requested atlas size Vector(64, 32) is too small to fit 3 textures. Generated atlas will be empty.\n");
+}
+
+void AtlasTest::grid() {
+    TextureTools::AtlasLayout atlas = TextureTools::atlas({64, 64}, {
+        {8, 16},
+        {28, 13},
+        {19, 23}
+    }, {2, 1}, AtlasPacking::Grid);
+
+    CORRADE_COMPARE(atlas.rectangles(), (std::vector<Rectanglei>{
+        Rectanglei::fromSize({2, 1}, {8, 16}),
+        Rectanglei::fromSize({34, 1}, {28, 13}),
+        Rectanglei::fromSize({2, 26}, {19, 23})}));
+    CORRADE_VERIFY(!atlas.isRotated(0));
+    CORRADE_COMPARE(atlas.usedSize(), Vector2i(64, 50));
+}
+
+void AtlasTest::gridTooSmall() {
+    std::ostringstream o;
+    Error::setOutput(&o);
+
+    TextureTools::AtlasLayout atlas = TextureTools::atlas({64, 32}, {
+        {8, 16},
+        {21, 13},
+        {19, 29}
+    }, {2, 1}, AtlasPacking::Grid);
+    CORRADE_VERIFY(atlas.isEmpty());
     CORRADE_COMPARE(o.str(), "TextureTools::atlas(): requested atlas size Vector(64, 32) is too small to fit 3 Vector(25, 31) textures. Generated atlas will be empty.\n");
 }
 
+void AtlasTest::maxRects() {
+    const std::vector<Vector2i> sizes{
+        {20, 30},
+        {20, 10},
+        {40, 10},
+        {20, 18}
+    };
+
+    /* Skyline can't use the space below the third texture */
+    TextureTools::AtlasLayout skyline = TextureTools::atlas({64, 64}, sizes, {}, AtlasPacking::Skyline);
+    CORRADE_COMPARE(skyline.rectangles(), (std::vector<Rectanglei>{
+        Rectanglei::fromSize({0, 0}, {20, 30}),
+        Rectanglei::fromSize({20, 28}, {20, 10}),
+        Rectanglei::fromSize({20, 18}, {40, 10}),
+        Rectanglei::fromSize({20, 0}, {20, 18})}));
+    CORRADE_COMPARE(skyline.usedSize(), Vector2i(60, 38));
+
+    /* MaxRects puts the second texture there */
+    TextureTools::AtlasLayout maxRects = TextureTools::atlas({64, 64}, sizes, {}, AtlasPacking::MaxRects);
+    CORRADE_COMPARE(maxRects.rectangles(), (std::vector<Rectanglei>{
+        Rectanglei::fromSize({0, 0}, {20, 30}),
+        Rectanglei::fromSize({40, 0}, {20, 10}),
+        Rectanglei::fromSize({20, 18}, {40, 10}),
+        Rectanglei::fromSize({20, 0}, {20, 18})}));
+    CORRADE_COMPARE(maxRects.usedSize(), Vector2i(60, 30));
+}
+
+void AtlasTest::rotation() {
+    /* The first texture fits only if rotated */
+    for(const AtlasPacking packing: {AtlasPacking::Skyline, AtlasPacking::MaxRects}) {
+        TextureTools::AtlasLayout atlas = TextureTools::atlas({64, 32}, {
+            {10, 60},
+            {30, 10}
+        }, {1, 2}, packing, AtlasFlag::AllowRotation);
+
+        CORRADE_COMPARE(atlas.rectangles(), (std::vector<Rectanglei>{
+            Rectanglei::fromSize({2, 1}, {60, 10}),
+            Rectanglei::fromSize({1, 14}, {30, 10})}));
+        CORRADE_VERIFY(atlas.isRotated(0));
+        CORRADE_VERIFY(!atlas.isRotated(1));
+    }
+
+    /* Without rotation it doesn't fit */
+    std::ostringstream o;
+    Error::setOutput(&o);
+    CORRADE_VERIFY(TextureTools::atlas({64, 32}, {{10, 60}, {30, 10}}, {1, 2}, AtlasPacking::MaxRects).isEmpty());
+}
+
+void AtlasTest::occupancy() {
+    TextureTools::AtlasLayout atlas = TextureTools::atlas({64, 32}, {
+        {10, 60},
+        {30, 10}
+    }, {1, 2}, AtlasPacking::Skyline, AtlasFlag::AllowRotation);
+
+    /* Padding is not counted in occupancy, but is in used size */
+    CORRADE_COMPARE(atlas.occupancy(), (600.0f + 300.0f)/(64.0f*32.0f));
+    CORRADE_COMPARE(atlas.usedSize(), Vector2i(64, 26));
+}
+
+void AtlasTest::noOverlap() {
+    /* Pseudo-random glyph-like sizes, including empty ones */
+    std::vector<Vector2i> sizes;
+    UnsignedInt seed = 1;
+    for(std::size_t i = 0; i != 500; ++i) {
+        seed = seed*1103515245 + 12345;
+        sizes.push_back({Int((seed >> 8)%24), Int((seed >> 16)%32)});
+    }
+
+    for(const AtlasPacking packing: {AtlasPacking::Skyline, AtlasPacking::MaxRects}) for(const AtlasFlags flags: {AtlasFlags(), AtlasFlags(AtlasFlag::AllowRotation)}) {
+        TextureTools::AtlasLayout atlas = TextureTools::atlas({512, 512}, sizes, {1, 1}, packing, flags);
+        CORRADE_COMPARE(atlas.rectangles().size(), sizes.size());
+
+        /* Padded rectangles are inside the atlas and don't overlap */
+        std::vector<Rectanglei> padded;
+        for(const Rectanglei& rectangle: atlas.rectangles()) {
+            if(!rectangle.size().product()) continue;
+            padded.push_back({rectangle.bottomLeft()-Vector2i(1), rectangle.topRight()+Vector2i(1)});
+        }
+        for(std::size_t i = 0; i != padded.size(); ++i) {
+            CORRADE_VERIFY(padded[i].left() >= 0 && padded[i].bottom() >= 0);
+            CORRADE_VERIFY(padded[i].right() <= 512 && padded[i].top() <= 512);
+            for(std::size_t j = 0; j != i; ++j)
+                CORRADE_VERIFY(padded[i].left() >= padded[j].right() || padded[i].right() <= padded[j].left() ||
+                               padded[i].bottom() >= padded[j].top() || padded[i].top() <= padded[j].bottom());
+        }
+    }
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::TextureTools::Test::AtlasTest)